@@ -194,6 +194,8 @@ void print_statistics_tree(bx_param_c *node, int level = 0);
 // #define BX_OUTP(addr, val, len)  bx_pc_system.outp(addr, val, len)
 #define BX_INP(addr, len)           bx_devices.inp(addr, len)
 #define BX_OUTP(addr, val, len)     bx_devices.outp(addr, val, len)
+#define BX_INP_BLOCK(addr, len, ptr, count)  bx_devices.inp_block(addr, len, ptr, count)
+#define BX_OUTP_BLOCK(addr, len, ptr, count) bx_devices.outp_block(addr, len, ptr, count)
 
 #ifdef BOCHSERVISOR
 #define BX_TICK1()
@@ -252,6 +254,8 @@ void print_statistics_tree(bx_param_c *node, int level = 0);
         if (bx_guard.report.io) bx_dbg_io_report(port, size, op, val)
 #  define BX_DBG_LIN_MEMORY_ACCESS(cpu, lin, phy, len, memtype, rw, data) \
         bx_dbg_lin_memory_access(cpu, lin, phy, len, memtype, rw, data)
+#  define BX_DBG_LIN_MEMORY_TRACE(cpu, lin, phy, len, memtype, rw, data) \
+        if (BX_CPU(cpu)->trace_mem) bx_dbg_lin_memory_trace(cpu, lin, phy, len, memtype, rw, data)
 #  define BX_DBG_PHY_MEMORY_ACCESS(cpu, phy, len, memtype, rw, why, data) \
         bx_dbg_phy_memory_access(cpu, phy, len, memtype, rw, why, data)
 #else  // #if BX_DEBUGGER
@@ -263,6 +267,7 @@ void print_statistics_tree(bx_param_c *node, int level = 0);
 #  define BX_DBG_A20_REPORT(val)                                                /* empty */
 #  define BX_DBG_IO_REPORT(port, size, op, val)                                 /* empty */
 #  define BX_DBG_LIN_MEMORY_ACCESS(cpu, lin, phy, len, memtype, rw, data)       /* empty */
+#  define BX_DBG_LIN_MEMORY_TRACE(cpu, lin, phy, len, memtype, rw, data)        /* empty */
 #  define BX_DBG_PHY_MEMORY_ACCESS(cpu,      phy, len, memtype, rw, attr, data) /* empty */
 #endif  // #if BX_DEBUGGER
 
@@ -321,8 +326,14 @@ class BOCHSAPI iofunctions {
   char logprefix[BX_LOGPREFIX_LEN + 1];
   FILE *logfd;
   class logfunctions *log;
+  struct bx_log_ring_t *ring;
+  volatile bx_bool async;
   void init(void);
   void flush(void);
+  void make_prefix(char *msgpfx, int level, const char *prefix, Bit64u ticks, Bit32u eip);
+  void write_msg(int level, const char *msgpfx, const char *msg);
+  bx_bool push_msg(int level, const char *prefix, const char *fmt, va_list ap);
+  unsigned drain_locked(void);
 
 // Log Class types
 public:
@@ -339,6 +350,9 @@ public:
   void init_log(FILE *fs);
   void exit_log();
   void set_log_prefix(const char *prefix);
+  void set_async(bx_bool enable);
+  bx_bool get_async() const { return async; }
+  unsigned drain_async(void);
   int get_n_logfns() const { return n_logfn; }
   logfunc_t *get_logfn(int index) { return logfn_list[index]; }
   void add_logfn(logfunc_t *fn);
@@ -375,7 +389,13 @@ typedef class iofunctions iofunc_t;
 #else
 
 #define BX_INFO(x)  (LOG_THIS info) x
-#define BX_DEBUG(x) (LOG_THIS ldebug) x
+#if BX_DEBUG_LOGGING
+// check the action first, so that the arguments of an ignored message
+// are not evaluated
+#define BX_DEBUG(x) do { if ((LOG_THIS getonoff(LOGLEV_DEBUG)) != ACT_IGNORE) (LOG_THIS ldebug) x; } while (0)
+#else
+#define BX_DEBUG(x)
+#endif
 #define BX_ERROR(x) (LOG_THIS error) x
 #define BX_PANIC(x) (LOG_THIS panic) x
 #define BX_FATAL(x) (LOG_THIS fatal1) x
@@ -417,7 +437,8 @@ BOCHSAPI extern logfunc_t *genlog;
 // defines for GDB stub
 void bx_gdbstub_init(void);
 void bx_gdbstub_break(void);
-int bx_gdbstub_check(unsigned int eip);
+int bx_gdbstub_check(bx_address eip);
+int bx_gdbstub_poll(void);
 #define GDBSTUB_STOP_NO_REASON   (0xac0)
 
 #if BX_SUPPORT_SMP
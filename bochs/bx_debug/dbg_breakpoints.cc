@@ -25,46 +25,148 @@
 
 static unsigned next_bpoint_id = 1;
 
+void bx_dbg_addr_index_c::clear(void)
+{
+  memset(page_bitmap, 0, sizeof(page_bitmap));
+  nitems = 0;
+  for (unsigned n=0; n < nbuckets; n++)
+    buckets[n] = -1;
+}
+
+void bx_dbg_addr_index_c::rehash(unsigned size)
+{
+  free(buckets);
+  buckets = (int*) malloc(size * sizeof(int));
+  nbuckets = size;
+
+  unsigned n;
+  for (n=0; n < nbuckets; n++)
+    buckets[n] = -1;
+  for (n=0; n < nitems; n++)
+    link_item(n);
+}
+
+// the chains keep the items in insertion order, so breakpoints at the same
+// address are checked in table order
+void bx_dbg_addr_index_c::link_item(unsigned n)
+{
+  int *link = &buckets[key_hash(items[n].key)];
+  while (*link >= 0)
+    link = &items[*link].next;
+  items[n].next = -1;
+  *link = n;
+}
+
+void bx_dbg_addr_index_c::add_item(Bit64u key, unsigned entry)
+{
+  items = (item_t*) bx_dbg_grow_table(items, nitems, &max_items, sizeof(item_t));
+  if (nitems * 2 >= nbuckets)
+    rehash(nbuckets ? (nbuckets * 2) : 64);
+
+  items[nitems].key = key;
+  items[nitems].entry = entry;
+  link_item(nitems++);
+}
+
+void bx_dbg_addr_index_c::insert(Bit64u key, Bit64u page, unsigned entry)
+{
+  unsigned bit = page_hash(page);
+  page_bitmap[bit >> 5] |= (1u << (bit & 31));
+  add_item(key, entry);
+}
+
+void bx_dbg_addr_index_c::insert_wide(unsigned entry)
+{
+  memset(page_bitmap, 0xff, sizeof(page_bitmap));
+  add_item(BX_DBG_INDEX_WIDE_KEY, entry);
+}
+
+int bx_dbg_addr_index_c::find(Bit64u key) const
+{
+  if (nitems == 0) return -1;
+
+  for (int n = buckets[key_hash(key)]; n >= 0; n = items[n].next) {
+    if (items[n].key == key) return n;
+  }
+  return -1;
+}
+
+int bx_dbg_addr_index_c::find_next(int item, Bit64u key) const
+{
+  for (int n = items[item].next; n >= 0; n = items[n].next) {
+    if (items[n].key == key) return n;
+  }
+  return -1;
+}
+
+void* bx_dbg_grow_table(void *table, unsigned num, unsigned *max, size_t entry_size)
+{
+  if (num < *max) return table;
+
+  *max = *max ? (*max * 2) : 16;
+  table = realloc(table, *max * entry_size);
+  if (table == NULL) {
+    dbg_printf("Error: out of memory for the debugger tables.\n");
+    bx_dbg_exit(1);
+  }
+  return table;
+}
+
+static void bx_dbg_rebuild_vbreak_index(void)
+{
+  bx_guard.iaddr.vir_index.clear();
+  for (unsigned i=0; i<bx_guard.iaddr.num_virtual; i++) {
+    bx_address eip = bx_guard.iaddr.vir[i].eip;
+    bx_guard.iaddr.vir_index.insert(eip, BX_DBG_INDEX_PAGE(eip), i);
+  }
+}
+
+static void bx_dbg_rebuild_lbreak_index(void)
+{
+  bx_guard.iaddr.lin_index.clear();
+  for (unsigned i=0; i<bx_guard.iaddr.num_linear; i++) {
+    bx_address addr = bx_guard.iaddr.lin[i].addr;
+    bx_guard.iaddr.lin_index.insert(addr, BX_DBG_INDEX_PAGE(addr), i);
+  }
+}
+
+static void bx_dbg_rebuild_pbreak_index(void)
+{
+  bx_guard.iaddr.phy_index.clear();
+  for (unsigned i=0; i<bx_guard.iaddr.num_physical; i++) {
+    bx_phy_address addr = bx_guard.iaddr.phy[i].addr;
+    bx_guard.iaddr.phy_index.insert(addr, BX_DBG_INDEX_PAGE(addr), i);
+  }
+}
+
 void bx_dbg_breakpoint_changed(void)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   if (bx_guard.iaddr.num_virtual)
     bx_guard.guard_for |= BX_DBG_GUARD_IADDR_VIR;
   else
     bx_guard.guard_for &= ~BX_DBG_GUARD_IADDR_VIR;
-#endif
 
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   if (bx_guard.iaddr.num_linear)
     bx_guard.guard_for |= BX_DBG_GUARD_IADDR_LIN;
   else
     bx_guard.guard_for &= ~BX_DBG_GUARD_IADDR_LIN;
-#endif
 
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   if (bx_guard.iaddr.num_physical)
     bx_guard.guard_for |= BX_DBG_GUARD_IADDR_PHY;
   else
     bx_guard.guard_for &= ~BX_DBG_GUARD_IADDR_PHY;
-#endif
 }
 
 void bx_dbg_en_dis_breakpoint_command(unsigned handle, bx_bool enable)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   if (bx_dbg_en_dis_vbreak(handle, enable))
     goto done;
-#endif
 
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   if (bx_dbg_en_dis_lbreak(handle, enable))
     goto done;
-#endif
 
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   if (bx_dbg_en_dis_pbreak(handle, enable))
     goto done;
-#endif
 
   dbg_printf("Error: breakpoint %u not found.\n", handle);
   return;
@@ -75,7 +177,6 @@ done:
 
 bx_bool bx_dbg_en_dis_pbreak(unsigned handle, bx_bool enable)
 {
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   // see if breakpoint is a physical breakpoint
   for (unsigned i=0; i<bx_guard.iaddr.num_physical; i++) {
     if (bx_guard.iaddr.phy[i].bpoint_id == handle) {
@@ -83,13 +184,11 @@ bx_bool bx_dbg_en_dis_pbreak(unsigned handle, bx_bool enable)
       return 1;
     }
   }
-#endif
   return 0;
 }
 
 bx_bool bx_dbg_en_dis_lbreak(unsigned handle, bx_bool enable)
 {
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   // see if breakpoint is a linear breakpoint
   for (unsigned i=0; i<bx_guard.iaddr.num_linear; i++) {
     if (bx_guard.iaddr.lin[i].bpoint_id == handle) {
@@ -97,13 +196,11 @@ bx_bool bx_dbg_en_dis_lbreak(unsigned handle, bx_bool enable)
       return 1;
     }
   }
-#endif
   return 0;
 }
 
 bx_bool bx_dbg_en_dis_vbreak(unsigned handle, bx_bool enable)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   // see if breakpoint is a virtual breakpoint
   for (unsigned i=0; i<bx_guard.iaddr.num_virtual; i++) {
     if (bx_guard.iaddr.vir[i].bpoint_id == handle) {
@@ -111,26 +208,19 @@ bx_bool bx_dbg_en_dis_vbreak(unsigned handle, bx_bool enable)
       return 1;
     }
   }
-#endif
   return 0;
 }
 
 void bx_dbg_del_breakpoint_command(unsigned handle)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   if (bx_dbg_del_vbreak(handle))
    goto done;
-#endif
 
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   if (bx_dbg_del_lbreak(handle))
    goto done;
-#endif
 
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   if (bx_dbg_del_pbreak(handle))
    goto done;
-#endif
 
   dbg_printf("Error: breakpoint %u not found.\n", handle);
   return;
@@ -141,7 +231,6 @@ done:
 
 bx_bool bx_dbg_del_pbreak(unsigned handle)
 {
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   // see if breakpoint is a physical breakpoint
   for (int i=0; i<(int)bx_guard.iaddr.num_physical; i++) {
     if (bx_guard.iaddr.phy[i].bpoint_id == handle) {
@@ -151,16 +240,15 @@ bx_bool bx_dbg_del_pbreak(unsigned handle)
         bx_guard.iaddr.phy[j] = bx_guard.iaddr.phy[j+1];
       }
       bx_guard.iaddr.num_physical--;
+      bx_dbg_rebuild_pbreak_index();
       return 1;
     }
   }
-#endif
   return 0;
 }
 
 bx_bool bx_dbg_del_lbreak(unsigned handle)
 {
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   // see if breakpoint is a linear breakpoint
   for (int i=0; i<(int)bx_guard.iaddr.num_linear; i++) {
     if (bx_guard.iaddr.lin[i].bpoint_id == handle) {
@@ -170,16 +258,15 @@ bx_bool bx_dbg_del_lbreak(unsigned handle)
         bx_guard.iaddr.lin[j] = bx_guard.iaddr.lin[j+1];
       }
       bx_guard.iaddr.num_linear--;
+      bx_dbg_rebuild_lbreak_index();
       return 1;
     }
   }
-#endif
   return 0;
 }
 
 bx_bool bx_dbg_del_vbreak(unsigned handle)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   // see if breakpoint is a virtual breakpoint
   for (int i=0; i<(int)bx_guard.iaddr.num_virtual; i++) {
     if (bx_guard.iaddr.vir[i].bpoint_id == handle) {
@@ -189,10 +276,10 @@ bx_bool bx_dbg_del_vbreak(unsigned handle)
         bx_guard.iaddr.vir[j] = bx_guard.iaddr.vir[j+1];
       }
       bx_guard.iaddr.num_virtual--;
+      bx_dbg_rebuild_vbreak_index();
       return 1;
     }
   }
-#endif
   return 0;
 }
 
@@ -210,93 +297,70 @@ static char* prepare_condition(const char *str)
 
 int bx_dbg_vbreakpoint_command(BreakpointKind bk, Bit32u cs, bx_address eip, const char *condition)
 {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   if (bk != bkRegular) {
     dbg_printf("Error: vbreak of this kind not implemented yet.\n");
     return -1;
   }
 
-  if (bx_guard.iaddr.num_virtual >= BX_DBG_MAX_VIR_BPOINTS) {
-    dbg_printf("Error: no more virtual breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_VIR_BPOINTS.\n");
-    return -1;
-  }
+  bx_guard.iaddr.vir = (struct bx_guard_t::ibreak::vbreak *) bx_dbg_grow_table(bx_guard.iaddr.vir,
+      bx_guard.iaddr.num_virtual, &bx_guard.iaddr.max_virtual, sizeof(struct bx_guard_t::ibreak::vbreak));
 
-  struct bx_guard_t::ibreak::vbreak *bp = &bx_guard.iaddr.vir[bx_guard.iaddr.num_virtual];
+  unsigned n = bx_guard.iaddr.num_virtual;
+  struct bx_guard_t::ibreak::vbreak *bp = &bx_guard.iaddr.vir[n];
   bp->cs  = cs;
   bp->eip = eip;
   bp->bpoint_id = next_bpoint_id++;
   bp->condition = prepare_condition(condition);
   bp->enabled=1;
   bx_guard.iaddr.num_virtual++;
+  bx_guard.iaddr.vir_index.insert(eip, BX_DBG_INDEX_PAGE(eip), n);
   bx_guard.guard_for |= BX_DBG_GUARD_IADDR_VIR;
   return bp->bpoint_id;
-
-#else
-  dbg_printf("Error: virtual breakpoint support not compiled in.\n");
-  dbg_printf("Error: make sure BX_DBG_MAX_VIR_BPOINTS > 0\n");
-  return -1;
-#endif
 }
 
 int bx_dbg_lbreakpoint_command(BreakpointKind bk, bx_address laddress, const char *condition)
 {
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   if (bk == bkAtIP) {
     dbg_printf("Error: lbreak of this kind not implemented yet.\n");
     return -1;
   }
 
-  if (bx_guard.iaddr.num_linear >= BX_DBG_MAX_LIN_BPOINTS) {
-    dbg_printf("Error: no more linear breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_LIN_BPOINTS.\n");
-    return -1;
-  }
+  bx_guard.iaddr.lin = (struct bx_guard_t::ibreak::lbreak *) bx_dbg_grow_table(bx_guard.iaddr.lin,
+      bx_guard.iaddr.num_linear, &bx_guard.iaddr.max_linear, sizeof(struct bx_guard_t::ibreak::lbreak));
 
-  struct bx_guard_t::ibreak::lbreak *bp = &bx_guard.iaddr.lin[bx_guard.iaddr.num_linear];
+  unsigned n = bx_guard.iaddr.num_linear;
+  struct bx_guard_t::ibreak::lbreak *bp = &bx_guard.iaddr.lin[n];
   bp->addr = laddress;
   int BpId = (bk == bkStepOver) ? 0 : next_bpoint_id++;
   bp->bpoint_id = BpId;
   bp->condition = prepare_condition(condition);
   bp->enabled=1;
   bx_guard.iaddr.num_linear++;
+  bx_guard.iaddr.lin_index.insert(laddress, BX_DBG_INDEX_PAGE(laddress), n);
   bx_guard.guard_for |= BX_DBG_GUARD_IADDR_LIN;
   return BpId;
-
-#else
-  dbg_printf("Error: linear breakpoint support not compiled in.\n");
-  dbg_printf("Error: make sure BX_DBG_MAX_LIN_BPOINTS > 0\n");
-  return -1;
-#endif
 }
 
 int bx_dbg_pbreakpoint_command(BreakpointKind bk, bx_phy_address paddress, const char *condition)
 {
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   if (bk != bkRegular) {
     dbg_printf("Error: pbreak of this kind not implemented yet.\n");
     return -1;
   }
 
-  if (bx_guard.iaddr.num_physical >= BX_DBG_MAX_PHY_BPOINTS) {
-    dbg_printf("Error: no more physical breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_PHY_BPOINTS.\n");
-    return -1;
-  }
+  bx_guard.iaddr.phy = (struct bx_guard_t::ibreak::pbreak *) bx_dbg_grow_table(bx_guard.iaddr.phy,
+      bx_guard.iaddr.num_physical, &bx_guard.iaddr.max_physical, sizeof(struct bx_guard_t::ibreak::pbreak));
 
-  struct bx_guard_t::ibreak::pbreak *bp = &bx_guard.iaddr.phy[bx_guard.iaddr.num_physical];
+  unsigned n = bx_guard.iaddr.num_physical;
+  struct bx_guard_t::ibreak::pbreak *bp = &bx_guard.iaddr.phy[n];
   bp->addr = paddress;
   bp->bpoint_id = next_bpoint_id++;
   bp->condition = prepare_condition(condition);
   bp->enabled=1;
   bx_guard.iaddr.num_physical++;
+  bx_guard.iaddr.phy_index.insert(paddress, BX_DBG_INDEX_PAGE(paddress), n);
   bx_guard.guard_for |= BX_DBG_GUARD_IADDR_PHY;
   return bp->bpoint_id;
-#else
-  dbg_printf("Error: physical breakpoint support not compiled in.\n");
-  dbg_printf("Error: make sure BX_DBG_MAX_PHY_BPOINTS > 0\n");
-  return -1;
-#endif
 }
 
 void bx_dbg_info_bpoints_command(void)
@@ -306,7 +370,6 @@ void bx_dbg_info_bpoints_command(void)
 // 1   breakpoint     keep y   0x00010664 condition
 
   dbg_printf("Num Type           Disp Enb Address\n");
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
   for (i=0; i<bx_guard.iaddr.num_virtual; i++) {
     struct bx_guard_t::ibreak::vbreak *bp = &bx_guard.iaddr.vir[i];
     dbg_printf("%3u ", bp->bpoint_id);
@@ -316,9 +379,7 @@ void bx_dbg_info_bpoints_command(void)
     dbg_printf("0x%04x:" FMT_ADDRX " %s", bp->cs, bp->eip,
                   (bp->condition != NULL) ? bp->condition : "\n");
   }
-#endif
 
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
   for (i=0; i<bx_guard.iaddr.num_linear; i++) {
     struct bx_guard_t::ibreak::lbreak *bp = &bx_guard.iaddr.lin[i];
     dbg_printf("%3u ", bp->bpoint_id);
@@ -328,9 +389,7 @@ void bx_dbg_info_bpoints_command(void)
     dbg_printf("0x" FMT_ADDRX " %s", bp->addr,
                   (bp->condition != NULL) ? bp->condition : "\n");
   }
-#endif
 
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
   for (i=0; i<bx_guard.iaddr.num_physical; i++) {
     struct bx_guard_t::ibreak::pbreak *bp = &bx_guard.iaddr.phy[i];
     dbg_printf("%3u ", bp->bpoint_id);
@@ -340,7 +399,6 @@ void bx_dbg_info_bpoints_command(void)
     dbg_printf("0x" FMT_PHY_ADDRX " %s", bp->addr,
                   (bp->condition != NULL) ? bp->condition : "\n");
   }
-#endif
 }
 
 #endif /* if BX_DEBUGGER */
@@ -27,6 +27,7 @@ extern "C" {
 #include "param_names.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#include "revexec.h"
 
 #if BX_DEBUGGER
 
@@ -100,6 +101,7 @@ static void bx_get_command(void);
 static void bx_dbg_print_guard_results();
 extern void bx_dbg_breakpoint_changed(void);
 static void bx_dbg_set_icount_guard(int which_cpu, Bit32u n);
+static void bx_dbg_set_guard_position(int which_cpu);
 
 bx_guard_t bx_guard;
 
@@ -127,8 +129,13 @@ static char  bx_disasm_tbuf[512];
 static bx_bool watchpoint_continue = 0;
 unsigned num_write_watchpoints = 0;
 unsigned num_read_watchpoints = 0;
-bx_watchpoint write_watchpoint[BX_DBG_MAX_WATCHPONTS];
-bx_watchpoint read_watchpoint[BX_DBG_MAX_WATCHPONTS];
+bx_watchpoint *write_watchpoint = NULL;
+bx_watchpoint *read_watchpoint = NULL;
+static unsigned max_write_watchpoints = 0, max_read_watchpoints = 0;
+// watchpoints are indexed by page, ranges covering more than
+// BX_DBG_WATCH_INDEX_PAGES pages are checked on every page
+#define BX_DBG_WATCH_INDEX_PAGES 64
+static bx_dbg_addr_index_c write_watch_index, read_watch_index;
 
 #define DBG_PRINTF_BUFFER_LEN 1024
 
@@ -266,18 +273,8 @@ int bx_dbg_main(void)
   // Print disassembly of the first instruction...  you wouldn't think it
   // would have to be so hard.  First initialize guard_found, since it is used
   // in the disassembly code to decide what instruction to print.
-  for (int i=0; i<BX_SMP_PROCESSORS; i++) {
-    BX_CPU(i)->guard_found.cs = BX_CPU(i)->sregs[BX_SEG_REG_CS].selector.value;
-    BX_CPU(i)->guard_found.eip = BX_CPU(i)->get_instruction_pointer();
-    BX_CPU(i)->guard_found.laddr =
-      BX_CPU(i)->get_laddr(BX_SEG_REG_CS, BX_CPU(i)->guard_found.eip);
-    BX_CPU(i)->guard_found.code_32_64 = 0;
-    // 00 - 16 bit, 01 - 32 bit, 10 - 64-bit, 11 - illegal
-    if (BX_CPU(i)->sregs[BX_SEG_REG_CS].cache.u.segment.d_b)
-      BX_CPU(i)->guard_found.code_32_64 |= 0x1;
-    if (BX_CPU(i)->get_cpu_mode() == BX_MODE_LONG_64)
-      BX_CPU(i)->guard_found.code_32_64 |= 0x2;
-  }
+  for (int i=0; i<BX_SMP_PROCESSORS; i++)
+    bx_dbg_set_guard_position(i);
   // finally, call the usual function to print the disassembly
   dbg_printf("Next at t=" FMT_LL "d\n", bx_pc_system.time_ticks());
   bx_dbg_disassemble_current(-1, 0);  // all cpus, don't print time
@@ -599,28 +596,84 @@ void bx_dbg_watchpoint_continue(bx_bool watch_continue)
   }
 }
 
+static void bx_dbg_index_watchpoint(bx_dbg_addr_index_c *index, const bx_watchpoint *wp, unsigned i)
+{
+  Bit64u first = BX_DBG_INDEX_PAGE(wp[i].addr), last = first;
+  if (wp[i].len > 0)
+    last = BX_DBG_INDEX_PAGE(wp[i].addr + wp[i].len - 1);
+  if (last - first >= BX_DBG_WATCH_INDEX_PAGES) {
+    index->insert_wide(i);
+  }
+  else {
+    for (Bit64u page = first; page <= last; page++)
+      index->insert(page, page, i);
+  }
+}
+
+static void bx_dbg_rebuild_watch_index(bx_dbg_addr_index_c *index, const bx_watchpoint *wp, unsigned num)
+{
+  index->clear();
+  for (unsigned i = 0; i < num; i++)
+    bx_dbg_index_watchpoint(index, wp, i);
+}
+
+static bx_bool bx_dbg_index_has_page(const bx_dbg_addr_index_c *index, Bit64u page)
+{
+  return index->page_marked(page) &&
+    (index->find(page) >= 0 || index->find(BX_DBG_INDEX_WIDE_KEY) >= 0);
+}
+
+// Pages with watchpoints are not mapped to host pointers in the TLB, so
+// the fast access paths never have to check the watchpoints
+bx_bool bx_dbg_watched_page(bx_phy_address ppf)
+{
+  Bit64u page = BX_DBG_INDEX_PAGE(ppf);
+  return (num_read_watchpoints && bx_dbg_index_has_page(&read_watch_index, page)) ||
+         (num_write_watchpoints && bx_dbg_index_has_page(&write_watch_index, page));
+}
+
+// drop the TLB host pointers of all CPUs after the watched pages changed
+static void bx_dbg_watched_pages_changed(void)
+{
+  for (unsigned cpu=0; cpu < BX_SMP_PROCESSORS; cpu++)
+    BX_CPU(cpu)->TLB_flush();
+}
+
+static bx_bool bx_dbg_watchpoint_hit(const bx_dbg_addr_index_c *index, const bx_watchpoint *wp,
+                                     bx_phy_address phy, bx_phy_address phy_end)
+{
+  for (Bit64u page = BX_DBG_INDEX_PAGE(phy); page <= BX_DBG_INDEX_PAGE(phy_end); page++) {
+    if (! index->page_marked(page)) continue;
+
+    Bit64u key = page;
+    for (int pass = 0; pass < 2; pass++, key = BX_DBG_INDEX_WIDE_KEY) {
+      for (int item = index->find(key); item >= 0; item = index->find_next(item, key)) {
+        const bx_watchpoint *w = &wp[index->entry(item)];
+        bx_phy_address watch_end = w->addr + w->len - 1;
+        if (watch_end < phy || phy_end < w->addr) continue;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
 void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned len, unsigned rw)
 {
   bx_phy_address phy_end = phy + len - 1;
 
   if (rw & 1) {
     // Check for physical write watch points
-    for (unsigned i = 0; i < num_write_watchpoints; i++) {
-      bx_phy_address watch_end = write_watchpoint[i].addr + write_watchpoint[i].len - 1;
-      if (watch_end < phy || phy_end < write_watchpoint[i].addr) continue;
+    if (num_write_watchpoints && bx_dbg_watchpoint_hit(&write_watch_index, write_watchpoint, phy, phy_end)) {
       BX_CPU(cpu)->watchpoint  = phy;
       BX_CPU(cpu)->break_point = BREAK_POINT_WRITE;
-      break;
     }
   }
   else {
     // Check for physical read watch points
-    for (unsigned i = 0; i < num_read_watchpoints; i++) {
-      bx_phy_address watch_end = read_watchpoint[i].addr + read_watchpoint[i].len - 1;
-      if (watch_end < phy || phy_end < read_watchpoint[i].addr) continue;
+    if (num_read_watchpoints && bx_dbg_watchpoint_hit(&read_watch_index, read_watchpoint, phy, phy_end)) {
       BX_CPU(cpu)->watchpoint  = phy;
       BX_CPU(cpu)->break_point = BREAK_POINT_READ;
-      break;
     }
   }
 }
@@ -631,9 +684,12 @@ void bx_dbg_lin_memory_access(unsigned cpu, bx_address lin, bx_phy_address phy,
 {
   bx_dbg_check_memory_watchpoints(cpu, phy, len, rw);
 
-  if (! BX_CPU(cpu)->trace_mem)
-    return;
+  if (BX_CPU(cpu)->trace_mem)
+    bx_dbg_lin_memory_trace(cpu, lin, phy, len, memtype, rw, data);
+}
 
+void bx_dbg_lin_memory_trace(unsigned cpu, bx_address lin, bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw, Bit8u *data)
+{
   dbg_printf("[CPU%d %s]: LIN 0x" FMT_ADDRX " PHY 0x" FMT_PHY_ADDRX " (len=%d, %s)",
      cpu, 
      (rw == BX_WRITE) ? "WR" : "RD",
@@ -1865,26 +1921,55 @@ void bx_dbg_print_watchpoints(void)
   }
 }
 
-void bx_dbg_watch(int type, bx_phy_address address, Bit32u len)
+void bx_dbg_add_watchpoint(int type, bx_phy_address address, Bit32u len)
 {
   if (type == BX_READ) {
-    if (num_read_watchpoints == BX_DBG_MAX_WATCHPONTS) {
-      dbg_printf("Too many read watchpoints (%d)\n", BX_DBG_MAX_WATCHPONTS);
-      return;
-    }
+    read_watchpoint = (bx_watchpoint*) bx_dbg_grow_table(read_watchpoint,
+        num_read_watchpoints, &max_read_watchpoints, sizeof(bx_watchpoint));
     read_watchpoint[num_read_watchpoints].addr = address;
     read_watchpoint[num_read_watchpoints].len = len;
-    num_read_watchpoints++;
-    dbg_printf("read watchpoint at 0x" FMT_PHY_ADDRX " len=%d inserted\n", address, len);
+    bx_dbg_index_watchpoint(&read_watch_index, read_watchpoint, num_read_watchpoints++);
   }
-  else if (type == BX_WRITE) {
-    if (num_write_watchpoints == BX_DBG_MAX_WATCHPONTS) {
-      dbg_printf("Too many write watchpoints (%d)\n", BX_DBG_MAX_WATCHPONTS);
-      return;
-    }
+  else {
+    write_watchpoint = (bx_watchpoint*) bx_dbg_grow_table(write_watchpoint,
+        num_write_watchpoints, &max_write_watchpoints, sizeof(bx_watchpoint));
     write_watchpoint[num_write_watchpoints].addr = address;
     write_watchpoint[num_write_watchpoints].len = len;
-    num_write_watchpoints++;
+    bx_dbg_index_watchpoint(&write_watch_index, write_watchpoint, num_write_watchpoints++);
+  }
+  bx_dbg_watched_pages_changed();
+}
+
+void bx_dbg_del_watchpoint(int type, unsigned n)
+{
+  if (type == BX_READ) {
+    if (n >= num_read_watchpoints) return;
+    // delete it by shifting remaining entries left
+    for (unsigned j=n; j<num_read_watchpoints-1; j++) {
+      read_watchpoint[j] = read_watchpoint[j+1];
+    }
+    num_read_watchpoints--;
+    bx_dbg_rebuild_watch_index(&read_watch_index, read_watchpoint, num_read_watchpoints);
+  }
+  else {
+    if (n >= num_write_watchpoints) return;
+    for (unsigned j=n; j<num_write_watchpoints-1; j++) {
+      write_watchpoint[j] = write_watchpoint[j+1];
+    }
+    num_write_watchpoints--;
+    bx_dbg_rebuild_watch_index(&write_watch_index, write_watchpoint, num_write_watchpoints);
+  }
+  bx_dbg_watched_pages_changed();
+}
+
+void bx_dbg_watch(int type, bx_phy_address address, Bit32u len)
+{
+  if (type == BX_READ) {
+    bx_dbg_add_watchpoint(BX_READ, address, len);
+    dbg_printf("read watchpoint at 0x" FMT_PHY_ADDRX " len=%d inserted\n", address, len);
+  }
+  else if (type == BX_WRITE) {
+    bx_dbg_add_watchpoint(BX_WRITE, address, len);
     dbg_printf("write watchpoint at 0x" FMT_PHY_ADDRX " len=%d inserted\n", address, len);
   }
   else {
@@ -1895,6 +1980,9 @@ void bx_dbg_watch(int type, bx_phy_address address, Bit32u len)
 void bx_dbg_unwatch_all()
 {
   num_read_watchpoints = num_write_watchpoints = 0;
+  read_watch_index.clear();
+  write_watch_index.clear();
+  bx_dbg_watched_pages_changed();
   dbg_printf("All watchpoints removed\n");
 }
 
@@ -1904,11 +1992,7 @@ void bx_dbg_unwatch(bx_phy_address address)
   for (i=0; i<num_read_watchpoints; i++) {
     if (read_watchpoint[i].addr == address) {
       dbg_printf("read watchpoint at 0x" FMT_PHY_ADDRX " removed\n", address);
-      // found watchpoint, delete it by shifting remaining entries left
-      for (int j=i; j<(int)(num_read_watchpoints-1); j++) {
-        read_watchpoint[j] = read_watchpoint[j+1];
-      }
-      num_read_watchpoints--;
+      bx_dbg_del_watchpoint(BX_READ, i);
       break;
     }
   }
@@ -1916,11 +2000,7 @@ void bx_dbg_unwatch(bx_phy_address address)
   for (i=0; i<num_write_watchpoints; i++) {
     if (write_watchpoint[i].addr == address) {
       dbg_printf("write watchpoint at 0x" FMT_PHY_ADDRX " removed\n", address);
-      // found watchpoint, delete it by shifting remaining entries left
-      for (int j=i; j<(int)(num_write_watchpoints-1); j++) {
-        write_watchpoint[j] = write_watchpoint[j+1];
-      }
-      num_write_watchpoints--;
+      bx_dbg_del_watchpoint(BX_WRITE, i);
       break;
     }
   }
@@ -2066,6 +2146,72 @@ void bx_dbg_stepN_command(int cpu, Bit32u count)
   bx_dbg_print_guard_results();
 }
 
+// called for every stop of the cpu loop while replaying from a checkpoint
+static bx_bool bx_dbg_revexec_stop_check(void)
+{
+  unsigned found = BX_CPU(0)->guard_found.guard_found;
+  stop_reason_t reason = (stop_reason_t) BX_CPU(0)->stop_reason;
+
+  bx_dbg_set_icount_guard(0, 0);
+  return (found || (reason != STOP_NO_REASON && reason != STOP_CPU_HALTED));
+}
+
+void bx_dbg_reverse_step_command(Bit32u count)
+{
+  if (count == 0) {
+    dbg_printf("Error: reverse-stepi: count=0\n");
+    return;
+  }
+
+  SIM->set_display_mode(DISP_MODE_SIM);
+
+  bx_guard.interrupt_requested = 0;
+  bx_dbg_set_icount_guard(0, 0);
+  if (! bx_revexec.step_back(count, bx_dbg_revexec_stop_check))
+    dbg_printf("Error: reverse-stepi: could not go back %u instructions\n", count);
+  bx_dbg_set_icount_guard(0, 0);
+  bx_dbg_set_guard_position(0);
+
+  BX_INSTR_DEBUG_PROMPT();
+  bx_dbg_print_guard_results();
+}
+
+void bx_dbg_reverse_continue_command(void)
+{
+  SIM->set_display_mode(DISP_MODE_SIM);
+
+  bx_guard.interrupt_requested = 0;
+  bx_dbg_set_icount_guard(0, 0);
+  int found = bx_revexec.continue_back(bx_dbg_revexec_stop_check);
+  if (found == 0)
+    dbg_printf("No breakpoint hit since the oldest checkpoint\n");
+  else if (found < 0)
+    dbg_printf("Error: reverse-continue failed\n");
+  if (found <= 0)
+    bx_dbg_set_icount_guard(0, 0);
+  bx_dbg_set_guard_position(0);
+
+  BX_INSTR_DEBUG_PROMPT();
+  bx_dbg_print_guard_results();
+}
+
+void bx_dbg_revexec_command(int mode, Bit64u interval)
+{
+  if (mode < 0) {
+    bx_revexec.print_info();
+  }
+  else if (mode == 0) {
+    bx_revexec.disable();
+    dbg_printf("Reverse execution disabled\n");
+  }
+  else {
+    if (interval == 0)
+      interval = BX_REVEXEC_DEFAULT_INTERVAL;
+    if (bx_revexec.enable(interval))
+      dbg_printf("Reverse execution enabled, checkpoint every " FMT_LL "u instructions\n", interval);
+  }
+}
+
 void bx_dbg_disassemble_current(int which_cpu, int print_time)
 {
   bx_phy_address phy;
@@ -2145,7 +2291,6 @@ void bx_dbg_print_guard_results(void)
   for (cpu=0; cpu<BX_SMP_PROCESSORS; cpu++) {
     unsigned found = BX_CPU(cpu)->guard_found.guard_found;
     if (! found) { /* ... */ }
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
     else if (found & BX_DBG_GUARD_IADDR_VIR) {
       i = BX_CPU(cpu)->guard_found.iaddr_index;
       dbg_printf("(%u) Breakpoint %u, in ", cpu,
@@ -2155,8 +2300,6 @@ void bx_dbg_print_guard_results(void)
             BX_CPU(cpu)->guard_found.laddr);
       dbg_printf("\n");
     }
-#endif
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
     else if (found & BX_DBG_GUARD_IADDR_LIN) {
       i = BX_CPU(cpu)->guard_found.iaddr_index;
       if (bx_guard.iaddr.lin[i].bpoint_id != 0)
@@ -2165,8 +2308,6 @@ void bx_dbg_print_guard_results(void)
             bx_guard.iaddr.lin[i].bpoint_id,
             BX_CPU(cpu)->guard_found.laddr);
     }
-#endif
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
     else if (found & BX_DBG_GUARD_IADDR_PHY) {
       i = BX_CPU(cpu)->guard_found.iaddr_index;
       dbg_printf("(%u) Breakpoint %u, 0x" FMT_ADDRX " in ?? ()\n",
@@ -2174,7 +2315,6 @@ void bx_dbg_print_guard_results(void)
             bx_guard.iaddr.phy[i].bpoint_id,
             BX_CPU(cpu)->guard_found.laddr);
     }
-#endif
     switch(BX_CPU(cpu)->stop_reason) {
     case STOP_NO_REASON:
     case STOP_CPU_HALTED:
@@ -2213,6 +2353,21 @@ void bx_dbg_print_guard_results(void)
   }
 }
 
+// set up the guard_found position from the cpu state, as the cpu loop would
+void bx_dbg_set_guard_position(int which_cpu)
+{
+  BX_CPU(which_cpu)->guard_found.cs = BX_CPU(which_cpu)->sregs[BX_SEG_REG_CS].selector.value;
+  BX_CPU(which_cpu)->guard_found.eip = BX_CPU(which_cpu)->get_instruction_pointer();
+  BX_CPU(which_cpu)->guard_found.laddr =
+    BX_CPU(which_cpu)->get_laddr(BX_SEG_REG_CS, BX_CPU(which_cpu)->guard_found.eip);
+  BX_CPU(which_cpu)->guard_found.code_32_64 = 0;
+  // 00 - 16 bit, 01 - 32 bit, 10 - 64-bit, 11 - illegal
+  if (BX_CPU(which_cpu)->sregs[BX_SEG_REG_CS].cache.u.segment.d_b)
+    BX_CPU(which_cpu)->guard_found.code_32_64 |= 0x1;
+  if (BX_CPU(which_cpu)->get_cpu_mode() == BX_MODE_LONG_64)
+    BX_CPU(which_cpu)->guard_found.code_32_64 |= 0x2;
+}
+
 void bx_dbg_set_icount_guard(int which_cpu, Bit32u n)
 {
   if (n == 0) {
@@ -3582,7 +3737,8 @@ void bx_dbg_print_help(void)
   dbg_printf("    help, q|quit|exit, set, instrument, show, trace, trace-reg,\n");
   dbg_printf("    trace-mem, u|disasm, ldsym, slist\n");
   dbg_printf("-*- Execution control -*-\n");
-  dbg_printf("    c|cont|continue, s|step, p|n|next, modebp, vmexitbp\n");
+  dbg_printf("    c|cont|continue, s|step, p|n|next, modebp, vmexitbp,\n");
+  dbg_printf("    rs|reverse-stepi, rc|reverse-continue, revexec\n");
   dbg_printf("-*- Breakpoint management -*-\n");
   dbg_printf("    vb|vbreak, lb|lbreak, pb|pbreak|b|break, sb, sba, blist,\n");
   dbg_printf("    bpe, bpd, d|del|delete, watch, unwatch\n");
@@ -93,6 +93,9 @@ void bx_dbg_set_rip_value(bx_address value);
 void bx_dbg_load_segreg(unsigned reg, unsigned value);
 bx_address bx_dbg_get_laddr(Bit16u sel, bx_address ofs);
 void bx_dbg_step_over_command(void);
+void bx_dbg_reverse_step_command(Bit32u count);
+void bx_dbg_reverse_continue_command(void);
+void bx_dbg_revexec_command(int mode, Bit64u interval);
 void bx_dbg_trace_command(bx_bool enable);
 void bx_dbg_trace_reg_command(bx_bool enable);
 void bx_dbg_trace_mem_command(bx_bool enable);
@@ -114,6 +117,8 @@ void bx_dbg_bt_command(unsigned dist);
 void bx_dbg_print_watchpoints(void);
 void bx_dbg_watchpoint_continue(bx_bool watch_continue);
 void bx_dbg_watch(int type, bx_phy_address address, Bit32u len);
+void bx_dbg_add_watchpoint(int type, bx_phy_address address, Bit32u len);
+void bx_dbg_del_watchpoint(int type, unsigned n);
 void bx_dbg_unwatch_all(void);
 void bx_dbg_unwatch(bx_phy_address handle);
 void bx_dbg_continue_command(bx_bool expression);
@@ -181,8 +186,12 @@ void bx_dbg_halt(unsigned cpu);
 void bx_dbg_lin_memory_access(unsigned cpu, bx_address lin, bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw,                Bit8u *data);
 void bx_dbg_phy_memory_access(unsigned cpu,                 bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw, unsigned attr, Bit8u *data);
 
+void bx_dbg_lin_memory_trace(unsigned cpu, bx_address lin, bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw, Bit8u *data);
+
 // check memory access for watchpoints
 void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned len, unsigned rw);
+// the page holds watchpoints and must not be accessed through a host pointer
+bx_bool bx_dbg_watched_page(bx_phy_address ppf);
 
 // commands that work with Bochs param tree
 void bx_dbg_restore_command(const char *param_name, const char *path);
@@ -244,41 +253,95 @@ void bx_dbg_exit(int code);
 
 #define BX_DBG_GUARD_ICOUNT        0x0010
 
+// Address index of the breakpoint and watchpoint tables, so that the checks
+// done for every instruction and memory access don't scan the tables. A
+// bitmap with one bit per (hashed) 4K page rejects the addresses on pages
+// without any entry with a single bit test; the entries on marked pages
+// are found through a hash table of their keys. A zero filled index is
+// valid and empty.
+#define BX_DBG_INDEX_PAGE(addr)   ((Bit64u)(addr) >> 12)
+#define BX_DBG_INDEX_PAGE_BITS    65536
+#define BX_DBG_INDEX_WIDE_KEY     BX_CONST64(0xffffffffffffffff)
+
+class bx_dbg_addr_index_c {
+public:
+  void clear(void);
+  // add a table entry with the given key, a breakpoint address or a page
+  // number of a watched range
+  void insert(Bit64u key, Bit64u page, unsigned entry);
+  // add a table entry to check on every page (key BX_DBG_INDEX_WIDE_KEY)
+  void insert_wide(unsigned entry);
+
+  BX_CPP_INLINE bx_bool page_marked(Bit64u page) const {
+    unsigned bit = page_hash(page);
+    return (page_bitmap[bit >> 5] >> (bit & 31)) & 1;
+  }
+
+  // returns the first item with the key, or -1
+  int find(Bit64u key) const;
+  // returns the next item with the key following 'item', or -1
+  int find_next(int item, Bit64u key) const;
+  unsigned entry(int item) const { return items[item].entry; }
+
+private:
+  static BX_CPP_INLINE unsigned page_hash(Bit64u page) {
+    return (unsigned)(page ^ (page >> 16) ^ (page >> 32)) & (BX_DBG_INDEX_PAGE_BITS - 1);
+  }
+  BX_CPP_INLINE unsigned key_hash(Bit64u key) const {
+    return (unsigned)((key * BX_CONST64(0x9e3779b97f4a7c15)) >> 32) & (nbuckets - 1);
+  }
+  void add_item(Bit64u key, unsigned entry);
+  void link_item(unsigned n);
+  void rehash(unsigned size);
+
+  Bit32u page_bitmap[BX_DBG_INDEX_PAGE_BITS / 32];
+
+  struct item_t {
+    Bit64u key;
+    unsigned entry;
+    int next;
+  } *items;
+  unsigned nitems, max_items;
+
+  int *buckets; // heads of the item chains, -1 if empty
+  unsigned nbuckets;
+};
+
+// make room for one more entry in a growing table of entry_size bytes per entry
+void* bx_dbg_grow_table(void *table, unsigned num, unsigned *max, size_t entry_size);
+
 struct bx_guard_t {
   unsigned guard_for;
 
   // instruction address breakpoints
   struct ibreak {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
-    unsigned num_virtual;
+    unsigned num_virtual, max_virtual;
     struct vbreak {
       Bit32u cs;  // only use 16 bits
       bx_address eip;
       unsigned bpoint_id;
       bx_bool enabled;
       char *condition;
-    } vir[BX_DBG_MAX_VIR_BPOINTS];
-#endif
+    } *vir;
+    bx_dbg_addr_index_c vir_index; // indexed by eip
 
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
-    unsigned num_linear;
+    unsigned num_linear, max_linear;
     struct lbreak {
       bx_address addr;
       unsigned bpoint_id;
       bx_bool enabled;
       char *condition;
-    } lin[BX_DBG_MAX_LIN_BPOINTS];
-#endif
+    } *lin;
+    bx_dbg_addr_index_c lin_index;
 
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
-    unsigned num_physical;
+    unsigned num_physical, max_physical;
     struct pbreak {
       bx_phy_address addr;
       unsigned bpoint_id;
       bx_bool enabled;
       char *condition;
-    } phy[BX_DBG_MAX_PHY_BPOINTS];
-#endif
+    } *phy;
+    bx_dbg_addr_index_c phy_index;
   } iaddr;
 
   // user typed Ctrl-C, requesting simulator stop at next convinient spot
@@ -336,8 +399,8 @@ struct bx_watchpoint {
 
 extern unsigned num_write_watchpoints;
 extern unsigned num_read_watchpoints;
-extern bx_watchpoint write_watchpoint[BX_DBG_MAX_WATCHPONTS];
-extern bx_watchpoint read_watchpoint[BX_DBG_MAX_WATCHPONTS];
+extern bx_watchpoint *write_watchpoint;
+extern bx_watchpoint *read_watchpoint;
 extern bx_guard_t bx_guard;
 
 #define IS_CODE_32(code_32_64) ((code_32_64 & 1) != 0)
@@ -610,8 +610,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 212
-#define YY_END_OF_BUFFER 213
+#define YY_NUM_RULES 217
+#define YY_END_OF_BUFFER 218
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -619,58 +619,60 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[453] =
+static const flex_int16_t yy_accept[479] =
     {   0,
-        0,    0,    0,    0,    0,    0,  213,  210,    1,  208,
-      196,  210,  209,  210,  193,  210,  198,  199,  183,  181,
-      182,  184,  204,  204,  207,  192,  210,  191,  176,  197,
-      206,  195,  206,   19,    6,   46,  206,  206,  206,  175,
-      206,  206,  206,  206,   13,  206,   14,   51,   27,   11,
-      206,   63,  206,   84,   52,  206,  206,  194,  211,    1,
-      211,  207,  211,    1,  188,    0,  201,    0,  209,  205,
-        0,  200,    0,  203,  204,    0,  186,  189,  187,  190,
-      185,  206,  111,   95,  206,  115,  112,   96,  121,  206,
-       80,  116,  206,  113,   97,  206,  206,   22,  166,  117,
-
-      206,  114,  120,   98,  206,  206,   24,  169,  118,  206,
-      206,  206,  206,  206,  206,  167,  206,  206,   30,  170,
-      206,  206,  171,  206,  206,    9,  206,  163,  206,  206,
-      172,   17,  206,  206,  206,  206,  206,  206,    3,  206,
-       19,  206,  206,  206,  206,  206,  155,  156,  206,  206,
-      206,  206,  206,  206,  206,   75,  206,  206,  119,  206,
-      122,  206,  168,  206,  206,  206,  206,  206,  206,  206,
-      206,   16,  206,  206,  206,  206,  206,   53,  206,  206,
-      178,  179,  180,  205,  202,   94,   34,  206,   48,   47,
-      102,  206,  206,  206,   36,    5,  206,   45,  206,  100,
-
-      206,   60,  206,  206,  131,  137,  132,  133,  136,  134,
-      206,  164,  135,  138,  206,  206,   30,   39,  206,  206,
-       65,   37,  206,  206,   61,   38,  206,  206,   40,  206,
-       35,  206,  206,    4,  206,  206,  206,  206,  206,  206,
-      206,  157,  158,  159,  160,  161,  162,  103,  139,  123,
-      104,  140,  124,  147,  154,  148,  149,  152,  150,  206,
-       28,  206,  165,  151,  153,   76,    2,  206,   99,  206,
-      206,  101,  206,   31,  206,  206,  206,  206,   42,  206,
-       62,  206,   41,  206,  206,  206,  206,  206,  206,  174,
-       32,   33,  206,  206,  177,    7,   23,  206,  206,  206,
-
-       68,   25,  206,   50,  206,  206,  175,   21,  206,  206,
-      206,  206,  206,   12,   92,  206,  206,  206,  206,  206,
-       49,  105,  141,  125,  106,  142,  126,  107,  143,  127,
-      108,  144,  128,  109,  145,  129,  110,  146,  130,   83,
-      206,   28,  206,  206,   85,   73,  206,   26,   10,   67,
-      206,  206,   59,  206,  206,  206,  206,  206,  206,  206,
-       15,   18,  206,  206,  206,  206,  206,  173,  206,  206,
-      206,   86,   43,  206,  206,  206,  206,   74,   57,  206,
-      206,  206,   88,  206,  206,   69,  206,  206,  206,   81,
-       90,   84,  206,   44,   93,   64,   89,  206,   17,   77,
-
-       20,  206,    0,  206,  206,  206,  206,  206,    0,  206,
-       16,  206,  206,  206,  206,   58,    0,  206,   54,   56,
-        0,   87,    0,    0,   82,  206,  206,    8,  206,    0,
-      206,    0,    0,    0,   78,   55,  206,    0,    0,   29,
-        0,   71,   70,   66,    0,    0,    0,   79,    0,   72,
-       91,    0
+        0,    0,    0,    0,    0,    0,  218,  215,    1,  213,
+      201,  215,  214,  215,  198,  215,  203,  204,  188,  186,
+      187,  189,  209,  209,  212,  197,  215,  196,  181,  202,
+      211,  200,  211,   24,    6,   51,  211,  211,  211,  180,
+      211,  211,  211,  211,   13,  211,   14,   56,   32,   11,
+      211,   68,  211,   89,   57,  211,  211,  199,  216,    1,
+      216,  212,  216,    1,  193,    0,  206,    0,  214,  210,
+        0,  205,    0,  208,  209,    0,  191,  194,  192,  195,
+      190,  211,  116,  100,  211,  120,  117,  101,  126,  211,
+       85,  121,  211,  118,  102,  211,  211,   27,  171,  122,
+
+      211,  119,  125,  103,  211,  211,   29,  174,  123,  211,
+      211,  211,  211,  211,  211,  172,  211,  211,   35,  175,
+      211,  211,  176,  211,  211,    9,  211,  168,  211,  211,
+      177,   22,  211,  211,  211,  211,  211,  211,    3,  211,
+       24,  211,  211,  211,  211,  211,  160,  161,  211,  211,
+       18,  211,  211,  211,   16,   80,  211,  211,  124,  211,
+      127,  211,  173,  211,  211,  211,  211,  211,  211,  211,
+      211,   21,  211,  211,  211,  211,  211,   58,  211,  211,
+      183,  184,  185,    0,  210,    0,  207,   99,   39,  211,
+       53,   52,  107,  211,  211,  211,   41,    5,  211,   50,
+
+      211,  105,  211,   65,  211,  211,  136,  142,  137,  138,
+      141,  139,  211,  169,  140,  143,  211,  211,   35,   44,
+      211,  211,   70,   42,  211,  211,   66,   43,  211,  211,
+       45,  211,   40,  211,  211,    4,  211,  211,  211,  211,
+      211,  211,  211,  162,  163,  164,  165,  166,  167,  108,
+      144,  128,  109,  145,  129,  152,  159,  153,  154,  157,
+      155,  211,   33,  211,  211,  170,  156,  158,   81,    2,
+      211,  104,  211,  211,  106,  211,   36,  211,  211,  211,
+      211,   47,  211,   67,  211,   46,  211,  211,  211,  211,
+      211,  211,  179,   36,   37,   38,  211,  211,  182,    7,
+
+       28,  211,  211,  211,   73,   30,  211,   55,  211,  211,
+      180,   26,  211,  211,  211,  211,  211,   12,   97,  211,
+      211,  211,  211,  211,   54,  110,  146,  130,  111,  147,
+      131,  112,  148,  132,  113,  149,  133,  114,  150,  134,
+      115,  151,  135,   88,  211,   33,  211,  211,  211,   90,
+       78,  211,   31,   10,   72,  211,  211,   64,  211,  211,
+      211,  211,  211,  211,  211,   20,   23,  211,  211,  211,
+      211,  211,  178,  211,  211,  211,   91,   48,  211,  211,
+      211,  211,   79,   62,  211,  211,  211,  211,  211,   93,
+      211,  211,   74,  211,  211,  211,   86,   95,   89,  211,
+
+       49,   98,   69,  178,   94,  211,   22,   82,   25,  211,
+        0,  211,  211,  211,  211,  211,  211,  211,    0,  211,
+       21,  211,  211,  211,  211,   63,    0,  211,   59,  211,
+       19,   61,    0,   92,    0,    0,   87,  211,  211,    8,
+      211,    0,  211,    0,    0,    0,    0,   83,   60,  211,
+        0,    0,   34,    0,    0,    0,   76,   75,   71,    0,
+        0,    0,    0,    0,   84,    0,    0,    0,   77,   96,
+        0,    0,    0,   15,    0,    0,   17,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -707,197 +709,247 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[61] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    1,    1,    1,    1,    1,    1,
-        4,    5,    1,    1,    4,    6,    6,    6,    4,    4,
-        7,    7,    7,    5,    5,    7,    5,    7,    5,    5,
-        5,    7,    7,    7,    5,    7,    8,    5,    5,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[465] =
+static const flex_int16_t yy_base[479] =
     {   0,
-        0,    0,   59,   61,   63,   65,  550,  551,  547,  551,
-      521,   64,    0,    0,  551,   61,  551,  551,  551,  551,
-      551,  551,   48,    0,  551,   55,  520,   64,  551,  551,
-        0,  551,   51,   58,   75,   91,  109,   50,   76,  507,
-      113,  153,  120,   27,  506,   72,  141,  490,  178,  195,
-      146,  496,   41,   87,   52,  496,  495,  551,  551,  538,
-      238,  551,    0,  537,  551,   80,  551,    0,    0,    0,
-      107,  551,    0,  131,    0,    0,  551,  551,  551,  551,
-      551,    0,    0,  493,  480,    0,    0,  493,  140,  496,
-        0,    0,  489,    0,    0,  486,  478,  120,    0,    0,
-
-       34,    0,   73,    0,  496,  487,  490,    0,    0,  471,
-      133,  470,  143,  481,  476,   92,  481,  488,  468,    0,
-      468,  472,    0,  139,  466,    0,  147,    0,  468,  464,
-        0,  465,  151,  468,  457,  475,  455,  471,    0,  469,
-      458,  461,  464,  463,  150,  189,  186,  187,  448,  162,
-      447,  169,  198,  454,  186,  467,  448,  452,  173,  456,
-      453,  458,  457,  188,  452,  448,  184,  457,  457,  439,
-      434,  438,  449,  434,  447,  442,  218,    0,  438,  437,
-        0,    0,    0,    0,    0,    0,    0,  430,    0,    0,
-        0,  446,  443,  426,    0,    0,  437,  438,  433,    0,
-
-      440,    0,  421,  432,    0,    0,    0,    0,    0,    0,
-      437,    0,    0,    0,  418,  429,    0,    0,  433,  419,
-        0,    0,  419,  413,    0,    0,  426,  406,    0,  409,
-        0,  423,  408,    0,  421,  420,  420,  410,  410,  404,
-      401,  229,  232,  233,  260,  261,  264,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  415,
-      230,  399,    0,    0,    0,    0,  402,  394,    0,  410,
-      396,    0,  406,    0,  397,  396,  391,  407,    0,  403,
-        0,  404,    0,  405,  400,  381,  400,  385,  382,    0,
-        0,    0,  381,  389,    0,  389,    0,  378,  393,  377,
-
-        0,    0,  387,    0,  375,  391,    0,    0,  374,  389,
-      377,  365,  385,    0,    0,  385,  376,  365,  378,  358,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      363,    0,  366,  367,    0,    0,  359,    0,    0,    0,
-      374,  362,    0,  370,  355,  372,  363,  363,  365,  364,
-        0,    0,  355,  362,  361,  353,  346,    0,  352,  342,
-      351,    0,    0,  345,  349,  345,  377,    0,    0,  337,
-      338,  349,    0,  345,  341,  371,  347,  339,  325,    0,
-        0,  316,  307,    0,    0,    0,    0,  314,    0,    0,
-
-        0,  318,  299,  299,  291,  273,  304,  263,  226,  272,
-        0,  277,  273,  272,  271,    0,  256,  257,    0,    0,
-      261,    0,  267,  266,    0,  255,  257,    0,  254,  132,
-      241,  239,  237,  237,    0,    0,  213,  215,  206,    0,
-      207,  551,  551,    0,  197,  118,  111,  551,   90,  551,
-      551,  551,  320,  328,  336,  341,  349,  355,  101,  361,
-       80,  367,  373,  374
+        1,   62,   61,   64,   49,  122,  122,  122,  121,  124,
+       97,  124,  184,  214,  127,  273,  127,  127,  127,  127,
+      127,  127,  318,  327,  127,  221,  100,  323,  187,  187,
+      350,  187,  368,  369,  382,  398,  416,  307,  383,  148,
+      420,  460,  317,  315,  237,  317,  448,  300,  468,  473,
+      412,  311,  383,  451,  316,  330,  331,  378,  378,  378,
+      516,  378,  525,  378,  378,  378,  378,  573,  378,  618,
+      378,  378,  677,  321,  379,  722,  379,  379,  379,  379,
+      379,  379,  379,  334,  323,  383,  383,  340,  427,  373,
+      415,  415,  370,  416,  416,  369,  378,  399,  442,  442,
+
+      443,  442,  444,  442,  407,  402,  409,  461,  461,  404,
+      413,  417,  451,  445,  446,  470,  454,  465,  456,  514,
+      461,  469,  521,  506,  468,  523,  515,  523,  473,  474,
+      528,  477,  508,  483,  493,  518,  508,  526,  571,  530,
+      525,  596,  601,  602,  608,  731,  718,  727,  589,  715,
+      591,  712,  732,  603,  727,  645,  713,  720,  726,  732,
+      732,  739,  740,  741,  738,  736,  750,  752,  755,  739,
+      736,  742,  756,  743,  758,  755,  754,  801,  755,  756,
+      803,  787,  812,  812,  812,  812,  812,  812,  812,  760,
+      813,  813,  813,  778,  777,  762,  816,  816,  775,  778,
+
+      775,  819,  784,  820,  767,  780,  822,  822,  822,  822,
+      822,  822,  787,  823,  823,  823,  770,  783,  825,  825,
+      789,  777,  827,  827,  779,  775,  829,  829,  790,  772,
+      831,  777,  832,  793,  780,  834,  795,  796,  798,  790,
+      792,  788,  787,  805,  806,  809,  810,  813,  814,  853,
+      853,  853,  853,  853,  853,  853,  853,  853,  853,  853,
+      853,  815,  811,  802,  817,  857,  857,  857,  857,  808,
+      802,  859,  820,  808,  864,  823,  867,  818,  819,  818,
+      836,  873,  834,  874,  837,  875,  840,  837,  820,  841,
+      828,  827,  881,  881,  881,  881,  828,  838,  883,  840,
+
+      884,  831,  848,  834,  887,  887,  846,  888,  836,  854,
+      890,  890,  839,  856,  846,  836,  858,  895,  895,  860,
+      853,  844,  859,  841,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  848,  901,  853,  851,  857,  904,
+      904,  851,  905,  905,  905,  868,  858,  907,  868,  856,
+      875,  868,  870,  874,  875,  915,  915,  868,  877,  878,
+      872,  867,  920,  875,  867,  878,  923,  923,  874,  880,
+      878,  912,  927,  927,  874,  877,  877,  891,  892,  932,
+      890,  888,  920,  898,  892,  884,  938,  938,  892,  885,
+
+      940,  940,  940,  940,  940,  894,  941,  941,  941,  900,
+      890,  904,  905,  906,  909,  901,  934,  897,  904,  909,
+      952,  916,  914,  915,  917,  957,  904,  907,  959,  945,
+      960,  960,  914,  961,  922,  923,  963,  914,  918,  965,
+      918,  931,  915,  931,  921,  924,  930,  972,  972,  919,
+      936,  931,  975,  927,  923,  939,  978,  978,  978,  934,
+      932,  933,  942,  945,  985,  944,  933,  938,  988,  988,
+      945,  946,  943,  991,  937,  953,  993,  994
     } ;
 
-static const flex_int16_t yy_def[465] =
+static const flex_int16_t yy_def[479] =
     {   0,
-      452,    1,  453,  453,  453,  453,  452,  452,  452,  452,
-      452,  454,  455,  456,  452,  457,  452,  452,  452,  452,
-      452,  452,  458,  459,  452,  452,  452,  452,  452,  452,
-      460,  452,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  452,  452,  452,
-      452,  452,  461,  452,  452,  454,  452,  454,  455,  462,
-      457,  452,  457,  458,  459,  463,  452,  452,  452,  452,
-      452,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-       61,  464,  461,  462,  463,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,  460,  460,  460,  460,  460,  460,  460,  460,
-
-      460,  460,  452,  460,  460,  460,  460,  460,  452,  460,
-      460,  460,  460,  460,  460,  460,  452,  460,  460,  460,
-      452,  460,  452,  452,  460,  460,  460,  460,  460,  452,
-      460,  452,  452,  452,  460,  460,  460,  452,  452,  460,
-      452,  452,  452,  460,  452,  452,  452,  452,  452,  452,
-      452,    0,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452
+      478,    1,    1,    3,    3,    5,  478,  478,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,   23,    8,    8,    8,    8,    8,    8,
+        8,    8,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,    8,    8,    9,
+        8,    8,    8,    9,    8,   12,    8,    8,   13,    8,
+       16,    8,    8,   23,   24,    8,    8,    8,    8,    8,
+        8,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       61,   61,   63,   12,   70,   16,   76,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+        8,   31,   31,   31,   31,   31,   31,   31,    8,   31,
+       31,   31,   31,   31,   31,   31,    8,   31,   31,   31,
+       31,   31,    8,   31,    8,    8,   31,   31,   31,   31,
+       31,    8,   31,    8,    8,    8,    8,   31,   31,   31,
+        8,    8,   31,    8,    8,    8,    8,    8,   31,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    0
     } ;
 
-static const flex_int16_t yy_nxt[612] =
+static const flex_int16_t yy_nxt[1055] =
     {   0,
-        8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
-       18,   19,   20,   21,   22,   23,   24,   24,   24,   24,
-       24,   24,   24,   24,   25,   26,   27,   28,   29,   30,
-       31,   31,    8,   32,   33,   34,   35,   36,   37,   38,
-       39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
-       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
-       60,   10,   60,   10,   60,   10,   60,   10,   67,   72,
-       75,   75,  135,   61,  136,   61,  172,   63,  198,   63,
-       77,   78,  183,   62,   67,   62,  173,   62,  199,   62,
-       80,   81,   83,   73,  118,   84,   68,  177,  119,   87,
-
-      178,  120,   88,   75,   76,   85,   89,   86,   90,   93,
-       91,  138,   68,  121,   92,   72,   94,  200,  139,   95,
-      122,  174,   96,   97,  201,   98,   99,  123,  175,  101,
-      451,  100,  102,  103,  213,  104,  105,  176,  106,   73,
-      214,  107,  108,  110,  111,  112,  113,  109,  114,  450,
-      125,  115,  126,   75,   75,  132,  196,  133,  197,  127,
-      116,  128,  134,  129,  449,  117,  438,  130,  131,  131,
-      131,  131,  131,  131,  131,  140,  141,  189,  190,  142,
-      167,  206,  439,  220,  191,  209,  223,  452,  240,  207,
-      168,  143,  241,  144,  146,  221,  169,  170,  224,  210,
-
-      147,  148,  228,  229,  242,  243,  244,  245,  246,  247,
-      255,  258,  149,  150,  151,  152,  153,  269,  256,  279,
-      154,  248,  251,  249,  252,  259,  275,  280,  264,  155,
-      156,  270,  260,  157,  265,  276,  158,  159,  261,  160,
-      448,  250,  253,  161,  447,  162,  163,  164,  446,  262,
-      165,  445,  166,  181,  181,  181,  181,  181,  181,  181,
-      181,  181,  290,  274,  322,  444,  323,  325,  328,  326,
-      329,  423,  341,  182,  182,  182,  424,  443,  182,  182,
-      182,  342,  442,  182,  324,  182,  441,  327,  330,  182,
-      182,  182,  440,  182,  182,  331,  334,  332,  335,  337,
-
-      437,  338,  436,  435,  434,  433,  432,  431,  430,  429,
-      428,  427,  426,  425,  422,  333,  336,  421,  420,  339,
-       59,   59,   59,   59,   59,   59,   59,   59,   66,  419,
-       66,   66,   66,   66,   66,   66,   69,  418,   69,   69,
-       69,   69,   69,   69,   70,   70,   70,   70,   70,   71,
-      417,   71,   71,   71,   71,   71,   71,   74,  416,  415,
-      414,  413,   74,   82,   82,   82,   82,   82,   82,  184,
-      184,  184,  184,  184,  184,  185,  185,  412,  185,  182,
-      182,  182,  411,  410,  409,  408,  407,  406,  405,  404,
-      403,  402,  401,  400,  399,  398,  397,  368,  396,  395,
-
-      394,  393,  392,  391,  390,  389,  388,  387,  386,  385,
-      384,  383,  382,  381,  380,  379,  378,  377,  376,  375,
-      374,  373,  372,  371,  370,  369,  368,  367,  366,  365,
-      364,  363,  362,  361,  360,  359,  358,  357,  356,  355,
-      354,  353,  352,  351,  350,  349,  348,  347,  346,  345,
-      344,  343,  340,  321,  320,  319,  318,  317,  316,  315,
-      314,  313,  312,  311,  310,  309,  308,  307,  306,  305,
-      304,  303,  302,  301,  300,  299,  298,  297,  296,  295,
-      294,  293,  292,  291,  289,  288,  287,  286,  285,  284,
-      283,  282,  281,  278,  277,  274,  273,  272,  271,  268,
-
-      267,  266,  263,  257,  254,  239,  238,  237,  236,  235,
-      234,  233,  232,  231,  230,  227,  226,  225,  222,  219,
-      218,  217,  216,  215,  212,  211,  208,  205,  204,  203,
-      202,  195,  194,  193,  192,  188,  187,  186,   64,   64,
-      180,  179,  171,  145,  137,  124,   79,   65,   64,  452,
-        7,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452
+        7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
+       17,   18,   19,   20,   21,   22,   23,   24,   24,   24,
+       24,   24,   24,   24,   24,   25,   26,   27,   28,   29,
+       30,   31,   31,    8,   32,   33,   34,   35,   36,   37,
+       38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
+       58,   59,   60,   63,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   61,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   62,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,    7,   64,   65,   66,   66,   79,   66,   67,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   68,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   69,   69,  124,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   70,   70,   77,   78,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   71,   71,  137,   71,   71,   71,   71,
+       71,   72,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   73,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   74,   74,   74,   74,   74,   74,   74,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   80,
+       81,  118,  132,  145,  133,  119,  138,  171,  120,  134,
+      135,  177,  136,  139,  178,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   76,  179,  180,  478,  188,  189,
+       82,   82,  190,  478,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   83,
+       87,  194,   84,   88,  195,  196,   93,   89,  172,   90,
+      121,   91,   85,   94,   86,   92,   95,  122,  173,   96,
+       97,  197,   98,   99,  123,  198,  101,  199,  100,  102,
+      103,  204,  104,  105,  205,  106,  167,  206,  107,  108,
+      110,  111,  112,  113,  109,  114,  168,  125,  115,  126,
+      207,  208,  169,  170,  191,  192,  127,  116,  128,  209,
+      129,  193,  117,  210,  130,  131,  131,  131,  131,  131,
+      131,  131,  140,  141,  146,  174,  142,  200,  202,  213,
+      147,  148,  175,  211,  214,  203,  217,  201,  143,  218,
+
+      144,  176,  149,  150,  151,  152,  153,  212,  156,  219,
+      154,  157,  215,  220,  158,  159,  221,  160,  216,  155,
+      224,  161,  227,  162,  163,  164,  228,  229,  165,  232,
+      166,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      183,  183,  183,  183,  183,  183,  183,  183,  183,  233,
+      222,  182,  182,  182,  225,  234,  182,  182,  182,  230,
+      231,  182,  223,  182,  235,  236,  226,  182,  182,  182,
+      237,  182,  182,  184,  184,  238,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  185,  185,  185,  185,  185,  185,  185,
+      185,  185,  239,  240,  241,  256,  242,  259,  185,  185,
+      243,  266,  185,  185,  185,  185,  185,  185,  185,  185,
+      185,  185,  185,  185,  185,  185,  185,  185,  185,  185,
+      185,  185,  185,  185,  185,  185,  185,  186,  186,  269,
+      186,  186,  186,  186,  186,  186,  186,  186,  186,  186,
+      186,  186,  186,  186,  186,  186,  186,  186,  186,  186,
+
+      186,  186,  186,  186,  186,  186,  186,  186,  186,  186,
+      186,  186,  186,  186,  186,  186,  186,  186,  186,  186,
+      186,  186,  186,  186,  186,  186,  186,  186,  186,  186,
+      186,  186,  186,  186,  186,  186,  186,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  244,  245,  246,  247,
+      248,  249,  187,  250,  260,  251,  187,  187,  187,  187,
+      187,  187,  253,  257,  254,  270,  262,  271,  261,  267,
+      272,  258,  263,  252,  274,  268,  275,  276,  277,  278,
+      280,  281,  255,  264,  273,  282,  265,  284,  279,  285,
+      286,  287,  288,  283,  289,  290,  291,  292,  293,  294,
+
+      295,  296,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  297,  298,  299,  300,  301,  302,  303,  304,  305,
+      306,  307,  308,  309,  310,  311,  312,  313,  314,  315,
+      316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+      326,  329,  327,  330,  332,  335,  333,  336,  338,  341,
+      339,  342,  344,  345,  347,  348,  349,  350,  351,  352,
+      328,  331,  346,  353,  334,  337,  354,  355,  340,  343,
+      356,  357,  358,  359,  360,  361,  362,  363,  364,  365,
+      366,  367,  368,  369,  370,  371,  372,  373,  374,  375,
+      376,  377,  378,  379,  380,  381,  382,  383,  384,  385,
+
+      386,  387,  389,  390,  391,  392,  393,  388,  394,  395,
+      396,  397,  398,  399,  400,  401,  402,  403,  404,  405,
+      406,  407,  408,  409,  410,  411,  412,  413,  414,  415,
+      416,  417,  418,  419,  420,  421,  422,  423,  424,  425,
+      426,  427,  428,  429,  430,  431,  432,  433,  434,  435,
+      437,  438,  439,  440,  436,  441,  442,  443,  444,  445,
+      446,  447,  448,  449,  450,  451,  453,  454,  456,  457,
+      458,  459,  460,  461,  462,  463,  464,  465,  466,  467,
+      468,  452,  455,  469,  470,  471,  472,  473,  474,  475,
+      476,  477,    0,  478,  478,  478,  478,  478,  478,  478,
+
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478
     } ;
 
-static const flex_int16_t yy_chk[612] =
+static const flex_int16_t yy_chk[1055] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -905,68 +957,116 @@ static const flex_int16_t yy_chk[612] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    4,    4,    5,    5,    6,    6,   12,   16,
-       23,   23,   44,    3,   44,    4,   53,    5,  101,    6,
-       26,   26,  461,    3,   66,    4,   53,    5,  101,    6,
-       28,   28,   33,   16,   38,   33,   12,   55,   38,   34,
-
-       55,   38,   34,  459,   23,   33,   34,   33,   34,   35,
-       34,   46,   66,   39,   34,   71,   35,  103,   46,   35,
-       39,   54,   35,   35,  103,   35,   35,   39,   54,   36,
-      449,   35,   36,   36,  116,   36,   36,   54,   36,   71,
-      116,   36,   36,   37,   37,   37,   37,   36,   37,  447,
-       41,   37,   41,   74,   74,   43,   98,   43,   98,   41,
-       37,   41,   43,   41,  446,   37,  430,   41,   42,   42,
-       42,   42,   42,   42,   42,   47,   47,   89,   89,   47,
-       51,  111,  430,  124,   89,  113,  127,   74,  145,  111,
-       51,   47,  145,   47,   49,  124,   51,   51,  127,  113,
-
-       49,   49,  133,  133,  146,  146,  146,  146,  146,  146,
-      150,  152,   49,   49,   49,   49,   49,  159,  150,  167,
-       49,  147,  148,  147,  148,  152,  164,  167,  155,   49,
-       50,  159,  153,   50,  155,  164,   50,   50,  153,   50,
-      445,  147,  148,   50,  441,   50,   50,   50,  439,  153,
-       50,  438,   50,   61,   61,   61,   61,   61,   61,   61,
-       61,   61,  177,  177,  242,  437,  242,  243,  244,  243,
-      244,  409,  261,   61,   61,   61,  409,  434,   61,   61,
-       61,  261,  433,   61,  242,   61,  432,  243,  244,   61,
-       61,   61,  431,   61,   61,  245,  246,  245,  246,  247,
-
-      429,  247,  427,  426,  424,  423,  421,  418,  417,  415,
-      414,  413,  412,  410,  408,  245,  246,  407,  406,  247,
-      453,  453,  453,  453,  453,  453,  453,  453,  454,  405,
-      454,  454,  454,  454,  454,  454,  455,  404,  455,  455,
-      455,  455,  455,  455,  456,  456,  456,  456,  456,  457,
-      403,  457,  457,  457,  457,  457,  457,  458,  402,  398,
-      393,  392,  458,  460,  460,  460,  460,  460,  460,  462,
-      462,  462,  462,  462,  462,  463,  463,  389,  463,  464,
-      464,  464,  388,  387,  386,  385,  384,  382,  381,  380,
-      377,  376,  375,  374,  371,  370,  369,  367,  366,  365,
-
-      364,  363,  360,  359,  358,  357,  356,  355,  354,  352,
-      351,  347,  344,  343,  341,  320,  319,  318,  317,  316,
-      313,  312,  311,  310,  309,  306,  305,  303,  300,  299,
-      298,  296,  294,  293,  289,  288,  287,  286,  285,  284,
-      282,  280,  278,  277,  276,  275,  273,  271,  270,  268,
-      267,  262,  260,  241,  240,  239,  238,  237,  236,  235,
-      233,  232,  230,  228,  227,  224,  223,  220,  219,  216,
-      215,  211,  204,  203,  201,  199,  198,  197,  194,  193,
-      192,  188,  180,  179,  176,  175,  174,  173,  172,  171,
-      170,  169,  168,  166,  165,  163,  162,  161,  160,  158,
-
-      157,  156,  154,  151,  149,  144,  143,  142,  141,  140,
-      138,  137,  136,  135,  134,  132,  130,  129,  125,  122,
-      121,  119,  118,  117,  115,  114,  112,  110,  107,  106,
-      105,   97,   96,   93,   90,   88,   85,   84,   64,   60,
-       57,   56,   52,   48,   45,   40,   27,   11,    9,    7,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-
-      452,  452,  452,  452,  452,  452,  452,  452,  452,  452,
-      452
+        1,    3,    3,    5,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    8,    9,   11,   12,   12,   27,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   13,   13,   40,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   14,   14,   26,   26,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   16,   16,   45,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   24,   24,   24,   24,   24,   24,   24,   28,
+       28,   38,   43,   48,   43,   38,   46,   52,   38,   43,
+       44,   55,   44,   46,   55,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   23,   56,   57,   74,   84,   85,
+       31,   31,   88,   24,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   33,
+       34,   90,   33,   34,   93,   96,   35,   34,   53,   34,
+       39,   34,   33,   35,   33,   34,   35,   39,   53,   35,
+       35,   97,   35,   35,   39,   98,   36,   98,   35,   36,
+       36,  105,   36,   36,  106,   36,   51,  107,   36,   36,
+       37,   37,   37,   37,   36,   37,   51,   41,   37,   41,
+      110,  111,   51,   51,   89,   89,   41,   37,   41,  111,
+       41,   89,   37,  112,   41,   42,   42,   42,   42,   42,
+       42,   42,   47,   47,   49,   54,   47,  101,  103,  114,
+       49,   49,   54,  113,  115,  103,  117,  101,   47,  118,
+
+       47,   54,   49,   49,   49,   49,   49,  113,   50,  119,
+       49,   50,  116,  121,   50,   50,  122,   50,  116,   49,
+      125,   50,  129,   50,   50,   50,  130,  132,   50,  134,
+       50,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,  135,
+      124,   61,   61,   61,  127,  136,   61,   61,   61,  133,
+      133,   61,  124,   61,  137,  138,  127,   61,   61,   61,
+      140,   61,   61,   68,   68,  141,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,  142,  143,  144,  149,  145,  151,   70,   70,
+      145,  154,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   73,   73,  156,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,  146,  146,  146,  146,
+      146,  146,   76,  147,  152,  147,   76,   76,   76,   76,
+       76,   76,  148,  150,  148,  157,  153,  158,  152,  155,
+      159,  150,  153,  147,  160,  155,  161,  162,  163,  164,
+      165,  166,  148,  153,  159,  167,  153,  168,  164,  169,
+      170,  171,  172,  167,  173,  174,  175,  176,  177,  177,
+
+      179,  180,  182,  182,  182,  182,  182,  182,  182,  182,
+      182,  190,  194,  195,  196,  199,  200,  201,  203,  205,
+      206,  213,  217,  218,  221,  222,  225,  226,  229,  230,
+      232,  234,  235,  237,  238,  239,  240,  241,  242,  243,
+      244,  245,  244,  245,  246,  247,  246,  247,  248,  249,
+      248,  249,  262,  263,  264,  265,  270,  271,  273,  274,
+      244,  245,  263,  276,  246,  247,  278,  279,  248,  249,
+      280,  281,  283,  285,  287,  288,  289,  290,  291,  292,
+      297,  298,  300,  302,  303,  304,  307,  309,  310,  313,
+      314,  315,  316,  317,  320,  321,  322,  323,  324,  345,
+
+      347,  348,  349,  352,  356,  357,  359,  348,  360,  361,
+      362,  363,  364,  365,  368,  369,  370,  371,  372,  374,
+      375,  376,  379,  380,  381,  382,  385,  386,  387,  388,
+      389,  391,  392,  393,  394,  395,  396,  399,  400,  406,
+      410,  411,  412,  413,  414,  415,  416,  417,  418,  419,
+      420,  422,  423,  424,  419,  425,  427,  428,  430,  433,
+      435,  436,  438,  439,  441,  442,  443,  444,  445,  446,
+      447,  450,  451,  452,  454,  455,  456,  460,  461,  462,
+      463,  442,  444,  464,  466,  467,  468,  471,  472,  473,
+      475,  476,    0,  478,  478,  478,  478,  478,  478,  478,
+
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1037,9 +1137,9 @@ static unsigned lex_input_size = 0;
      { bxlval.sval = strdup(bxtext); return(BX_TOKEN_GENERIC); }
 #endif
 
-#line 1040 "<stdout>"
+#line 1140 "<stdout>"
 
-#line 1042 "<stdout>"
+#line 1142 "<stdout>"
 
 #define INITIAL 0
 #define EXAMINE 1
@@ -1260,7 +1360,7 @@ YY_DECL
 	{
 #line 59 "lexer.l"
 
-#line 1263 "<stdout>"
+#line 1363 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1287,13 +1387,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 453 )
+				if ( yy_current_state >= 479 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 551 );
+		while ( yy_base[yy_current_state] != 994 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1373,153 +1473,153 @@ YY_RULE_SETUP
 { bxlval.sval = strdup(bxtext); return(BX_TOKEN_STEP_OVER); }
 	YY_BREAK
 case 15:
-YY_RULE_SETUP
-#line 74 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LIST_BREAK); }
-	YY_BREAK
+#line 75 "lexer.l"
 case 16:
 YY_RULE_SETUP
 #line 75 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_VBREAKPOINT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_REVERSE_STEP); }
 	YY_BREAK
 case 17:
+#line 77 "lexer.l"
+case 18:
 YY_RULE_SETUP
-#line 76 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LBREAKPOINT); }
+#line 77 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_REVERSE_CONTINUE); }
 	YY_BREAK
-case 18:
-#line 78 "lexer.l"
 case 19:
-#line 79 "lexer.l"
+YY_RULE_SETUP
+#line 78 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_REVEXEC); }
+	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 79 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PBREAKPOINT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LIST_BREAK); }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 80 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_INFO); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_VBREAKPOINT); }
 	YY_BREAK
 case 22:
-#line 82 "lexer.l"
-case 23:
 YY_RULE_SETUP
-#line 82 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CONTROL_REGS); }
+#line 81 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LBREAKPOINT); }
 	YY_BREAK
+case 23:
+#line 83 "lexer.l"
 case 24:
 #line 84 "lexer.l"
 case 25:
 YY_RULE_SETUP
 #line 84 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEBUG_REGS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PBREAKPOINT); }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 85 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SEGMENT_REGS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_INFO); }
 	YY_BREAK
 case 27:
-YY_RULE_SETUP
-#line 86 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_R); }
-	YY_BREAK
+#line 87 "lexer.l"
 case 28:
-#line 88 "lexer.l"
-case 29:
 YY_RULE_SETUP
-#line 88 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_REGS); }
+#line 87 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CONTROL_REGS); }
 	YY_BREAK
+case 29:
+#line 89 "lexer.l"
 case 30:
 YY_RULE_SETUP
 #line 89 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_FPU); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEBUG_REGS); }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 90 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_XMM); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SEGMENT_REGS); }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 91 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_YMM); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_R); }
 	YY_BREAK
 case 33:
-YY_RULE_SETUP
-#line 92 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ZMM); }
-	YY_BREAK
+#line 93 "lexer.l"
 case 34:
 YY_RULE_SETUP
 #line 93 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_AVX); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_REGS); }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 94 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_MMX); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_FPU); }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 95 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CPU); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_XMM); }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 96 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IDT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_YMM); }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 97 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IVT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ZMM); }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 98 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GDT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_AVX); }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 99 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LDT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_MMX); }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 100 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TSS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CPU); }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 101 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TAB); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IDT); }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 102 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LINUX); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IVT); }
 	YY_BREAK
 case 44:
-#line 104 "lexer.l"
+YY_RULE_SETUP
+#line 103 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GDT); }
+	YY_BREAK
 case 45:
-#line 105 "lexer.l"
+YY_RULE_SETUP
+#line 104 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LDT); }
+	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 105 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEL_BREAKPOINT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TSS); }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 106 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ENABLE_BREAKPOINT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TAB); }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 107 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISABLE_BREAKPOINT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LINUX); }
 	YY_BREAK
 case 49:
 #line 109 "lexer.l"
@@ -1528,803 +1628,822 @@ case 50:
 case 51:
 YY_RULE_SETUP
 #line 110 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_QUIT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEL_BREAKPOINT); }
 	YY_BREAK
 case 52:
-#line 112 "lexer.l"
+YY_RULE_SETUP
+#line 111 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ENABLE_BREAKPOINT); }
+	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 112 "lexer.l"
-{ BEGIN(EXAMINE); bxlval.sval = strdup(bxtext); return(BX_TOKEN_EXAMINE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISABLE_BREAKPOINT); }
 	YY_BREAK
 case 54:
-YY_RULE_SETUP
-#line 113 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_RESTORE); }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
 #line 114 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WRITEMEM); }
-	YY_BREAK
+case 55:
+#line 115 "lexer.l"
 case 56:
 YY_RULE_SETUP
 #line 115 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SETPMEM); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_QUIT); }
 	YY_BREAK
 case 57:
-YY_RULE_SETUP
-#line 116 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_QUERY); }
-	YY_BREAK
+#line 117 "lexer.l"
 case 58:
 YY_RULE_SETUP
 #line 117 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PENDING); }
+{ BEGIN(EXAMINE); bxlval.sval = strdup(bxtext); return(BX_TOKEN_EXAMINE); }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 118 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TAKE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_RESTORE); }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 119 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DMA); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WRITEMEM); }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 120 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IRQ); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SETPMEM); }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 121 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TLB); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_QUERY); }
 	YY_BREAK
 case 63:
-#line 123 "lexer.l"
+YY_RULE_SETUP
+#line 122 "lexer.l"
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PENDING); }
+	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 123 "lexer.l"
-{ BEGIN(DISASM); bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISASM); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TAKE); }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 124 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_HEX); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DMA); }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 125 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_INSTRUMENT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_IRQ); }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 126 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_STOP); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TLB); }
 	YY_BREAK
 case 68:
-YY_RULE_SETUP
-#line 127 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DOIT); }
-	YY_BREAK
+#line 128 "lexer.l"
 case 69:
 YY_RULE_SETUP
 #line 128 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACE); }
+{ BEGIN(DISASM); bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISASM); }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 129 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACEREG); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_HEX); }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 130 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACEMEM); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_INSTRUMENT); }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 131 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SWITCH_MODE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_STOP); }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 132 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SIZE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DOIT); }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 133 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PTIME); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACE); }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 134 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TIMEBP); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACEREG); }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 135 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TIMEBP_ABSOLUTE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TRACEMEM); }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 136 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_MODEBP); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SWITCH_MODE); }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 137 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_VMEXITBP); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SIZE); }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 138 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PRINT_STACK); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PTIME); }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 139 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_BT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TIMEBP); }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 140 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WATCH); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_TIMEBP_ABSOLUTE); }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 141 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_UNWATCH); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_MODEBP); }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 142 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_READ); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_VMEXITBP); }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 143 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WRITE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PRINT_STACK); }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 144 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SHOW); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_BT); }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 145 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LOAD_SYMBOLS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WATCH); }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 146 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SYMBOLS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_UNWATCH); }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 147 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LIST_SYMBOLS); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_READ); }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 148 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GLOBAL); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WRITE); }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 149 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WHERE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SHOW); }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 150 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PRINT_STRING); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LOAD_SYMBOLS); }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 151 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PAGE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SYMBOLS); }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 152 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEVICE); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_LIST_SYMBOLS); }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 153 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ALL); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GLOBAL); }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 154 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_AL; return(BX_TOKEN_8BL_REG);}
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_WHERE); }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 155 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_BL; return(BX_TOKEN_8BL_REG);}
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PRINT_STRING); }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 156 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_CL; return(BX_TOKEN_8BL_REG);}
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_PAGE); }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 157 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_DL; return(BX_TOKEN_8BL_REG);}
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_DEVICE); }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 158 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_SIL); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_ALL); }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 159 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_DIL); }
+{ bxlval.uval = BX_8BIT_REG_AL; return(BX_TOKEN_8BL_REG);}
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 160 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_SPL); }
+{ bxlval.uval = BX_8BIT_REG_BL; return(BX_TOKEN_8BL_REG);}
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 161 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_BPL); }
+{ bxlval.uval = BX_8BIT_REG_CL; return(BX_TOKEN_8BL_REG);}
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 162 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R8);  }
+{ bxlval.uval = BX_8BIT_REG_DL; return(BX_TOKEN_8BL_REG);}
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 163 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R9);  }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_SIL); }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 164 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R10); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_DIL); }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 165 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R11); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_SPL); }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 166 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R12); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_BPL); }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 167 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R13); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R8);  }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 168 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R14); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R9);  }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 169 "lexer.l"
-{ LONG_MODE_8BL_REG(BX_8BIT_REG_R15); }
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R10); }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 170 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_AH; return(BX_TOKEN_8BH_REG);}
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R11); }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 171 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_BH; return(BX_TOKEN_8BH_REG);}
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R12); }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 172 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_CH; return(BX_TOKEN_8BH_REG);}
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R13); }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 173 "lexer.l"
-{ bxlval.uval = BX_8BIT_REG_DH; return(BX_TOKEN_8BH_REG);}
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R14); }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 174 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_AX; return(BX_TOKEN_16B_REG);}
+{ LONG_MODE_8BL_REG(BX_8BIT_REG_R15); }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 175 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_BX; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_8BIT_REG_AH; return(BX_TOKEN_8BH_REG);}
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 176 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_CX; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_8BIT_REG_BH; return(BX_TOKEN_8BH_REG);}
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 177 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_DX; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_8BIT_REG_CH; return(BX_TOKEN_8BH_REG);}
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 178 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_SI; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_8BIT_REG_DH; return(BX_TOKEN_8BH_REG);}
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 179 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_DI; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_16BIT_REG_AX; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 180 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_BP; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_16BIT_REG_BX; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 181 "lexer.l"
-{ bxlval.uval = BX_16BIT_REG_SP; return(BX_TOKEN_16B_REG);}
+{ bxlval.uval = BX_16BIT_REG_CX; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 182 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R8);  }
+{ bxlval.uval = BX_16BIT_REG_DX; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 183 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R9);  }
+{ bxlval.uval = BX_16BIT_REG_SI; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 184 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R10); }
+{ bxlval.uval = BX_16BIT_REG_DI; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 185 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R11); }
+{ bxlval.uval = BX_16BIT_REG_BP; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 186 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R12); }
+{ bxlval.uval = BX_16BIT_REG_SP; return(BX_TOKEN_16B_REG);}
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 187 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R13); }
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R8);  }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 188 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R14); }
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R9);  }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 189 "lexer.l"
-{ LONG_MODE_16B_REG(BX_16BIT_REG_R15); }
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R10); }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 190 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_EAX; return(BX_TOKEN_32B_REG);}
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R11); }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 191 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_EBX; return(BX_TOKEN_32B_REG);}
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R12); }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 192 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_ECX; return(BX_TOKEN_32B_REG);}
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R13); }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 193 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_EDX; return(BX_TOKEN_32B_REG);}
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R14); }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 194 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_ESI; return(BX_TOKEN_32B_REG);}
+{ LONG_MODE_16B_REG(BX_16BIT_REG_R15); }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 195 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_EDI; return(BX_TOKEN_32B_REG);}
+{ bxlval.uval = BX_32BIT_REG_EAX; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 196 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_EBP; return(BX_TOKEN_32B_REG);}
+{ bxlval.uval = BX_32BIT_REG_EBX; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 197 "lexer.l"
-{ bxlval.uval = BX_32BIT_REG_ESP; return(BX_TOKEN_32B_REG);}
+{ bxlval.uval = BX_32BIT_REG_ECX; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 198 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R8);  }
+{ bxlval.uval = BX_32BIT_REG_EDX; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 199 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R9);  }
+{ bxlval.uval = BX_32BIT_REG_ESI; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 200 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R10); }
+{ bxlval.uval = BX_32BIT_REG_EDI; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 201 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R11); }
+{ bxlval.uval = BX_32BIT_REG_EBP; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 202 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R12); }
+{ bxlval.uval = BX_32BIT_REG_ESP; return(BX_TOKEN_32B_REG);}
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 203 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R13); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R8);  }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 204 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R14); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R9);  }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 205 "lexer.l"
-{ LONG_MODE_32B_REG(BX_32BIT_REG_R15); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R10); }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 206 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RAX); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R11); }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 207 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RBX); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R12); }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 208 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RCX); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R13); }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 209 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RDX); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R14); }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 210 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RSI); }
+{ LONG_MODE_32B_REG(BX_32BIT_REG_R15); }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 211 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RDI); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RAX); }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 212 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RSP); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RBX); }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 213 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_RBP); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RCX); }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 214 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R8);  }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RDX); }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 215 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R9);  }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RSI); }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 216 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R10); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RDI); }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 217 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R11); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RSP); }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 218 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R12); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_RBP); }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 219 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R13); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R8);  }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 220 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R14); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R9);  }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 221 "lexer.l"
-{ LONG_MODE_64B_REG(BX_64BIT_REG_R15); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R10); }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 222 "lexer.l"
-{ return(BX_TOKEN_REG_IP); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R11); }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 223 "lexer.l"
-{ return(BX_TOKEN_REG_EIP);}
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R12); }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 224 "lexer.l"
-{ return(BX_TOKEN_REG_RIP);}
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R13); }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 225 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_CS; return(BX_TOKEN_CS); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R14); }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 226 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_ES; return(BX_TOKEN_ES); }
+{ LONG_MODE_64B_REG(BX_64BIT_REG_R15); }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 227 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_SS; return(BX_TOKEN_SS); }
+{ return(BX_TOKEN_REG_IP); }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 228 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_DS; return(BX_TOKEN_DS); }
+{ return(BX_TOKEN_REG_EIP);}
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 229 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_FS; return(BX_TOKEN_FS); }
+{ return(BX_TOKEN_REG_RIP);}
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 230 "lexer.l"
-{ bxlval.uval = BX_SEG_REG_GS; return(BX_TOKEN_GS); }
+{ bxlval.uval = BX_SEG_REG_CS; return(BX_TOKEN_CS); }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 231 "lexer.l"
-{ EVEX_OPMASK_REG(bxtext[1] - '0'); }
+{ bxlval.uval = BX_SEG_REG_ES; return(BX_TOKEN_ES); }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 232 "lexer.l"
-{ bxlval.uval = 0; return (BX_TOKEN_FLAGS); }
+{ bxlval.uval = BX_SEG_REG_SS; return(BX_TOKEN_SS); }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 233 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_XML); }
+{ bxlval.uval = BX_SEG_REG_DS; return(BX_TOKEN_DS); }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 234 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_HELP); }
+{ bxlval.uval = BX_SEG_REG_FS; return(BX_TOKEN_FS); }
 	YY_BREAK
 case 176:
-#line 236 "lexer.l"
+YY_RULE_SETUP
+#line 235 "lexer.l"
+{ bxlval.uval = BX_SEG_REG_GS; return(BX_TOKEN_GS); }
+	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 236 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CALC); }
+{ EVEX_OPMASK_REG(bxtext[1] - '0'); }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 237 "lexer.l"
-{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_XFORMAT); }
+{ bxlval.uval = 0; return (BX_TOKEN_FLAGS); }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 238 "lexer.l"
-{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_XFORMAT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_XML); }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 239 "lexer.l"
-{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISFORMAT); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_HELP); }
 	YY_BREAK
 case 181:
-YY_RULE_SETUP
-#line 240 "lexer.l"
-{ return ('+'); }
-	YY_BREAK
+#line 241 "lexer.l"
 case 182:
 YY_RULE_SETUP
 #line 241 "lexer.l"
-{ return ('-'); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_CALC); }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 242 "lexer.l"
-{ return ('*'); }
+{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_XFORMAT); }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 243 "lexer.l"
-{ return ('/'); }
+{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_XFORMAT); }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 244 "lexer.l"
-{ return (BX_TOKEN_RSHIFT); }
+{ BEGIN(INITIAL); bxlval.sval = strdup(bxtext); return(BX_TOKEN_DISFORMAT); }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 245 "lexer.l"
-{ return (BX_TOKEN_LSHIFT); }
+{ return ('+'); }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 246 "lexer.l"
-{ return (BX_TOKEN_EQ); }
+{ return ('-'); }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 247 "lexer.l"
-{ return (BX_TOKEN_NE); }
+{ return ('*'); }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 248 "lexer.l"
-{ return (BX_TOKEN_LE); }
+{ return ('/'); }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 249 "lexer.l"
-{ return (BX_TOKEN_GE); }
+{ return (BX_TOKEN_RSHIFT); }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 250 "lexer.l"
-{ return ('>'); }
+{ return (BX_TOKEN_LSHIFT); }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 251 "lexer.l"
-{ return ('<'); }
+{ return (BX_TOKEN_EQ); }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 252 "lexer.l"
-{ return ('&'); }
+{ return (BX_TOKEN_NE); }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 253 "lexer.l"
-{ return ('|'); }
+{ return (BX_TOKEN_LE); }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 254 "lexer.l"
-{ return ('^'); }
+{ return (BX_TOKEN_GE); }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 255 "lexer.l"
-{ return ('!'); }
+{ return ('>'); }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 256 "lexer.l"
-{ return ('@'); }
+{ return ('<'); }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 257 "lexer.l"
-{ return ('('); }
+{ return ('&'); }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 258 "lexer.l"
-{ return (')'); }
+{ return ('|'); }
 	YY_BREAK
 case 200:
-#line 260 "lexer.l"
+YY_RULE_SETUP
+#line 259 "lexer.l"
+{ return ('^'); }
+	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 260 "lexer.l"
-{ bxlval.sval = strdup(bxtext+1); bxlval.sval[strlen(bxlval.sval)-1] = 0; return(BX_TOKEN_STRING); }
+{ return ('!'); }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 261 "lexer.l"
-{ bxlval.uval = strtoull(bxtext, NULL, 16); return(BX_TOKEN_NUMERIC); }
+{ return ('@'); }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 262 "lexer.l"
-{ bxlval.uval = strtoull(bxtext, NULL, 8); return(BX_TOKEN_NUMERIC); }
+{ return ('('); }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 263 "lexer.l"
-{ bxlval.uval = strtoull(bxtext, NULL, 10); return(BX_TOKEN_NUMERIC); }
+{ return (')'); }
 	YY_BREAK
 case 205:
-YY_RULE_SETUP
-#line 264 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SYMBOLNAME); }
-	YY_BREAK
+#line 265 "lexer.l"
 case 206:
 YY_RULE_SETUP
 #line 265 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GENERIC); }
+{ bxlval.sval = strdup(bxtext+1); bxlval.sval[strlen(bxlval.sval)-1] = 0; return(BX_TOKEN_STRING); }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 266 "lexer.l"
-{ return ('\n'); }
+{ bxlval.uval = strtoull(bxtext, NULL, 16); return(BX_TOKEN_NUMERIC); }
 	YY_BREAK
 case 208:
-/* rule 208 can match eol */
 YY_RULE_SETUP
 #line 267 "lexer.l"
-{ return ('\n'); }
+{ bxlval.uval = strtoull(bxtext, NULL, 8); return(BX_TOKEN_NUMERIC); }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 268 "lexer.l"
-; // eat up comments '//'
+{ bxlval.uval = strtoull(bxtext, NULL, 10); return(BX_TOKEN_NUMERIC); }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 269 "lexer.l"
-{ return(bxtext[0]); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_SYMBOLNAME); }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 270 "lexer.l"
-{ BEGIN(INITIAL); unput(*bxtext); }
+{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GENERIC); }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 271 "lexer.l"
+{ return ('\n'); }
+	YY_BREAK
+case 213:
+/* rule 213 can match eol */
+YY_RULE_SETUP
+#line 272 "lexer.l"
+{ return ('\n'); }
+	YY_BREAK
+case 214:
+YY_RULE_SETUP
+#line 273 "lexer.l"
+; // eat up comments '//'
+	YY_BREAK
+case 215:
+YY_RULE_SETUP
+#line 274 "lexer.l"
+{ return(bxtext[0]); }
+	YY_BREAK
+case 216:
+YY_RULE_SETUP
+#line 275 "lexer.l"
+{ BEGIN(INITIAL); unput(*bxtext); }
+	YY_BREAK
+case 217:
+YY_RULE_SETUP
+#line 276 "lexer.l"
 ECHO;
 	YY_BREAK
-#line 2327 "<stdout>"
+#line 2446 "<stdout>"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(EXAMINE):
 case YY_STATE_EOF(DISASM):
@@ -2623,7 +2742,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 453 )
+			if ( yy_current_state >= 479 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2651,11 +2770,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 453 )
+		if ( yy_current_state >= 479 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 452);
+	yy_is_jam = (yy_current_state == 478);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3331,7 +3450,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 271 "lexer.l"
+#line 276 "lexer.l"
 
 
   int
@@ -223,9 +223,12 @@ extern int bxdebug;
     BX_TOKEN_REG_IP = 364,
     BX_TOKEN_REG_EIP = 365,
     BX_TOKEN_REG_RIP = 366,
-    NOT = 367,
-    NEG = 368,
-    INDIRECT = 369
+    BX_TOKEN_REVERSE_STEP = 367,
+    BX_TOKEN_REVERSE_CONTINUE = 368,
+    BX_TOKEN_REVEXEC = 369,
+    NOT = 370,
+    NEG = 371,
+    INDIRECT = 372
   };
 #endif
 /* Tokens.  */
@@ -338,9 +341,12 @@ extern int bxdebug;
 #define BX_TOKEN_REG_IP 364
 #define BX_TOKEN_REG_EIP 365
 #define BX_TOKEN_REG_RIP 366
-#define NOT 367
-#define NEG 368
-#define INDIRECT 369
+#define BX_TOKEN_REVERSE_STEP 367
+#define BX_TOKEN_REVERSE_CONTINUE 368
+#define BX_TOKEN_REVEXEC 369
+#define NOT 370
+#define NEG 371
+#define INDIRECT 372
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -353,7 +359,7 @@ union YYSTYPE
   Bit64u   uval;
   bx_bool  bval;
 
-#line 357 "y.tab.c" /* yacc.c:355  */
+#line 363 "y.tab.c" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -370,7 +376,7 @@ int bxparse (void);
 
 /* Copy the second part of user declarations.  */
 
-#line 374 "y.tab.c" /* yacc.c:358  */
+#line 380 "y.tab.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -610,23 +616,23 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  306
+#define YYFINAL  321
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   2358
+#define YYLAST   2548
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  131
+#define YYNTOKENS  134
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  59
+#define YYNNTS  62
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  298
+#define YYNRULES  310
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  584
+#define YYNSTATES  606
 
 /* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
    by yylex, with out-of-bounds checking.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   369
+#define YYMAXUTOK   372
 
 #define YYTRANSLATE(YYX)                                                \
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -636,18 +642,18 @@ union yyalloc
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     124,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     127,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   127,     2,     2,     2,     2,   120,     2,
-     128,   129,   118,   112,     2,   113,     2,   119,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   126,     2,
-     116,   125,   117,     2,   130,     2,     2,     2,     2,     2,
+       2,     2,     2,   130,     2,     2,     2,     2,   123,     2,
+     131,   132,   121,   115,     2,   116,     2,   122,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   129,     2,
+     119,   128,   120,     2,   133,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   115,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   118,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   114,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   117,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -671,43 +677,46 @@ static const yytype_uint8 yytranslate[] =
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
       85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   121,   122,   123
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     124,   125,   126
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   147,   147,   148,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
-     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
-     198,   199,   200,   201,   202,   203,   204,   210,   211,   216,
-     217,   222,   223,   224,   225,   226,   227,   232,   237,   245,
-     253,   261,   266,   271,   276,   281,   286,   294,   302,   310,
-     318,   326,   334,   342,   347,   355,   360,   368,   373,   378,
-     383,   388,   393,   398,   403,   408,   413,   418,   426,   431,
-     436,   441,   449,   457,   465,   470,   478,   483,   488,   493,
-     501,   509,   514,   519,   523,   527,   531,   535,   539,   543,
-     547,   554,   559,   564,   569,   574,   579,   584,   589,   594,
-     599,   604,   609,   614,   622,   630,   635,   643,   648,   653,
-     658,   663,   668,   673,   678,   683,   688,   693,   698,   703,
-     708,   713,   718,   723,   731,   732,   735,   743,   751,   759,
-     767,   775,   783,   791,   799,   807,   815,   822,   830,   838,
-     843,   848,   853,   861,   869,   877,   885,   893,   898,   903,
-     911,   916,   921,   926,   931,   936,   941,   946,   951,   959,
-     964,   972,   980,   988,   993,   999,  1006,  1011,  1017,  1023,
-    1029,  1034,  1039,  1044,  1049,  1054,  1059,  1064,  1070,  1076,
-    1082,  1090,  1095,  1100,  1105,  1110,  1115,  1120,  1125,  1130,
-    1135,  1140,  1145,  1150,  1155,  1160,  1165,  1170,  1175,  1185,
-    1196,  1202,  1215,  1220,  1231,  1236,  1252,  1268,  1278,  1283,
-    1291,  1300,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
-    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
-    1328,  1329,  1330,  1331,  1332,  1333,  1339,  1340,  1341,  1342,
-    1343,  1344,  1345,  1346,  1347,  1348,  1349,  1350,  1351,  1352,
-    1353,  1354,  1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,
-    1363,  1364,  1365,  1366,  1367,  1368,  1369,  1370,  1371
+       0,   150,   150,   151,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
+     216,   217,   222,   223,   228,   229,   230,   231,   232,   233,
+     238,   243,   251,   259,   267,   272,   277,   282,   287,   292,
+     300,   308,   316,   324,   332,   340,   348,   353,   361,   366,
+     374,   379,   384,   389,   394,   399,   404,   409,   414,   419,
+     424,   432,   437,   442,   447,   455,   463,   471,   476,   484,
+     489,   494,   499,   507,   515,   520,   528,   536,   541,   546,
+     554,   559,   564,   568,   572,   576,   580,   584,   588,   592,
+     599,   604,   609,   614,   619,   624,   629,   634,   639,   644,
+     649,   654,   659,   667,   675,   680,   688,   693,   698,   703,
+     708,   713,   718,   723,   728,   733,   738,   743,   748,   753,
+     758,   763,   768,   776,   777,   780,   788,   796,   804,   812,
+     820,   828,   836,   844,   852,   860,   867,   875,   883,   888,
+     893,   898,   906,   914,   922,   930,   938,   943,   948,   956,
+     961,   966,   971,   976,   981,   986,   991,   996,  1004,  1009,
+    1017,  1025,  1033,  1038,  1044,  1051,  1056,  1061,  1066,  1073,
+    1079,  1085,  1091,  1096,  1101,  1106,  1111,  1116,  1121,  1126,
+    1132,  1138,  1144,  1152,  1157,  1162,  1167,  1172,  1177,  1182,
+    1187,  1192,  1197,  1202,  1207,  1212,  1217,  1222,  1227,  1232,
+    1237,  1247,  1258,  1264,  1277,  1282,  1293,  1298,  1314,  1330,
+    1340,  1345,  1353,  1362,  1372,  1373,  1374,  1375,  1376,  1377,
+    1378,  1379,  1380,  1381,  1382,  1383,  1384,  1385,  1386,  1387,
+    1388,  1389,  1390,  1391,  1392,  1393,  1394,  1395,  1401,  1402,
+    1403,  1404,  1405,  1406,  1407,  1408,  1409,  1410,  1411,  1412,
+    1413,  1414,  1415,  1416,  1417,  1418,  1419,  1420,  1421,  1422,
+    1423,  1424,  1425,  1426,  1427,  1428,  1429,  1430,  1431,  1432,
+    1433
 };
 #endif
 
@@ -748,9 +757,10 @@ static const char *const yytname[] =
   "BX_TOKEN_HELP", "BX_TOKEN_XML", "BX_TOKEN_CALC", "BX_TOKEN_DEVICE",
   "BX_TOKEN_GENERIC", "BX_TOKEN_RSHIFT", "BX_TOKEN_LSHIFT", "BX_TOKEN_EQ",
   "BX_TOKEN_NE", "BX_TOKEN_LE", "BX_TOKEN_GE", "BX_TOKEN_REG_IP",
-  "BX_TOKEN_REG_EIP", "BX_TOKEN_REG_RIP", "'+'", "'-'", "'|'", "'^'",
-  "'<'", "'>'", "'*'", "'/'", "'&'", "NOT", "NEG", "INDIRECT", "'\\n'",
-  "'='", "':'", "'!'", "'('", "')'", "'@'", "$accept", "commands",
+  "BX_TOKEN_REG_EIP", "BX_TOKEN_REG_RIP", "BX_TOKEN_REVERSE_STEP",
+  "BX_TOKEN_REVERSE_CONTINUE", "BX_TOKEN_REVEXEC", "'+'", "'-'", "'|'",
+  "'^'", "'<'", "'>'", "'*'", "'/'", "'&'", "NOT", "NEG", "INDIRECT",
+  "'\\n'", "'='", "':'", "'!'", "'('", "')'", "'@'", "$accept", "commands",
   "command", "BX_TOKEN_TOGGLE_ON_OFF", "BX_TOKEN_REGISTERS",
   "BX_TOKEN_SEGREG", "timebp_command", "modebp_command",
   "vmexitbp_command", "show_command", "page_command", "tlb_command",
@@ -758,17 +768,17 @@ static const char *const yytname[] =
   "trace_mem_command", "print_stack_command", "backtrace_command",
   "watch_point_command", "symbol_command", "where_command",
   "print_string_command", "continue_command", "stepN_command",
-  "step_over_command", "set_command", "breakpoint_command",
-  "blist_command", "slist_command", "info_command", "optional_numeric",
-  "regs_command", "fpu_regs_command", "mmx_regs_command",
-  "xmm_regs_command", "ymm_regs_command", "zmm_regs_command",
-  "segment_regs_command", "control_regs_command", "debug_regs_command",
-  "delete_command", "bpe_command", "bpd_command", "quit_command",
-  "examine_command", "restore_command", "writemem_command",
-  "setpmem_command", "query_command", "take_command",
-  "disassemble_command", "instrument_command", "doit_command",
-  "crc_command", "help_command", "calc_command", "if_command",
-  "vexpression", "expression", YY_NULLPTR
+  "step_over_command", "reverse_step_command", "reverse_continue_command",
+  "revexec_command", "set_command", "breakpoint_command", "blist_command",
+  "slist_command", "info_command", "optional_numeric", "regs_command",
+  "fpu_regs_command", "mmx_regs_command", "xmm_regs_command",
+  "ymm_regs_command", "zmm_regs_command", "segment_regs_command",
+  "control_regs_command", "debug_regs_command", "delete_command",
+  "bpe_command", "bpd_command", "quit_command", "examine_command",
+  "restore_command", "writemem_command", "setpmem_command",
+  "query_command", "take_command", "disassemble_command",
+  "instrument_command", "doit_command", "crc_command", "help_command",
+  "calc_command", "if_command", "vexpression", "expression", YY_NULLPTR
 };
 #endif
 
@@ -788,18 +798,18 @@ static const yytype_uint16 yytoknum[] =
      335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
      345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
      355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,    43,    45,   124,    94,    60,    62,    42,    47,
-      38,   367,   368,   369,    10,    61,    58,    33,    40,    41,
-      64
+     365,   366,   367,   368,   369,    43,    45,   124,    94,    60,
+      62,    42,    47,    38,   370,   371,   372,    10,    61,    58,
+      33,    40,    41,    64
 };
 # endif
 
-#define YYPACT_NINF -176
+#define YYPACT_NINF -182
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-176)))
+  (!!((Yystate) == (-182)))
 
-#define YYTABLE_NINF -297
+#define YYTABLE_NINF -309
 
 #define yytable_value_is_error(Yytable_value) \
   0
@@ -808,65 +818,67 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     549,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,     3,  1288,   -38,  -112,    21,  -108,  1311,
-     111,   292,   -78,   -51,   -35,  1508,   -65,  -176,  -176,   -52,
-     -34,   -29,   -27,   -26,   -25,   -24,   -23,  1039,    20,    34,
-    1288,    44,   -12,  1288,   911,   -21,  -176,  1288,  1288,    47,
-      47,    47,   -16,  1288,  1288,   -14,   -13,   -54,   -41,     5,
-    1062,     2,    13,   -58,   -11,  1288,  -176,  1288,  1447,  1288,
-    -176,  -176,  -176,  1288,  1288,  -176,  1288,  1288,  1288,   421,
-    -176,     4,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  2232,  1288,  -176,  1488,    37,   -40,  -176,
-    -176,    10,    11,    12,    14,    35,    41,    47,    42,    43,
-      45,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  1336,  -176,  1336,  1336,  -176,   163,    16,
-    -176,   250,  1288,  -176,   618,     6,    22,    49,    50,    55,
-      68,  1288,  1288,  1288,  1288,    73,    74,    76,   -33,   -56,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  1091,
-    -176,  1512,    69,  1288,   886,    77,   -39,    78,  1536,  1114,
-      47,    81,    46,  -176,   144,    82,    84,  1560,   886,  -176,
-    -176,    86,    87,    88,  -176,  1584,  1608,  -176,  -176,    91,
-    -176,    95,  -176,    99,  1288,   106,  1288,  1288,  -176,  -176,
-    1632,   119,   120,   -37,   121,  -176,  1242,    90,   141,  -176,
-    -176,  1656,  1680,   149,   155,   156,   160,   161,   162,   164,
-     166,   167,   168,   169,   170,   183,   184,   201,   202,   203,
-     204,   205,   212,   216,   227,   228,   235,   236,   247,   248,
-     249,   251,   253,   254,   257,   258,   263,   265,   266,   267,
-     268,   273,   274,   275,   280,   282,   283,   284,  -176,   285,
-    1704,    19,    19,    19,  1460,    19,  -176,  -176,  -176,  1288,
-    1288,  1288,  1288,  1288,  1288,  1288,  1288,  1288,  1288,  1288,
-    1288,  1288,  1288,  1288,  1288,  1728,  -176,   288,   291,  -176,
-    1288,  1288,  1288,  1288,  1288,  1288,   293,  1288,  1288,  1288,
-    -176,  -176,   113,  1336,  1336,  1336,  1336,  1336,  1336,  1336,
-    1336,  1336,  1336,   100,  -176,   218,  -176,   -17,   331,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  1288,  2232,  1288,  1288,
-    1288,  -176,  -176,  -176,   294,  -176,   -30,   -28,  -176,  -176,
-    1752,  -176,   312,   886,  1288,  1288,   886,  -176,   313,  -176,
-    -176,  -176,  -176,   677,   314,  -176,   348,  -176,  1776,  -176,
-    -176,  -176,  1800,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,   706,  -176,   758,   834,  -176,  -176,  -176,   332,  -176,
-    -176,  -176,  1824,  1265,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,    36,    36,    19,    19,    19,
-      19,  1035,  1035,  1035,  1035,  1035,  1035,    36,    36,    36,
-    2232,  -176,  -176,  -176,  1848,  1872,  1896,  1920,  1944,  1968,
-    -176,  1992,  2016,  2040,  -176,  -176,  -176,   276,   276,   276,
-     276,  -176,  -176,  -176,   636,   338,   339,   395,  -176,   341,
-     342,   343,   344,   345,  -176,   346,  -176,   351,  -176,  -176,
-    -176,  2064,  1322,    70,  2088,  -176,  -176,  2112,  -176,   352,
-    -176,  -176,  -176,  2136,  -176,  2160,  -176,  2184,  -176,  -176,
-    -176,  2208,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,   411,  -176,  -176,  -176,   358,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,   360,  -176,  -176
+     567,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,    -8,  1351,   -35,  -108,   284,   -96,  1482,
+     979,  1073,   -62,   -50,   -47,  1495,   -75,  -182,  -182,   -71,
+     -69,   -61,   -59,   -49,   -43,   -42,   -31,   118,    28,    38,
+    1351,    48,   -25,  1351,   300,   -52,  -182,  1351,  1351,    55,
+      55,    55,   -16,  1351,  1351,   -14,    -9,   -72,   -68,   148,
+    1111,    -7,   -18,   -53,    10,  1351,  -182,  1351,  1608,  1351,
+    -182,  -182,  -182,   -64,    12,     6,  1351,  1351,  -182,  1351,
+    1351,  1351,   436,  -182,    18,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  2419,
+    1351,  -182,  1450,    50,   -63,  -182,  -182,    19,    20,    21,
+      22,    23,    24,    55,    40,    45,    46,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  1494,
+    -182,  1494,  1494,  -182,  1095,     8,  -182,   -17,  1351,  -182,
+     848,    49,    52,    53,    56,    57,    58,  1351,  1351,  1351,
+    1351,    59,    74,    84,   -44,   -57,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  1140,  -182,  1609,   106,  1351,
+     936,    86,   -54,    89,  1636,  1271,    55,    90,    54,  -182,
+     150,    94,    95,  1663,   936,  -182,  -182,    96,    98,    99,
+    -182,  1690,  1717,  -182,  -182,   103,  -182,   104,  -182,   105,
+    1351,   110,  1351,  1351,  -182,  -182,  1744,   111,   114,   -70,
+     117,  -182,  1297,   108,   120,  -182,  -182,  1771,  1798,   123,
+     135,   136,   137,   147,   149,   151,   155,   157,   158,   159,
+     171,   172,   173,   174,   175,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   213,   214,   215,   217,   240,   241,
+     243,   244,   245,   248,   251,   252,   253,   254,   255,   256,
+     257,   262,   263,   276,   277,   278,   279,  -182,   280,  1825,
+     285,  -182,  -182,   116,  -182,   286,   268,   268,   268,  1056,
+     268,  -182,  -182,  -182,  1351,  1351,  1351,  1351,  1351,  1351,
+    1351,  1351,  1351,  1351,  1351,  1351,  1351,  1351,  1351,  1351,
+    1852,  -182,   287,   288,  -182,  1351,  1351,  1351,  1351,  1351,
+    1351,   290,  1351,  1351,  1351,  -182,  -182,   270,  1494,  1494,
+    1494,  1494,  1494,  1494,  1494,  1494,  1494,  1494,   164,  -182,
+     349,  -182,     7,   350,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  1351,  2419,  1351,  1351,  1351,  -182,  -182,  -182,   293,
+    -182,   -34,   -33,  -182,  -182,  1879,  -182,   295,   936,  1351,
+    1351,   936,  -182,   296,  -182,  -182,  -182,  -182,   698,   297,
+    -182,   329,  -182,  1906,  -182,  -182,  -182,  1933,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,   730,  -182,   773,   904,
+    -182,  -182,  -182,   305,  -182,  -182,  -182,  1960,  1325,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,   307,  -182,  -182,     9,     9,   268,   268,
+     268,   268,   624,   624,   624,   624,   624,   624,     9,     9,
+       9,  2419,  -182,  -182,  -182,  1987,  2014,  2041,  2068,  2095,
+    2122,  -182,  2149,  2176,  2203,  -182,  -182,  -182,    85,    85,
+      85,    85,  -182,  -182,  -182,   647,   308,   310,   382,  -182,
+     325,   326,   332,   344,   351,  -182,   352,  -182,   353,  -182,
+    -182,  -182,  2230,  1191,    36,  2257,  -182,  -182,  2284,  -182,
+     354,  -182,  -182,  -182,  2311,  -182,  2338,  -182,  2365,  -182,
+    -182,  -182,  2392,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,   408,  -182,  -182,  -182,   355,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,   356,  -182,  -182
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -874,87 +886,91 @@ static const yytype_int16 yypact[] =
      means the default is an error.  */
 static const yytype_uint16 yydefact[] =
 {
-      55,   269,   268,   270,   271,   272,    61,    62,    63,    64,
-      65,    66,   273,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    59,    60,     0,
+      58,   281,   280,   282,   283,   284,    64,    65,    66,    67,
+      68,    69,   285,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    62,    63,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   267,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   279,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   266,     0,     0,     0,
-     275,   276,   277,     0,     0,    56,     0,     0,     0,     0,
-       3,     0,   274,    39,    40,    41,    47,    45,    46,    38,
-      35,    36,    37,    42,    43,    44,    48,    49,    50,     4,
-       5,     6,     7,     8,    19,    20,     9,    10,    11,    12,
-      13,    14,    15,    16,    18,    17,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      51,    52,    53,    54,     0,   104,     0,     0,     0,   106,
-     110,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   134,   245,   244,   246,   247,   248,   249,   243,   242,
-     251,   252,   253,     0,   121,     0,     0,   250,     0,   267,
-     124,     0,     0,   129,     0,     0,     0,     0,     0,     0,
-       0,   154,   154,   154,   154,     0,     0,     0,     0,     0,
-     168,   157,   158,   159,   160,   161,   164,   163,   162,     0,
-     172,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   180,     0,     0,     0,     0,     0,    57,
-      58,     0,     0,     0,    79,     0,     0,    69,    70,     0,
-      83,     0,    85,     0,     0,     0,     0,     0,    89,    96,
-       0,     0,     0,     0,     0,    76,     0,     0,     0,   135,
-     102,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   278,     0,     0,     0,
+     287,   288,   289,     0,     0,     0,     0,     0,    59,     0,
+       0,     0,     0,     3,     0,   286,    42,    43,    44,    50,
+      48,    49,    41,    38,    39,    40,    45,    46,    47,    51,
+      52,    53,     4,     5,     6,     7,     8,     9,    10,    11,
+      22,    23,    12,    13,    14,    15,    16,    17,    18,    19,
+      21,    20,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    54,    55,    56,    57,
+       0,   107,     0,     0,     0,   109,   113,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   143,   257,   256,
+     258,   259,   260,   261,   255,   254,   263,   264,   265,     0,
+     130,     0,     0,   262,     0,   279,   133,     0,     0,   138,
+       0,     0,     0,     0,     0,     0,     0,   163,   163,   163,
+     163,     0,     0,     0,     0,     0,   177,   166,   167,   168,
+     169,   170,   173,   172,   171,     0,   181,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   189,
+       0,     0,     0,     0,     0,    60,    61,     0,     0,     0,
+      82,     0,     0,    72,    73,     0,    86,     0,    88,     0,
+       0,     0,     0,     0,    92,    99,     0,     0,     0,     0,
+       0,    79,     0,     0,     0,   144,   105,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   239,     0,
-       0,   295,   296,   294,     0,   297,     1,     2,   156,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   241,     0,     0,   107,
+       0,     0,     0,     0,     0,     0,     0,   251,     0,     0,
+       0,   114,   116,    60,   117,     0,   307,   308,   306,     0,
+     309,     1,     2,   165,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     264,   263,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   127,     0,   125,   296,     0,   130,
-     165,   166,   167,   145,   137,   138,   154,   155,   154,   154,
-     154,   144,   143,   146,     0,   147,     0,     0,   149,   170,
-       0,   171,     0,     0,     0,     0,     0,   176,     0,   177,
-     179,    78,   183,     0,     0,   186,     0,   181,     0,   189,
-     190,   191,     0,    80,    81,    82,    68,    67,    84,    86,
-      88,     0,    87,     0,     0,    97,    73,    72,     0,    74,
-      71,    98,     0,     0,   136,   103,    77,   194,   195,   196,
-     233,   203,   197,   198,   199,   200,   201,   202,   235,   193,
-     218,   219,   220,   221,   222,   225,   224,   223,   231,   210,
-     226,   227,   228,   232,   206,   207,   208,   209,   211,   213,
-     212,   204,   205,   214,   229,   230,   236,   215,   216,   234,
-     238,   237,   217,   240,   298,   283,   284,   290,   291,   292,
-     293,   279,   280,   285,   286,   289,   288,   281,   282,   287,
-     278,   105,   108,   109,     0,     0,     0,     0,     0,     0,
-     111,     0,     0,     0,   265,   258,   259,   254,   255,   260,
-     261,   256,   257,   262,     0,     0,     0,     0,   132,     0,
-       0,     0,     0,     0,   148,     0,   152,     0,   150,   169,
-     173,     0,   280,   281,     0,   178,   184,     0,   187,     0,
-     182,   192,    90,     0,    91,     0,    92,     0,    75,    99,
-     100,     0,   114,   113,   115,   116,   117,   112,   118,   119,
-     120,     0,   122,   128,   126,     0,   131,   139,   140,   141,
-     142,   153,   151,   174,   175,   185,   188,    93,    94,    95,
-     101,     0,   133,   123
+       0,   253,     0,     0,   110,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   276,   275,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   136,
+       0,   134,   308,     0,   139,   174,   175,   176,   154,   146,
+     147,   163,   164,   163,   163,   163,   153,   152,   155,     0,
+     156,     0,     0,   158,   179,     0,   180,     0,     0,     0,
+       0,     0,   185,     0,   186,   188,    81,   192,     0,     0,
+     195,     0,   190,     0,   198,   199,   200,     0,    83,    84,
+      85,    71,    70,    87,    89,    91,     0,    90,     0,     0,
+     100,    76,    75,     0,    77,    74,   101,     0,     0,   145,
+     106,    80,   203,   204,   205,   245,   215,   209,   210,   211,
+     212,   213,   214,   247,   202,   230,   231,   232,   233,   234,
+     237,   236,   235,   243,   222,   238,   239,   240,   244,   218,
+     219,   220,   221,   223,   225,   224,   216,   217,   226,   241,
+     242,   248,   227,   228,   246,   250,   249,   206,   207,   208,
+     229,   252,   115,     0,   118,   310,   295,   296,   302,   303,
+     304,   305,   291,   292,   297,   298,   301,   300,   293,   294,
+     299,   290,   108,   111,   112,     0,     0,     0,     0,     0,
+       0,   120,     0,     0,     0,   277,   270,   271,   266,   267,
+     272,   273,   268,   269,   274,     0,     0,     0,     0,   141,
+       0,     0,     0,     0,     0,   157,     0,   161,     0,   159,
+     178,   182,     0,   292,   293,     0,   187,   193,     0,   196,
+       0,   191,   201,    93,     0,    94,     0,    95,     0,    78,
+     102,   103,     0,   119,   123,   122,   124,   125,   126,   121,
+     127,   128,   129,     0,   131,   137,   135,     0,   140,   148,
+     149,   150,   151,   162,   160,   183,   184,   194,   197,    96,
+      97,    98,   104,     0,   142,   132
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -176,  -176,    33,   -45,   417,    -2,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -175,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,  -176,
-    -176,  -176,  -176,  -176,  -176,  -176,  -176,  -162,     0
+    -182,  -182,   402,   -45,   417,    -2,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -181,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,  -182,
+    -168,     0
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    79,    80,   221,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     366,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   168,   367
+      -1,    82,    83,   227,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   381,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     174,   382
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -962,482 +978,520 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     133,   340,   517,   341,   342,   222,   223,   368,   369,   370,
-     137,   248,   140,   376,   136,   150,   151,   167,   175,   241,
-     171,   174,   134,   233,   141,   142,   143,   144,   145,     6,
-       7,     8,     9,    10,    11,   353,   374,   201,   234,   525,
-     204,   527,   229,   208,   214,   176,   377,   217,   218,   215,
-     242,   206,   207,   225,   226,   231,   328,   388,   138,   190,
-     240,   177,   418,   219,   220,   251,   249,   252,   378,   300,
-     230,   243,   191,   301,   302,   235,   303,   304,   305,   133,
-     146,   216,   246,   232,   329,   389,   139,   419,   147,   202,
-     192,   375,   236,   237,   526,   193,   528,   194,   195,   196,
-     197,   198,   336,   203,   244,   205,   247,   518,   224,   324,
-     227,   228,   307,   250,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,   245,   135,   308,   238,
-     360,   148,   149,   327,   325,   330,   331,   332,   382,   333,
-     354,   311,   312,   313,   314,   324,   361,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,   423,
-     334,   167,   324,   167,   167,   394,   335,   337,   338,   515,
-     339,   396,   357,   362,   363,  -296,  -296,  -296,  -296,   364,
-     169,   505,   506,   507,   508,   509,   510,   511,   512,   513,
-     514,   520,   365,   521,   522,   523,   324,   371,   372,   380,
-     373,   387,   390,   383,   386,   395,   399,    66,   400,   393,
-     403,   404,   405,    46,   398,   408,   343,   344,   402,   409,
-      70,    71,    72,   410,    73,   345,   346,   347,   348,    74,
-     412,   349,   350,   351,   411,   170,   413,   414,    76,    77,
-      66,    78,   504,   416,   417,   420,   422,   309,   310,   311,
-     312,   313,   314,    70,    71,    72,   315,   384,   317,   318,
-     319,   320,   385,   322,   323,   424,   343,   344,   397,   355,
-     324,    76,    77,   427,    78,   345,   346,   347,   348,   428,
-     429,   349,   350,   351,   430,   431,   432,   516,   433,   352,
-     434,   435,   436,   437,   438,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,   439,   440,   475,
-     476,   477,   478,   479,   480,   481,   482,   483,   484,   485,
-     486,   487,   488,   489,   490,   441,   442,   443,   444,   445,
-     494,   495,   496,   497,   498,   499,   446,   501,   502,   503,
-     447,   167,   167,   167,   167,   167,   167,   167,   167,   167,
-     167,   448,   449,   309,   310,   311,   312,   313,   314,   450,
-     451,    46,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,   452,   453,   454,   356,   455,   324,   456,   457,   343,
-     344,   458,   459,   531,   532,   533,   534,   460,    66,   461,
-     462,   463,   464,   537,   349,   350,   351,   465,   466,   467,
-     519,    70,    71,    72,   468,    73,   469,   470,   471,   472,
-     172,   543,   492,   545,   547,   493,   173,   500,   524,    76,
-      77,   306,    78,   551,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,   530,   535,   538,    13,
-      14,    15,    16,    17,   539,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,   548,    29,    30,    31,
-      32,    33,   563,   564,   565,   566,   567,   568,   569,   570,
-     571,    34,    35,    36,    37,   572,   576,    38,    39,    40,
-     581,    41,   582,    42,   583,   299,    43,     0,    44,    45,
-      46,     0,    47,    48,    49,    50,    51,     0,     0,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,     0,     0,
-      61,    62,     0,    63,     0,    64,    65,    66,    67,    68,
-       0,    69,     0,     0,     0,     0,     0,     0,     0,     0,
-      70,    71,    72,     0,    73,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,     0,    75,     0,     0,    76,    77,
-       0,    78,     1,     2,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,     0,     0,     0,    13,    14,    15,
-      16,    17,     0,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,     0,    29,    30,    31,    32,    33,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    34,
-      35,    36,    37,     0,     0,    38,    39,    40,     0,    41,
-       0,    42,     0,     0,    43,     0,    44,    45,    46,     0,
-      47,    48,    49,    50,    51,     0,     0,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,     0,   358,    61,    62,
-       0,    63,     0,    64,    65,    66,    67,    68,     0,    69,
-       0,     0,     0,     0,     0,   561,     0,     0,    70,    71,
-      72,     0,    73,     0,     0,     0,     0,    74,     0,     0,
-       0,     0,     0,    75,     0,     0,    76,    77,     0,    78,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
+     139,   355,   370,   356,   357,   228,   229,   383,   384,   385,
+     247,   140,   391,   143,   142,   156,   254,   173,   221,   146,
+     177,   180,   313,   226,   235,   389,   538,   368,   237,   433,
+     315,   157,   310,   343,   181,   546,   548,   207,   212,   213,
+     210,   248,   403,   214,   220,   392,   182,   223,   224,   183,
+     222,   252,   196,   231,   232,   236,   197,   434,   198,   238,
+     246,   144,   249,   311,   344,   257,   199,   258,   200,   309,
+     393,   225,   226,   404,   255,   253,   316,   317,   201,   318,
+     319,   320,   139,   390,   202,   203,   324,   325,   326,   327,
+     328,   329,   145,   547,   549,   250,   204,   208,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   209,   351,   211,
+     371,   230,   339,   233,   326,   327,   328,   329,   234,   141,
+     251,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,   314,   539,   369,   339,   256,   339,   312,
+     340,  -308,  -308,  -308,  -308,   323,   342,   345,   346,   347,
+     348,   349,   350,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,   339,   239,   173,   352,   173,
+     173,   409,   205,   353,   354,   397,   375,   438,   372,   376,
+     377,   240,   411,   378,   379,   380,   386,    46,   358,   359,
+     526,   527,   528,   529,   530,   531,   532,   533,   534,   535,
+     541,   387,   542,   543,   544,   395,   364,   365,   366,   398,
+     401,   388,   493,   402,    66,   408,   405,   410,   241,    46,
+     413,   414,   415,   418,   417,   419,   420,    70,    71,    72,
+     423,   424,   425,   536,    76,   242,   243,   427,   431,    77,
+     426,   432,   428,   429,   435,   206,    66,   439,    79,    80,
+     442,    81,   437,   324,   325,   326,   327,   328,   329,    70,
+      71,    72,   443,   444,   445,   330,   399,   332,   333,   334,
+     335,   400,   337,   338,   446,   244,   447,   412,   448,   339,
+      79,    80,   449,    81,   450,   451,   452,   147,   148,   149,
+     150,   151,     6,     7,     8,     9,    10,    11,   453,   454,
+     455,   456,   457,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,   458,   459,   460,   461,   462,
+     463,   464,   465,   466,   496,   497,   498,   499,   500,   501,
+     502,   503,   504,   505,   506,   507,   508,   509,   510,   511,
+     467,   468,   469,   152,   470,   515,   516,   517,   518,   519,
+     520,   153,   522,   523,   524,   215,   173,   173,   173,   173,
+     173,   173,   173,   173,   173,   173,   216,   471,   472,    46,
+     473,   474,   475,   358,   359,   476,   217,   218,   477,   478,
+     479,   480,   481,   482,   483,   360,   361,   362,   363,   484,
+     485,   364,   365,   366,   154,   155,    66,   339,   552,   553,
+     554,   555,   525,   486,   487,   488,   489,   490,   558,    70,
+      71,    72,   492,   494,   513,   514,    76,   521,   537,   540,
+     545,    77,   551,   556,   559,   560,   564,   219,   566,   568,
+      79,    80,   569,    81,   573,   585,   321,   586,   572,     1,
        2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   343,
-     344,     0,   359,     0,   324,     0,    46,     0,   345,   346,
-     347,   348,     0,     0,   349,   350,   351,     0,     0,     0,
-     562,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    66,     0,    46,     0,     0,     0,     0,
-     309,   310,   311,   312,   313,   314,    70,    71,    72,   315,
-     384,   317,   318,   319,   320,   385,   322,   323,     0,     0,
-       0,   536,    66,   324,    76,    77,     0,    78,     0,   309,
-     310,   311,   312,   313,   314,    70,    71,    72,   315,   384,
-     317,   318,   319,   320,   385,   322,   323,    46,     0,     0,
-     542,     0,   324,    76,    77,     0,    78,     1,     2,     3,
+      12,   587,   588,   589,    13,    14,    15,    16,    17,   590,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,   591,    29,    30,    31,    32,    33,   603,   592,   593,
+     594,   598,   604,   605,   322,   308,    34,    35,    36,    37,
+       0,     0,    38,    39,    40,     0,    41,     0,    42,     0,
+       0,    43,     0,    44,    45,    46,     0,    47,    48,    49,
+      50,    51,     0,     0,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,     0,     0,    61,    62,     0,    63,     0,
+      64,    65,    66,    67,    68,     0,    69,     0,     0,     0,
+       0,     0,     0,     0,     0,    70,    71,    72,    73,    74,
+      75,     0,    76,     0,     0,     0,     0,    77,     0,     0,
+       0,     0,     0,    78,     0,     0,    79,    80,     0,    81,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,     0,     0,     0,    13,    14,    15,    16,    17,
+       0,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,     0,    29,    30,    31,    32,    33,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    34,    35,    36,
+      37,     0,     0,    38,    39,    40,     0,    41,     0,    42,
+       0,     0,    43,     0,    44,    45,    46,     0,    47,    48,
+      49,    50,    51,     0,     0,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,     0,     0,    61,    62,     0,    63,
+       0,    64,    65,    66,    67,    68,   583,    69,     0,     0,
+       0,     0,     0,     0,     0,     0,    70,    71,    72,    73,
+      74,    75,     0,    76,     0,     0,     0,     0,    77,     0,
+       0,     0,     0,     0,    78,     0,     0,    79,    80,     0,
+      81,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   324,   325,   326,
+     327,   328,   329,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,   336,   337,   338,     0,     0,
+     358,   359,     0,   339,     0,     0,     0,     0,     0,     0,
+       0,     0,   360,   361,   362,   363,     0,    46,   364,   365,
+     366,     0,     0,     0,   584,     0,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,     0,     0,
+       0,     0,     0,     0,    66,     0,     0,     0,     0,    46,
+       0,   324,   325,   326,   327,   328,   329,    70,    71,    72,
+       0,     0,     0,   330,   399,   332,   333,   334,   335,   400,
+     337,   338,     0,     0,     0,   557,    66,   339,    79,    80,
+       0,    81,     0,   324,   325,   326,   327,   328,   329,    70,
+      71,    72,    46,     0,     0,   330,   399,   332,   333,   334,
+     335,   400,   337,   338,     0,     0,     0,   563,     0,   339,
+      79,    80,     0,    81,     0,     0,     0,   373,     0,    66,
+       0,     0,     0,     0,     0,     0,   324,   325,   326,   327,
+     328,   329,    70,    71,    72,     0,     0,     0,   330,   399,
+     332,   333,   334,   335,   400,   337,   338,     0,     0,     0,
+     565,     0,   339,    79,    80,     0,    81,     1,     2,     3,
        4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
-       0,     0,     0,     0,    66,     0,     0,     0,     0,     0,
-       0,   309,   310,   311,   312,   313,   314,    70,    71,    72,
-     315,   384,   317,   318,   319,   320,   385,   322,   323,     0,
-       0,     0,   544,     0,   324,    76,    77,     0,    78,     1,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
        2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,     0,     0,    46,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,     0,     0,     0,     0,
-      66,     0,     0,     0,     0,     0,     0,   309,   310,   311,
-     312,   313,   314,    70,    71,    72,   315,   384,   317,   318,
-     319,   320,   385,   322,   323,    46,     0,     0,   546,     0,
-     324,    76,    77,     0,    78,     0,   209,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   210,     0,     0,
-      46,     0,    66,     0,     0,     0,     0,   211,   212,   309,
-     310,   311,   312,   313,   314,    70,    71,    72,   315,   384,
-     317,   318,   319,   320,   385,   322,   323,    66,     0,     0,
-       0,     0,   324,    76,    77,     0,    78,     0,     0,     0,
-      70,    71,    72,     0,    73,     0,     0,     0,     0,    74,
-       0,     0,     0,     0,     0,   213,     0,     0,    76,    77,
-       0,    78,     1,     2,     3,     4,     5,     6,     7,     8,
+      12,   324,   325,   326,   327,   328,   329,     0,     0,     0,
+       0,     0,     0,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,     0,    46,     0,   374,     0,   339,     0,     0,
+       0,     0,     1,     2,     3,     4,     5,     6,     7,     8,
        9,    10,    11,    12,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,     0,     0,     0,
+      66,     0,     0,     0,     0,    46,     0,   324,   325,   326,
+     327,   328,   329,    70,    71,    72,     0,     0,     0,   330,
+     399,   332,   333,   334,   335,   400,   337,   338,     0,     0,
+       0,   567,    66,   339,    79,    80,     0,    81,     0,   324,
+     325,   326,   327,   328,   329,    70,    71,    72,   175,     0,
+       0,   330,   399,   332,   333,   334,   335,   400,   337,   338,
+       0,     0,     0,     0,     0,   339,    79,    80,     0,    81,
+       0,     0,     0,     0,     0,    66,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    70,    71,
+      72,     0,     0,     0,     0,    76,     0,     0,     0,     0,
+      77,     0,     0,     0,     0,     0,   176,     0,     0,    79,
+      80,     0,    81,     0,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   199,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,     0,     0,    46,     0,
-       0,     0,     0,     0,     0,     0,     0,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
-       0,    46,     0,     0,     0,    66,     0,     0,   309,   310,
-     311,   312,   313,   314,     0,     0,     0,     0,    70,    71,
-      72,     0,    73,   321,   322,   323,     0,    74,    66,     0,
-      46,   324,     0,   200,     0,     0,    76,    77,     0,    78,
-       0,    70,    71,    72,     0,    73,     0,     0,     0,     0,
-      74,     0,     0,    46,     0,     0,   239,    66,     0,    76,
-      77,     0,    78,     0,     0,     0,     0,     0,     0,     0,
-      70,    71,    72,     0,    73,     0,     0,     0,     0,    74,
-      66,     0,     0,     0,     0,   379,     0,     0,    76,    77,
-       0,    78,     0,    70,    71,    72,     0,    73,     0,     0,
-       0,     0,    74,     0,     0,     0,     0,     0,   392,     0,
-       0,    76,    77,     0,    78,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     1,     2,
+       0,     0,    46,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,     0,     0,     0,     0,   324,
+     325,   326,   327,   328,   329,     0,     0,     0,     0,    66,
+       0,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+      46,     0,    70,    71,    72,   339,     0,     0,   495,    76,
+       0,     0,     0,     0,   178,     0,     0,     0,   358,   359,
+     179,     0,     0,    79,    80,     0,    81,    66,     0,    46,
+     360,   361,   362,   363,     0,     0,   364,   365,   366,     0,
+      70,    71,    72,     0,   367,     0,     0,    76,     0,     0,
+       0,     0,    77,     0,     0,     0,    66,     0,   245,     0,
+       0,    79,    80,     0,    81,     0,     0,     0,     0,    70,
+      71,    72,     0,     0,     0,     0,    76,     0,     0,     0,
+       0,    77,     0,     0,     0,     0,     0,   394,     0,     0,
+      79,    80,     0,    81,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,     0,     0,     0,     0,
+       0,     0,     0,     0,  -307,  -307,  -307,  -307,  -307,  -307,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,  -307,  -307,  -307,     0,     0,     0,     0,     0,
+     339,     0,     0,     0,     0,     0,     0,     0,     1,     2,
        3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    46,    66,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,     0,     0,     0,     0,     0,     0,     0,
-       0,    46,     0,     0,   152,   153,   154,   155,   156,     6,
-       7,     8,     9,    10,    11,   157,     0,     0,     0,     0,
-       0,     0,     0,     0,    46,     0,     0,     0,    66,   152,
-     153,   154,   155,   156,     6,     7,     8,     9,    10,    11,
-     157,    70,    71,    72,     0,    73,     0,    46,     0,     0,
-      74,    66,     0,     0,     0,     0,   421,     0,     0,    76,
-      77,     0,    78,     0,    70,    71,    72,     0,    73,     0,
-     158,     0,     0,    74,    66,     0,     0,     0,     0,   550,
-       0,     0,    76,    77,     0,    78,     0,    70,    71,    72,
-       0,    73,     0,     0,     0,   158,    74,   159,     0,     0,
-       0,     0,     0,     0,     0,    76,    77,     0,    78,     0,
-     160,   161,   162,     0,   163,  -295,  -295,  -295,  -295,  -295,
-    -295,     0,   159,     0,     0,   164,     0,     0,   165,   166,
-    -295,  -295,  -295,     0,     0,   160,   161,   162,   324,   163,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   165,   166,   253,     0,   254,   255,   256,
-       0,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-      27,    28,     0,   266,   267,   268,   269,   270,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   271,   272,   273,
-     274,     0,     0,   275,   276,   277,     0,     0,     0,     0,
-       0,     0,     0,     0,   278,   279,     0,     0,     0,   280,
-     281,   282,   283,   178,     0,   284,   285,   286,   287,   288,
-     289,     0,   290,   291,     0,   179,   292,   293,     0,   294,
-       0,     0,     0,   180,   295,   296,     0,   297,     0,     0,
-     181,   182,   183,   184,   185,   186,     0,   187,     0,     0,
-       0,     0,     0,   309,   310,   311,   312,   313,   314,     0,
-       0,   298,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,     0,     0,   324,     0,     0,   474,
-       0,   309,   310,   311,   312,   313,   314,     0,     0,   188,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   189,
-       0,     0,   326,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   381,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     391,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   401,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   406,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   407,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   415,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     425,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   426,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   473,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   491,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   529,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     540,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   541,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   549,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   552,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   553,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     554,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   555,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   556,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   557,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   558,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     559,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   560,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   573,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   574,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,   575,     0,   324,   309,
-     310,   311,   312,   313,   314,     0,     0,     0,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,     0,     0,     0,
-     577,     0,   324,   309,   310,   311,   312,   313,   314,     0,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,     0,     0,     0,   578,     0,   324,   309,   310,   311,
-     312,   313,   314,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,     0,     0,     0,   579,     0,
-     324,   309,   310,   311,   312,   313,   314,     0,     0,     0,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,     0,
-       0,     0,   580,     0,   324,   309,   310,   311,   312,   313,
-     314,     0,     0,     0,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,     0,     0,     0,     0,     0,   324
+      70,    71,    72,     0,     0,     0,     0,    76,     0,     0,
+       0,     0,    77,    66,    46,     0,     0,     0,   407,     0,
+       0,    79,    80,     0,    81,     0,    70,    71,    72,     0,
+       0,     0,     0,    76,     0,     0,     0,     0,    77,     0,
+      46,    66,     0,     0,   436,     0,     0,    79,    80,     0,
+      81,     0,     0,     0,    70,    71,    72,     0,     0,     0,
+       0,    76,     0,     0,     0,     0,    77,    66,     0,     0,
+       0,     0,   571,     0,     0,    79,    80,     0,    81,     0,
+      70,    71,    72,     0,     0,     0,     0,    76,     0,     0,
+       0,     0,    77,     0,     0,     0,     0,     0,     0,     0,
+       0,    79,    80,     0,    81,   158,   159,   160,   161,   162,
+       6,     7,     8,     9,    10,    11,   163,   158,   159,   160,
+     161,   162,     6,     7,     8,     9,    10,    11,   163,     0,
+     184,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   185,     0,     0,     0,     0,     0,     0,     0,
+     186,     0,     0,     0,     0,     0,     0,   187,   188,   189,
+     190,   191,   192,     0,   193,     0,     0,     0,     0,     0,
+       0,   164,     0,   324,   325,   326,   327,   328,   329,     0,
+       0,     0,     0,   164,     0,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,     0,     0,     0,   341,   165,   339,
+       0,     0,     0,     0,     0,     0,   194,     0,     0,     0,
+     165,   166,   167,   168,     0,     0,   195,     0,   169,     0,
+       0,     0,     0,   166,   167,   168,     0,     0,     0,   170,
+     169,     0,   171,   172,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   171,   172,   259,     0,   260,   261,
+     262,     0,   263,   264,   265,   266,   267,   268,   269,   270,
+     271,    27,    28,     0,   272,   273,   274,   275,   276,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   277,   278,
+     279,   280,     0,     0,   281,   282,   283,     0,     0,     0,
+       0,     0,     0,     0,     0,   284,   285,     0,     0,     0,
+     286,   287,   288,   289,     0,     0,   290,   291,   292,   293,
+     294,   295,     0,   296,   297,     0,     0,   298,   299,     0,
+     300,     0,     0,     0,     0,   301,   302,     0,   303,     0,
+       0,     0,   324,   325,   326,   327,   328,   329,     0,     0,
+     304,   305,   306,     0,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,     0,     0,   307,   396,     0,   339,   324,
+     325,   326,   327,   328,   329,     0,     0,     0,     0,     0,
+       0,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+       0,     0,     0,   406,     0,   339,   324,   325,   326,   327,
+     328,   329,     0,     0,     0,     0,     0,     0,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,     0,     0,     0,
+     416,     0,   339,   324,   325,   326,   327,   328,   329,     0,
+       0,     0,     0,     0,     0,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,     0,     0,     0,   421,     0,   339,
+     324,   325,   326,   327,   328,   329,     0,     0,     0,     0,
+       0,     0,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,     0,     0,     0,   422,     0,   339,   324,   325,   326,
+     327,   328,   329,     0,     0,     0,     0,     0,     0,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,     0,     0,
+       0,   430,     0,   339,   324,   325,   326,   327,   328,   329,
+       0,     0,     0,     0,     0,     0,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,     0,     0,     0,   440,     0,
+     339,   324,   325,   326,   327,   328,   329,     0,     0,     0,
+       0,     0,     0,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,     0,     0,     0,   441,     0,   339,   324,   325,
+     326,   327,   328,   329,     0,     0,     0,     0,     0,     0,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,     0,
+       0,     0,   491,     0,   339,   324,   325,   326,   327,   328,
+     329,     0,     0,     0,     0,     0,     0,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,     0,     0,     0,   512,
+       0,   339,   324,   325,   326,   327,   328,   329,     0,     0,
+       0,     0,     0,     0,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,     0,     0,     0,   550,     0,   339,   324,
+     325,   326,   327,   328,   329,     0,     0,     0,     0,     0,
+       0,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+       0,     0,     0,   561,     0,   339,   324,   325,   326,   327,
+     328,   329,     0,     0,     0,     0,     0,     0,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,     0,     0,     0,
+     562,     0,   339,   324,   325,   326,   327,   328,   329,     0,
+       0,     0,     0,     0,     0,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,     0,     0,     0,   570,     0,   339,
+     324,   325,   326,   327,   328,   329,     0,     0,     0,     0,
+       0,     0,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,     0,     0,     0,   574,     0,   339,   324,   325,   326,
+     327,   328,   329,     0,     0,     0,     0,     0,     0,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,     0,     0,
+       0,   575,     0,   339,   324,   325,   326,   327,   328,   329,
+       0,     0,     0,     0,     0,     0,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,     0,     0,     0,   576,     0,
+     339,   324,   325,   326,   327,   328,   329,     0,     0,     0,
+       0,     0,     0,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,     0,     0,     0,   577,     0,   339,   324,   325,
+     326,   327,   328,   329,     0,     0,     0,     0,     0,     0,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,     0,
+       0,     0,   578,     0,   339,   324,   325,   326,   327,   328,
+     329,     0,     0,     0,     0,     0,     0,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,     0,     0,     0,   579,
+       0,   339,   324,   325,   326,   327,   328,   329,     0,     0,
+       0,     0,     0,     0,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,     0,     0,     0,   580,     0,   339,   324,
+     325,   326,   327,   328,   329,     0,     0,     0,     0,     0,
+       0,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+       0,     0,     0,   581,     0,   339,   324,   325,   326,   327,
+     328,   329,     0,     0,     0,     0,     0,     0,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,     0,     0,     0,
+     582,     0,   339,   324,   325,   326,   327,   328,   329,     0,
+       0,     0,     0,     0,     0,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,     0,     0,     0,   595,     0,   339,
+     324,   325,   326,   327,   328,   329,     0,     0,     0,     0,
+       0,     0,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,     0,     0,     0,   596,     0,   339,   324,   325,   326,
+     327,   328,   329,     0,     0,     0,     0,     0,     0,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,     0,     0,
+       0,   597,     0,   339,   324,   325,   326,   327,   328,   329,
+       0,     0,     0,     0,     0,     0,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,     0,     0,     0,   599,     0,
+     339,   324,   325,   326,   327,   328,   329,     0,     0,     0,
+       0,     0,     0,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,     0,     0,     0,   600,     0,   339,   324,   325,
+     326,   327,   328,   329,     0,     0,     0,     0,     0,     0,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,     0,
+       0,     0,   601,     0,   339,   324,   325,   326,   327,   328,
+     329,     0,     0,     0,     0,     0,     0,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,     0,     0,     0,   602,
+       0,   339,   324,   325,   326,   327,   328,   329,     0,     0,
+       0,     0,     0,     0,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,     0,     0,     0,     0,     0,   339
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,   163,    19,   165,   166,    50,    51,   182,   183,   184,
-      48,    69,   124,    69,    14,    17,   124,    19,    96,    17,
-      20,    21,    19,    18,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    19,    69,    37,    33,    69,
-      40,    69,    96,    43,    44,    96,   102,    47,    48,    70,
-      48,    63,    64,    53,    54,    96,    96,    96,    96,   124,
-      60,    96,    99,    16,    17,    65,   124,    67,   124,    69,
-     124,    69,   124,    73,    74,    70,    76,    77,    78,    79,
-      59,   102,    69,   124,   124,   124,   124,   124,    67,    69,
-     124,   124,    87,    88,   124,   124,   124,   124,   124,   124,
-     124,   124,   147,    69,   102,    61,    93,   124,   124,   126,
-     124,   124,    79,   124,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,   124,   124,   124,   124,
-     124,   110,   111,    96,   134,   125,   125,   125,    69,   125,
-     124,   105,   106,   107,   108,   126,   124,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,    69,
-     125,   163,   126,   165,   166,   210,   125,   125,   125,    69,
-     125,   125,   172,   124,   124,   105,   106,   107,   108,   124,
-      69,   343,   344,   345,   346,   347,   348,   349,   350,   351,
-     352,   366,   124,   368,   369,   370,   126,   124,   124,   199,
-     124,   124,   124,   203,   204,   124,   124,    96,   124,   209,
-     124,   124,   124,    69,   214,   124,   103,   104,   218,   124,
-     109,   110,   111,   124,   113,   112,   113,   114,   115,   118,
-     124,   118,   119,   120,   234,   124,   236,   237,   127,   128,
-      96,   130,   129,   124,   124,   124,   246,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   124,   103,   104,   124,    19,
-     126,   127,   128,   124,   130,   112,   113,   114,   115,   124,
-     124,   118,   119,   120,   124,   124,   124,    69,   124,   126,
-     124,   124,   124,   124,   124,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,   124,   124,   309,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   124,   124,   124,   124,   124,
-     330,   331,   332,   333,   334,   335,   124,   337,   338,   339,
-     124,   343,   344,   345,   346,   347,   348,   349,   350,   351,
-     352,   124,   124,   103,   104,   105,   106,   107,   108,   124,
-     124,    69,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,   124,   124,   124,   124,   124,   126,   124,   124,   103,
-     104,   124,   124,   383,   384,   385,   386,   124,    96,   124,
-     124,   124,   124,   393,   118,   119,   120,   124,   124,   124,
-      69,   109,   110,   111,   124,   113,   124,   124,   124,   124,
-     118,   411,   124,   413,   414,   124,   124,   124,   124,   127,
-     128,     0,   130,   423,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,   124,   124,   124,    18,
-      19,    20,    21,    22,    96,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,   124,    36,    37,    38,
-      39,    40,   124,   124,    69,   124,   124,   124,   124,   124,
-     124,    50,    51,    52,    53,   124,   124,    56,    57,    58,
-      69,    60,   124,    62,   124,    68,    65,    -1,    67,    68,
-      69,    -1,    71,    72,    73,    74,    75,    -1,    -1,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    -1,    -1,
-      89,    90,    -1,    92,    -1,    94,    95,    96,    97,    98,
-      -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,   118,
-      -1,    -1,    -1,    -1,    -1,   124,    -1,    -1,   127,   128,
-      -1,   130,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    -1,    -1,    -1,    18,    19,    20,
-      21,    22,    -1,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    -1,    36,    37,    38,    39,    40,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,
-      51,    52,    53,    -1,    -1,    56,    57,    58,    -1,    60,
-      -1,    62,    -1,    -1,    65,    -1,    67,    68,    69,    -1,
-      71,    72,    73,    74,    75,    -1,    -1,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    -1,    19,    89,    90,
-      -1,    92,    -1,    94,    95,    96,    97,    98,    -1,   100,
-      -1,    -1,    -1,    -1,    -1,    19,    -1,    -1,   109,   110,
-     111,    -1,   113,    -1,    -1,    -1,    -1,   118,    -1,    -1,
-      -1,    -1,    -1,   124,    -1,    -1,   127,   128,    -1,   130,
+       0,   169,    19,   171,   172,    50,    51,   188,   189,   190,
+      17,    19,    69,    48,    14,    17,    69,    19,    70,   127,
+      20,    21,    16,    17,    96,    69,    19,    19,    96,    99,
+      75,   127,    96,    96,    96,    69,    69,    37,    63,    64,
+      40,    48,    96,    43,    44,   102,    96,    47,    48,    96,
+     102,    69,   127,    53,    54,   127,   127,   127,   127,   127,
+      60,    96,    69,   127,   127,    65,   127,    67,   127,    69,
+     127,    16,    17,   127,   127,    93,    76,    77,   127,    79,
+      80,    81,    82,   127,   127,   127,   103,   104,   105,   106,
+     107,   108,   127,   127,   127,   102,   127,    69,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    69,   153,    61,
+     127,   127,   129,   127,   105,   106,   107,   108,   127,   127,
+     127,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,   127,   127,   127,   129,   127,   129,   127,
+     140,   105,   106,   107,   108,   127,    96,   128,   128,   128,
+     128,   128,   128,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   129,    18,   169,   128,   171,
+     172,   216,    54,   128,   128,    69,   127,    69,   178,   127,
+     127,    33,   128,   127,   127,   127,   127,    69,   103,   104,
+     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
+     381,   127,   383,   384,   385,   205,   121,   122,   123,   209,
+     210,   127,    96,   127,    96,   215,   127,   127,    70,    69,
+     220,   127,   127,   127,   224,   127,   127,   109,   110,   111,
+     127,   127,   127,    69,   116,    87,    88,   127,   127,   121,
+     240,   127,   242,   243,   127,   127,    96,   127,   130,   131,
+     127,   133,   252,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   127,   127,   127,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   127,   127,   127,   127,   127,   129,
+     130,   131,   127,   133,   127,   127,   127,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,   127,   127,
+     127,   127,   127,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     127,   127,   127,    59,   127,   345,   346,   347,   348,   349,
+     350,    67,   352,   353,   354,    55,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,    66,   127,   127,    69,
+     127,   127,   127,   103,   104,   127,    76,    77,   127,   127,
+     127,   127,   127,   127,   127,   115,   116,   117,   118,   127,
+     127,   121,   122,   123,   110,   111,    96,   129,   398,   399,
+     400,   401,   132,   127,   127,   127,   127,   127,   408,   109,
+     110,   111,   127,   127,   127,   127,   116,   127,    69,    69,
+     127,   121,   127,   127,   127,    96,   426,   127,   428,   429,
+     130,   131,   127,   133,   127,   127,     0,   127,   438,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    69,   127,   127,    18,    19,    20,    21,    22,   127,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,   127,    36,    37,    38,    39,    40,    69,   127,   127,
+     127,   127,   127,   127,    82,    68,    50,    51,    52,    53,
+      -1,    -1,    56,    57,    58,    -1,    60,    -1,    62,    -1,
+      -1,    65,    -1,    67,    68,    69,    -1,    71,    72,    73,
+      74,    75,    -1,    -1,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    -1,    -1,    89,    90,    -1,    92,    -1,
+      94,    95,    96,    97,    98,    -1,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   109,   110,   111,   112,   113,
+     114,    -1,   116,    -1,    -1,    -1,    -1,   121,    -1,    -1,
+      -1,    -1,    -1,   127,    -1,    -1,   130,   131,    -1,   133,
        3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      13,    14,    -1,    -1,    -1,    18,    19,    20,    21,    22,
+      -1,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    -1,    36,    37,    38,    39,    40,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    52,
+      53,    -1,    -1,    56,    57,    58,    -1,    60,    -1,    62,
+      -1,    -1,    65,    -1,    67,    68,    69,    -1,    71,    72,
+      73,    74,    75,    -1,    -1,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    -1,    -1,    89,    90,    -1,    92,
+      -1,    94,    95,    96,    97,    98,    19,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,   110,   111,   112,
+     113,   114,    -1,   116,    -1,    -1,    -1,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,    -1,   130,   131,    -1,
+     133,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   103,   104,   105,
+     106,   107,   108,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   121,   122,   123,    -1,    -1,
+     103,   104,    -1,   129,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,    -1,    69,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    96,    -1,    -1,    -1,    -1,    69,
+      -1,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,    -1,    -1,    -1,   127,    96,   129,   130,   131,
+      -1,   133,    -1,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,    69,    -1,    -1,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,
+     130,   131,    -1,   133,    -1,    -1,    -1,    19,    -1,    96,
+      -1,    -1,    -1,    -1,    -1,    -1,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,    -1,    -1,    -1,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,    -1,    -1,
+     127,    -1,   129,   130,   131,    -1,   133,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
        4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
       14,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,   103,
-     104,    -1,   124,    -1,   126,    -1,    69,    -1,   112,   113,
-     114,   115,    -1,    -1,   118,   119,   120,    -1,    -1,    -1,
-     124,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    96,    -1,    69,    -1,    -1,    -1,    -1,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,    -1,    -1,
-      -1,   124,    96,   126,   127,   128,    -1,   130,    -1,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    69,    -1,    -1,
-     124,    -1,   126,   127,   128,    -1,   130,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
-      -1,    -1,    -1,    -1,    96,    -1,    -1,    -1,    -1,    -1,
-      -1,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   127,   128,    -1,   130,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    -1,    -1,    69,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
-      96,    -1,    -1,    -1,    -1,    -1,    -1,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    69,    -1,    -1,   124,    -1,
-     126,   127,   128,    -1,   130,    -1,    55,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    66,    -1,    -1,
-      69,    -1,    96,    -1,    -1,    -1,    -1,    76,    77,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    96,    -1,    -1,
-      -1,    -1,   126,   127,   128,    -1,   130,    -1,    -1,    -1,
-     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,   118,
-      -1,    -1,    -1,    -1,    -1,   124,    -1,    -1,   127,   128,
-      -1,   130,     3,     4,     5,     6,     7,     8,     9,    10,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,    -1,    69,    -1,   127,    -1,   129,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,     7,     8,     9,    10,
       11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    54,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    -1,    -1,    69,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
-      -1,    69,    -1,    -1,    -1,    96,    -1,    -1,   103,   104,
-     105,   106,   107,   108,    -1,    -1,    -1,    -1,   109,   110,
-     111,    -1,   113,   118,   119,   120,    -1,   118,    96,    -1,
-      69,   126,    -1,   124,    -1,    -1,   127,   128,    -1,   130,
-      -1,   109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,
-     118,    -1,    -1,    69,    -1,    -1,   124,    96,    -1,   127,
-     128,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     109,   110,   111,    -1,   113,    -1,    -1,    -1,    -1,   118,
-      96,    -1,    -1,    -1,    -1,   124,    -1,    -1,   127,   128,
-      -1,   130,    -1,   109,   110,   111,    -1,   113,    -1,    -1,
-      -1,    -1,   118,    -1,    -1,    -1,    -1,    -1,   124,    -1,
-      -1,   127,   128,    -1,   130,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      96,    -1,    -1,    -1,    -1,    69,    -1,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,    -1,    -1,    -1,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    -1,    -1,
+      -1,   127,    96,   129,   130,   131,    -1,   133,    -1,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,    69,    -1,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      -1,    -1,    -1,    -1,    -1,   129,   130,   131,    -1,   133,
+      -1,    -1,    -1,    -1,    -1,    96,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,   109,   110,
+     111,    -1,    -1,    -1,    -1,   116,    -1,    -1,    -1,    -1,
+     121,    -1,    -1,    -1,    -1,    -1,   127,    -1,    -1,   130,
+     131,    -1,   133,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    69,    -1,    -1,     3,     4,     5,     6,     7,     8,
+      -1,    -1,    69,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,   103,
+     104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,    96,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      69,    -1,   109,   110,   111,   129,    -1,    -1,   132,   116,
+      -1,    -1,    -1,    -1,   121,    -1,    -1,    -1,   103,   104,
+     127,    -1,    -1,   130,   131,    -1,   133,    96,    -1,    69,
+     115,   116,   117,   118,    -1,    -1,   121,   122,   123,    -1,
+     109,   110,   111,    -1,   129,    -1,    -1,   116,    -1,    -1,
+      -1,    -1,   121,    -1,    -1,    -1,    96,    -1,   127,    -1,
+      -1,   130,   131,    -1,   133,    -1,    -1,    -1,    -1,   109,
+     110,   111,    -1,    -1,    -1,    -1,   116,    -1,    -1,    -1,
+      -1,   121,    -1,    -1,    -1,    -1,    -1,   127,    -1,    -1,
+     130,   131,    -1,   133,     3,     4,     5,     6,     7,     8,
        9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    69,    -1,    -1,    -1,    96,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,   109,   110,   111,    -1,   113,    -1,    69,    -1,    -1,
-     118,    96,    -1,    -1,    -1,    -1,   124,    -1,    -1,   127,
-     128,    -1,   130,    -1,   109,   110,   111,    -1,   113,    -1,
-      69,    -1,    -1,   118,    96,    -1,    -1,    -1,    -1,   124,
-      -1,    -1,   127,   128,    -1,   130,    -1,   109,   110,   111,
-      -1,   113,    -1,    -1,    -1,    69,   118,    96,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   127,   128,    -1,   130,    -1,
-     109,   110,   111,    -1,   113,   103,   104,   105,   106,   107,
-     108,    -1,    96,    -1,    -1,   124,    -1,    -1,   127,   128,
-     118,   119,   120,    -1,    -1,   109,   110,   111,   126,   113,
+      -1,    -1,    -1,    -1,   103,   104,   105,   106,   107,   108,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,   121,   122,   123,    -1,    -1,    -1,    -1,    -1,
+     129,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    69,    96,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   127,   128,    18,    -1,    20,    21,    22,
-      -1,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    -1,    36,    37,    38,    39,    40,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    52,
-      53,    -1,    -1,    56,    57,    58,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    -1,    72,
-      73,    74,    75,    15,    -1,    78,    79,    80,    81,    82,
-      83,    -1,    85,    86,    -1,    27,    89,    90,    -1,    92,
-      -1,    -1,    -1,    35,    97,    98,    -1,   100,    -1,    -1,
-      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
-      -1,    -1,    -1,   103,   104,   105,   106,   107,   108,    -1,
-      -1,   124,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,    -1,    -1,   126,    -1,    -1,   129,
-      -1,   103,   104,   105,   106,   107,   108,    -1,    -1,    91,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,   101,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,   124,    -1,   126,   103,
-     104,   105,   106,   107,   108,    -1,    -1,    -1,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,    -1,    -1,    -1,
-     124,    -1,   126,   103,   104,   105,   106,   107,   108,    -1,
-      -1,    -1,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,    -1,    -1,    -1,   124,    -1,   126,   103,   104,   105,
-     106,   107,   108,    -1,    -1,    -1,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,    -1,    -1,    -1,   124,    -1,
-     126,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,    -1,
-      -1,    -1,   124,    -1,   126,   103,   104,   105,   106,   107,
-     108,    -1,    -1,    -1,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,    -1,    -1,    -1,    -1,    -1,   126
+     109,   110,   111,    -1,    -1,    -1,    -1,   116,    -1,    -1,
+      -1,    -1,   121,    96,    69,    -1,    -1,    -1,   127,    -1,
+      -1,   130,   131,    -1,   133,    -1,   109,   110,   111,    -1,
+      -1,    -1,    -1,   116,    -1,    -1,    -1,    -1,   121,    -1,
+      69,    96,    -1,    -1,   127,    -1,    -1,   130,   131,    -1,
+     133,    -1,    -1,    -1,   109,   110,   111,    -1,    -1,    -1,
+      -1,   116,    -1,    -1,    -1,    -1,   121,    96,    -1,    -1,
+      -1,    -1,   127,    -1,    -1,   130,   131,    -1,   133,    -1,
+     109,   110,   111,    -1,    -1,    -1,    -1,   116,    -1,    -1,
+      -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   130,   131,    -1,   133,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      35,    -1,    -1,    -1,    -1,    -1,    -1,    42,    43,    44,
+      45,    46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,   103,   104,   105,   106,   107,   108,    -1,
+      -1,    -1,    -1,    69,    -1,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,    -1,    -1,    -1,   127,    96,   129,
+      -1,    -1,    -1,    -1,    -1,    -1,    91,    -1,    -1,    -1,
+      96,   109,   110,   111,    -1,    -1,   101,    -1,   116,    -1,
+      -1,    -1,    -1,   109,   110,   111,    -1,    -1,    -1,   127,
+     116,    -1,   130,   131,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   130,   131,    18,    -1,    20,    21,
+      22,    -1,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    -1,    36,    37,    38,    39,    40,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,
+      52,    53,    -1,    -1,    56,    57,    58,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    67,    68,    -1,    -1,    -1,
+      72,    73,    74,    75,    -1,    -1,    78,    79,    80,    81,
+      82,    83,    -1,    85,    86,    -1,    -1,    89,    90,    -1,
+      92,    -1,    -1,    -1,    -1,    97,    98,    -1,   100,    -1,
+      -1,    -1,   103,   104,   105,   106,   107,   108,    -1,    -1,
+     112,   113,   114,    -1,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,    -1,    -1,   127,   127,    -1,   129,   103,
+     104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,   106,
+     107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,    -1,    -1,
+     127,    -1,   129,   103,   104,   105,   106,   107,   108,    -1,
+      -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,
+     103,   104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,
+     106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    -1,    -1,
+      -1,   127,    -1,   129,   103,   104,   105,   106,   107,   108,
+      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,
+     129,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,
+     105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,    -1,
+      -1,    -1,   127,    -1,   129,   103,   104,   105,   106,   107,
+     108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   103,   104,   105,   106,   107,   108,    -1,    -1,
+      -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,   103,
+     104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,   106,
+     107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,    -1,    -1,
+     127,    -1,   129,   103,   104,   105,   106,   107,   108,    -1,
+      -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,
+     103,   104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,
+     106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    -1,    -1,
+      -1,   127,    -1,   129,   103,   104,   105,   106,   107,   108,
+      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,
+     129,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,
+     105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,    -1,
+      -1,    -1,   127,    -1,   129,   103,   104,   105,   106,   107,
+     108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   103,   104,   105,   106,   107,   108,    -1,    -1,
+      -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,   103,
+     104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,   106,
+     107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,    -1,    -1,
+     127,    -1,   129,   103,   104,   105,   106,   107,   108,    -1,
+      -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,   129,
+     103,   104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,   105,
+     106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    -1,    -1,
+      -1,   127,    -1,   129,   103,   104,   105,   106,   107,   108,
+      -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,    -1,    -1,    -1,   127,    -1,
+     129,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
+      -1,    -1,    -1,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,    -1,    -1,    -1,   127,    -1,   129,   103,   104,
+     105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,    -1,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,    -1,
+      -1,    -1,   127,    -1,   129,   103,   104,   105,   106,   107,
+     108,    -1,    -1,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   103,   104,   105,   106,   107,   108,    -1,    -1,
+      -1,    -1,    -1,    -1,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,    -1,    -1,    -1,    -1,    -1,   129
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -1451,93 +1505,97 @@ static const yytype_uint8 yystos[] =
       58,    60,    62,    65,    67,    68,    69,    71,    72,    73,
       74,    75,    78,    79,    80,    81,    82,    83,    84,    85,
       86,    89,    90,    92,    94,    95,    96,    97,    98,   100,
-     109,   110,   111,   113,   118,   124,   127,   128,   130,   132,
-     133,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     109,   110,   111,   112,   113,   114,   116,   121,   127,   130,
+     131,   133,   135,   136,   138,   139,   140,   141,   142,   143,
      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   162,   163,   164,
-     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187,   189,    19,   124,   189,    48,    96,   124,
-     124,     3,     4,     5,     6,     7,    59,    67,   110,   111,
-     136,   124,     3,     4,     5,     6,     7,    14,    69,    96,
-     109,   110,   111,   113,   124,   127,   128,   136,   188,    69,
-     124,   189,   118,   124,   189,    96,    96,    96,    15,    27,
-      35,    42,    43,    44,    45,    46,    47,    49,    91,   101,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,    54,
-     124,   189,    69,    69,   189,    61,    63,    64,   189,    55,
-      66,    76,    77,   124,   189,    70,   102,   189,   189,    16,
-      17,   134,   134,   134,   124,   189,   189,   124,   124,    96,
-     124,    96,   124,    18,    33,    70,    87,    88,   124,   124,
-     189,    17,    48,    69,   102,   124,    69,    93,    69,   124,
-     124,   189,   189,    18,    20,    21,    22,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    36,    37,    38,    39,
-      40,    50,    51,    52,    53,    56,    57,    58,    67,    68,
-      72,    73,    74,    75,    78,    79,    80,    81,    82,    83,
-      85,    86,    89,    90,    92,    97,    98,   100,   124,   135,
-     189,   189,   189,   189,   189,   189,     0,   133,   124,   103,
-     104,   105,   106,   107,   108,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   126,   189,   124,    96,    96,   124,
-     125,   125,   125,   125,   125,   125,   134,   125,   125,   125,
-     188,   188,   188,   103,   104,   112,   113,   114,   115,   118,
-     119,   120,   126,    19,   124,    19,   124,   189,    19,   124,
-     124,   124,   124,   124,   124,   124,   161,   189,   161,   161,
-     161,   124,   124,   124,    69,   124,    69,   102,   124,   124,
-     189,   124,    69,   189,   113,   118,   189,   124,    96,   124,
-     124,   124,   124,   189,   134,   124,   125,   124,   189,   124,
-     124,   124,   189,   124,   124,   124,   124,   124,   124,   124,
-     124,   189,   124,   189,   189,   124,   124,   124,    99,   124,
-     124,   124,   189,    69,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,   124,   124,   124,   129,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   124,   124,   124,   189,   189,   189,   189,   189,   189,
-     124,   189,   189,   189,   129,   188,   188,   188,   188,   188,
-     188,   188,   188,   188,   188,    69,    69,    19,   124,    69,
-     161,   161,   161,   161,   124,    69,   124,    69,   124,   124,
-     124,   189,   189,   189,   189,   124,   124,   189,   124,    96,
-     124,   124,   124,   189,   124,   189,   124,   189,   124,   124,
-     124,   189,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,    19,   124,   124,   124,    69,   124,   124,   124,   124,
-     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     124,    69,   124,   124
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   195,
+      19,   127,   195,    48,    96,   127,   127,     3,     4,     5,
+       6,     7,    59,    67,   110,   111,   139,   127,     3,     4,
+       5,     6,     7,    14,    69,    96,   109,   110,   111,   116,
+     127,   130,   131,   139,   194,    69,   127,   195,   121,   127,
+     195,    96,    96,    96,    15,    27,    35,    42,    43,    44,
+      45,    46,    47,    49,    91,   101,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,    54,   127,   195,    69,    69,
+     195,    61,    63,    64,   195,    55,    66,    76,    77,   127,
+     195,    70,   102,   195,   195,    16,    17,   137,   137,   137,
+     127,   195,   195,   127,   127,    96,   127,    96,   127,    18,
+      33,    70,    87,    88,   127,   127,   195,    17,    48,    69,
+     102,   127,    69,    93,    69,   127,   127,   195,   195,    18,
+      20,    21,    22,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    36,    37,    38,    39,    40,    50,    51,    52,
+      53,    56,    57,    58,    67,    68,    72,    73,    74,    75,
+      78,    79,    80,    81,    82,    83,    85,    86,    89,    90,
+      92,    97,    98,   100,   112,   113,   114,   127,   138,   195,
+      96,   127,   127,    16,   127,   137,   195,   195,   195,   195,
+     195,     0,   136,   127,   103,   104,   105,   106,   107,   108,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   129,
+     195,   127,    96,    96,   127,   128,   128,   128,   128,   128,
+     128,   137,   128,   128,   128,   194,   194,   194,   103,   104,
+     115,   116,   117,   118,   121,   122,   123,   129,    19,   127,
+      19,   127,   195,    19,   127,   127,   127,   127,   127,   127,
+     127,   167,   195,   167,   167,   167,   127,   127,   127,    69,
+     127,    69,   102,   127,   127,   195,   127,    69,   195,   116,
+     121,   195,   127,    96,   127,   127,   127,   127,   195,   137,
+     127,   128,   127,   195,   127,   127,   127,   195,   127,   127,
+     127,   127,   127,   127,   127,   127,   195,   127,   195,   195,
+     127,   127,   127,    99,   127,   127,   127,   195,    69,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,    96,   127,   132,   195,   195,   195,   195,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
+     195,   195,   127,   127,   127,   195,   195,   195,   195,   195,
+     195,   127,   195,   195,   195,   132,   194,   194,   194,   194,
+     194,   194,   194,   194,   194,   194,    69,    69,    19,   127,
+      69,   167,   167,   167,   167,   127,    69,   127,    69,   127,
+     127,   127,   195,   195,   195,   195,   127,   127,   195,   127,
+      96,   127,   127,   127,   195,   127,   195,   127,   195,   127,
+     127,   127,   195,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,    19,   127,   127,   127,    69,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,    69,   127,   127
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   131,   132,   132,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
-     133,   133,   133,   133,   133,   133,   133,   134,   134,   135,
-     135,   136,   136,   136,   136,   136,   136,   137,   137,   138,
-     139,   140,   140,   140,   140,   140,   140,   141,   142,   143,
-     144,   145,   146,   147,   147,   148,   148,   149,   149,   149,
-     149,   149,   149,   149,   149,   149,   149,   149,   150,   150,
-     150,   150,   151,   152,   153,   153,   154,   154,   154,   154,
-     155,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   157,   157,   157,   157,   157,   157,   157,   157,   157,
-     157,   157,   157,   157,   158,   159,   159,   160,   160,   160,
-     160,   160,   160,   160,   160,   160,   160,   160,   160,   160,
-     160,   160,   160,   160,   161,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     175,   175,   175,   176,   177,   178,   179,   180,   180,   180,
-     181,   181,   181,   181,   181,   181,   181,   181,   181,   182,
-     182,   183,   184,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-     186,   187,   188,   188,   188,   188,   188,   188,   188,   188,
-     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
-     188,   188,   188,   188,   188,   188,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189
+       0,   134,   135,   135,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     137,   137,   138,   138,   139,   139,   139,   139,   139,   139,
+     140,   140,   141,   142,   143,   143,   143,   143,   143,   143,
+     144,   145,   146,   147,   148,   149,   150,   150,   151,   151,
+     152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
+     152,   153,   153,   153,   153,   154,   155,   156,   156,   157,
+     157,   157,   157,   158,   159,   159,   160,   161,   161,   161,
+     162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
+     163,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+     163,   163,   163,   164,   165,   165,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   167,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   181,
+     181,   181,   182,   183,   184,   185,   186,   186,   186,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   188,   188,
+     189,   190,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
+     191,   191,   192,   193,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,   194,   194,   194,   194,   195,   195,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
+     195
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -1548,31 +1606,33 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     3,     2,
-       2,     3,     3,     3,     3,     4,     2,     3,     3,     2,
-       3,     3,     3,     2,     3,     2,     3,     3,     3,     2,
-       4,     4,     4,     5,     5,     5,     2,     3,     3,     4,
-       4,     5,     2,     3,     2,     4,     2,     3,     4,     4,
-       2,     4,     5,     5,     5,     5,     5,     5,     5,     5,
-       5,     2,     5,     7,     2,     3,     5,     3,     5,     2,
-       3,     5,     4,     6,     2,     2,     3,     3,     3,     5,
-       5,     5,     5,     3,     3,     3,     3,     3,     4,     3,
-       4,     5,     4,     5,     0,     1,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     3,     3,     3,     2,     4,
-       3,     3,     2,     4,     5,     5,     3,     3,     4,     3,
-       2,     3,     4,     3,     4,     5,     3,     4,     5,     3,
-       3,     3,     4,     3,     3,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     3,     2,     2,     3,     3,     3,     3,     4,     2,
+       3,     3,     2,     3,     3,     3,     2,     3,     2,     3,
+       3,     3,     2,     4,     4,     4,     5,     5,     5,     2,
+       3,     3,     4,     4,     5,     2,     3,     2,     4,     2,
+       3,     4,     4,     2,     2,     3,     2,     2,     3,     4,
+       4,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+       2,     5,     7,     2,     3,     5,     3,     5,     2,     3,
+       5,     4,     6,     2,     2,     3,     3,     3,     5,     5,
+       5,     5,     3,     3,     3,     3,     3,     4,     3,     4,
+       5,     4,     5,     0,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     3,     3,     3,     2,     4,     3,
+       3,     2,     4,     5,     5,     3,     3,     4,     3,     2,
+       3,     4,     3,     4,     5,     3,     4,     5,     3,     3,
+       3,     4,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     2,
-       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     2,     2,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       3,     2,     3,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     2,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     2,     2,     2,     2,     3
+       3,     3,     3,     3,     3,     3,     2,     2,     2,     2,
+       3
 };
 
 
@@ -2248,1315 +2308,1398 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 54:
-#line 202 "parser.y" /* yacc.c:1646  */
+        case 57:
+#line 208 "parser.y" /* yacc.c:1646  */
     { eval_value = (yyvsp[0].uval); }
-#line 2255 "y.tab.c" /* yacc.c:1646  */
+#line 2315 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 56:
-#line 205 "parser.y" /* yacc.c:1646  */
+  case 59:
+#line 211 "parser.y" /* yacc.c:1646  */
     {
       }
-#line 2262 "y.tab.c" /* yacc.c:1646  */
+#line 2322 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 58:
-#line 212 "parser.y" /* yacc.c:1646  */
+  case 61:
+#line 218 "parser.y" /* yacc.c:1646  */
     { (yyval.bval)=(yyvsp[0].bval); }
-#line 2268 "y.tab.c" /* yacc.c:1646  */
+#line 2328 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 60:
-#line 218 "parser.y" /* yacc.c:1646  */
+  case 63:
+#line 224 "parser.y" /* yacc.c:1646  */
     { (yyval.sval)=(yyvsp[0].sval); }
-#line 2274 "y.tab.c" /* yacc.c:1646  */
+#line 2334 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 66:
-#line 228 "parser.y" /* yacc.c:1646  */
+  case 69:
+#line 234 "parser.y" /* yacc.c:1646  */
     { (yyval.uval)=(yyvsp[0].uval); }
-#line 2280 "y.tab.c" /* yacc.c:1646  */
+#line 2340 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 67:
-#line 233 "parser.y" /* yacc.c:1646  */
+  case 70:
+#line 239 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_timebp_command(0, (yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2289 "y.tab.c" /* yacc.c:1646  */
+#line 2349 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 68:
-#line 238 "parser.y" /* yacc.c:1646  */
+  case 71:
+#line 244 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_timebp_command(1, (yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2298 "y.tab.c" /* yacc.c:1646  */
+#line 2358 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 69:
-#line 246 "parser.y" /* yacc.c:1646  */
+  case 72:
+#line 252 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_modebp_command();
           free((yyvsp[-1].sval));
       }
-#line 2307 "y.tab.c" /* yacc.c:1646  */
+#line 2367 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 70:
-#line 254 "parser.y" /* yacc.c:1646  */
+  case 73:
+#line 260 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_vmexitbp_command();
           free((yyvsp[-1].sval));
       }
-#line 2316 "y.tab.c" /* yacc.c:1646  */
+#line 2376 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 71:
-#line 262 "parser.y" /* yacc.c:1646  */
+  case 74:
+#line 268 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_command((yyvsp[-1].sval));
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2325 "y.tab.c" /* yacc.c:1646  */
+#line 2385 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 72:
-#line 267 "parser.y" /* yacc.c:1646  */
+  case 75:
+#line 273 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_command("all");
           free((yyvsp[-2].sval));
       }
-#line 2334 "y.tab.c" /* yacc.c:1646  */
+#line 2394 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 73:
-#line 272 "parser.y" /* yacc.c:1646  */
+  case 76:
+#line 278 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_command("off");
           free((yyvsp[-2].sval));
       }
-#line 2343 "y.tab.c" /* yacc.c:1646  */
+#line 2403 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 74:
-#line 277 "parser.y" /* yacc.c:1646  */
+  case 77:
+#line 283 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_param_command((yyvsp[-1].sval), 0);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2352 "y.tab.c" /* yacc.c:1646  */
+#line 2412 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 75:
-#line 282 "parser.y" /* yacc.c:1646  */
+  case 78:
+#line 288 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_param_command((yyvsp[-2].sval), 1);
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2361 "y.tab.c" /* yacc.c:1646  */
+#line 2421 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 76:
-#line 287 "parser.y" /* yacc.c:1646  */
+  case 79:
+#line 293 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_show_command(0);
           free((yyvsp[-1].sval));
       }
-#line 2370 "y.tab.c" /* yacc.c:1646  */
+#line 2430 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 77:
-#line 295 "parser.y" /* yacc.c:1646  */
+  case 80:
+#line 301 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_xlate_address((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2379 "y.tab.c" /* yacc.c:1646  */
+#line 2439 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 78:
-#line 303 "parser.y" /* yacc.c:1646  */
+  case 81:
+#line 309 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_tlb_lookup((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2388 "y.tab.c" /* yacc.c:1646  */
+#line 2448 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 79:
-#line 311 "parser.y" /* yacc.c:1646  */
+  case 82:
+#line 317 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_ptime_command();
           free((yyvsp[-1].sval));
       }
-#line 2397 "y.tab.c" /* yacc.c:1646  */
+#line 2457 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 80:
-#line 319 "parser.y" /* yacc.c:1646  */
+  case 83:
+#line 325 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_trace_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2406 "y.tab.c" /* yacc.c:1646  */
+#line 2466 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 81:
-#line 327 "parser.y" /* yacc.c:1646  */
+  case 84:
+#line 333 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_trace_reg_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2415 "y.tab.c" /* yacc.c:1646  */
+#line 2475 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 82:
-#line 335 "parser.y" /* yacc.c:1646  */
+  case 85:
+#line 341 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_trace_mem_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2424 "y.tab.c" /* yacc.c:1646  */
+#line 2484 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 83:
-#line 343 "parser.y" /* yacc.c:1646  */
+  case 86:
+#line 349 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_print_stack_command(16);
           free((yyvsp[-1].sval));
       }
-#line 2433 "y.tab.c" /* yacc.c:1646  */
+#line 2493 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 84:
-#line 348 "parser.y" /* yacc.c:1646  */
+  case 87:
+#line 354 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_print_stack_command((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2442 "y.tab.c" /* yacc.c:1646  */
+#line 2502 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 85:
-#line 356 "parser.y" /* yacc.c:1646  */
+  case 88:
+#line 362 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_bt_command(16);
         free((yyvsp[-1].sval));
       }
-#line 2451 "y.tab.c" /* yacc.c:1646  */
+#line 2511 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 86:
-#line 361 "parser.y" /* yacc.c:1646  */
+  case 89:
+#line 367 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_bt_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2460 "y.tab.c" /* yacc.c:1646  */
+#line 2520 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 87:
-#line 369 "parser.y" /* yacc.c:1646  */
+  case 90:
+#line 375 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watchpoint_continue(0);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2469 "y.tab.c" /* yacc.c:1646  */
+#line 2529 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 88:
-#line 374 "parser.y" /* yacc.c:1646  */
+  case 91:
+#line 380 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watchpoint_continue(1);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2478 "y.tab.c" /* yacc.c:1646  */
+#line 2538 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 89:
-#line 379 "parser.y" /* yacc.c:1646  */
+  case 92:
+#line 385 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_print_watchpoints();
           free((yyvsp[-1].sval));
       }
-#line 2487 "y.tab.c" /* yacc.c:1646  */
+#line 2547 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 90:
-#line 384 "parser.y" /* yacc.c:1646  */
+  case 93:
+#line 390 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(0, (yyvsp[-1].uval), 1); /* BX_READ */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2496 "y.tab.c" /* yacc.c:1646  */
+#line 2556 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 91:
-#line 389 "parser.y" /* yacc.c:1646  */
+  case 94:
+#line 395 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(0, (yyvsp[-1].uval), 1); /* BX_READ */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2505 "y.tab.c" /* yacc.c:1646  */
+#line 2565 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 92:
-#line 394 "parser.y" /* yacc.c:1646  */
+  case 95:
+#line 400 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(1, (yyvsp[-1].uval), 1); /* BX_WRITE */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2514 "y.tab.c" /* yacc.c:1646  */
+#line 2574 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 93:
-#line 399 "parser.y" /* yacc.c:1646  */
+  case 96:
+#line 405 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(0, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_READ */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2523 "y.tab.c" /* yacc.c:1646  */
+#line 2583 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 94:
-#line 404 "parser.y" /* yacc.c:1646  */
+  case 97:
+#line 410 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(0, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_READ */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2532 "y.tab.c" /* yacc.c:1646  */
+#line 2592 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 95:
-#line 409 "parser.y" /* yacc.c:1646  */
+  case 98:
+#line 415 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_watch(1, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_WRITE */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2541 "y.tab.c" /* yacc.c:1646  */
+#line 2601 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 96:
-#line 414 "parser.y" /* yacc.c:1646  */
+  case 99:
+#line 420 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_unwatch_all();
           free((yyvsp[-1].sval));
       }
-#line 2550 "y.tab.c" /* yacc.c:1646  */
+#line 2610 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 97:
-#line 419 "parser.y" /* yacc.c:1646  */
+  case 100:
+#line 425 "parser.y" /* yacc.c:1646  */
     {
           bx_dbg_unwatch((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2559 "y.tab.c" /* yacc.c:1646  */
+#line 2619 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 98:
-#line 427 "parser.y" /* yacc.c:1646  */
+  case 101:
+#line 433 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_symbol_command((yyvsp[-1].sval), 0, 0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2568 "y.tab.c" /* yacc.c:1646  */
+#line 2628 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 99:
-#line 432 "parser.y" /* yacc.c:1646  */
+  case 102:
+#line 438 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_symbol_command((yyvsp[-2].sval), 0, (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2577 "y.tab.c" /* yacc.c:1646  */
+#line 2637 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 100:
-#line 437 "parser.y" /* yacc.c:1646  */
+  case 103:
+#line 443 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_symbol_command((yyvsp[-1].sval), 1, 0);
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2586 "y.tab.c" /* yacc.c:1646  */
+#line 2646 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 101:
-#line 442 "parser.y" /* yacc.c:1646  */
+  case 104:
+#line 448 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_symbol_command((yyvsp[-2].sval), 1, (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2595 "y.tab.c" /* yacc.c:1646  */
+#line 2655 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 102:
-#line 450 "parser.y" /* yacc.c:1646  */
+  case 105:
+#line 456 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_where_command();
         free((yyvsp[-1].sval));
       }
-#line 2604 "y.tab.c" /* yacc.c:1646  */
+#line 2664 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 103:
-#line 458 "parser.y" /* yacc.c:1646  */
+  case 106:
+#line 464 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_print_string_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2613 "y.tab.c" /* yacc.c:1646  */
+#line 2673 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 104:
-#line 466 "parser.y" /* yacc.c:1646  */
+  case 107:
+#line 472 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_continue_command(1);
         free((yyvsp[-1].sval));
       }
-#line 2622 "y.tab.c" /* yacc.c:1646  */
+#line 2682 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 105:
-#line 471 "parser.y" /* yacc.c:1646  */
+  case 108:
+#line 477 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_continue_command((yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2631 "y.tab.c" /* yacc.c:1646  */
+#line 2691 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 106:
-#line 479 "parser.y" /* yacc.c:1646  */
+  case 109:
+#line 485 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_stepN_command(dbg_cpu, 1);
         free((yyvsp[-1].sval));
       }
-#line 2640 "y.tab.c" /* yacc.c:1646  */
+#line 2700 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 107:
-#line 484 "parser.y" /* yacc.c:1646  */
+  case 110:
+#line 490 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_stepN_command(dbg_cpu, (yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2649 "y.tab.c" /* yacc.c:1646  */
+#line 2709 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 108:
-#line 489 "parser.y" /* yacc.c:1646  */
+  case 111:
+#line 495 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_stepN_command(-1, (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2658 "y.tab.c" /* yacc.c:1646  */
+#line 2718 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 109:
-#line 494 "parser.y" /* yacc.c:1646  */
+  case 112:
+#line 500 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_stepN_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 2667 "y.tab.c" /* yacc.c:1646  */
+#line 2727 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 110:
-#line 502 "parser.y" /* yacc.c:1646  */
+  case 113:
+#line 508 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_step_over_command();
         free((yyvsp[-1].sval));
       }
-#line 2676 "y.tab.c" /* yacc.c:1646  */
+#line 2736 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 111:
-#line 510 "parser.y" /* yacc.c:1646  */
+  case 114:
+#line 516 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_reverse_step_command(1);
+        free((yyvsp[-1].sval));
+      }
+#line 2745 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 115:
+#line 521 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_reverse_step_command((yyvsp[-1].uval));
+        free((yyvsp[-2].sval));
+      }
+#line 2754 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 116:
+#line 529 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_reverse_continue_command();
+        free((yyvsp[-1].sval));
+      }
+#line 2763 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 117:
+#line 537 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_revexec_command(-1, 0);
+        free((yyvsp[-1].sval));
+      }
+#line 2772 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 118:
+#line 542 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_revexec_command((yyvsp[-1].bval), 0);
+        free((yyvsp[-2].sval));
+      }
+#line 2781 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 119:
+#line 547 "parser.y" /* yacc.c:1646  */
+    {
+        bx_dbg_revexec_command(1, (yyvsp[-1].uval));
+        free((yyvsp[-3].sval));
+      }
+#line 2790 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 120:
+#line 555 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_set_auto_disassemble((yyvsp[-1].bval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2685 "y.tab.c" /* yacc.c:1646  */
+#line 2799 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 112:
-#line 515 "parser.y" /* yacc.c:1646  */
+  case 121:
+#line 560 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_set_symbol_command((yyvsp[-3].sval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2694 "y.tab.c" /* yacc.c:1646  */
+#line 2808 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 113:
-#line 520 "parser.y" /* yacc.c:1646  */
+  case 122:
+#line 565 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_reg8l_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2702 "y.tab.c" /* yacc.c:1646  */
+#line 2816 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 114:
-#line 524 "parser.y" /* yacc.c:1646  */
+  case 123:
+#line 569 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_reg8h_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2710 "y.tab.c" /* yacc.c:1646  */
+#line 2824 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 115:
-#line 528 "parser.y" /* yacc.c:1646  */
+  case 124:
+#line 573 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_reg16_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2718 "y.tab.c" /* yacc.c:1646  */
+#line 2832 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 116:
-#line 532 "parser.y" /* yacc.c:1646  */
+  case 125:
+#line 577 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_reg32_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2726 "y.tab.c" /* yacc.c:1646  */
+#line 2840 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 117:
-#line 536 "parser.y" /* yacc.c:1646  */
+  case 126:
+#line 581 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_reg64_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2734 "y.tab.c" /* yacc.c:1646  */
+#line 2848 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 118:
-#line 540 "parser.y" /* yacc.c:1646  */
+  case 127:
+#line 585 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_rip_value((yyvsp[-1].uval));
       }
-#line 2742 "y.tab.c" /* yacc.c:1646  */
+#line 2856 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 119:
-#line 544 "parser.y" /* yacc.c:1646  */
+  case 128:
+#line 589 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_set_rip_value((yyvsp[-1].uval));
       }
-#line 2750 "y.tab.c" /* yacc.c:1646  */
+#line 2864 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 120:
-#line 548 "parser.y" /* yacc.c:1646  */
+  case 129:
+#line 593 "parser.y" /* yacc.c:1646  */
     { 
         bx_dbg_load_segreg((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2758 "y.tab.c" /* yacc.c:1646  */
+#line 2872 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 121:
-#line 555 "parser.y" /* yacc.c:1646  */
+  case 130:
+#line 600 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_vbreakpoint_command(bkAtIP, 0, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2767 "y.tab.c" /* yacc.c:1646  */
+#line 2881 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 122:
-#line 560 "parser.y" /* yacc.c:1646  */
+  case 131:
+#line 605 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_vbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].uval), NULL);
         free((yyvsp[-4].sval));
       }
-#line 2776 "y.tab.c" /* yacc.c:1646  */
+#line 2890 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 123:
-#line 565 "parser.y" /* yacc.c:1646  */
+  case 132:
+#line 610 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_vbreakpoint_command(bkRegular, (yyvsp[-5].uval), (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-6].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2785 "y.tab.c" /* yacc.c:1646  */
+#line 2899 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 124:
-#line 570 "parser.y" /* yacc.c:1646  */
+  case 133:
+#line 615 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_lbreakpoint_command(bkAtIP, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2794 "y.tab.c" /* yacc.c:1646  */
+#line 2908 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 125:
-#line 575 "parser.y" /* yacc.c:1646  */
+  case 134:
+#line 620 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_lbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-2].sval));
       }
-#line 2803 "y.tab.c" /* yacc.c:1646  */
+#line 2917 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 126:
-#line 580 "parser.y" /* yacc.c:1646  */
+  case 135:
+#line 625 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_lbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2812 "y.tab.c" /* yacc.c:1646  */
+#line 2926 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 127:
-#line 585 "parser.y" /* yacc.c:1646  */
+  case 136:
+#line 630 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_lbreakpoint_symbol_command((yyvsp[-1].sval), NULL);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2821 "y.tab.c" /* yacc.c:1646  */
+#line 2935 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 128:
-#line 590 "parser.y" /* yacc.c:1646  */
+  case 137:
+#line 635 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_lbreakpoint_symbol_command((yyvsp[-3].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2830 "y.tab.c" /* yacc.c:1646  */
+#line 2944 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 129:
-#line 595 "parser.y" /* yacc.c:1646  */
+  case 138:
+#line 640 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_pbreakpoint_command(bkAtIP, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2839 "y.tab.c" /* yacc.c:1646  */
+#line 2953 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 130:
-#line 600 "parser.y" /* yacc.c:1646  */
+  case 139:
+#line 645 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-2].sval));
       }
-#line 2848 "y.tab.c" /* yacc.c:1646  */
+#line 2962 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 131:
-#line 605 "parser.y" /* yacc.c:1646  */
+  case 140:
+#line 650 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2857 "y.tab.c" /* yacc.c:1646  */
+#line 2971 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 132:
-#line 610 "parser.y" /* yacc.c:1646  */
+  case 141:
+#line 655 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-3].sval));
       }
-#line 2866 "y.tab.c" /* yacc.c:1646  */
+#line 2980 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 133:
-#line 615 "parser.y" /* yacc.c:1646  */
+  case 142:
+#line 660 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-5].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2875 "y.tab.c" /* yacc.c:1646  */
+#line 2989 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 134:
-#line 623 "parser.y" /* yacc.c:1646  */
+  case 143:
+#line 668 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_bpoints_command();
         free((yyvsp[-1].sval));
       }
-#line 2884 "y.tab.c" /* yacc.c:1646  */
+#line 2998 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 135:
-#line 631 "parser.y" /* yacc.c:1646  */
+  case 144:
+#line 676 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_symbols_command(0);
         free((yyvsp[-1].sval));
       }
-#line 2893 "y.tab.c" /* yacc.c:1646  */
+#line 3007 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 136:
-#line 636 "parser.y" /* yacc.c:1646  */
+  case 145:
+#line 681 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_symbols_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
       }
-#line 2902 "y.tab.c" /* yacc.c:1646  */
+#line 3016 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 137:
-#line 644 "parser.y" /* yacc.c:1646  */
+  case 146:
+#line 689 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_bpoints_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2911 "y.tab.c" /* yacc.c:1646  */
+#line 3025 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 138:
-#line 649 "parser.y" /* yacc.c:1646  */
+  case 147:
+#line 694 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(-1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2920 "y.tab.c" /* yacc.c:1646  */
+#line 3034 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 139:
-#line 654 "parser.y" /* yacc.c:1646  */
+  case 148:
+#line 699 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_idt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2929 "y.tab.c" /* yacc.c:1646  */
+#line 3043 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 140:
-#line 659 "parser.y" /* yacc.c:1646  */
+  case 149:
+#line 704 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_ivt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2938 "y.tab.c" /* yacc.c:1646  */
+#line 3052 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 141:
-#line 664 "parser.y" /* yacc.c:1646  */
+  case 150:
+#line 709 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_gdt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2947 "y.tab.c" /* yacc.c:1646  */
+#line 3061 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 142:
-#line 669 "parser.y" /* yacc.c:1646  */
+  case 151:
+#line 714 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_ldt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2956 "y.tab.c" /* yacc.c:1646  */
+#line 3070 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 143:
-#line 674 "parser.y" /* yacc.c:1646  */
+  case 152:
+#line 719 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_dump_table();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2965 "y.tab.c" /* yacc.c:1646  */
+#line 3079 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 144:
-#line 679 "parser.y" /* yacc.c:1646  */
+  case 153:
+#line 724 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_tss_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2974 "y.tab.c" /* yacc.c:1646  */
+#line 3088 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 145:
-#line 684 "parser.y" /* yacc.c:1646  */
+  case 154:
+#line 729 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_flags();
         free((yyvsp[-2].sval));
       }
-#line 2983 "y.tab.c" /* yacc.c:1646  */
+#line 3097 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 146:
-#line 689 "parser.y" /* yacc.c:1646  */
+  case 155:
+#line 734 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_linux_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2992 "y.tab.c" /* yacc.c:1646  */
+#line 3106 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 147:
-#line 694 "parser.y" /* yacc.c:1646  */
+  case 156:
+#line 739 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_symbols_command(0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3001 "y.tab.c" /* yacc.c:1646  */
+#line 3115 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 148:
-#line 699 "parser.y" /* yacc.c:1646  */
+  case 157:
+#line 744 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_symbols_command((yyvsp[-1].sval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3010 "y.tab.c" /* yacc.c:1646  */
+#line 3124 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 149:
-#line 704 "parser.y" /* yacc.c:1646  */
+  case 158:
+#line 749 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_device("", "");
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3019 "y.tab.c" /* yacc.c:1646  */
+#line 3133 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 150:
-#line 709 "parser.y" /* yacc.c:1646  */
+  case 159:
+#line 754 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_device((yyvsp[-1].sval), "");
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3028 "y.tab.c" /* yacc.c:1646  */
+#line 3142 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 151:
-#line 714 "parser.y" /* yacc.c:1646  */
+  case 160:
+#line 759 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_device((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3037 "y.tab.c" /* yacc.c:1646  */
+#line 3151 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 152:
-#line 719 "parser.y" /* yacc.c:1646  */
+  case 161:
+#line 764 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_device((yyvsp[-1].sval), "");
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3046 "y.tab.c" /* yacc.c:1646  */
+#line 3160 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 153:
-#line 724 "parser.y" /* yacc.c:1646  */
+  case 162:
+#line 769 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_device((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3055 "y.tab.c" /* yacc.c:1646  */
+#line 3169 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 154:
-#line 731 "parser.y" /* yacc.c:1646  */
+  case 163:
+#line 776 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = EMPTY_ARG; }
-#line 3061 "y.tab.c" /* yacc.c:1646  */
+#line 3175 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 156:
-#line 736 "parser.y" /* yacc.c:1646  */
+  case 165:
+#line 781 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_GENERAL_PURPOSE_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3070 "y.tab.c" /* yacc.c:1646  */
+#line 3184 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 157:
-#line 744 "parser.y" /* yacc.c:1646  */
+  case 166:
+#line 789 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_FPU_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3079 "y.tab.c" /* yacc.c:1646  */
+#line 3193 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 158:
-#line 752 "parser.y" /* yacc.c:1646  */
+  case 167:
+#line 797 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_MMX_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3088 "y.tab.c" /* yacc.c:1646  */
+#line 3202 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 159:
-#line 760 "parser.y" /* yacc.c:1646  */
+  case 168:
+#line 805 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_SSE_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3097 "y.tab.c" /* yacc.c:1646  */
+#line 3211 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 160:
-#line 768 "parser.y" /* yacc.c:1646  */
+  case 169:
+#line 813 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_YMM_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3106 "y.tab.c" /* yacc.c:1646  */
+#line 3220 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 161:
-#line 776 "parser.y" /* yacc.c:1646  */
+  case 170:
+#line 821 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_registers_command(BX_INFO_ZMM_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3115 "y.tab.c" /* yacc.c:1646  */
+#line 3229 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 162:
-#line 784 "parser.y" /* yacc.c:1646  */
+  case 171:
+#line 829 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_segment_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3124 "y.tab.c" /* yacc.c:1646  */
+#line 3238 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 163:
-#line 792 "parser.y" /* yacc.c:1646  */
+  case 172:
+#line 837 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_control_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3133 "y.tab.c" /* yacc.c:1646  */
+#line 3247 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 164:
-#line 800 "parser.y" /* yacc.c:1646  */
+  case 173:
+#line 845 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_info_debug_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3142 "y.tab.c" /* yacc.c:1646  */
+#line 3256 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 165:
-#line 808 "parser.y" /* yacc.c:1646  */
+  case 174:
+#line 853 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_del_breakpoint_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3151 "y.tab.c" /* yacc.c:1646  */
+#line 3265 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 166:
-#line 816 "parser.y" /* yacc.c:1646  */
+  case 175:
+#line 861 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_en_dis_breakpoint_command((yyvsp[-1].uval), 1);
         free((yyvsp[-2].sval));
       }
-#line 3160 "y.tab.c" /* yacc.c:1646  */
+#line 3274 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 167:
-#line 823 "parser.y" /* yacc.c:1646  */
+  case 176:
+#line 868 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_en_dis_breakpoint_command((yyvsp[-1].uval), 0);
         free((yyvsp[-2].sval));
       }
-#line 3169 "y.tab.c" /* yacc.c:1646  */
+#line 3283 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 168:
-#line 831 "parser.y" /* yacc.c:1646  */
+  case 177:
+#line 876 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_quit_command();
         free((yyvsp[-1].sval));
       }
-#line 3178 "y.tab.c" /* yacc.c:1646  */
+#line 3292 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 169:
-#line 839 "parser.y" /* yacc.c:1646  */
+  case 178:
+#line 884 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_examine_command((yyvsp[-3].sval), (yyvsp[-2].sval),1, (yyvsp[-1].uval), 1);
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3187 "y.tab.c" /* yacc.c:1646  */
+#line 3301 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 170:
-#line 844 "parser.y" /* yacc.c:1646  */
+  case 179:
+#line 889 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_examine_command((yyvsp[-2].sval), (yyvsp[-1].sval),1, 0, 0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3196 "y.tab.c" /* yacc.c:1646  */
+#line 3310 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 171:
-#line 849 "parser.y" /* yacc.c:1646  */
+  case 180:
+#line 894 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_examine_command((yyvsp[-2].sval), NULL,0, (yyvsp[-1].uval), 1);
         free((yyvsp[-2].sval));
       }
-#line 3205 "y.tab.c" /* yacc.c:1646  */
+#line 3319 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 172:
-#line 854 "parser.y" /* yacc.c:1646  */
+  case 181:
+#line 899 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_examine_command((yyvsp[-1].sval), NULL,0, 0, 0);
         free((yyvsp[-1].sval));
       }
-#line 3214 "y.tab.c" /* yacc.c:1646  */
+#line 3328 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 173:
-#line 862 "parser.y" /* yacc.c:1646  */
+  case 182:
+#line 907 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_restore_command((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3223 "y.tab.c" /* yacc.c:1646  */
+#line 3337 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 174:
-#line 870 "parser.y" /* yacc.c:1646  */
+  case 183:
+#line 915 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_writemem_command((yyvsp[-3].sval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3232 "y.tab.c" /* yacc.c:1646  */
+#line 3346 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 175:
-#line 878 "parser.y" /* yacc.c:1646  */
+  case 184:
+#line 923 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_setpmem_command((yyvsp[-3].uval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval));
       }
-#line 3241 "y.tab.c" /* yacc.c:1646  */
+#line 3355 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 176:
-#line 886 "parser.y" /* yacc.c:1646  */
+  case 185:
+#line 931 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_query_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3250 "y.tab.c" /* yacc.c:1646  */
+#line 3364 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 177:
-#line 894 "parser.y" /* yacc.c:1646  */
+  case 186:
+#line 939 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3259 "y.tab.c" /* yacc.c:1646  */
+#line 3373 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 178:
-#line 899 "parser.y" /* yacc.c:1646  */
+  case 187:
+#line 944 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_take_command((yyvsp[-2].sval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3268 "y.tab.c" /* yacc.c:1646  */
+#line 3382 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 179:
-#line 904 "parser.y" /* yacc.c:1646  */
+  case 188:
+#line 949 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3277 "y.tab.c" /* yacc.c:1646  */
+#line 3391 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 180:
-#line 912 "parser.y" /* yacc.c:1646  */
+  case 189:
+#line 957 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_current(NULL);
         free((yyvsp[-1].sval));
       }
-#line 3286 "y.tab.c" /* yacc.c:1646  */
+#line 3400 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 181:
-#line 917 "parser.y" /* yacc.c:1646  */
+  case 190:
+#line 962 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_command(NULL, (yyvsp[-1].uval), (yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3295 "y.tab.c" /* yacc.c:1646  */
+#line 3409 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 182:
-#line 922 "parser.y" /* yacc.c:1646  */
+  case 191:
+#line 967 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_command(NULL, (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 3304 "y.tab.c" /* yacc.c:1646  */
+#line 3418 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 183:
-#line 927 "parser.y" /* yacc.c:1646  */
+  case 192:
+#line 972 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_current((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3313 "y.tab.c" /* yacc.c:1646  */
+#line 3427 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 184:
-#line 932 "parser.y" /* yacc.c:1646  */
+  case 193:
+#line 977 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_command((yyvsp[-2].sval), (yyvsp[-1].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3322 "y.tab.c" /* yacc.c:1646  */
+#line 3436 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 185:
-#line 937 "parser.y" /* yacc.c:1646  */
+  case 194:
+#line 982 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_command((yyvsp[-3].sval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3331 "y.tab.c" /* yacc.c:1646  */
+#line 3445 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 186:
-#line 942 "parser.y" /* yacc.c:1646  */
+  case 195:
+#line 987 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_switch_mode();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3340 "y.tab.c" /* yacc.c:1646  */
+#line 3454 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 187:
-#line 947 "parser.y" /* yacc.c:1646  */
+  case 196:
+#line 992 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_disassemble_hex_mode_switch((yyvsp[-1].bval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3349 "y.tab.c" /* yacc.c:1646  */
+#line 3463 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 188:
-#line 952 "parser.y" /* yacc.c:1646  */
+  case 197:
+#line 997 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_set_disassemble_size((yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3358 "y.tab.c" /* yacc.c:1646  */
+#line 3472 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 189:
-#line 960 "parser.y" /* yacc.c:1646  */
+  case 198:
+#line 1005 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_instrument_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3367 "y.tab.c" /* yacc.c:1646  */
+#line 3481 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 190:
-#line 965 "parser.y" /* yacc.c:1646  */
+  case 199:
+#line 1010 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_instrument_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3376 "y.tab.c" /* yacc.c:1646  */
+#line 3490 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 191:
-#line 973 "parser.y" /* yacc.c:1646  */
+  case 200:
+#line 1018 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_doit_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3385 "y.tab.c" /* yacc.c:1646  */
+#line 3499 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 192:
-#line 981 "parser.y" /* yacc.c:1646  */
+  case 201:
+#line 1026 "parser.y" /* yacc.c:1646  */
     {
         bx_dbg_crc_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 3394 "y.tab.c" /* yacc.c:1646  */
+#line 3508 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 193:
-#line 989 "parser.y" /* yacc.c:1646  */
+  case 202:
+#line 1034 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("q|quit|exit - quit debugger and emulator execution\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3403 "y.tab.c" /* yacc.c:1646  */
+#line 3517 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 194:
-#line 994 "parser.y" /* yacc.c:1646  */
+  case 203:
+#line 1039 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("c|cont|continue - continue executing\n");
          dbg_printf("c|cont|continue if \"expression\" - continue executing only if expression is true\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3413 "y.tab.c" /* yacc.c:1646  */
+#line 3527 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 195:
-#line 1000 "parser.y" /* yacc.c:1646  */
+  case 204:
+#line 1045 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("s|step [count] - execute #count instructions on current processor (default is one instruction)\n");
          dbg_printf("s|step [cpu] <count> - execute #count instructions on processor #cpu\n");
          dbg_printf("s|step all <count> - execute #count instructions on all the processors\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3424 "y.tab.c" /* yacc.c:1646  */
+#line 3538 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 196:
-#line 1007 "parser.y" /* yacc.c:1646  */
+  case 205:
+#line 1052 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("n|next|p - execute instruction stepping over subroutines\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3433 "y.tab.c" /* yacc.c:1646  */
+#line 3547 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 197:
-#line 1012 "parser.y" /* yacc.c:1646  */
+  case 206:
+#line 1057 "parser.y" /* yacc.c:1646  */
+    {
+         dbg_printf("rs|reverse-stepi [count] - go back #count instructions (default is one instruction)\n");
+         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
+       }
+#line 3556 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 207:
+#line 1062 "parser.y" /* yacc.c:1646  */
+    {
+         dbg_printf("rc|reverse-continue - go back to the previous breakpoint or watchpoint hit\n");
+         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
+       }
+#line 3565 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 208:
+#line 1067 "parser.y" /* yacc.c:1646  */
+    {
+         dbg_printf("revexec on [interval] - record checkpoints every #interval instructions for reverse execution\n");
+         dbg_printf("revexec off - stop recording and drop all checkpoints\n");
+         dbg_printf("revexec - show the reverse execution checkpoints\n");
+         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
+       }
+#line 3576 "y.tab.c" /* yacc.c:1646  */
+    break;
+
+  case 209:
+#line 1074 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("vb|vbreak <seg:offset> - set a virtual address instruction breakpoint\n");
          dbg_printf("vb|vbreak <seg:offset> if \"expression\" - set a conditional virtual address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3443 "y.tab.c" /* yacc.c:1646  */
+#line 3586 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 198:
-#line 1018 "parser.y" /* yacc.c:1646  */
+  case 210:
+#line 1080 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("lb|lbreak <addr> - set a linear address instruction breakpoint\n");
          dbg_printf("lb|lbreak <addr> if \"expression\" - set a conditional linear address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3453 "y.tab.c" /* yacc.c:1646  */
+#line 3596 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 199:
-#line 1024 "parser.y" /* yacc.c:1646  */
+  case 211:
+#line 1086 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("p|pb|break|pbreak <addr> - set a physical address instruction breakpoint\n");
          dbg_printf("p|pb|break|pbreak <addr> if \"expression\" - set a conditional physical address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3463 "y.tab.c" /* yacc.c:1646  */
+#line 3606 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 200:
-#line 1030 "parser.y" /* yacc.c:1646  */
+  case 212:
+#line 1092 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("d|del|delete <n> - delete a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3472 "y.tab.c" /* yacc.c:1646  */
+#line 3615 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 201:
-#line 1035 "parser.y" /* yacc.c:1646  */
+  case 213:
+#line 1097 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("bpe <n> - enable a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3481 "y.tab.c" /* yacc.c:1646  */
+#line 3624 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 202:
-#line 1040 "parser.y" /* yacc.c:1646  */
+  case 214:
+#line 1102 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("bpd <n> - disable a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3490 "y.tab.c" /* yacc.c:1646  */
+#line 3633 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 203:
-#line 1045 "parser.y" /* yacc.c:1646  */
+  case 215:
+#line 1107 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("blist - list all breakpoints (same as 'info break')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3499 "y.tab.c" /* yacc.c:1646  */
+#line 3642 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 204:
-#line 1050 "parser.y" /* yacc.c:1646  */
+  case 216:
+#line 1112 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("modebp - toggles mode switch breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3508 "y.tab.c" /* yacc.c:1646  */
+#line 3651 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 205:
-#line 1055 "parser.y" /* yacc.c:1646  */
+  case 217:
+#line 1117 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("vmexitbp - toggles VMEXIT switch breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3517 "y.tab.c" /* yacc.c:1646  */
+#line 3660 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 206:
-#line 1060 "parser.y" /* yacc.c:1646  */
+  case 218:
+#line 1122 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("crc <addr1> <addr2> - show CRC32 for physical memory range addr1..addr2\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3526 "y.tab.c" /* yacc.c:1646  */
+#line 3669 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 207:
-#line 1065 "parser.y" /* yacc.c:1646  */
+  case 219:
+#line 1127 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("trace on  - print disassembly for every executed instruction\n");
          dbg_printf("trace off - disable instruction tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3536 "y.tab.c" /* yacc.c:1646  */
+#line 3679 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 208:
-#line 1071 "parser.y" /* yacc.c:1646  */
+  case 220:
+#line 1133 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("trace-reg on  - print all registers before every executed instruction\n");
          dbg_printf("trace-reg off - disable registers state tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3546 "y.tab.c" /* yacc.c:1646  */
+#line 3689 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 209:
-#line 1077 "parser.y" /* yacc.c:1646  */
+  case 221:
+#line 1139 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("trace-mem on  - print all memory accesses occured during instruction execution\n");
          dbg_printf("trace-mem off - disable memory accesses tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3556 "y.tab.c" /* yacc.c:1646  */
+#line 3699 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 210:
-#line 1083 "parser.y" /* yacc.c:1646  */
+  case 222:
+#line 1145 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("restore <param_name> [path] - restore bochs root param from the file\n");
          dbg_printf("for example:\n");
@@ -3564,164 +3707,164 @@ yyreduce:
          dbg_printf("restore \"cpu0\" \"/save\" - restore CPU #0 from file \"cpu0\" located in directory \"/save\"\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3568 "y.tab.c" /* yacc.c:1646  */
+#line 3711 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 211:
-#line 1091 "parser.y" /* yacc.c:1646  */
+  case 223:
+#line 1153 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("ptime - print current time (number of ticks since start of simulation)\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3577 "y.tab.c" /* yacc.c:1646  */
+#line 3720 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 212:
-#line 1096 "parser.y" /* yacc.c:1646  */
+  case 224:
+#line 1158 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("sb <delta> - insert a time breakpoint delta instructions into the future\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3586 "y.tab.c" /* yacc.c:1646  */
+#line 3729 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 213:
-#line 1101 "parser.y" /* yacc.c:1646  */
+  case 225:
+#line 1163 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("sba <time> - insert breakpoint at specific time\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3595 "y.tab.c" /* yacc.c:1646  */
+#line 3738 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 214:
-#line 1106 "parser.y" /* yacc.c:1646  */
+  case 226:
+#line 1168 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("print-stack [num_words] - print the num_words top 16 bit words on the stack\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3604 "y.tab.c" /* yacc.c:1646  */
+#line 3747 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 215:
-#line 1111 "parser.y" /* yacc.c:1646  */
+  case 227:
+#line 1173 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("ldsym [global] <filename> [offset] - load symbols from file\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3613 "y.tab.c" /* yacc.c:1646  */
+#line 3756 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 216:
-#line 1116 "parser.y" /* yacc.c:1646  */
+  case 228:
+#line 1178 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("slist [string] - list symbols whose preffix is string (same as 'info symbols')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3622 "y.tab.c" /* yacc.c:1646  */
+#line 3765 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 217:
-#line 1121 "parser.y" /* yacc.c:1646  */
+  case 229:
+#line 1183 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("r|reg|regs|registers - list of CPU registers and their contents (same as 'info registers')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3631 "y.tab.c" /* yacc.c:1646  */
+#line 3774 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 218:
-#line 1126 "parser.y" /* yacc.c:1646  */
+  case 230:
+#line 1188 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("fp|fpu - print FPU state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3640 "y.tab.c" /* yacc.c:1646  */
+#line 3783 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 219:
-#line 1131 "parser.y" /* yacc.c:1646  */
+  case 231:
+#line 1193 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("mmx - print MMX state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3649 "y.tab.c" /* yacc.c:1646  */
+#line 3792 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 220:
-#line 1136 "parser.y" /* yacc.c:1646  */
+  case 232:
+#line 1198 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("xmm|sse - print SSE state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3658 "y.tab.c" /* yacc.c:1646  */
+#line 3801 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 221:
-#line 1141 "parser.y" /* yacc.c:1646  */
+  case 233:
+#line 1203 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("ymm - print AVX state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3667 "y.tab.c" /* yacc.c:1646  */
+#line 3810 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 222:
-#line 1146 "parser.y" /* yacc.c:1646  */
+  case 234:
+#line 1208 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("zmm - print AVX-512 state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3676 "y.tab.c" /* yacc.c:1646  */
+#line 3819 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 223:
-#line 1151 "parser.y" /* yacc.c:1646  */
+  case 235:
+#line 1213 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("sreg - show segment registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3685 "y.tab.c" /* yacc.c:1646  */
+#line 3828 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 224:
-#line 1156 "parser.y" /* yacc.c:1646  */
+  case 236:
+#line 1218 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("creg - show control registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3694 "y.tab.c" /* yacc.c:1646  */
+#line 3837 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 225:
-#line 1161 "parser.y" /* yacc.c:1646  */
+  case 237:
+#line 1223 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("dreg - show debug registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3703 "y.tab.c" /* yacc.c:1646  */
+#line 3846 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 226:
-#line 1166 "parser.y" /* yacc.c:1646  */
+  case 238:
+#line 1228 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("writemem <filename> <laddr> <len> - dump 'len' bytes of virtual memory starting from the linear address 'laddr' into the file\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3712 "y.tab.c" /* yacc.c:1646  */
+#line 3855 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 227:
-#line 1171 "parser.y" /* yacc.c:1646  */
+  case 239:
+#line 1233 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("setpmem <addr> <datasize> <val> - set physical memory location of size 'datasize' to value 'val'\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3721 "y.tab.c" /* yacc.c:1646  */
+#line 3864 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 228:
-#line 1176 "parser.y" /* yacc.c:1646  */
+  case 240:
+#line 1238 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("u|disasm [/count] <start> <end> - disassemble instructions for given linear address\n");
          dbg_printf("    Optional 'count' is the number of disassembled instructions\n");
@@ -3731,11 +3874,11 @@ yyreduce:
          dbg_printf("       when \"disassemble\" command is used.\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3735 "y.tab.c" /* yacc.c:1646  */
+#line 3878 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 229:
-#line 1186 "parser.y" /* yacc.c:1646  */
+  case 241:
+#line 1248 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("watch - print current watch point status\n");
          dbg_printf("watch stop - stop simulation when a watchpoint is encountred\n");
@@ -3746,21 +3889,21 @@ yyreduce:
          dbg_printf("watch w|write addr <len> - insert a write watch point at physical address addr with range <len>\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3750 "y.tab.c" /* yacc.c:1646  */
+#line 3893 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 230:
-#line 1197 "parser.y" /* yacc.c:1646  */
+  case 242:
+#line 1259 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("unwatch      - remove all watch points\n");
          dbg_printf("unwatch addr - remove a watch point\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3760 "y.tab.c" /* yacc.c:1646  */
+#line 3903 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 231:
-#line 1203 "parser.y" /* yacc.c:1646  */
+  case 243:
+#line 1265 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("x  /nuf <addr> - examine memory at linear address\n");
          dbg_printf("xp /nuf <addr> - examine memory at physical address\n");
@@ -3773,20 +3916,20 @@ yyreduce:
          dbg_printf("    m selects an alternative output format (memory dump)\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3777 "y.tab.c" /* yacc.c:1646  */
+#line 3920 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 232:
-#line 1216 "parser.y" /* yacc.c:1646  */
+  case 244:
+#line 1278 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("instrument <command> - calls BX_INSTR_DEBUG_CMD instrumentation callback with <command>\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3786 "y.tab.c" /* yacc.c:1646  */
+#line 3929 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 233:
-#line 1221 "parser.y" /* yacc.c:1646  */
+  case 245:
+#line 1283 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("set <regname> = <expr> - set register value to expression\n");
          dbg_printf("set eflags = <expr> - set eflags value to expression, not all flags can be modified\n");
@@ -3797,20 +3940,20 @@ yyreduce:
          dbg_printf("set u|disasm|disassemble off - same as 'set $auto_disassemble = 0'\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3801 "y.tab.c" /* yacc.c:1646  */
+#line 3944 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 234:
-#line 1232 "parser.y" /* yacc.c:1646  */
+  case 246:
+#line 1294 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("page <laddr> - show linear to physical xlation for linear address laddr\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3810 "y.tab.c" /* yacc.c:1646  */
+#line 3953 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 235:
-#line 1237 "parser.y" /* yacc.c:1646  */
+  case 247:
+#line 1299 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("info break - show information about current breakpoint status\n");
          dbg_printf("info cpu - show dump of all cpu registers\n");
@@ -3826,11 +3969,11 @@ yyreduce:
          dbg_printf("info device [string] [string] - show state of device with options\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3830 "y.tab.c" /* yacc.c:1646  */
+#line 3973 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 236:
-#line 1253 "parser.y" /* yacc.c:1646  */
+  case 248:
+#line 1315 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("show <command> - toggles show symbolic info (calls to begin with)\n");
          dbg_printf("show - shows current show mode\n");
@@ -3846,11 +3989,11 @@ yyreduce:
          dbg_printf("show dbg_none - turn off all bx_dbg flags\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3850 "y.tab.c" /* yacc.c:1646  */
+#line 3993 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 237:
-#line 1269 "parser.y" /* yacc.c:1646  */
+  case 249:
+#line 1331 "parser.y" /* yacc.c:1646  */
     {
          dbg_printf("calc|? <expr> - calculate a expression and display the result.\n");
          dbg_printf("    'expr' can reference any general-purpose, opmask and segment\n");
@@ -3860,391 +4003,391 @@ yyreduce:
          dbg_printf("    a selector:offset (in protected mode) pair.\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3864 "y.tab.c" /* yacc.c:1646  */
+#line 4007 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 238:
-#line 1279 "parser.y" /* yacc.c:1646  */
+  case 250:
+#line 1341 "parser.y" /* yacc.c:1646  */
     {
          bx_dbg_print_help();
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3873 "y.tab.c" /* yacc.c:1646  */
+#line 4016 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 239:
-#line 1284 "parser.y" /* yacc.c:1646  */
+  case 251:
+#line 1346 "parser.y" /* yacc.c:1646  */
     {
          bx_dbg_print_help();
          free((yyvsp[-1].sval));
        }
-#line 3882 "y.tab.c" /* yacc.c:1646  */
+#line 4025 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 240:
-#line 1292 "parser.y" /* yacc.c:1646  */
+  case 252:
+#line 1354 "parser.y" /* yacc.c:1646  */
     {
      eval_value = (yyvsp[-1].uval);
      bx_dbg_calc_command((yyvsp[-1].uval));
      free((yyvsp[-2].sval));
    }
-#line 3892 "y.tab.c" /* yacc.c:1646  */
+#line 4035 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 241:
-#line 1301 "parser.y" /* yacc.c:1646  */
+  case 253:
+#line 1363 "parser.y" /* yacc.c:1646  */
     {
      eval_value = (yyvsp[-1].uval) != 0;
      bx_dbg_calc_command((yyvsp[-1].uval));
      free((yyvsp[-2].sval));
    }
-#line 3902 "y.tab.c" /* yacc.c:1646  */
+#line 4045 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 242:
-#line 1310 "parser.y" /* yacc.c:1646  */
+  case 254:
+#line 1372 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[0].uval); }
-#line 3908 "y.tab.c" /* yacc.c:1646  */
+#line 4051 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 243:
-#line 1311 "parser.y" /* yacc.c:1646  */
+  case 255:
+#line 1373 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_symbol_value((yyvsp[0].sval)); free((yyvsp[0].sval));}
-#line 3914 "y.tab.c" /* yacc.c:1646  */
+#line 4057 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 244:
-#line 1312 "parser.y" /* yacc.c:1646  */
+  case 256:
+#line 1374 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg8l_value((yyvsp[0].uval)); }
-#line 3920 "y.tab.c" /* yacc.c:1646  */
+#line 4063 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 245:
-#line 1313 "parser.y" /* yacc.c:1646  */
+  case 257:
+#line 1375 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg8h_value((yyvsp[0].uval)); }
-#line 3926 "y.tab.c" /* yacc.c:1646  */
+#line 4069 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 246:
-#line 1314 "parser.y" /* yacc.c:1646  */
+  case 258:
+#line 1376 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg16_value((yyvsp[0].uval)); }
-#line 3932 "y.tab.c" /* yacc.c:1646  */
+#line 4075 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 247:
-#line 1315 "parser.y" /* yacc.c:1646  */
+  case 259:
+#line 1377 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg32_value((yyvsp[0].uval)); }
-#line 3938 "y.tab.c" /* yacc.c:1646  */
+#line 4081 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 248:
-#line 1316 "parser.y" /* yacc.c:1646  */
+  case 260:
+#line 1378 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg64_value((yyvsp[0].uval)); }
-#line 3944 "y.tab.c" /* yacc.c:1646  */
+#line 4087 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 249:
-#line 1317 "parser.y" /* yacc.c:1646  */
+  case 261:
+#line 1379 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_opmask_value((yyvsp[0].uval)); }
-#line 3950 "y.tab.c" /* yacc.c:1646  */
+#line 4093 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 250:
-#line 1318 "parser.y" /* yacc.c:1646  */
+  case 262:
+#line 1380 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_selector_value((yyvsp[0].uval)); }
-#line 3956 "y.tab.c" /* yacc.c:1646  */
+#line 4099 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 251:
-#line 1319 "parser.y" /* yacc.c:1646  */
+  case 263:
+#line 1381 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_ip (); }
-#line 3962 "y.tab.c" /* yacc.c:1646  */
+#line 4105 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 252:
-#line 1320 "parser.y" /* yacc.c:1646  */
+  case 264:
+#line 1382 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_eip(); }
-#line 3968 "y.tab.c" /* yacc.c:1646  */
+#line 4111 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 253:
-#line 1321 "parser.y" /* yacc.c:1646  */
+  case 265:
+#line 1383 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_rip(); }
-#line 3974 "y.tab.c" /* yacc.c:1646  */
+#line 4117 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 254:
-#line 1322 "parser.y" /* yacc.c:1646  */
+  case 266:
+#line 1384 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) + (yyvsp[0].uval); }
-#line 3980 "y.tab.c" /* yacc.c:1646  */
+#line 4123 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 255:
-#line 1323 "parser.y" /* yacc.c:1646  */
+  case 267:
+#line 1385 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) - (yyvsp[0].uval); }
-#line 3986 "y.tab.c" /* yacc.c:1646  */
+#line 4129 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 256:
-#line 1324 "parser.y" /* yacc.c:1646  */
+  case 268:
+#line 1386 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) * (yyvsp[0].uval); }
-#line 3992 "y.tab.c" /* yacc.c:1646  */
+#line 4135 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 257:
-#line 1325 "parser.y" /* yacc.c:1646  */
+  case 269:
+#line 1387 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) / (yyvsp[0].uval); }
-#line 3998 "y.tab.c" /* yacc.c:1646  */
+#line 4141 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 258:
-#line 1326 "parser.y" /* yacc.c:1646  */
+  case 270:
+#line 1388 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) >> (yyvsp[0].uval); }
-#line 4004 "y.tab.c" /* yacc.c:1646  */
+#line 4147 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 259:
-#line 1327 "parser.y" /* yacc.c:1646  */
+  case 271:
+#line 1389 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) << (yyvsp[0].uval); }
-#line 4010 "y.tab.c" /* yacc.c:1646  */
+#line 4153 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 260:
-#line 1328 "parser.y" /* yacc.c:1646  */
+  case 272:
+#line 1390 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) | (yyvsp[0].uval); }
-#line 4016 "y.tab.c" /* yacc.c:1646  */
+#line 4159 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 261:
-#line 1329 "parser.y" /* yacc.c:1646  */
+  case 273:
+#line 1391 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) ^ (yyvsp[0].uval); }
-#line 4022 "y.tab.c" /* yacc.c:1646  */
+#line 4165 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 262:
-#line 1330 "parser.y" /* yacc.c:1646  */
+  case 274:
+#line 1392 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) & (yyvsp[0].uval); }
-#line 4028 "y.tab.c" /* yacc.c:1646  */
+#line 4171 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 263:
-#line 1331 "parser.y" /* yacc.c:1646  */
+  case 275:
+#line 1393 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = !(yyvsp[0].uval); }
-#line 4034 "y.tab.c" /* yacc.c:1646  */
+#line 4177 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 264:
-#line 1332 "parser.y" /* yacc.c:1646  */
+  case 276:
+#line 1394 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = -(yyvsp[0].uval); }
-#line 4040 "y.tab.c" /* yacc.c:1646  */
+#line 4183 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 265:
-#line 1333 "parser.y" /* yacc.c:1646  */
+  case 277:
+#line 1395 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-1].uval); }
-#line 4046 "y.tab.c" /* yacc.c:1646  */
+#line 4189 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 266:
-#line 1339 "parser.y" /* yacc.c:1646  */
+  case 278:
+#line 1401 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[0].uval); }
-#line 4052 "y.tab.c" /* yacc.c:1646  */
+#line 4195 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 267:
-#line 1340 "parser.y" /* yacc.c:1646  */
+  case 279:
+#line 1402 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_symbol_value((yyvsp[0].sval)); free((yyvsp[0].sval));}
-#line 4058 "y.tab.c" /* yacc.c:1646  */
+#line 4201 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 268:
-#line 1341 "parser.y" /* yacc.c:1646  */
+  case 280:
+#line 1403 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg8l_value((yyvsp[0].uval)); }
-#line 4064 "y.tab.c" /* yacc.c:1646  */
+#line 4207 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 269:
-#line 1342 "parser.y" /* yacc.c:1646  */
+  case 281:
+#line 1404 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg8h_value((yyvsp[0].uval)); }
-#line 4070 "y.tab.c" /* yacc.c:1646  */
+#line 4213 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 270:
-#line 1343 "parser.y" /* yacc.c:1646  */
+  case 282:
+#line 1405 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg16_value((yyvsp[0].uval)); }
-#line 4076 "y.tab.c" /* yacc.c:1646  */
+#line 4219 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 271:
-#line 1344 "parser.y" /* yacc.c:1646  */
+  case 283:
+#line 1406 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg32_value((yyvsp[0].uval)); }
-#line 4082 "y.tab.c" /* yacc.c:1646  */
+#line 4225 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 272:
-#line 1345 "parser.y" /* yacc.c:1646  */
+  case 284:
+#line 1407 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_reg64_value((yyvsp[0].uval)); }
-#line 4088 "y.tab.c" /* yacc.c:1646  */
+#line 4231 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 273:
-#line 1346 "parser.y" /* yacc.c:1646  */
+  case 285:
+#line 1408 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_opmask_value((yyvsp[0].uval)); }
-#line 4094 "y.tab.c" /* yacc.c:1646  */
+#line 4237 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 274:
-#line 1347 "parser.y" /* yacc.c:1646  */
+  case 286:
+#line 1409 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_selector_value((yyvsp[0].uval)); }
-#line 4100 "y.tab.c" /* yacc.c:1646  */
+#line 4243 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 275:
-#line 1348 "parser.y" /* yacc.c:1646  */
+  case 287:
+#line 1410 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_ip (); }
-#line 4106 "y.tab.c" /* yacc.c:1646  */
+#line 4249 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 276:
-#line 1349 "parser.y" /* yacc.c:1646  */
+  case 288:
+#line 1411 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_eip(); }
-#line 4112 "y.tab.c" /* yacc.c:1646  */
+#line 4255 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 277:
-#line 1350 "parser.y" /* yacc.c:1646  */
+  case 289:
+#line 1412 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_rip(); }
-#line 4118 "y.tab.c" /* yacc.c:1646  */
+#line 4261 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 278:
-#line 1351 "parser.y" /* yacc.c:1646  */
+  case 290:
+#line 1413 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_get_laddr ((yyvsp[-2].uval), (yyvsp[0].uval)); }
-#line 4124 "y.tab.c" /* yacc.c:1646  */
+#line 4267 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 279:
-#line 1352 "parser.y" /* yacc.c:1646  */
+  case 291:
+#line 1414 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) + (yyvsp[0].uval); }
-#line 4130 "y.tab.c" /* yacc.c:1646  */
+#line 4273 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 280:
-#line 1353 "parser.y" /* yacc.c:1646  */
+  case 292:
+#line 1415 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) - (yyvsp[0].uval); }
-#line 4136 "y.tab.c" /* yacc.c:1646  */
+#line 4279 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 281:
-#line 1354 "parser.y" /* yacc.c:1646  */
+  case 293:
+#line 1416 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) * (yyvsp[0].uval); }
-#line 4142 "y.tab.c" /* yacc.c:1646  */
+#line 4285 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 282:
-#line 1355 "parser.y" /* yacc.c:1646  */
+  case 294:
+#line 1417 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = ((yyvsp[0].uval) != 0) ? (yyvsp[-2].uval) / (yyvsp[0].uval) : 0; }
-#line 4148 "y.tab.c" /* yacc.c:1646  */
+#line 4291 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 283:
-#line 1356 "parser.y" /* yacc.c:1646  */
+  case 295:
+#line 1418 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) >> (yyvsp[0].uval); }
-#line 4154 "y.tab.c" /* yacc.c:1646  */
+#line 4297 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 284:
-#line 1357 "parser.y" /* yacc.c:1646  */
+  case 296:
+#line 1419 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) << (yyvsp[0].uval); }
-#line 4160 "y.tab.c" /* yacc.c:1646  */
+#line 4303 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 285:
-#line 1358 "parser.y" /* yacc.c:1646  */
+  case 297:
+#line 1420 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) | (yyvsp[0].uval); }
-#line 4166 "y.tab.c" /* yacc.c:1646  */
+#line 4309 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 286:
-#line 1359 "parser.y" /* yacc.c:1646  */
+  case 298:
+#line 1421 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) ^ (yyvsp[0].uval); }
-#line 4172 "y.tab.c" /* yacc.c:1646  */
+#line 4315 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 287:
-#line 1360 "parser.y" /* yacc.c:1646  */
+  case 299:
+#line 1422 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) & (yyvsp[0].uval); }
-#line 4178 "y.tab.c" /* yacc.c:1646  */
+#line 4321 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 288:
-#line 1361 "parser.y" /* yacc.c:1646  */
+  case 300:
+#line 1423 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) > (yyvsp[0].uval); }
-#line 4184 "y.tab.c" /* yacc.c:1646  */
+#line 4327 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 289:
-#line 1362 "parser.y" /* yacc.c:1646  */
+  case 301:
+#line 1424 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) < (yyvsp[0].uval); }
-#line 4190 "y.tab.c" /* yacc.c:1646  */
+#line 4333 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 290:
-#line 1363 "parser.y" /* yacc.c:1646  */
+  case 302:
+#line 1425 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) == (yyvsp[0].uval); }
-#line 4196 "y.tab.c" /* yacc.c:1646  */
+#line 4339 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 291:
-#line 1364 "parser.y" /* yacc.c:1646  */
+  case 303:
+#line 1426 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) != (yyvsp[0].uval); }
-#line 4202 "y.tab.c" /* yacc.c:1646  */
+#line 4345 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 292:
-#line 1365 "parser.y" /* yacc.c:1646  */
+  case 304:
+#line 1427 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) <= (yyvsp[0].uval); }
-#line 4208 "y.tab.c" /* yacc.c:1646  */
+#line 4351 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 293:
-#line 1366 "parser.y" /* yacc.c:1646  */
+  case 305:
+#line 1428 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-2].uval) >= (yyvsp[0].uval); }
-#line 4214 "y.tab.c" /* yacc.c:1646  */
+#line 4357 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 294:
-#line 1367 "parser.y" /* yacc.c:1646  */
+  case 306:
+#line 1429 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = !(yyvsp[0].uval); }
-#line 4220 "y.tab.c" /* yacc.c:1646  */
+#line 4363 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 295:
-#line 1368 "parser.y" /* yacc.c:1646  */
+  case 307:
+#line 1430 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = -(yyvsp[0].uval); }
-#line 4226 "y.tab.c" /* yacc.c:1646  */
+#line 4369 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 296:
-#line 1369 "parser.y" /* yacc.c:1646  */
+  case 308:
+#line 1431 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_lin_indirect((yyvsp[0].uval)); }
-#line 4232 "y.tab.c" /* yacc.c:1646  */
+#line 4375 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 297:
-#line 1370 "parser.y" /* yacc.c:1646  */
+  case 309:
+#line 1432 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = bx_dbg_phy_indirect((yyvsp[0].uval)); }
-#line 4238 "y.tab.c" /* yacc.c:1646  */
+#line 4381 "y.tab.c" /* yacc.c:1646  */
     break;
 
-  case 298:
-#line 1371 "parser.y" /* yacc.c:1646  */
+  case 310:
+#line 1433 "parser.y" /* yacc.c:1646  */
     { (yyval.uval) = (yyvsp[-1].uval); }
-#line 4244 "y.tab.c" /* yacc.c:1646  */
+#line 4387 "y.tab.c" /* yacc.c:1646  */
     break;
 
 
-#line 4248 "y.tab.c" /* yacc.c:1646  */
+#line 4391 "y.tab.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4472,7 +4615,7 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 1374 "parser.y" /* yacc.c:1906  */
+#line 1436 "parser.y" /* yacc.c:1906  */
 
 #endif  /* if BX_DEBUGGER */
 /* The #endif is appended by the makefile after running yacc. */
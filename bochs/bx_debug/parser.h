@@ -154,9 +154,12 @@ extern int bxdebug;
     BX_TOKEN_REG_IP = 364,
     BX_TOKEN_REG_EIP = 365,
     BX_TOKEN_REG_RIP = 366,
-    NOT = 367,
-    NEG = 368,
-    INDIRECT = 369
+    BX_TOKEN_REVERSE_STEP = 367,
+    BX_TOKEN_REVERSE_CONTINUE = 368,
+    BX_TOKEN_REVEXEC = 369,
+    NOT = 370,
+    NEG = 371,
+    INDIRECT = 372
   };
 #endif
 /* Tokens.  */
@@ -269,9 +272,12 @@ extern int bxdebug;
 #define BX_TOKEN_REG_IP 364
 #define BX_TOKEN_REG_EIP 365
 #define BX_TOKEN_REG_RIP 366
-#define NOT 367
-#define NEG 368
-#define INDIRECT 369
+#define BX_TOKEN_REVERSE_STEP 367
+#define BX_TOKEN_REVERSE_CONTINUE 368
+#define BX_TOKEN_REVEXEC 369
+#define NOT 370
+#define NEG 371
+#define INDIRECT 372
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -284,7 +290,7 @@ union YYSTYPE
   Bit64u   uval;
   bx_bool  bval;
 
-#line 288 "y.tab.h" /* yacc.c:1909  */
+#line 294 "y.tab.h" /* yacc.c:1909  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -131,6 +131,9 @@ Bit64u eval_value;
 %token BX_TOKEN_REG_IP
 %token BX_TOKEN_REG_EIP
 %token BX_TOKEN_REG_RIP
+%token <sval> BX_TOKEN_REVERSE_STEP
+%token <sval> BX_TOKEN_REVERSE_CONTINUE
+%token <sval> BX_TOKEN_REVEXEC
 %type <uval> optional_numeric
 %type <uval> vexpression
 %type <uval> expression
@@ -152,6 +155,9 @@ command:
       continue_command
     | stepN_command
     | step_over_command
+    | reverse_step_command
+    | reverse_continue_command
+    | revexec_command
     | set_command
     | breakpoint_command
     | info_command
@@ -505,6 +511,45 @@ step_over_command:
       }
     ;
 
+reverse_step_command:
+      BX_TOKEN_REVERSE_STEP '\n'
+      {
+        bx_dbg_reverse_step_command(1);
+        free($1);
+      }
+    | BX_TOKEN_REVERSE_STEP BX_TOKEN_NUMERIC '\n'
+      {
+        bx_dbg_reverse_step_command($2);
+        free($1);
+      }
+    ;
+
+reverse_continue_command:
+      BX_TOKEN_REVERSE_CONTINUE '\n'
+      {
+        bx_dbg_reverse_continue_command();
+        free($1);
+      }
+    ;
+
+revexec_command:
+      BX_TOKEN_REVEXEC '\n'
+      {
+        bx_dbg_revexec_command(-1, 0);
+        free($1);
+      }
+    | BX_TOKEN_REVEXEC BX_TOKEN_TOGGLE_ON_OFF '\n'
+      {
+        bx_dbg_revexec_command($2, 0);
+        free($1);
+      }
+    | BX_TOKEN_REVEXEC BX_TOKEN_ON BX_TOKEN_NUMERIC '\n'
+      {
+        bx_dbg_revexec_command(1, $3);
+        free($1);
+      }
+    ;
+
 set_command:
       BX_TOKEN_SET BX_TOKEN_DISASM BX_TOKEN_TOGGLE_ON_OFF '\n'
       {
@@ -1008,6 +1053,23 @@ help_command:
          dbg_printf("n|next|p - execute instruction stepping over subroutines\n");
          free($1);free($2);
        }
+     | BX_TOKEN_HELP BX_TOKEN_REVERSE_STEP '\n'
+       {
+         dbg_printf("rs|reverse-stepi [count] - go back #count instructions (default is one instruction)\n");
+         free($1);free($2);
+       }
+     | BX_TOKEN_HELP BX_TOKEN_REVERSE_CONTINUE '\n'
+       {
+         dbg_printf("rc|reverse-continue - go back to the previous breakpoint or watchpoint hit\n");
+         free($1);free($2);
+       }
+     | BX_TOKEN_HELP BX_TOKEN_REVEXEC '\n'
+       {
+         dbg_printf("revexec on [interval] - record checkpoints every #interval instructions for reverse execution\n");
+         dbg_printf("revexec off - stop recording and drop all checkpoints\n");
+         dbg_printf("revexec - show the reverse execution checkpoints\n");
+         free($1);free($2);
+       }
      | BX_TOKEN_HELP BX_TOKEN_VBREAKPOINT '\n'
        {
          dbg_printf("vb|vbreak <seg:offset> - set a virtual address instruction breakpoint\n");
@@ -2,7 +2,7 @@
 // $Id$
 /////////////////////////////////////////////////////////////////////////
 //
-//  Copyright (C) 2001-2014  The Bochs Project
+//  Copyright (C) 2001-2026  The Bochs Project
 //
 //  This library is free software; you can redistribute it and/or
 //  modify it under the terms of the GNU Lesser General Public
@@ -23,7 +23,7 @@
 #include "cpu/cpu.h"
 
 #if BX_DEBUGGER
-#if !((BX_HAVE_MAP || BX_HAVE_MAP_H) && (BX_HAVE_SET || BX_HAVE_SET_H))
+#if !(BX_HAVE_MAP || BX_HAVE_MAP_H)
 
 static const char BX_HAVE_MAP_ERR[] = "context not implemented because BX_HAVE_MAP=0\n";
 
@@ -72,74 +72,85 @@ const char* bx_dbg_disasm_symbolic_address(bx_address eip, bx_address base)
 #include <map.h>
 #endif
 
-#if BX_HAVE_SET
-#include <set>
-#elif BX_HAVE_SET_H
-#include <set.h>
+#if BX_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
 #endif
 
+// The symbols of a context are kept in flat arrays: the entries sorted by
+// address, the names in a single string pool, an index of the entries sorted
+// by name and a hash table for exact name lookups. A symbol file is parsed in
+// one go, then sorted and indexed once. The result is written to a cache file
+// ("<symbol file>.bxsym") with the same layout, so that loading the same file
+// again only has to map it.
+
 struct symbol_entry_t
 {
-  symbol_entry_t (bx_address _start = 0, const char* _name = 0)
-  {
-    start = _start;
-    name = _name ? strdup(_name) : 0;
-  }
-  ~symbol_entry_t()
-  {
-    if (name)
-      free(name);
-  }
-
-  void trim_quotes(void);
-
-  char* name;
   bx_address start;
-
-private:
-  symbol_entry_t(const symbol_entry_t&);  // No definition
-  void operator=(const symbol_entry_t &); // No definition
+  Bit32u name;      // offset of the name in the string pool
 };
 
-struct lt_symbol_entry_t
-{
-  bool operator()(const symbol_entry_t* s1, const symbol_entry_t* s2) const
-  {
-    return s1->start < s2->start;
-  }
-};
-
-struct lt_rsymbol_entry_t
-{
-  bool operator()(const symbol_entry_t* s1, const symbol_entry_t* s2) const
-  {
-    return strcoll(s1->name, s2->name) < 0;
-  }
-};
+#define BX_SYMCACHE_MAGIC   0x59535842  // "BXSY"
+#define BX_SYMCACHE_VERSION 1
+
+// cache file layout: header, entries, name index, hash table, string pool
+typedef struct {
+  Bit32u magic;
+  Bit32u version;
+  Bit32u entry_size;
+  Bit32u num_syms;
+  Bit32u hash_size;
+  Bit32u pool_len;
+  Bit64u src_size;
+  Bit64u src_mtime;
+  Bit64u offset;
+} bx_symcache_header_t;
 
 struct context_t
 {
-  typedef std::set<symbol_entry_t*,lt_symbol_entry_t>  sym_set_t;
-  typedef std::set<symbol_entry_t*,lt_rsymbol_entry_t> rsym_set_t;
   typedef std::map<bx_address,context_t*> map_t;
 
   context_t (bx_address);
  ~context_t();
 
   static context_t* get_context(bx_address);
-  symbol_entry_t* get_symbol_entry(bx_address);
-  symbol_entry_t* get_symbol_entry(const char *symbol) const;
-  void add_symbol(symbol_entry_t*);
-  const sym_set_t* get_all_symbols() const {return &m_syms;}
-  const rsym_set_t* get_all_rsymbols() const {return &m_rsyms;}
+  const symbol_entry_t* get_symbol_entry(bx_address) const;
+  const symbol_entry_t* get_symbol_entry(const char *symbol) const;
+  const char* get_name(const symbol_entry_t *sym) const { return m_pool + sym->name; }
+
+  bool empty() const { return m_num == 0; }
+  unsigned get_num_symbols() const { return m_num; }
+  const symbol_entry_t* get_symbol(unsigned n) const { return &m_syms[n]; }
+  // n-th symbol in name order
+  const symbol_entry_t* get_rsymbol(unsigned n) const { return &m_syms[m_rsyms[n]]; }
+  unsigned find_rsymbol(const char *symbol) const;
+
+  void add_symbol(bx_address start, const char *name);
+  void build_index(void);
+
+  bool load_cache(const char *path, const struct stat *src, bx_address offset);
+  void save_cache(const char *path, const struct stat *src, bx_address offset) const;
 
-  friend class context_dtor_t;
 protected:
   static map_t s_map;
-  // Forvard references (find name by address)
-  sym_set_t m_syms;
-  // Reverse references (find address by name)
-  rsym_set_t m_rsyms;
+  static Bit32u hash_name(const char *name);
+  void release_storage(void);
+  void unshare(void);
+
+  // Forward references (find name by address), sorted by address
+  symbol_entry_t *m_syms;
+  unsigned m_num, m_max;
+  // String pool
+  char *m_pool;
+  Bit32u m_pool_len, m_pool_max;
+  // Reverse references (find address by name): entry numbers sorted by
+  // name and an open addressing hash table of entry number + 1
+  Bit32u *m_rsyms;
+  Bit32u *m_hash;
+  Bit32u m_hash_size;
+  // cache file image the arrays point into (if any)
+  void *m_image;
+  size_t m_image_len;
+  bool m_image_mapped;
   bx_address m_id;
 };
 
@@ -147,71 +158,345 @@ context_t::map_t context_t::s_map;
 
 context_t::context_t (bx_address id)
 {
+  m_syms = NULL;
+  m_num = m_max = 0;
+  m_pool = NULL;
+  m_pool_len = m_pool_max = 0;
+  m_rsyms = m_hash = NULL;
+  m_hash_size = 0;
+  m_image = NULL;
+  m_image_len = 0;
+  m_image_mapped = 0;
   m_id = id;
   s_map[m_id] = this;
 }
 
 context_t::~context_t()
 {
-  while (!m_syms.empty())
-  {
-    sym_set_t::iterator it = m_syms.begin();
-    symbol_entry_t *sym = *it;
-    m_syms.erase(it);
-    delete sym;
+  release_storage();
+}
+
+static void bx_dbg_free_image(void *image, size_t len, bool mapped)
+{
+#if BX_HAVE_SYS_MMAN_H
+  if (mapped) {
+    munmap(image, len);
+    return;
   }
+#endif
+  free(image);
+}
+
+void context_t::release_storage(void)
+{
+  if (m_image) {
+    bx_dbg_free_image(m_image, m_image_len, m_image_mapped);
+    m_image = NULL;
+  } else {
+    free(m_syms);
+    free(m_pool);
+    free(m_rsyms);
+    free(m_hash);
+  }
+  m_syms = NULL;
+  m_pool = NULL;
+  m_rsyms = m_hash = NULL;
+  m_num = m_max = 0;
+  m_pool_len = m_pool_max = 0;
+  m_hash_size = 0;
+}
+
+// copy the arrays out of a cache file image before modifying them
+void context_t::unshare(void)
+{
+  if (!m_image) return;
+
+  unsigned num = m_num;
+  Bit32u pool_len = m_pool_len;
+  symbol_entry_t *syms = (symbol_entry_t*) malloc((num + 1) * sizeof(symbol_entry_t));
+  char *pool = (char*) malloc(pool_len + 1);
+  memcpy(syms, m_syms, num * sizeof(symbol_entry_t));
+  memcpy(pool, m_pool, pool_len);
+  release_storage();
+  m_syms = syms;
+  m_num = num;
+  m_max = num + 1;
+  m_pool = pool;
+  m_pool_len = pool_len;
+  m_pool_max = pool_len + 1;
 }
 
 context_t* context_t::get_context(bx_address i)
 {
-  return s_map[i];
+  map_t::const_iterator iter = s_map.find(i);
+  return (iter != s_map.end()) ? iter->second : 0;
+}
+
+Bit32u context_t::hash_name(const char *name)
+{
+  Bit32u hash = 2166136261U;  // FNV-1a
+  while (*name) {
+    hash ^= (Bit8u) *name++;
+    hash *= 16777619U;
+  }
+  return hash;
 }
 
-symbol_entry_t* context_t::get_symbol_entry(bx_address ip)
+// Find the symbol containing ip: the last one starting at or below ip. If
+// there are several symbols at this address, the first loaded one is used.
+const symbol_entry_t* context_t::get_symbol_entry(bx_address ip) const
 {
-  symbol_entry_t probe(ip, 0);
+  unsigned lo = 0, hi = m_num;
+
   // find the first symbol whose address is greater than ip.
-  if (m_syms.empty ())
-      return 0;
-  sym_set_t::iterator iter = m_syms.upper_bound(&probe);
+  while (lo < hi) {
+    unsigned mid = lo + (hi - lo) / 2;
+    if (m_syms[mid].start <= ip)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo == 0 || lo == m_num) // No symbol found
+    return 0;
+
+  --lo;
+  while (lo > 0 && m_syms[lo - 1].start == m_syms[lo].start)
+    --lo;
+  return &m_syms[lo];
+}
 
-  if (iter == m_syms.end()) { // No symbol found
+const symbol_entry_t* context_t::get_symbol_entry(const char *symbol) const
+{
+  if (m_hash_size == 0)
     return 0;
+
+  Bit32u mask = m_hash_size - 1;
+  for (Bit32u h = hash_name(symbol) & mask; m_hash[h] != 0; h = (h + 1) & mask) {
+    const symbol_entry_t *sym = &m_syms[m_hash[h] - 1];
+    if (!strcmp(get_name(sym), symbol))
+      return sym;
   }
+  return 0; // No symbol found
+}
 
-  --iter;
-  if(iter == m_syms.end())
-      return 0;
-  return *iter;
+// position of the first symbol in name order not less than symbol
+unsigned context_t::find_rsymbol(const char *symbol) const
+{
+  unsigned lo = 0, hi = m_num;
+
+  while (lo < hi) {
+    unsigned mid = lo + (hi - lo) / 2;
+    if (strcoll(get_name(get_rsymbol(mid)), symbol) < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
 }
 
-symbol_entry_t* context_t::get_symbol_entry(const char *symbol) const
+void context_t::add_symbol(bx_address start, const char *name)
 {
-  if (m_rsyms.empty())
+  unshare();
+
+  Bit32u len = (Bit32u) strlen(name) + 1;
+  if (m_num == m_max) {
+    m_max = m_max ? m_max * 2 : 256;
+    m_syms = (symbol_entry_t*) realloc(m_syms, m_max * sizeof(symbol_entry_t));
+  }
+  while (m_pool_len + len > m_pool_max) {
+    m_pool_max = m_pool_max ? m_pool_max * 2 : 4096;
+    m_pool = (char*) realloc(m_pool, m_pool_max);
+  }
+  memcpy(m_pool + m_pool_len, name, len);
+  m_syms[m_num].start = start;
+  m_syms[m_num].name = m_pool_len;
+  m_num++;
+  m_pool_len += len;
+}
+
+// Names are appended to the pool in load order, so the pool offset is used
+// as tie breaker to keep the first loaded of several equal entries first.
+
+static int cmp_symbol_address(const void *a, const void *b)
+{
+  const symbol_entry_t *s1 = (const symbol_entry_t*) a;
+  const symbol_entry_t *s2 = (const symbol_entry_t*) b;
+  if (s1->start != s2->start)
+    return (s1->start < s2->start) ? -1 : 1;
+  return (s1->name < s2->name) ? -1 : (s1->name > s2->name);
+}
+
+static const context_t *sort_context;
+
+static int cmp_symbol_name(const void *a, const void *b)
+{
+  const symbol_entry_t *s1 = sort_context->get_symbol(*(const Bit32u*) a);
+  const symbol_entry_t *s2 = sort_context->get_symbol(*(const Bit32u*) b);
+  int cmp = strcoll(sort_context->get_name(s1), sort_context->get_name(s2));
+  if (cmp != 0)
+    return cmp;
+  return (s1->name < s2->name) ? -1 : (s1->name > s2->name);
+}
+
+void context_t::build_index(void)
+{
+  unsigned n;
+
+  unshare();
+  free(m_rsyms);
+  free(m_hash);
+  m_rsyms = m_hash = NULL;
+  m_hash_size = 0;
+  if (m_num == 0) return;
+
+  qsort(m_syms, m_num, sizeof(symbol_entry_t), cmp_symbol_address);
+
+  m_rsyms = (Bit32u*) malloc(m_num * sizeof(Bit32u));
+  for (n = 0; n < m_num; n++)
+    m_rsyms[n] = n;
+  sort_context = this;
+  qsort(m_rsyms, m_num, sizeof(Bit32u), cmp_symbol_name);
+
+  // insert in name order, so the first loaded of several equal names is found
+  m_hash_size = 16;
+  while (m_hash_size < m_num * 2)
+    m_hash_size <<= 1;
+  m_hash = (Bit32u*) calloc(m_hash_size, sizeof(Bit32u));
+  Bit32u mask = m_hash_size - 1;
+  for (n = 0; n < m_num; n++) {
+    const symbol_entry_t *sym = get_rsymbol(n);
+    if (n > 0 && !strcmp(get_name(get_rsymbol(n - 1)), get_name(sym)))
+      continue;
+    Bit32u h = hash_name(get_name(sym)) & mask;
+    while (m_hash[h] != 0)
+      h = (h + 1) & mask;
+    m_hash[h] = m_rsyms[n] + 1;
+  }
+}
+
+bool context_t::load_cache(const char *path, const struct stat *src, bx_address offset)
+{
+  struct stat st;
+  bx_symcache_header_t header;
+  unsigned n;
+
+  FILE *fp = fopen(path, "rb");
+  if (!fp)
     return 0;
+  // the cache must be newer than the symbol file it was created from
+  if ((fstat(fileno(fp), &st) != 0) || (st.st_mtime < src->st_mtime) ||
+      (fread(&header, sizeof(header), 1, fp) != 1) ||
+      (header.magic != BX_SYMCACHE_MAGIC) || (header.version != BX_SYMCACHE_VERSION) ||
+      (header.entry_size != sizeof(symbol_entry_t)) ||
+      (header.src_size != (Bit64u) src->st_size) ||
+      (header.src_mtime != (Bit64u) src->st_mtime) || (header.offset != (Bit64u) offset) ||
+      (header.num_syms == 0) || (header.pool_len == 0) ||
+      (header.hash_size & (header.hash_size - 1)) || (header.hash_size <= header.num_syms) ||
+      ((Bit64u) st.st_size != sizeof(header) + (Bit64u) header.num_syms * (sizeof(symbol_entry_t) + 4) +
+                              (Bit64u) header.hash_size * 4 + header.pool_len)) {
+    fclose(fp);
+    return 0;
+  }
 
-  symbol_entry_t probe(0, symbol);
-  rsym_set_t::const_iterator iter;
-  iter=m_rsyms.find(&probe);
-  if(iter==m_rsyms.end()) // No symbol found
+  size_t len = (size_t) st.st_size;
+  void *image = NULL;
+  bool mapped = 0;
+#if BX_HAVE_SYS_MMAN_H
+  image = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+  if (image == MAP_FAILED)
+    image = NULL;
+  else
+    mapped = 1;
+#endif
+  if (image == NULL) {
+    image = malloc(len);
+    if ((fseek(fp, 0, SEEK_SET) != 0) || (fread(image, 1, len, fp) != len)) {
+      free(image);
+      fclose(fp);
+      return 0;
+    }
+  }
+  fclose(fp);
+
+  symbol_entry_t *syms = (symbol_entry_t*)((Bit8u*) image + sizeof(header));
+  Bit32u *rsyms = (Bit32u*)(syms + header.num_syms);
+  Bit32u *hash = rsyms + header.num_syms;
+  char *pool = (char*)(hash + header.hash_size);
+
+  // only check that the indices are in range, no parsing or sorting required
+  bool valid = (pool[header.pool_len - 1] == 0);
+  for (n = 0; valid && n < header.num_syms; n++) {
+    valid = (syms[n].name < header.pool_len) && (rsyms[n] < header.num_syms);
+  }
+  // the hash lookup stops at an empty slot, there must be one
+  Bit32u used = 0;
+  for (n = 0; valid && n < header.hash_size; n++) {
+    valid = (hash[n] <= header.num_syms);
+    if (hash[n] != 0) used++;
+  }
+  if (used > header.num_syms)
+    valid = 0;
+  if (!valid) {
+    bx_dbg_free_image(image, len, mapped);
     return 0;
-  return *iter;
+  }
+
+  release_storage();
+  m_image = image;
+  m_image_len = len;
+  m_image_mapped = mapped;
+  m_syms = syms;
+  m_num = header.num_syms;
+  m_rsyms = rsyms;
+  m_hash = hash;
+  m_hash_size = header.hash_size;
+  m_pool = pool;
+  m_pool_len = header.pool_len;
+  return 1;
 }
 
-void context_t::add_symbol(symbol_entry_t* sym)
+void context_t::save_cache(const char *path, const struct stat *src, bx_address offset) const
 {
-  m_syms.insert(sym);
-  m_rsyms.insert(sym);
+  bx_symcache_header_t header;
+
+  if (m_num == 0) return;
+
+  memset(&header, 0, sizeof(header));
+  header.magic = BX_SYMCACHE_MAGIC;
+  header.version = BX_SYMCACHE_VERSION;
+  header.entry_size = sizeof(symbol_entry_t);
+  header.num_syms = m_num;
+  header.hash_size = m_hash_size;
+  header.pool_len = m_pool_len;
+  header.src_size = (Bit64u) src->st_size;
+  header.src_mtime = (Bit64u) src->st_mtime;
+  header.offset = (Bit64u) offset;
+
+  // the cache is optional, it is silently skipped if it can't be written
+  FILE *fp = fopen(path, "wb");
+  if (!fp) return;
+  bool ok = (fwrite(&header, sizeof(header), 1, fp) == 1) &&
+            (fwrite(m_syms, sizeof(symbol_entry_t), m_num, fp) == m_num) &&
+            (fwrite(m_rsyms, sizeof(Bit32u), m_num, fp) == m_num) &&
+            (fwrite(m_hash, sizeof(Bit32u), m_hash_size, fp) == m_hash_size) &&
+            (fwrite(m_pool, 1, m_pool_len, fp) == m_pool_len);
+  if (fclose(fp) != 0)
+    ok = 0;
+  if (!ok)
+    remove(path);
 }
 
-void symbol_entry_t::trim_quotes(void)
+// returns a copy of the string with leading and trailing quotes removed
+static char* bx_dbg_strdup_unquoted(const char *str)
 {
+  char *name = strdup(str);
   size_t len = strlen(name);
-  if (name[0] == '\"' && name[len-1] == '\"')
+  if (len >= 2 && name[0] == '\"' && name[len-1] == '\"')
   {
     memmove(name, name+1, len);
     name[len-2] = 0;
   }
+  return name;
 }
 
 bx_address bx_dbg_get_symbol_value(const char *symbol)
@@ -220,10 +505,9 @@ bx_address bx_dbg_get_symbol_value(const char *symbol)
   if(!cntx) // Context not found
     return 0;
 
-  symbol_entry_t s(0, symbol);
-  s.trim_quotes();
-
-  symbol_entry_t* sym=cntx->get_symbol_entry(s.name);
+  char *name = bx_dbg_strdup_unquoted(symbol);
+  const symbol_entry_t* sym=cntx->get_symbol_entry(name);
+  free(name);
   if(!sym) // symbol not found
     return 0;
 
@@ -245,12 +529,12 @@ const char* bx_dbg_symbolic_address(bx_address context, bx_address xip, bx_addre
     }
   }
   // full linear address not only xip (for nonzero based segments)
-  symbol_entry_t* entr = cntx->get_symbol_entry(base+xip);
+  const symbol_entry_t* entr = cntx->get_symbol_entry(base+xip);
   if (!entr) {
     snprintf (buf, 80, "no symbol");
     return buf;
   }
-  snprintf (buf, 80, "%s+%x", entr->name, (base+xip) - entr->start);
+  snprintf (buf, 80, "%s+%x", cntx->get_name(entr), (unsigned)((base+xip) - entr->start));
   return buf;
 }
 
@@ -265,18 +549,18 @@ const char* bx_dbg_disasm_symbolic_address(bx_address xip, bx_address base)
   }
 
   // full linear address not only xip (for nonzero based segments)
-  symbol_entry_t* entr = cntx->get_symbol_entry(base+xip);
+  const symbol_entry_t* entr = cntx->get_symbol_entry(base+xip);
   if (!entr) {
     return 0;
   }
-  snprintf (buf, 80, "%s+%" FMT_64 "x", entr->name, (base+xip) - entr->start);
+  snprintf (buf, 80, "%s+%" FMT_64 "x", cntx->get_name(entr), (Bit64u)((base+xip) - entr->start));
   return buf;
 }
 
 int bx_dbg_symbol_command(const char* filename, bx_bool global, bx_address offset)
 {
-  symbol_entry_t file(0, filename);
-  file.trim_quotes();
+  char *file_name = bx_dbg_strdup_unquoted(filename);
+  struct stat src;
 
   // Install symbols in correct context (page table)
   // The file format should be
@@ -290,15 +574,30 @@ int bx_dbg_symbol_command(const char* filename, bx_bool global, bx_address offse
     cntx = new context_t(context_id);
   }
 
-  FILE* fp = fopen(file.name, "rt"); // 't' is need for win32, unixes simply ignore it
+  FILE* fp = fopen(file_name, "rt"); // 't' is need for win32, unixes simply ignore it
   if (!fp) {
-    dbg_printf ("Could not open symbol file '%s'\n", file.name);
+    dbg_printf ("Could not open symbol file '%s'\n", file_name);
+    free(file_name);
     return -1;
   }
 
+  // the cache file can only be used for a context without symbols
+  size_t name_len = strlen(file_name);
+  char *cache_name = (char*) malloc(name_len + 7);
+  memcpy(cache_name, file_name, name_len);
+  strcpy(cache_name + name_len, ".bxsym");
+  bool use_cache = cntx->empty() && (fstat(fileno(fp), &src) == 0);
+  if (use_cache && cntx->load_cache(cache_name, &src, offset)) {
+    fclose(fp);
+    free(cache_name);
+    free(file_name);
+    return 0;
+  }
+
   // C++/C# symbols can be long
   char buf[512];
   int  line_num = 1;
+  int  ret = 0;
 
   while (fgets(buf, sizeof(buf), fp)) {
     // handle end of line (before error messages)
@@ -318,16 +617,15 @@ int bx_dbg_symbol_command(const char* filename, bx_bool global, bx_address offse
 #endif
     if (!isspace(*sym_name)) {
       if (*sym_name == 0)
-        dbg_printf("%s:%d: missing symbol name\n", file.name, line_num);
+        dbg_printf("%s:%d: missing symbol name\n", file_name, line_num);
       else
-        dbg_printf("%s:%d: syntax error near '%s'\n", file.name, line_num, sym_name);
-      fclose(fp);
-      return -1;
+        dbg_printf("%s:%d: syntax error near '%s'\n", file_name, line_num, sym_name);
+      ret = -1;
+      break;
     }
     ++sym_name;
 
-    symbol_entry_t* sym = new symbol_entry_t(addr + offset, sym_name);
-    cntx->add_symbol(sym);
+    cntx->add_symbol(addr + offset, sym_name);
 
     // skip the rest of long line
     while (!whole_line) {
@@ -340,7 +638,15 @@ int bx_dbg_symbol_command(const char* filename, bx_bool global, bx_address offse
     ++line_num;
   }
   fclose(fp);
-  return 0;
+
+  // sort and index once after the whole file is loaded, the symbols
+  // preceding a syntax error are kept
+  cntx->build_index();
+  if (use_cache && ret == 0)
+    cntx->save_cache(cache_name, &src, offset);
+  free(cache_name);
+  free(file_name);
+  return ret;
 }
 
 // check if s1 is prefix of s2
@@ -365,51 +671,50 @@ void bx_dbg_info_symbols_command(const char *symbol)
     return;
   }
 
-  if(symbol) {
-    const context_t::rsym_set_t* rsyms;
+  if (cntx->empty()) {
+    dbg_printf ("symbols not loaded\n");
+    return;
+  }
 
-    rsyms=cntx->get_all_rsymbols();
-    if (rsyms->empty ()) {
-      dbg_printf ("symbols not loaded\n");
-      return;
-    }
+  unsigned n, num = cntx->get_num_symbols();
+  const symbol_entry_t *sym, *prev = 0;
 
-    symbol_entry_t probe(0, symbol);
+  if(symbol) {
     // remove leading and trailing quotas
-    probe.trim_quotes();
-    context_t::rsym_set_t::const_iterator iter;
-    iter=rsyms->lower_bound(&probe);
+    char *name = bx_dbg_strdup_unquoted(symbol);
+    n = cntx->find_rsymbol(name);
 
-    if(iter==rsyms->end() || !bx_dbg_strprefix(probe.name, (*iter)->name))
+    if(n == num || !bx_dbg_strprefix(name, cntx->get_name(cntx->get_rsymbol(n))))
       dbg_printf ("No symbols found\n");
     else {
-      for(;iter!=rsyms->end() && bx_dbg_strprefix(probe.name, (*iter)->name);++iter) {
+      for(;n < num && bx_dbg_strprefix(name, cntx->get_name(sym = cntx->get_rsymbol(n)));++n) {
+        // show only the first loaded of several symbols with the same name
+        if (prev && !strcmp(cntx->get_name(prev), cntx->get_name(sym)))
+          continue;
+        prev = sym;
 #if BX_SUPPORT_X86_64 && (BX_HAVE_STRTOULL || BX_HAVE_STRTOUQ)
-        dbg_printf (FMT_ADDRX64 ": %s\n", (*iter)->start, (*iter)->name);
+        dbg_printf (FMT_ADDRX64 ": %s\n", sym->start, cntx->get_name(sym));
 #else
-        dbg_printf ("%08x: %s\n", (*iter)->start, (*iter)->name);
+        dbg_printf ("%08x: %s\n", sym->start, cntx->get_name(sym));
 #endif
       }
     }
+    free(name);
   }
   else {
-    const context_t::sym_set_t* syms;
-
-    syms=cntx->get_all_symbols();
-    if (syms->empty()) {
-      dbg_printf ("symbols not loaded\n");
-      return;
-    }
-
-    context_t::sym_set_t::const_iterator iter;
-    for(iter = syms->begin();iter!=syms->end();++iter) {
+    for(n = 0;n < num;++n) {
+      sym = cntx->get_symbol(n);
+      // show only the first loaded of several symbols at the same address
+      if (prev && prev->start == sym->start)
+        continue;
+      prev = sym;
 #if BX_SUPPORT_X86_64 && (BX_HAVE_STRTOULL || BX_HAVE_STRTOUQ)
         if (sizeof(long) == 8)
-            dbg_printf ("%16lx: %s\n", (*iter)->start, (*iter)->name);
+            dbg_printf ("%16lx: %s\n", sym->start, cntx->get_name(sym));
         else
-            dbg_printf ("%16llx: %s\n", (*iter)->start, (*iter)->name);
+            dbg_printf ("%16llx: %s\n", sym->start, cntx->get_name(sym));
 #else
-      dbg_printf ("%08x: %s\n", (*iter)->start, (*iter)->name);
+      dbg_printf ("%08x: %s\n", sym->start, cntx->get_name(sym));
 #endif
     }
   }
@@ -422,11 +727,10 @@ int bx_dbg_lbreakpoint_symbol_command(const char *symbol, const char *condition)
     dbg_printf ("Global context not available\n");
     return -1;
   }
-  symbol_entry_t probe(0, symbol);
   // remove leading and trailing quotes
-  probe.trim_quotes();
-
-  const symbol_entry_t* sym=cntx->get_symbol_entry(probe.name);
+  char *name = bx_dbg_strdup_unquoted(symbol);
+  const symbol_entry_t* sym=cntx->get_symbol_entry(name);
+  free(name);
   if(sym)
     return bx_dbg_lbreakpoint_command(bkRegular, sym->start, condition);
   dbg_printf ("symbol not found\n");
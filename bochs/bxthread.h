@@ -46,6 +46,7 @@
 #define BX_INIT_MUTEX(mutex) mutex = SDL_CreateMutex()
 #define BX_FINI_MUTEX(mutex) SDL_DestroyMutex(mutex)
 #define BX_MSLEEP(val) SDL_Delay(val)
+#define BX_YIELD() SDL_Delay(0)
 
 #elif defined(WIN32)
 
@@ -60,10 +61,12 @@
 #define BX_INIT_MUTEX(mutex) InitializeCriticalSection(&(mutex))
 #define BX_FINI_MUTEX(mutex) DeleteCriticalSection(&(mutex))
 #define BX_MSLEEP(val) Sleep(val)
+#define BX_YIELD() SwitchToThread()
 
 #else
 
 #include <pthread.h>
+#include <sched.h>
 
 #define BX_THREAD_VAR(name) pthread_t (name)
 #define BX_THREAD_FUNC(name,arg) void name(void* arg)
@@ -77,9 +80,93 @@
 #define BX_INIT_MUTEX(mutex) pthread_mutex_init(&(mutex),NULL)
 #define BX_FINI_MUTEX(mutex) pthread_mutex_destroy(&(mutex))
 #define BX_MSLEEP(val) usleep(val*1000)
+#define BX_YIELD() sched_yield()
 
 #endif
 
+// Thread local storage and atomic operations on memory shared by several
+// host threads. The atomic operations are full memory barriers.
+
+#if defined(__GNUC__)
+
+#define BX_HAVE_ATOMICS 1
+#define BX_THREAD_LOCAL __thread
+#define BX_ATOMIC_CAS8(ptr, oldval, newval) \
+  __sync_bool_compare_and_swap((volatile Bit8u*)(ptr), (Bit8u)(oldval), (Bit8u)(newval))
+#define BX_ATOMIC_CAS16(ptr, oldval, newval) \
+  __sync_bool_compare_and_swap((volatile Bit16u*)(ptr), (Bit16u)(oldval), (Bit16u)(newval))
+#define BX_ATOMIC_CAS32(ptr, oldval, newval) \
+  __sync_bool_compare_and_swap((volatile Bit32u*)(ptr), (Bit32u)(oldval), (Bit32u)(newval))
+#define BX_ATOMIC_CAS64(ptr, oldval, newval) \
+  __sync_bool_compare_and_swap((volatile Bit64u*)(ptr), (Bit64u)(oldval), (Bit64u)(newval))
+#define BX_ATOMIC_OR32(ptr, val)   __sync_fetch_and_or((volatile Bit32u*)(ptr), (Bit32u)(val))
+#define BX_ATOMIC_OR64(ptr, val)   __sync_fetch_and_or((volatile Bit64u*)(ptr), (Bit64u)(val))
+#define BX_ATOMIC_AND32(ptr, val)  __sync_fetch_and_and((volatile Bit32u*)(ptr), (Bit32u)(val))
+#define BX_ATOMIC_ADD32(ptr, val)  __sync_add_and_fetch((volatile Bit32u*)(ptr), (Bit32u)(val))
+#define BX_ATOMIC_XCHG32(ptr, val) __atomic_exchange_n((volatile Bit32u*)(ptr), (Bit32u)(val), __ATOMIC_SEQ_CST)
+#define BX_MEMORY_BARRIER() __sync_synchronize()
+
+#if defined(__x86_64__)
+#define BX_HAVE_ATOMIC_CAS128 1
+// 16-byte compare-and-swap of the aligned qword pair lo/hi at ptr
+static BX_CPP_INLINE bool bx_atomic_cas128(volatile Bit64u *ptr,
+  Bit64u old_lo, Bit64u old_hi, Bit64u new_lo, Bit64u new_hi)
+{
+  unsigned char ok;
+  __asm__ __volatile__ ("lock; cmpxchg16b %1; setz %0"
+    : "=q" (ok), "+m" (*ptr), "+a" (old_lo), "+d" (old_hi)
+    : "b" (new_lo), "c" (new_hi)
+    : "cc", "memory");
+  return ok != 0;
+}
+#endif
+
+#elif defined(_MSC_VER)
+
+#include <intrin.h>
+
+#define BX_HAVE_ATOMICS 1
+#define BX_THREAD_LOCAL __declspec(thread)
+#define BX_ATOMIC_CAS8(ptr, oldval, newval) \
+  (_InterlockedCompareExchange8((volatile char*)(ptr), (char)(newval), (char)(oldval)) == (char)(oldval))
+#define BX_ATOMIC_CAS16(ptr, oldval, newval) \
+  (_InterlockedCompareExchange16((volatile short*)(ptr), (short)(newval), (short)(oldval)) == (short)(oldval))
+#define BX_ATOMIC_CAS32(ptr, oldval, newval) \
+  (InterlockedCompareExchange((volatile LONG*)(ptr), (LONG)(newval), (LONG)(oldval)) == (LONG)(oldval))
+#define BX_ATOMIC_CAS64(ptr, oldval, newval) \
+  (InterlockedCompareExchange64((volatile LONGLONG*)(ptr), (LONGLONG)(newval), (LONGLONG)(oldval)) == (LONGLONG)(oldval))
+#define BX_ATOMIC_OR32(ptr, val)   ((Bit32u) InterlockedOr((volatile LONG*)(ptr), (LONG)(val)))
+#define BX_ATOMIC_OR64(ptr, val)   ((Bit64u) InterlockedOr64((volatile LONGLONG*)(ptr), (LONGLONG)(val)))
+#define BX_ATOMIC_AND32(ptr, val)  ((Bit32u) InterlockedAnd((volatile LONG*)(ptr), (LONG)(val)))
+#define BX_ATOMIC_ADD32(ptr, val)  ((Bit32u) InterlockedExchangeAdd((volatile LONG*)(ptr), (LONG)(val)) + (Bit32u)(val))
+#define BX_ATOMIC_XCHG32(ptr, val) ((Bit32u) InterlockedExchange((volatile LONG*)(ptr), (LONG)(val)))
+#define BX_MEMORY_BARRIER() MemoryBarrier()
+
+#if defined(_M_X64)
+#define BX_HAVE_ATOMIC_CAS128 1
+// 16-byte compare-and-swap of the aligned qword pair lo/hi at ptr
+static __inline bool bx_atomic_cas128(volatile Bit64u *ptr,
+  Bit64u old_lo, Bit64u old_hi, Bit64u new_lo, Bit64u new_hi)
+{
+  __int64 cmp[2] = { (__int64) old_lo, (__int64) old_hi };
+  return _InterlockedCompareExchange128((volatile __int64*)(ptr), (__int64)(new_hi), (__int64)(new_lo), cmp) != 0;
+}
+#endif
+
+#else
+
+#define BX_HAVE_ATOMICS 0
+
+#endif
+
+#ifndef BX_HAVE_ATOMIC_CAS128
+#define BX_HAVE_ATOMIC_CAS128 0
+#endif
+
+#if BX_SUPPORT_SMP_THREADS && !BX_HAVE_ATOMICS
+#error "parallel SMP simulation requires a compiler with atomic builtins"
+#endif
+
 typedef struct
 {
 #if BX_WITH_SDL || BX_WITH_SDL2
@@ -22,6 +22,7 @@
 #include "bxversion.h"
 #include "iodev/iodev.h"
 #include "param_names.h"
+#include "replay.h"
 #include <assert.h>
 
 #ifdef HAVE_LOCALE_H
@@ -170,6 +171,7 @@ void bx_init_std_nic_options(const char *name, bx_list_c *menu)
     "socket",
 #endif
     "vnet",
+    "pcap",
     NULL
   };
 
@@ -423,9 +425,20 @@ void bx_init_options()
 #if BX_SUPPORT_SMP
   new bx_param_num_c(cpu_param,
       "quantum", "Quantum ticks in SMP simulation",
-      "Maximum amount of instructions allowed to execute before returning control to another CPU.",
+      "Minimum amount of instructions allowed to execute before returning control to another CPU.",
       BX_SMP_QUANTUM_MIN, BX_SMP_QUANTUM_MAX,
       16);
+  new bx_param_num_c(cpu_param,
+      "max_quantum", "Maximum quantum in SMP simulation",
+      "Upper limit for the quantum while the CPUs don't interact",
+      BX_SMP_QUANTUM_MIN, BX_SMP_MAX_QUANTUM_MAX,
+      1024);
+#endif
+#if BX_SUPPORT_SMP_THREADS
+  new bx_param_bool_c(cpu_param,
+      "parallel", "Parallel SMP simulation",
+      "Run each simulated CPU in its own host thread",
+      0);
 #endif
   new bx_param_bool_c(cpu_param,
       "reset_on_triple_fault", "Enable CPU reset on triple fault",
@@ -935,6 +948,9 @@ void bx_init_options()
 #if BX_WITH_VNCSRV
     "vncsrv",
 #endif
+#if BX_WITH_SHMFB
+    "shmfb",
+#endif
 #if BX_WITH_WX
     "wx",
 #endif
@@ -982,6 +998,12 @@ void bx_init_options()
       "If enabled, the VGA timer is based on realtime",
       1);
 
+  new bx_param_bool_c(display,
+      "vga_headless",
+      "VGA headless mode",
+      "If enabled, the VGA display is only rendered on demand",
+      0);
+
   bx_param_num_c *vga_update_freq = new bx_param_num_c(display,
       "vga_update_frequency",
       "VGA Update Frequency",
@@ -1625,8 +1647,37 @@ void bx_init_options()
     "",
     0, BX_MAX_BIT32U,
     0);
+  new bx_param_num_c(menu,
+    "checkpoint_interval",
+    "Checkpoint interval",
+    "Instructions between checkpoints for reverse execution (0 = disabled)",
+    0, BX_MAX_BIT32U,
+    0);
   enabled->set_dependent_list(menu->clone());
 
+  // record / replay of nondeterministic inputs
+  static const char *replay_mode_names[] = { "none", "record", "replay", NULL };
+  menu = new bx_list_c(misc, "replay", "Record / Replay Options");
+  menu->set_options(menu->SHOW_PARENT | menu->USE_BOX_TITLE);
+  bx_param_enum_c *replay_mode = new bx_param_enum_c(menu,
+    "mode",
+    "Record / replay mode",
+    "Record nondeterministic inputs to a log or replay them from it",
+    replay_mode_names,
+    BX_REPLAY_OFF,
+    BX_REPLAY_OFF);
+  path = new bx_param_filename_c(menu,
+    "file",
+    "Replay log",
+    "Pathname of the record / replay log",
+    "replay.log", BX_PATHNAME_LEN);
+  path->set_extension("log");
+  deplist = new bx_list_c(NULL);
+  deplist->add(path);
+  replay_mode->set_dependent_list(deplist, 0);
+  replay_mode->set_dependent_bitmap(BX_REPLAY_RECORD, 1);
+  replay_mode->set_dependent_bitmap(BX_REPLAY_PLAY, 1);
+
 #if BX_PLUGINS
   // user plugin options
   menu = new bx_list_c(misc, "user_plugin", "User Plugin Options");
@@ -1664,6 +1715,12 @@ void bx_init_options()
       "%t%e%d", BX_LOGPREFIX_LEN);
   prefix->set_ask_format("Enter log prefix: [%s] ");
 
+  new bx_param_bool_c(menu,
+      "async",
+      "Asynchronous log output",
+      "Format and write log messages in a separate thread",
+      0);
+
   path = new bx_param_filename_c(menu,
       "debugger_filename",
       "Debugger Log filename",
@@ -2565,10 +2622,19 @@ static int parse_line_formatted(const char *context, int num_params, char *param
       PARSE_ERR(("%s: floppy_bootsig_check directive malformed.", context));
     }
   } else if (!strcmp(params[0], "log")) {
-    if (num_params != 2) {
+    if ((num_params < 2) || (num_params > 3)) {
       PARSE_ERR(("%s: log directive has wrong # args.", context));
     }
     SIM->get_param_string(BXPN_LOG_FILENAME)->set(params[1]);
+    if (num_params == 3) {
+      if (!strncmp(params[2], "async=", 6)) {
+        if (parse_param_bool(params[2], 6, BXPN_LOG_ASYNC) < 0) {
+          PARSE_ERR(("%s: log directive malformed.", context));
+        }
+      } else {
+        PARSE_ERR(("%s: log directive malformed.", context));
+      }
+    }
   } else if (!strcmp(params[0], "logprefix")) {
     if (num_params != 2) {
       PARSE_ERR(("%s: logprefix directive has wrong # args.", context));
@@ -2747,6 +2813,8 @@ static int parse_line_formatted(const char *context, int num_params, char *param
         SIM->get_param_num(BXPN_VGA_UPDATE_FREQUENCY)->set(atol(&params[i][12]));
       } else if (!strncmp(params[i], "realtime=", 9)) {
         SIM->get_param_bool(BXPN_VGA_REALTIME)->set(atol(&params[i][9]));
+      } else if (!strncmp(params[i], "headless=", 9)) {
+        SIM->get_param_bool(BXPN_VGA_HEADLESS)->set(atol(&params[i][9]));
       } else {
         PARSE_ERR(("%s: vga directive malformed.", context));
       }
@@ -2773,6 +2841,15 @@ static int parse_line_formatted(const char *context, int num_params, char *param
         PARSE_ERR(("%s: mouse directive malformed.", context));
       }
     }
+  } else if (!strcmp(params[0], "replay")) {
+    if (num_params < 2) {
+      PARSE_ERR(("%s: replay directive malformed.", context));
+    }
+    for (i=1; i<num_params; i++) {
+      if (bx_parse_param_from_list(context, params[i], (bx_list_c*) SIM->get_param("misc.replay")) < 0) {
+        PARSE_ERR(("%s: replay directive malformed.", context));
+      }
+    }
   } else if (!strcmp(params[0], "private_colormap")) {
     if (num_params != 2) {
       PARSE_ERR(("%s: private_colormap directive malformed.", context));
@@ -2947,6 +3024,9 @@ static int parse_line_formatted(const char *context, int num_params, char *param
       else if (!strncmp(params[i], "bss_base=", 9)) {
         SIM->get_param_num("bss_base", base)->set(atoi(&params[i][9]));
       }
+      else if (!strncmp(params[i], "checkpoint_interval=", 20)) {
+        SIM->get_param_num("checkpoint_interval", base)->set(strtoul(&params[i][20], NULL, 10));
+      }
       else {
         PARSE_ERR(("%s: gdbstub directive malformed.", context));
       }
@@ -3243,7 +3323,11 @@ int bx_write_log_options(FILE *fp, bx_list_c *base)
   bx_param_num_c *mparam;
   int action, def_action, level, mod;
 
-  fprintf(fp, "log: %s\n", SIM->get_param_string("filename", base)->getptr());
+  fprintf(fp, "log: %s", SIM->get_param_string("filename", base)->getptr());
+  if (SIM->get_param_bool("async", base)->get()) {
+    fprintf(fp, ", async=1");
+  }
+  fprintf(fp, "\n");
   fprintf(fp, "logprefix: %s\n", SIM->get_param_string("prefix", base)->getptr());
 
   strcpy(pname, "general.logfn");
@@ -3283,9 +3367,10 @@ int bx_write_debugger_options(FILE *fp)
   bx_list_c *base = (bx_list_c*) SIM->get_param(BXPN_GDBSTUB);
   bx_bool enabled = SIM->get_param_bool("enabled", base)->get();
   if (enabled) {
-    fprintf(fp, "gdbstub: enabled=%d, port=%d, text_base=%d, data_base=%d, bss_base=%d\n",
+    fprintf(fp, "gdbstub: enabled=%d, port=%d, text_base=%d, data_base=%d, bss_base=%d, checkpoint_interval=%u\n",
             enabled, SIM->get_param_num("port", base)->get(), SIM->get_param_num("text_base", base)->get(),
-            SIM->get_param_num("data_base", base)->get(), SIM->get_param_num("bss_base", base)->get());
+            SIM->get_param_num("data_base", base)->get(), SIM->get_param_num("bss_base", base)->get(),
+            (Bit32u) SIM->get_param_num("checkpoint_interval", base)->get());
   } else {
     fprintf(fp, "# no gdb stub\n");
   }
@@ -3384,15 +3469,19 @@ int bx_write_configuration(const char *rc, int overwrite)
     }
   }
   fprintf(fp, "\n");
-  fprintf(fp, "vga: extension=%s, update_freq=%u, realtime=%u\n",
+  fprintf(fp, "vga: extension=%s, update_freq=%u, realtime=%u, headless=%u\n",
     SIM->get_param_string(BXPN_VGA_EXTENSION)->getptr(),
     SIM->get_param_num(BXPN_VGA_UPDATE_FREQUENCY)->get(),
-    SIM->get_param_bool(BXPN_VGA_REALTIME)->get());
+    SIM->get_param_bool(BXPN_VGA_REALTIME)->get(),
+    SIM->get_param_bool(BXPN_VGA_HEADLESS)->get());
 #if BX_SUPPORT_SMP
-  fprintf(fp, "cpu: count=%u:%u:%u, ips=%u, quantum=%d, ",
+  fprintf(fp, "cpu: count=%u:%u:%u, ips=%u, quantum=%d, max_quantum=%d, ",
     SIM->get_param_num(BXPN_CPU_NPROCESSORS)->get(), SIM->get_param_num(BXPN_CPU_NCORES)->get(),
     SIM->get_param_num(BXPN_CPU_NTHREADS)->get(), SIM->get_param_num(BXPN_IPS)->get(),
-    SIM->get_param_num(BXPN_SMP_QUANTUM)->get());
+    SIM->get_param_num(BXPN_SMP_QUANTUM)->get(), SIM->get_param_num(BXPN_SMP_MAX_QUANTUM)->get());
+#if BX_SUPPORT_SMP_THREADS
+  fprintf(fp, "parallel=%d, ", SIM->get_param_bool(BXPN_SMP_PARALLEL)->get());
+#endif
 #else
   fprintf(fp, "cpu: count=1, ips=%u, ", SIM->get_param_num(BXPN_IPS)->get());
 #endif
@@ -3423,6 +3512,7 @@ int bx_write_configuration(const char *rc, int overwrite)
   fprintf(fp, "print_timestamps: enabled=%d\n", bx_dbg.print_timestamps);
   bx_write_debugger_options(fp);
   fprintf(fp, "port_e9_hack: enabled=%d\n", SIM->get_param_bool(BXPN_PORT_E9_HACK)->get());
+  bx_write_param_list(fp, (bx_list_c*) SIM->get_param("misc.replay"), NULL, 0);
   fprintf(fp, "private_colormap: enabled=%d\n", SIM->get_param_bool(BXPN_PRIVATE_COLORMAP)->get());
 #if BX_WITH_AMIGAOS
   fprintf(fp, "fullscreen: enabled=%d\n", SIM->get_param_bool(BXPN_FULLSCREEN)->get());
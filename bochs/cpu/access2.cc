@@ -38,7 +38,7 @@ BX_CPU_C::write_linear_byte(unsigned s, bx_address laddr, Bit8u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 1, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 1, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 1);
       *hostAddr = data;
@@ -66,7 +66,7 @@ BX_CPU_C::write_linear_word(unsigned s, bx_address laddr, Bit16u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 2);
       WriteHostWordToLittleEndian(hostAddr, data);
@@ -94,7 +94,7 @@ BX_CPU_C::write_linear_dword(unsigned s, bx_address laddr, Bit32u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 4);
       WriteHostDWordToLittleEndian(hostAddr, data);
@@ -122,7 +122,7 @@ BX_CPU_C::write_linear_qword(unsigned s, bx_address laddr, Bit64u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 8);
       WriteHostQWordToLittleEndian(hostAddr, data);
@@ -148,7 +148,7 @@ BX_CPU_C::write_linear_xmmword(unsigned s, bx_address laddr, const BxPackedXmmRe
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 16, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 16, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 16);
       WriteHostQWordToLittleEndian(hostAddr,   data->xmm64u(0));
@@ -173,7 +173,7 @@ BX_CPU_C::write_linear_xmmword_aligned(unsigned s, bx_address laddr, const BxPac
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 16, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 16, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 16);
       WriteHostQWordToLittleEndian(hostAddr,   data->xmm64u(0));
@@ -203,7 +203,7 @@ BX_CPU_C::write_linear_ymmword(unsigned s, bx_address laddr, const BxPackedYmmRe
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 32, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 32, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 32);
       for (unsigned n = 0; n < 4; n++) {
@@ -229,7 +229,7 @@ BX_CPU_C::write_linear_ymmword_aligned(unsigned s, bx_address laddr, const BxPac
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 32, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 32, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 32);
       for (unsigned n = 0; n < 4; n++) {
@@ -260,7 +260,7 @@ BX_CPU_C::write_linear_zmmword(unsigned s, bx_address laddr, const BxPackedZmmRe
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 64, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 64, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 64);
       for (unsigned n = 0; n < 8; n++) {
@@ -286,7 +286,7 @@ BX_CPU_C::write_linear_zmmword_aligned(unsigned s, bx_address laddr, const BxPac
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 64, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 64, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 64);
       for (unsigned n = 0; n < 8; n++) {
@@ -352,7 +352,7 @@ BX_CPU_C::read_linear_byte(unsigned s, bx_address laddr)
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
       data = *hostAddr;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 1, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 1, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
       return data;
     }
   }
@@ -382,7 +382,7 @@ BX_CPU_C::read_linear_word(unsigned s, bx_address laddr)
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       ReadHostWordFromLittleEndian(hostAddr, data);
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 2, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 2, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
       return data;
     }
   }
@@ -412,7 +412,7 @@ BX_CPU_C::read_linear_dword(unsigned s, bx_address laddr)
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       ReadHostDWordFromLittleEndian(hostAddr, data);
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 4, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 4, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
       return data;
     }
   }
@@ -442,7 +442,7 @@ BX_CPU_C::read_linear_qword(unsigned s, bx_address laddr)
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       ReadHostQWordFromLittleEndian(hostAddr, data);
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 8, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 8, tlbEntry->get_memtype(), BX_READ, (Bit8u*) &data);
       return data;
     }
   }
@@ -469,7 +469,7 @@ BX_CPU_C::read_linear_xmmword(unsigned s, bx_address laddr, BxPackedXmmRegister
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
       ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 16, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 16, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -492,7 +492,7 @@ BX_CPU_C::read_linear_xmmword_aligned(unsigned s, bx_address laddr, BxPackedXmmR
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
       ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 16, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 16, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -521,7 +521,7 @@ BX_CPU_C::read_linear_ymmword(unsigned s, bx_address laddr, BxPackedYmmRegister
       for (unsigned n=0; n < 4; n++) {
         ReadHostQWordFromLittleEndian(hostAddr+n, data->ymm64u(n));
       }
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 32, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 32, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -545,7 +545,7 @@ BX_CPU_C::read_linear_ymmword_aligned(unsigned s, bx_address laddr, BxPackedYmmR
       for (unsigned n=0; n < 4; n++) {
         ReadHostQWordFromLittleEndian(hostAddr+n, data->ymm64u(n));
       }
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 32, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 32, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -574,7 +574,7 @@ BX_CPU_C::read_linear_zmmword(unsigned s, bx_address laddr, BxPackedZmmRegister
       for (unsigned n=0; n < 8; n++) {
         ReadHostQWordFromLittleEndian(hostAddr+n, data->zmm64u(n));
       }
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 64, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 64, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -598,7 +598,7 @@ BX_CPU_C::read_linear_zmmword_aligned(unsigned s, bx_address laddr, BxPackedZmmR
       for (unsigned n=0; n < 8; n++) {
         ReadHostQWordFromLittleEndian(hostAddr+n, data->zmm64u(n));
       }
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, (tlbEntry->ppf | pageOffset), 64, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, (tlbEntry->ppf | pageOffset), 64, tlbEntry->get_memtype(), BX_READ, (Bit8u*) data);
       return;
     }
   }
@@ -619,6 +619,13 @@ BX_CPU_C::read_linear_zmmword_aligned(unsigned s, bx_address laddr, BxPackedZmmR
 // address translation info is kept across read/write calls //
 //////////////////////////////////////////////////////////////
 
+#if BX_SUPPORT_SMP_THREADS
+// remember the data read for the atomic update in write_RMW_linear_atomic()
+#define BX_RMW_SAVE_DATA(data) BX_CPU_THIS_PTR address_xlation.rmw_data[0] = (data)
+#else
+#define BX_RMW_SAVE_DATA(data)
+#endif
+
   Bit8u BX_CPP_AttrRegparmN(2)
 BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
 {
@@ -640,7 +647,8 @@ BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
 #endif
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 1, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 1, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_RMW_SAVE_DATA(data);
       return data;
     }
   }
@@ -648,6 +656,7 @@ BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 1, CPL, BX_RW, 0x0, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+  BX_RMW_SAVE_DATA(data);
   return data;
 }
 
@@ -676,7 +685,8 @@ BX_CPU_C::read_RMW_linear_word(unsigned s, bx_address laddr)
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
 #endif
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_RMW_SAVE_DATA(data);
       return data;
     }
   }
@@ -684,6 +694,7 @@ BX_CPU_C::read_RMW_linear_word(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 2, CPL, BX_RW, 0x1, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+  BX_RMW_SAVE_DATA(data);
   return data;
 }
 
@@ -712,7 +723,8 @@ BX_CPU_C::read_RMW_linear_dword(unsigned s, bx_address laddr)
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
 #endif
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_RMW_SAVE_DATA(data);
       return data;
     }
   }
@@ -720,6 +732,7 @@ BX_CPU_C::read_RMW_linear_dword(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 4, CPL, BX_RW, 0x3, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+  BX_RMW_SAVE_DATA(data);
   return data;
 }
 
@@ -748,7 +761,8 @@ BX_CPU_C::read_RMW_linear_qword(unsigned s, bx_address laddr)
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
 #endif
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
+      BX_RMW_SAVE_DATA(data);
       return data;
     }
   }
@@ -756,12 +770,18 @@ BX_CPU_C::read_RMW_linear_qword(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 8, CPL, BX_RW, 0x7, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+  BX_RMW_SAVE_DATA(data);
   return data;
 }
 
   void BX_CPP_AttrRegparmN(1)
 BX_CPU_C::write_RMW_linear_byte(Bit8u val8)
 {
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.cpus_running && write_RMW_linear_atomic(val8, 1))
+    return;
+#endif
+
   BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
     BX_CPU_THIS_PTR address_xlation.paddress1, 1, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1), BX_WRITE, 0, (Bit8u*) &val8);
 
@@ -779,6 +799,11 @@ BX_CPU_C::write_RMW_linear_byte(Bit8u val8)
   void BX_CPP_AttrRegparmN(1)
 BX_CPU_C::write_RMW_linear_word(Bit16u val16)
 {
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.cpus_running && write_RMW_linear_atomic(val16, 2))
+    return;
+#endif
+
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit16u *hostAddr = (Bit16u *) BX_CPU_THIS_PTR address_xlation.pages;
@@ -819,6 +844,11 @@ BX_CPU_C::write_RMW_linear_word(Bit16u val16)
   void BX_CPP_AttrRegparmN(1)
 BX_CPU_C::write_RMW_linear_dword(Bit32u val32)
 {
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.cpus_running && write_RMW_linear_atomic(val32, 4))
+    return;
+#endif
+
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit32u *hostAddr = (Bit32u *) BX_CPU_THIS_PTR address_xlation.pages;
@@ -869,6 +899,11 @@ BX_CPU_C::write_RMW_linear_dword(Bit32u val32)
   void BX_CPP_AttrRegparmN(1)
 BX_CPU_C::write_RMW_linear_qword(Bit64u val64)
 {
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.cpus_running && write_RMW_linear_atomic(val64, 8))
+    return;
+#endif
+
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit64u *hostAddr = (Bit64u *) BX_CPU_THIS_PTR address_xlation.pages;
@@ -916,6 +951,101 @@ BX_CPU_C::write_RMW_linear_qword(Bit64u val64)
   }
 }
 
+#if BX_SUPPORT_SMP_THREADS
+
+// Returns a host pointer for the atomic update of the memory read by the
+// last read_RMW_linear_* call, NULL if the access is split between two
+// pages, misaligned or not backed by host memory (e.g. memory mapped I/O).
+Bit8u* BX_CPU_C::write_RMW_linear_host_ptr(unsigned len)
+{
+  Bit8u *hostAddr;
+
+  if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
+    hostAddr = (Bit8u *) BX_CPU_THIS_PTR address_xlation.pages;
+  }
+  else if (BX_CPU_THIS_PTR address_xlation.pages == 1) {
+    bx_phy_address pAddr = BX_CPU_THIS_PTR address_xlation.paddress1;
+    hostAddr = (Bit8u *) getHostMemAddr(PPFOf(pAddr), BX_RW);
+    if (! hostAddr) return NULL;
+    hostAddr += PAGE_OFFSET(pAddr);
+    pageWriteStampTable.decWriteStamp(pAddr, len);
+  }
+  else {
+    return NULL;
+  }
+
+  if (((bx_ptr_equiv_t) hostAddr) & (len - 1))
+    return NULL;
+
+  return hostAddr;
+}
+
+// Another CPU modified the memory after the read part of the RMW access,
+// execute the instruction again.
+void BX_CPU_C::restart_RMW_instruction(void)
+{
+  RIP = BX_CPU_THIS_PTR prev_rip;
+  if (BX_CPU_THIS_PTR speculative_rsp)
+    RSP = BX_CPU_THIS_PTR prev_rsp;
+  BX_CPU_THIS_PTR speculative_rsp = 0;
+
+  longjmp(BX_CPU_THIS_PTR jmp_buf_env, 1); // go back to main decode loop
+}
+
+// Complete the RMW access with a host compare-and-swap so that the update
+// is atomic with respect to the CPUs running in the other host threads.
+// Returns 0 if the access can't be done atomically, the caller then falls
+// back to the regular write.
+bx_bool BX_CPU_C::write_RMW_linear_atomic(Bit64u val, unsigned len)
+{
+  Bit8u *hostAddr = write_RMW_linear_host_ptr(len);
+  if (! hostAddr) return 0;
+
+  Bit64u data = BX_CPU_THIS_PTR address_xlation.rmw_data[0];
+  bx_bool done;
+
+  switch(len) {
+    case 1:
+      done = BX_ATOMIC_CAS8(hostAddr, data, val);
+      break;
+    case 2:
+      {
+        Bit16u old16, new16;
+        WriteHostWordToLittleEndian(&old16, (Bit16u) data);
+        WriteHostWordToLittleEndian(&new16, (Bit16u) val);
+        done = BX_ATOMIC_CAS16(hostAddr, old16, new16);
+      }
+      break;
+    case 4:
+      {
+        Bit32u old32, new32;
+        WriteHostDWordToLittleEndian(&old32, (Bit32u) data);
+        WriteHostDWordToLittleEndian(&new32, (Bit32u) val);
+        done = BX_ATOMIC_CAS32(hostAddr, old32, new32);
+      }
+      break;
+    default:
+      {
+        Bit64u old64, new64;
+        WriteHostQWordToLittleEndian(&old64, data);
+        WriteHostQWordToLittleEndian(&new64, val);
+        done = BX_ATOMIC_CAS64(hostAddr, old64, new64);
+      }
+      break;
+  }
+
+  if (! done)
+    restart_RMW_instruction();
+
+  BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
+      BX_CPU_THIS_PTR address_xlation.paddress1, len, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
+      BX_WRITE, 0, (Bit8u*) &val);
+
+  return 1;
+}
+
+#endif
+
 #if BX_SUPPORT_X86_64
 
 void BX_CPU_C::read_RMW_linear_dqword_aligned_64(unsigned s, bx_address laddr, Bit64u *hi, Bit64u *lo)
@@ -933,13 +1063,17 @@ void BX_CPU_C::read_RMW_linear_dqword_aligned_64(unsigned s, bx_address laddr, B
       pageWriteStampTable.decWriteStamp(pAddr, 16);
       ReadHostQWordFromLittleEndian(hostAddr,     *lo);
       ReadHostQWordFromLittleEndian(hostAddr + 1, *hi);
+#if BX_SUPPORT_SMP_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = *lo;
+      BX_CPU_THIS_PTR address_xlation.rmw_data[1] = *hi;
+#endif
       BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
 #endif
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr,     pAddr,     8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) lo);
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr + 8, pAddr + 8, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) hi);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr,     pAddr,     8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) lo);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr + 8, pAddr + 8, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) hi);
       return;
     }
   }
@@ -955,10 +1089,27 @@ void BX_CPU_C::read_RMW_linear_dqword_aligned_64(unsigned s, bx_address laddr, B
 
   *lo = data.xmm64u(0);
   *hi = data.xmm64u(1);
+#if BX_SUPPORT_SMP_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_data[0] = *lo;
+  BX_CPU_THIS_PTR address_xlation.rmw_data[1] = *hi;
+#endif
 }
 
 void BX_CPU_C::write_RMW_linear_dqword(Bit64u hi, Bit64u lo)
 {
+#if BX_SUPPORT_SMP_THREADS && BX_HAVE_ATOMIC_CAS128
+  if (bx_pc_system.cpus_running) {
+    // the host is little endian as well, the qwords are compared as stored
+    Bit64u *hostAddr = (Bit64u *) write_RMW_linear_host_ptr(16);
+    if (hostAddr) {
+      if (! bx_atomic_cas128(hostAddr, BX_CPU_THIS_PTR address_xlation.rmw_data[0],
+               BX_CPU_THIS_PTR address_xlation.rmw_data[1], lo, hi))
+        restart_RMW_instruction();
+      return;
+    }
+  }
+#endif
+
   write_RMW_linear_qword(lo);
 
   BX_CPU_THIS_PTR address_xlation.paddress1 += 8;
@@ -996,7 +1147,7 @@ void BX_CPU_C::write_new_stack_word(bx_address laddr, unsigned curr_pl, Bit16u d
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 2);
       WriteHostWordToLittleEndian(hostAddr, data);
@@ -1024,7 +1175,7 @@ void BX_CPU_C::write_new_stack_dword(bx_address laddr, unsigned curr_pl, Bit32u
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 4);
       WriteHostDWordToLittleEndian(hostAddr, data);
@@ -1052,7 +1203,7 @@ void BX_CPU_C::write_new_stack_qword(bx_address laddr, unsigned curr_pl, Bit64u
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       bx_phy_address pAddr = tlbEntry->ppf | pageOffset;
-      BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
+      BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_WRITE, (Bit8u*) &data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(pAddr, 8);
       WriteHostQWordToLittleEndian(hostAddr, data);
@@ -24,6 +24,9 @@
 #include "bochs.h"
 #include "cpu.h"
 #include "iodev/iodev.h"
+#if BX_SUPPORT_SMP_THREADS
+#include "bxthread.h"
+#endif
 
 #if BX_SUPPORT_APIC
 
@@ -145,7 +148,9 @@ int apic_bus_broadcast_interrupt(Bit8u vector, Bit8u delivery_mode, bx_bool trig
 
 static void apic_bus_broadcast_eoi(Bit8u vector)
 {
+  BX_LOCK_DEVICES();
   DEV_ioapic_receive_eoi(vector);
+  BX_UNLOCK_DEVICES();
 }
 
 #endif
@@ -153,13 +158,26 @@ static void apic_bus_broadcast_eoi(Bit8u vector)
 // available even if APIC is not compiled in
 BOCHSAPI_MSVCONLY void apic_bus_deliver_smi(void)
 {
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.is_remote_cpu(0)) {
+    BX_CPU(0)->lapic.post_request(BX_LAPIC_MBOX_SMI);
+    return;
+  }
+#endif
   BX_CPU(0)->deliver_SMI();
 }
 
 void apic_bus_broadcast_smi(void)
 {
-  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++)
+  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SUPPORT_SMP_THREADS
+    if (bx_pc_system.is_remote_cpu(i)) {
+      BX_CPU(i)->lapic.post_request(BX_LAPIC_MBOX_SMI);
+      continue;
+    }
+#endif
     BX_CPU(i)->deliver_SMI();
+  }
 }
 
 #if BX_SUPPORT_APIC
@@ -187,6 +205,14 @@ bx_local_apic_c::bx_local_apic_c(BX_CPU_C *mycpu, unsigned id)
   timer_handle = bx_pc_system.register_timer_ticks(this,
             bx_local_apic_c::periodic_smf, 0, 0, 0, "lapic");
   timer_active = 0;
+
+#if BX_SUPPORT_SMP_THREADS
+  mbox_flags = 0;
+  memset((void*) mbox_irq, 0, sizeof(mbox_irq));
+  mbox_sipi_vector = 0;
+  mbox_intr = 0;
+  mbox_invlpg = 0;
+#endif
   
 #if BX_SUPPORT_VMX >= 2
   // Register a non-active timer for VMX preemption timer.
@@ -817,6 +843,12 @@ void bx_local_apic_c::service_local_apic(void)
 
 bx_bool bx_local_apic_c::deliver(Bit8u vector, Bit8u delivery_mode, Bit8u trig_mode)
 {
+#if BX_SUPPORT_SMP_THREADS
+  // the CPU is running in another host thread, let it handle the message
+  if (bx_pc_system.is_remote_cpu(cpu->which_cpu()))
+    return post_interrupt(vector, delivery_mode, trig_mode);
+#endif
+
   switch(delivery_mode) {
   case APIC_DM_FIXED:
   case APIC_DM_LOWPRI:
@@ -1449,4 +1481,117 @@ void bx_local_apic_c::register_state(bx_param_c *parent)
 #endif
 }
 
+#if BX_SUPPORT_SMP_THREADS
+
+void bx_local_apic_c::post_request(Bit32u flags)
+{
+  BX_ATOMIC_OR32(&mbox_flags, flags);
+}
+
+bx_bool bx_local_apic_c::post_interrupt(Bit8u vector, Bit8u delivery_mode, Bit8u trig_mode)
+{
+  switch(delivery_mode) {
+  case APIC_DM_FIXED:
+  case APIC_DM_LOWPRI:
+  case APIC_DM_EXTINT:
+    {
+      unsigned n = ((delivery_mode == APIC_DM_EXTINT) << 1) | (trig_mode & 1);
+      BX_ATOMIC_OR32(&mbox_irq[n][vector >> 5], 1 << (vector & 0x1f));
+      post_request(BX_LAPIC_MBOX_IRQ);
+    }
+    break;
+  case APIC_DM_SMI:
+    post_request(BX_LAPIC_MBOX_SMI);
+    break;
+  case APIC_DM_NMI:
+    post_request(BX_LAPIC_MBOX_NMI);
+    break;
+  case APIC_DM_INIT:
+    post_request(BX_LAPIC_MBOX_INIT);
+    break;
+  case APIC_DM_SIPI:
+    mbox_sipi_vector = vector;
+    post_request(BX_LAPIC_MBOX_SIPI);
+    break;
+  default:
+    return 0;
+  }
+
+  return 1;
+}
+
+void bx_local_apic_c::post_intr(bx_bool level)
+{
+  mbox_intr = level;
+  post_request(BX_LAPIC_MBOX_INTR);
+}
+
+void bx_local_apic_c::post_invlpg(bx_address addr)
+{
+  // a single page can be queued, fall back to a full TLB flush otherwise
+  Bit64u page = (Bit64u)(addr >> 12) + 1;
+  if (page <= 0xffffffff) {
+    if (BX_ATOMIC_CAS32(&mbox_invlpg, 0, page) || mbox_invlpg == (Bit32u) page) {
+      post_request(BX_LAPIC_MBOX_INVLPG);
+      return;
+    }
+  }
+  post_request(BX_LAPIC_MBOX_TLB_FLUSH);
+}
+
+void bx_local_apic_c::drain_mailbox(void)
+{
+  Bit32u flags = BX_ATOMIC_XCHG32(&mbox_flags, 0);
+
+  if (flags & (BX_LAPIC_MBOX_TLB_FLUSH | BX_LAPIC_MBOX_INVLPG)) {
+    Bit32u page = BX_ATOMIC_XCHG32(&mbox_invlpg, 0);
+    if (flags & BX_LAPIC_MBOX_TLB_FLUSH)
+      cpu->TLB_flush();
+    else if (page)
+      cpu->TLB_invlpg((bx_address)(page - 1) << 12);
+  }
+  if (flags & BX_LAPIC_MBOX_ICACHE_FLUSH) {
+    cpu->iCache.flushICacheEntries();
+    cpu->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  }
+  if (flags & BX_LAPIC_MBOX_INTR) {
+    if (mbox_intr)
+      cpu->raise_INTR();
+    else
+      cpu->clear_INTR();
+  }
+  if (flags & BX_LAPIC_MBOX_ASYNC_EVENT)
+    cpu->async_event = 1;
+  if (flags & BX_LAPIC_MBOX_IRQ) {
+    for (unsigned n=0; n<4; n++) {
+      for (unsigned i=0; i<8; i++) {
+        Bit32u vectors = BX_ATOMIC_XCHG32(&mbox_irq[n][i], 0);
+        for (unsigned bit=0; vectors; bit++, vectors >>= 1) {
+          if (vectors & 1)
+            deliver((i << 5) | bit, (n & 2) ? APIC_DM_EXTINT : APIC_DM_FIXED, n & 1);
+        }
+      }
+    }
+  }
+  if (flags & BX_LAPIC_MBOX_SMI)
+    deliver(0, APIC_DM_SMI, 0);
+  if (flags & BX_LAPIC_MBOX_NMI)
+    deliver(0, APIC_DM_NMI, 0);
+  if (flags & BX_LAPIC_MBOX_INIT)
+    deliver(0, APIC_DM_INIT, 0);
+  if (flags & BX_LAPIC_MBOX_SIPI) {
+    // the startup message is only accepted once the INIT is processed
+    if (cpu->is_unmasked_event_pending(BX_EVENT_INIT))
+      post_request(BX_LAPIC_MBOX_SIPI);
+    else
+      deliver(mbox_sipi_vector, APIC_DM_SIPI, 0);
+  }
+#if BX_SUPPORT_MONITOR_MWAIT
+  if (flags & BX_LAPIC_MBOX_MONITOR)
+    cpu->wakeup_monitor();
+#endif
+}
+
+#endif
+
 #endif /* if BX_SUPPORT_APIC */
@@ -133,6 +133,23 @@ enum {
   APIC_LVT_ERROR   = 5
 };
 
+#if BX_SUPPORT_SMP_THREADS
+// Requests posted to the mailbox of a local APIC by other host threads
+// during parallel SMP simulation. The CPU owning the APIC handles them
+// before running its next trace.
+#define BX_LAPIC_MBOX_IRQ          (1 << 0)  /* vectors pending in mbox_irq */
+#define BX_LAPIC_MBOX_SMI          (1 << 1)
+#define BX_LAPIC_MBOX_NMI          (1 << 2)
+#define BX_LAPIC_MBOX_INIT         (1 << 3)
+#define BX_LAPIC_MBOX_SIPI         (1 << 4)  /* vector in mbox_sipi_vector */
+#define BX_LAPIC_MBOX_INTR         (1 << 5)  /* INTR line level in mbox_intr */
+#define BX_LAPIC_MBOX_ASYNC_EVENT  (1 << 6)  /* DMA hold request */
+#define BX_LAPIC_MBOX_TLB_FLUSH    (1 << 7)
+#define BX_LAPIC_MBOX_INVLPG       (1 << 8)  /* page in mbox_invlpg */
+#define BX_LAPIC_MBOX_ICACHE_FLUSH (1 << 9)
+#define BX_LAPIC_MBOX_MONITOR      (1 << 10) /* monitored memory was written */
+#endif
+
 class BOCHSAPI bx_local_apic_c : public logfunctions
 {
   bx_phy_address base_addr;
@@ -214,6 +231,14 @@ class BOCHSAPI bx_local_apic_c : public logfunctions
 
   BX_CPU_C *cpu;
 
+#if BX_SUPPORT_SMP_THREADS
+  volatile Bit32u mbox_flags;
+  volatile Bit32u mbox_irq[4][8];  // pending vectors, [(EXTINT << 1) | trig_mode]
+  volatile Bit32u mbox_sipi_vector;
+  volatile Bit32u mbox_intr;
+  volatile Bit32u mbox_invlpg;     // page number + 1, 0 = empty
+#endif
+
 public:
   bx_bool INTR;
   bx_local_apic_c(BX_CPU_C *cpu, unsigned id);
@@ -280,6 +305,15 @@ public:
   void deactivate_mwaitx_timer(void);
   static void mwaitx_timer_expired(void *);
 #endif
+
+#if BX_SUPPORT_SMP_THREADS
+  bx_bool mailbox_pending(void) const { return mbox_flags != 0; }
+  void post_request(Bit32u flags);
+  bx_bool post_interrupt(Bit8u vector, Bit8u delivery_mode, Bit8u trig_mode);
+  void post_intr(bx_bool level);
+  void post_invlpg(bx_address addr);
+  void drain_mailbox(void);  // only the local CPU should call this
+#endif
 };
 
 int apic_bus_deliver_lowest_priority(Bit8u vector, apic_dest_t dest, bx_bool trig_mode, bx_bool broadcast);
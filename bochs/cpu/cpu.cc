@@ -26,6 +26,7 @@
 
 #include "cpustats.h"
 #include "param_names.h"
+#include "revexec.h"
 
 #ifdef BOCHSERVISOR
 extern struct _bochs_routines routines;
@@ -100,6 +101,7 @@ void BX_CPU_C::cpu_loop(void)
 
     bxICacheEntry_c *entry = getICacheEntry();
     bxInstruction_c *i = entry->i;
+    BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
 
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
     for(;;) {
@@ -113,7 +115,9 @@ void BX_CPU_C::cpu_loop(void)
 
       if (BX_CPU_THIS_PTR async_event) break;
 
-      i = getICacheEntry()->i;
+      entry = getICacheEntry();
+      i = entry->i;
+      BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
     }
 #else // BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS == 0
 
@@ -147,6 +151,7 @@ void BX_CPU_C::cpu_loop(void)
         entry = getICacheEntry();
         i = entry->i;
         last = i + (entry->tlen);
+        BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
       }
     }
 #endif
@@ -167,6 +172,12 @@ void BX_CPU_C::cpu_run_trace(void)
     return;
   }
 
+#if BX_SUPPORT_SMP_THREADS
+  // handle requests posted by the other CPUs and the devices
+  if (BX_CPU_THIS_PTR lapic.mailbox_pending())
+    BX_CPU_THIS_PTR lapic.drain_mailbox();
+#endif
+
   // check on events which occurred for previous instructions (traps)
   // and ones which are asynchronous to the CPU (hardware interrupts)
   if (BX_CPU_THIS_PTR async_event) {
@@ -178,6 +189,7 @@ void BX_CPU_C::cpu_run_trace(void)
 
   bxICacheEntry_c *entry = getICacheEntry();
   bxInstruction_c *i = entry->i;
+  BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
 
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
   // want to allow changing of the instruction inside instrumentation callback
@@ -267,10 +279,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::linkTrace(bxInstruction_c *i)
     return;
   }
 
-  bxInstruction_c *next = i->getNextTrace(BX_CPU_THIS_PTR iCache.traceLinkTimeStamp);
-  if (next) {
-    BX_EXECUTE_INSTRUCTION(next);
-    return;
+  // the linked trace is known by its first instruction only, the icache
+  // entry is looked up while it has to be reported to the instrumentation
+  if (! BX_INSTR_TRACE_ENTRY_ENABLED()) {
+    bxInstruction_c *next = i->getNextTrace(BX_CPU_THIS_PTR iCache.traceLinkTimeStamp);
+    if (next) {
+      BX_EXECUTE_INSTRUCTION(next);
+      return;
+    }
   }
 
   bx_address eipBiased = RIP + BX_CPU_THIS_PTR eipPageBias;
@@ -288,6 +304,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::linkTrace(bxInstruction_c *i)
   {
     i->setNextTrace(entry->i, BX_CPU_THIS_PTR iCache.traceLinkTimeStamp);
     i = entry->i;
+    BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
     BX_EXECUTE_INSTRUCTION(i);
   }
 }
@@ -717,12 +734,13 @@ bx_bool BX_CPU_C::dbg_instruction_epilog(void)
   // Just committed an instruction, before fetching a new one
   // see if debugger is looking for iaddr breakpoint of any type
   if (bx_guard.guard_for & BX_DBG_GUARD_IADDR_ALL) {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
-    if (bx_guard.guard_for & BX_DBG_GUARD_IADDR_VIR) {
-      for (unsigned n=0; n<bx_guard.iaddr.num_virtual; n++) {
-        if (bx_guard.iaddr.vir[n].enabled &&
-           (bx_guard.iaddr.vir[n].cs  == cs) &&
-           (bx_guard.iaddr.vir[n].eip == debug_eip))
+    // the address index rejects instructions on pages without breakpoints
+    // with one bit test, the hits are looked up by exact address
+    const bx_dbg_addr_index_c *index = &bx_guard.iaddr.vir_index;
+    if ((bx_guard.guard_for & BX_DBG_GUARD_IADDR_VIR) && index->page_marked(BX_DBG_INDEX_PAGE(debug_eip))) {
+      for (int item = index->find(debug_eip); item >= 0; item = index->find_next(item, debug_eip)) {
+        unsigned n = index->entry(item);
+        if (bx_guard.iaddr.vir[n].enabled && (bx_guard.iaddr.vir[n].cs == cs))
         {
           if (! bx_guard.iaddr.vir[n].condition || bx_dbg_eval_condition(bx_guard.iaddr.vir[n].condition)) {
             BX_CPU_THIS_PTR guard_found.guard_found = BX_DBG_GUARD_IADDR_VIR;
@@ -732,12 +750,13 @@ bx_bool BX_CPU_C::dbg_instruction_epilog(void)
         }
       }
     }
-#endif
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
-    if (bx_guard.guard_for & BX_DBG_GUARD_IADDR_LIN) {
-      for (unsigned n=0; n<bx_guard.iaddr.num_linear; n++) {
-        if (bx_guard.iaddr.lin[n].enabled &&
-           (bx_guard.iaddr.lin[n].addr == BX_CPU_THIS_PTR guard_found.laddr))
+
+    bx_address laddr = BX_CPU_THIS_PTR guard_found.laddr;
+    index = &bx_guard.iaddr.lin_index;
+    if ((bx_guard.guard_for & BX_DBG_GUARD_IADDR_LIN) && index->page_marked(BX_DBG_INDEX_PAGE(laddr))) {
+      for (int item = index->find(laddr); item >= 0; item = index->find_next(item, laddr)) {
+        unsigned n = index->entry(item);
+        if (bx_guard.iaddr.lin[n].enabled)
         {
           if (! bx_guard.iaddr.lin[n].condition || bx_dbg_eval_condition(bx_guard.iaddr.lin[n].condition)) {
             BX_CPU_THIS_PTR guard_found.guard_found = BX_DBG_GUARD_IADDR_LIN;
@@ -747,14 +766,15 @@ bx_bool BX_CPU_C::dbg_instruction_epilog(void)
         }
       }
     }
-#endif
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
+
     if (bx_guard.guard_for & BX_DBG_GUARD_IADDR_PHY) {
       bx_phy_address phy;
-      bx_bool valid = dbg_xlate_linear2phy(BX_CPU_THIS_PTR guard_found.laddr, &phy);
-      if (valid) {
-        for (unsigned n=0; n<bx_guard.iaddr.num_physical; n++) {
-          if (bx_guard.iaddr.phy[n].enabled && (bx_guard.iaddr.phy[n].addr == phy))
+      bx_bool valid = dbg_xlate_linear2phy(laddr, &phy);
+      index = &bx_guard.iaddr.phy_index;
+      if (valid && index->page_marked(BX_DBG_INDEX_PAGE(phy))) {
+        for (int item = index->find(phy); item >= 0; item = index->find_next(item, phy)) {
+          unsigned n = index->entry(item);
+          if (bx_guard.iaddr.phy[n].enabled)
           {
             if (! bx_guard.iaddr.phy[n].condition || bx_dbg_eval_condition(bx_guard.iaddr.phy[n].condition)) {
               BX_CPU_THIS_PTR guard_found.guard_found = BX_DBG_GUARD_IADDR_PHY;
@@ -765,17 +785,20 @@ bx_bool BX_CPU_C::dbg_instruction_epilog(void)
         }
       }
     }
-#endif
   }
 #endif
 
 #if BX_GDBSTUB
   if (bx_dbg.gdbstub_enabled) {
-    unsigned reason = bx_gdbstub_check(EIP);
+    unsigned reason = bx_gdbstub_check(RIP);
     if (reason != GDBSTUB_STOP_NO_REASON) return(1);
   }
 #endif
 
+  // take a checkpoint or stop at the end of a replay
+  if (BX_CPU_THIS_PTR icount >= bx_revexec.get_stop_icount())
+    return bx_revexec.stop_reached();
+
   return(0);
 }
 #endif // BX_DEBUGGER || BX_GDBSTUB
@@ -551,6 +551,14 @@ BOCHSAPI extern BX_CPU_C   bx_cpu;
   BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, (laddr), (paddr), (size), (memtype), (rw), (dataptr)); \
 }
 
+// notify about an access through the host pointer of a TLB entry. Pages
+// with debugger watchpoints never get a host pointer (see translate_linear),
+// so the watchpoints don't have to be checked here.
+#define BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(laddr, paddr, size, memtype, rw, dataptr) {     \
+  BX_INSTR_LIN_ACCESS(BX_CPU_ID, (laddr), (paddr), (size), (memtype), (rw));                 \
+  BX_DBG_LIN_MEMORY_TRACE(BX_CPU_ID, (laddr), (paddr), (size), (memtype), (rw), (dataptr));  \
+}
+
 #define BX_NOTIFY_PHY_MEMORY_ACCESS(paddr, size, memtype, rw, why, dataptr) {              \
   BX_INSTR_PHY_ACCESS(BX_CPU_ID, (paddr), (size), (memtype), (rw));                        \
   BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID, (paddr), (size), (memtype), (rw), (why), (dataptr)); \
@@ -957,6 +965,9 @@ public: // for now...
 
   Bit64u icount;
   Bit64u icount_last_sync;
+#if BX_SUPPORT_SMP
+  bx_bool pause_hint; // PAUSE executed, probably spinning on a lock held by another CPU
+#endif
 
 #define BX_INHIBIT_INTERRUPTS        0x01
 #define BX_INHIBIT_DEBUG             0x02
@@ -1319,6 +1330,10 @@ public: // for now...
 #if BX_SUPPORT_MEMTYPE
     BxMemtype memtype1;       // memory type of the page 1
     BxMemtype memtype2;       // memory type of the page 2
+#endif
+#if BX_SUPPORT_SMP_THREADS
+    Bit64u rmw_data[2];       // data read by the last R-M-W access, used to
+                              // complete the write atomically
 #endif
   } address_xlation;
 
@@ -4358,6 +4373,10 @@ public: // for now...
 #endif
   BX_SMF bx_bool handleAsyncEvent(void);
   BX_SMF bx_bool handleWaitForEvent(void);
+  BX_SMF bx_bool is_wakeup_event_pending(void);
+#if BX_SUPPORT_SMP
+  BX_SMF bx_bool is_parked(void);
+#endif
   BX_SMF void InterruptAcknowledge(void);
 
   BX_SMF void boundaryFetch(const Bit8u *fetchPtr, unsigned remainingInPage, bxInstruction_c *);
@@ -4491,6 +4510,12 @@ public: // for now...
   BX_SMF void write_RMW_linear_dqword(Bit64u hi, Bit64u lo);
 #endif
 
+#if BX_SUPPORT_SMP_THREADS
+  BX_SMF Bit8u* write_RMW_linear_host_ptr(unsigned len);
+  BX_SMF bx_bool write_RMW_linear_atomic(Bit64u val, unsigned len);
+  BX_SMF void restart_RMW_instruction(void) BX_CPP_AttrNoReturn();
+#endif
+
   // write of word/dword to new stack could happen only in legacy mode
   BX_SMF void write_new_stack_word(bx_segment_reg_t *seg, Bit32u offset, unsigned curr_pl, Bit16u data);
   BX_SMF void write_new_stack_dword(bx_segment_reg_t *seg, Bit32u offset, unsigned curr_pl, Bit32u data);
@@ -4572,6 +4597,11 @@ public: // for now...
 
   BX_SMF bx_hostpageaddr_t getHostMemAddr(bx_phy_address addr, unsigned rw);
 
+  BX_SMF void write_paging_entry(bx_phy_address entry_addr, unsigned len, Bit64u old_entry, Bit64u new_entry);
+#if BX_SUPPORT_SMP_THREADS
+  BX_SMF bx_bool write_paging_entry_atomic(bx_phy_address entry_addr, unsigned len, Bit64u old_entry, Bit64u new_entry);
+#endif
+
   // linear address for translate_linear expected to be canonical !
   BX_SMF bx_phy_address translate_linear(bx_TLB_entry *entry, bx_address laddr, unsigned user, unsigned rw);
   BX_SMF bx_phy_address translate_linear_legacy(bx_address laddr, Bit32u &lpf_mask, unsigned user, unsigned rw);
@@ -26,6 +26,7 @@
 #define LOG_THIS BX_CPU_THIS_PTR
 
 #include "iodev/iodev.h"
+#include "replay.h"
 
 bx_bool BX_CPU_C::handleWaitForEvent(void)
 {
@@ -41,13 +42,7 @@ bx_bool BX_CPU_C::handleWaitForEvent(void)
   // an interrupt wakes up the CPU.
   while (1)
   {
-    if ((is_pending(BX_EVENT_PENDING_INTR | BX_EVENT_PENDING_LAPIC_INTR) && (BX_CPU_THIS_PTR get_IF() || BX_CPU_THIS_PTR activity_state == BX_ACTIVITY_STATE_MWAIT_IF)) ||
-         is_unmasked_event_pending(BX_EVENT_NMI | BX_EVENT_SMI | BX_EVENT_INIT |
-            BX_EVENT_VMX_VTPR_UPDATE |
-            BX_EVENT_VMX_VEOI_UPDATE |
-            BX_EVENT_VMX_VIRTUAL_APIC_WRITE |
-            BX_EVENT_VMX_MONITOR_TRAP_FLAG |
-            BX_EVENT_VMX_VIRTUAL_NMI))
+    if (is_wakeup_event_pending())
     {
       // interrupt ends the HALT condition
 #if BX_SUPPORT_MONITOR_MWAIT
@@ -72,7 +67,9 @@ bx_bool BX_CPU_C::handleWaitForEvent(void)
 
     if (BX_HRQ && BX_DBG_ASYNC_DMA) {
       // handle DMA also when CPU is halted
+      BX_LOCK_DEVICES();
       DEV_dma_raise_hlda();
+      BX_UNLOCK_DEVICES();
     }
 
     // for multiprocessor simulation, even if this CPU is halted we still
@@ -93,6 +90,11 @@ bx_bool BX_CPU_C::handleWaitForEvent(void)
     if (bx_guard.interrupt_requested)
       return 1; // Return to caller of cpu_loop.
 #endif
+#if BX_GDBSTUB
+    // no instructions are executed, so check for a break request from GDB here
+    if (bx_dbg.gdbstub_enabled && bx_gdbstub_poll())
+      return 1; // Return to caller of cpu_loop.
+#endif
 
     if (bx_pc_system.kill_bochs_request) {
       // setting kill_bochs_request causes the cpu loop to return ASAP.
@@ -108,6 +110,38 @@ bx_bool BX_CPU_C::handleWaitForEvent(void)
   return 0;
 }
 
+// An interrupt or event ending the HLT or MWAIT state is pending
+bx_bool BX_CPU_C::is_wakeup_event_pending(void)
+{
+  return (is_pending(BX_EVENT_PENDING_INTR | BX_EVENT_PENDING_LAPIC_INTR) && (BX_CPU_THIS_PTR get_IF() || BX_CPU_THIS_PTR activity_state == BX_ACTIVITY_STATE_MWAIT_IF)) ||
+          is_unmasked_event_pending(BX_EVENT_NMI | BX_EVENT_SMI | BX_EVENT_INIT |
+            BX_EVENT_VMX_VTPR_UPDATE |
+            BX_EVENT_VMX_VEOI_UPDATE |
+            BX_EVENT_VMX_VIRTUAL_APIC_WRITE |
+            BX_EVENT_VMX_MONITOR_TRAP_FLAG |
+            BX_EVENT_VMX_VIRTUAL_NMI);
+}
+
+#if BX_SUPPORT_SMP
+// The CPU waits in HLT, MWAIT or wait-for-SIPI state and nothing could
+// wake it up yet, so the SMP scheduler doesn't have to run it at all.
+bx_bool BX_CPU_C::is_parked(void)
+{
+  if (BX_CPU_THIS_PTR activity_state == BX_ACTIVITY_STATE_ACTIVE)
+    return 0;
+
+  // SIPI and INIT change the state directly from the APIC
+  if (BX_CPU_THIS_PTR activity_state == BX_ACTIVITY_STATE_WAIT_FOR_SIPI)
+    return 1;
+
+  if (is_wakeup_event_pending() ||
+      is_unmasked_event_pending(BX_EVENT_VMX_PREEMPTION_TIMER_EXPIRED))
+    return 0;
+
+  return ! (BX_HRQ && BX_DBG_ASYNC_DMA);
+}
+#endif
+
 void BX_CPU_C::InterruptAcknowledge(void)
 {
   Bit8u vector;
@@ -138,8 +172,14 @@ void BX_CPU_C::InterruptAcknowledge(void)
     vector = BX_CPU_THIS_PTR lapic.acknowledge_int();
   else
 #endif
+  {
     // if no local APIC, always acknowledge the PIC.
+    BX_LOCK_DEVICES();
     vector = DEV_pic_iac(); // may set INTR with next interrupt
+    BX_UNLOCK_DEVICES();
+  }
+
+  bx_replay.interrupt(BX_CPU_ID, vector);
 
   BX_CPU_THIS_PTR EXT = 1; /* external event */
 #if BX_SUPPORT_VMX
@@ -332,7 +372,9 @@ bx_bool BX_CPU_C::handleAsyncEvent(void)
   else if (BX_HRQ && BX_DBG_ASYNC_DMA) {
     // NOTE: similar code in ::take_dma()
     // assert Hold Acknowledge (HLDA) and go into a bus hold state
+    BX_LOCK_DEVICES();
     DEV_dma_raise_hlda();
+    BX_UNLOCK_DEVICES();
   }
 
   if (BX_CPU_THIS_PTR get_TF())
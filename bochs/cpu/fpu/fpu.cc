@@ -76,7 +76,9 @@ void BX_CPU_C::FPU_check_pending_exceptions(void)
      {
         // MSDOS compatibility external interrupt (IRQ13)
         BX_INFO(("math_abort: MSDOS compatibility FPU exception"));
+        BX_LOCK_DEVICES();
         DEV_pic_raise_irq(13);
+        BX_UNLOCK_DEVICES();
      }
   }
 }
@@ -42,6 +42,12 @@ extern int assignHandler(bxInstruction_c *i, Bit32u fetchModeMask);
 void flushICaches(void)
 {
   for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SUPPORT_SMP_THREADS
+    if (bx_pc_system.is_remote_cpu(i)) {
+      BX_CPU(i)->lapic.post_request(BX_LAPIC_MBOX_ICACHE_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->iCache.flushICacheEntries();
     BX_CPU(i)->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
   }
@@ -54,6 +60,13 @@ void handleSMC(bx_phy_address pAddr, Bit32u mask)
   INC_SMC_STAT(smc);
 
   for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SUPPORT_SMP_THREADS
+    // the icache of a CPU running in another thread is flushed entirely
+    if (bx_pc_system.is_remote_cpu(i)) {
+      BX_CPU(i)->lapic.post_request(BX_LAPIC_MBOX_ICACHE_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
     BX_CPU(i)->iCache.handleSMC(pAddr, mask);
   }
@@ -148,6 +161,7 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
 #endif
 
       BX_CPU_THIS_PTR iCache.commit_page_split_trace(BX_CPU_THIS_PTR pAddrFetchPage, entry);
+      BX_INSTR_TRACE_DECODED(BX_CPU_ID, entry);
       return entry;
     }
 
@@ -181,6 +195,7 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
           entry->traceMask |= traceMask;
           pageWriteStampTable.markICacheMask(pAddr, entry->traceMask);
           BX_CPU_THIS_PTR iCache.commit_trace(entry->tlen);
+          BX_INSTR_TRACE_DECODED(BX_CPU_ID, entry);
           return entry;
       }
     }
@@ -199,6 +214,8 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
 
   BX_CPU_THIS_PTR iCache.commit_trace(entry->tlen);
 
+  BX_INSTR_TRACE_DECODED(BX_CPU_ID, entry);
+
   return entry;
 }
 
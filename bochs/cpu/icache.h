@@ -26,6 +26,16 @@
 
 extern void handleSMC(bx_phy_address pAddr, Bit32u mask);
 
+#if BX_SUPPORT_SMP_THREADS
+#include "bxthread.h"
+// the write stamps are shared by the CPUs running in parallel
+#define BX_WRITE_STAMP_SET(stamp, mask)   BX_ATOMIC_OR32(&(stamp), (mask))
+#define BX_WRITE_STAMP_CLEAR(stamp, mask) BX_ATOMIC_AND32(&(stamp), ~(mask))
+#else
+#define BX_WRITE_STAMP_SET(stamp, mask)   (stamp) |= (mask)
+#define BX_WRITE_STAMP_CLEAR(stamp, mask) (stamp) &= ~(mask)
+#endif
+
 class bxPageWriteStampTable
 {
   const Bit32u PHY_MEM_PAGES = 1024*1024;
@@ -53,12 +63,12 @@ public:
     Bit32u mask  = 1 << (PAGE_OFFSET((Bit32u) pAddr) >> 7);
            mask |= 1 << (PAGE_OFFSET((Bit32u) pAddr + len - 1) >> 7);
 
-    fineGranularityMapping[hash(pAddr)] |= mask;
+    BX_WRITE_STAMP_SET(fineGranularityMapping[hash(pAddr)], mask);
   }
 
   BX_CPP_INLINE void markICacheMask(bx_phy_address pAddr, Bit32u mask)
   {
-    fineGranularityMapping[hash(pAddr)] |= mask;
+    BX_WRITE_STAMP_SET(fineGranularityMapping[hash(pAddr)], mask);
   }
 
   // whole page is being altered
@@ -68,7 +78,7 @@ public:
 
     if (fineGranularityMapping[index]) {
       handleSMC(pAddr, 0xffffffff); // one of the CPUs might be running trace from this page
-      fineGranularityMapping[index] = 0;
+      BX_WRITE_STAMP_CLEAR(fineGranularityMapping[index], 0xffffffff);
     }
   }
 
@@ -84,7 +94,7 @@ public:
        if (fineGranularityMapping[index] & mask) {
           // one of the CPUs might be running trace from this page
           handleSMC(pAddr, mask);
-          fineGranularityMapping[index] &= ~mask;
+          BX_WRITE_STAMP_CLEAR(fineGranularityMapping[index], mask);
        }       
     }
   }
@@ -659,6 +659,9 @@ void BX_CPU_C::reset(unsigned source)
   if (source == BX_RESET_HARDWARE)
     BX_CPU_THIS_PTR icount = 0;
   BX_CPU_THIS_PTR icount_last_sync = BX_CPU_THIS_PTR icount;
+#if BX_SUPPORT_SMP
+  BX_CPU_THIS_PTR pause_hint = 0;
+#endif
 
   BX_CPU_THIS_PTR inhibit_mask = 0;
   BX_CPU_THIS_PTR inhibit_icount = 0;
@@ -81,20 +81,21 @@ Bit32u BX_CPU_C::FastRepINSW(bxInstruction_c *i, Bit32u dstOff, Bit16u port, Bit
 
   // If after all the restrictions, there is anything left to do...
   if (wordCount) {
+    // Only devices with a block handler (e.g. the ATA data port) can take
+    // whole runs at once, and only for DF=0
+    bx_bool blockIO = (BX_CPU_THIS_PTR get_DF() == 0);
     for (count=0; count<wordCount; ) {
-      bx_devices.bulkIOQuantumsTransferred = 0;
-      if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
-        bx_devices.bulkIOHostAddr = hostAddrDst;
-        bx_devices.bulkIOQuantumsRequested = (wordCount - count);
+      Bit32u transferred = 0;
+      if (blockIO) {
+        transferred = BX_INP_BLOCK(port, 2, hostAddrDst, wordCount - count);
+        if (! transferred) blockIO = 0;
       }
-      else
-        bx_devices.bulkIOQuantumsRequested = 0;
-      Bit16u temp16 = BX_INP(port, 2);
-      if (bx_devices.bulkIOQuantumsTransferred) {
-        hostAddrDst = bx_devices.bulkIOHostAddr;
-        count += bx_devices.bulkIOQuantumsTransferred;
+      if (transferred) {
+        hostAddrDst += transferred << 1;
+        count += transferred;
       }
       else {
+        Bit16u temp16 = BX_INP(port, 2);
         WriteHostWordToLittleEndian(hostAddrDst, temp16);
         hostAddrDst += pointerDelta;
         count++;
@@ -103,9 +104,6 @@ Bit32u BX_CPU_C::FastRepINSW(bxInstruction_c *i, Bit32u dstOff, Bit16u port, Bit
       if (BX_CPU_THIS_PTR async_event) break;
     }
 
-    // Reset for next non-bulk IO
-    bx_devices.bulkIOQuantumsRequested = 0;
-
     return count;
   }
 
@@ -161,22 +159,23 @@ Bit32u BX_CPU_C::FastRepOUTSW(bxInstruction_c *i, unsigned srcSeg, Bit32u srcOff
 
   // If after all the restrictions, there is anything left to do...
   if (wordCount) {
+    // Only devices with a block handler (e.g. the ATA data port) can take
+    // whole runs at once, and only for DF=0
+    bx_bool blockIO = (BX_CPU_THIS_PTR get_DF() == 0);
     for (count=0; count<wordCount; ) {
-      bx_devices.bulkIOQuantumsTransferred = 0;
-      if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
-        bx_devices.bulkIOHostAddr = hostAddrSrc;
-        bx_devices.bulkIOQuantumsRequested = (wordCount - count);
+      Bit32u transferred = 0;
+      if (blockIO) {
+        transferred = BX_OUTP_BLOCK(port, 2, hostAddrSrc, wordCount - count);
+        if (! transferred) blockIO = 0;
       }
-      else
-        bx_devices.bulkIOQuantumsRequested = 0;
-      Bit16u temp16;
-      ReadHostWordFromLittleEndian(hostAddrSrc, temp16);
-      BX_OUTP(port, temp16, 2);
-      if (bx_devices.bulkIOQuantumsTransferred) {
-        hostAddrSrc = bx_devices.bulkIOHostAddr;
-        count += bx_devices.bulkIOQuantumsTransferred;
+      if (transferred) {
+        hostAddrSrc += transferred << 1;
+        count += transferred;
       }
       else {
+        Bit16u temp16;
+        ReadHostWordFromLittleEndian(hostAddrSrc, temp16);
+        BX_OUTP(port, temp16, 2);
         hostAddrSrc += pointerDelta;
         count++;
       }
@@ -184,9 +183,6 @@ Bit32u BX_CPU_C::FastRepOUTSW(bxInstruction_c *i, unsigned srcSeg, Bit32u srcOff
       if (BX_CPU_THIS_PTR async_event) break;
     }
 
-    // Reset for next non-bulk IO
-    bx_devices.bulkIOQuantumsRequested = 0;
-
     return count;
   }
 
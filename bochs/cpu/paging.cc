@@ -22,6 +22,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "revexec.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 // X86 Registers Which Affect Paging:
@@ -808,8 +809,8 @@ void BX_CPU_C::update_access_dirty_PAE(bx_phy_address *entry_addr, Bit64u *entry
   // Update A bit if needed
   for (unsigned level=max_level; level > leaf; level--) {
     if (!(entry[level] & 0x20)) {
+      write_paging_entry(entry_addr[level], 8, entry[level], entry[level] | 0x20);
       entry[level] |= 0x20;
-      access_write_physical(entry_addr[level], 8, &entry[level]);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[level], 8, entry_memtype[level], BX_WRITE,
             (BX_PTE_ACCESS + level), (Bit8u*)(&entry[level]));
     }
@@ -817,8 +818,8 @@ void BX_CPU_C::update_access_dirty_PAE(bx_phy_address *entry_addr, Bit64u *entry
 
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x20) || (write && !(entry[leaf] & 0x40))) {
+    write_paging_entry(entry_addr[leaf], 8, entry[leaf], entry[leaf] | 0x20 | (write<<6));
     entry[leaf] |= (0x20 | (write<<6)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 8, &entry[leaf]);
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 8, entry_memtype[leaf], BX_WRITE,
             (BX_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
@@ -1153,16 +1154,16 @@ void BX_CPU_C::update_access_dirty(bx_phy_address *entry_addr, Bit32u *entry, Bx
   if (leaf == BX_LEVEL_PTE) {
     // Update PDE A bit if needed
     if (!(entry[BX_LEVEL_PDE] & 0x20)) {
+      write_paging_entry(entry_addr[BX_LEVEL_PDE], 4, entry[BX_LEVEL_PDE], entry[BX_LEVEL_PDE] | 0x20);
       entry[BX_LEVEL_PDE] |= 0x20;
-      access_write_physical(entry_addr[BX_LEVEL_PDE], 4, &entry[BX_LEVEL_PDE]);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[BX_LEVEL_PDE], 4, entry_memtype[BX_LEVEL_PDE], BX_WRITE, BX_PDE_ACCESS, (Bit8u*)(&entry[BX_LEVEL_PDE]));
     }
   }
 
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x20) || (write && !(entry[leaf] & 0x40))) {
+    write_paging_entry(entry_addr[leaf], 4, entry[leaf], entry[leaf] | 0x20 | (write<<6));
     entry[leaf] |= (0x20 | (write<<6)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 4, &entry[leaf]);
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 4, entry_memtype[leaf], BX_WRITE, (BX_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
 }
@@ -1339,6 +1340,14 @@ bx_phy_address BX_CPU_C::translate_linear(bx_TLB_entry *tlbEntry, bx_address lad
     // All access allowed also via direct pointer
 #if BX_X86_DEBUGGER
     if (! hwbreakpoint_check(laddr, BX_HWDebugMemW, BX_HWDebugMemRW))
+#endif
+#if BX_DEBUGGER
+    // keep accesses to pages with watchpoints on the slow path
+    if (! bx_dbg_watched_page(ppf))
+#endif
+#if BX_DEBUGGER || BX_GDBSTUB
+    // reverse execution saves the RAM pages in the slow write path
+    if (! (isWrite && bx_revexec.enabled()))
 #endif
        tlbEntry->lpf = lpf; // allow direct access with HostPtr
   }
@@ -1897,16 +1906,16 @@ void BX_CPU_C::update_ept_access_dirty(bx_phy_address *entry_addr, Bit64u *entry
   // Update A bit if needed
   for (unsigned level=BX_LEVEL_PML4; level > leaf; level--) {
     if (!(entry[level] & 0x100)) {
+      write_paging_entry(entry_addr[level], 8, entry[level], entry[level] | 0x100);
       entry[level] |= 0x100;
-      access_write_physical(entry_addr[level], 8, &entry[level]);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[level], 8, MEMTYPE(eptptr_memtype), BX_WRITE, (BX_EPT_PTE_ACCESS + level), (Bit8u*)(&entry[level]));
     }
   }
 
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x100) || (write && !(entry[leaf] & 0x200))) {
+    write_paging_entry(entry_addr[leaf], 8, entry[leaf], entry[leaf] | 0x100 | (write<<9));
     entry[leaf] |= (0x100 | (write<<9)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 8, &entry[leaf]);
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 8, MEMTYPE(eptptr_memtype), BX_WRITE, (BX_EPT_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
 }
@@ -2447,6 +2456,70 @@ void BX_CPU_C::access_read_physical(bx_phy_address paddr, unsigned len, void *da
   BX_MEM(0)->readPhysicalPage(BX_CPU_THIS, paddr, len, data);
 }
 
+// Store the accessed/dirty bits set by the page walk in a paging structure
+// entry. 'new_entry' differs from 'old_entry' in these bits only.
+void BX_CPU_C::write_paging_entry(bx_phy_address entry_addr, unsigned len, Bit64u old_entry, Bit64u new_entry)
+{
+#if BX_SUPPORT_SMP_THREADS
+  if (bx_pc_system.cpus_running && write_paging_entry_atomic(entry_addr, len, old_entry, new_entry))
+    return;
+#endif
+
+  if (len == 8) {
+    access_write_physical(entry_addr, 8, &new_entry);
+  }
+  else {
+    Bit32u new_entry32 = (Bit32u) new_entry;
+    access_write_physical(entry_addr, 4, &new_entry32);
+  }
+}
+
+#if BX_SUPPORT_SMP_THREADS
+
+// The CPUs running in the other host threads may update the same entry, for
+// example a guest LOCK CMPXCHG on a PTE. Set the bits with a compare-and-swap
+// and retry while only the accessed/dirty bits changed meanwhile. If another
+// CPU modified the entry otherwise the update is dropped, as if the walk
+// had completed before the modification. Returns 0 if the entry isn't
+// backed by host memory, the caller then writes it the regular way.
+bx_bool BX_CPU_C::write_paging_entry_atomic(bx_phy_address entry_addr, unsigned len, Bit64u old_entry, Bit64u new_entry)
+{
+  Bit8u *hostAddr = (Bit8u *) getHostMemAddr(PPFOf(entry_addr), BX_RW);
+  if (! hostAddr) return 0;
+  hostAddr += PAGE_OFFSET(entry_addr);
+  pageWriteStampTable.decWriteStamp(entry_addr, len);
+
+  Bit64u set_bits = new_entry & ~old_entry;
+  // accessed and dirty bits are 5/6 for paging and 8/9 for EPT entries
+  Bit64u ad_bits = (set_bits & 0x300) ? 0x300 : 0x60;
+
+  while (1) {
+    Bit64u curr_entry;
+    if (len == 8) {
+      Bit64u old64, new64;
+      WriteHostQWordToLittleEndian(&old64, old_entry);
+      WriteHostQWordToLittleEndian(&new64, new_entry);
+      if (BX_ATOMIC_CAS64(hostAddr, old64, new64)) break;
+      ReadHostQWordFromLittleEndian(hostAddr, curr_entry);
+    }
+    else {
+      Bit32u old32, new32, curr32;
+      WriteHostDWordToLittleEndian(&old32, (Bit32u) old_entry);
+      WriteHostDWordToLittleEndian(&new32, (Bit32u) new_entry);
+      if (BX_ATOMIC_CAS32(hostAddr, old32, new32)) break;
+      ReadHostDWordFromLittleEndian(hostAddr, curr32);
+      curr_entry = curr32;
+    }
+    if ((curr_entry ^ old_entry) & ~ad_bits) break;
+    old_entry = curr_entry;
+    new_entry = curr_entry | set_bits;
+  }
+
+  return 1;
+}
+
+#endif
+
 bx_hostpageaddr_t BX_CPU_C::getHostMemAddr(bx_phy_address paddr, unsigned rw)
 {
 #if BX_SUPPORT_VMX && BX_SUPPORT_X86_64
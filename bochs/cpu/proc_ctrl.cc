@@ -79,6 +79,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PAUSE(bxInstruction_c *i)
   }
 #endif
 
+#if BX_SUPPORT_SMP
+  // give the other CPUs a chance to release the lock we are spinning on
+  if (BX_SMP_PROCESSORS > 1) {
+    BX_CPU_THIS_PTR pause_hint = 1;
+    BX_CPU_THIS_PTR async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  }
+#endif
+
   BX_NEXT_INSTR(i);
 }
 
@@ -23,6 +23,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "replay.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 #include <stdlib.h>
@@ -48,6 +49,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDRAND_Ew(bxInstruction_c *i)
     val_16 <<= 8;
     val_16 |= rand() & 0xff;
 
+    val_16 = (Bit16u) bx_replay.value(BX_REPLAY_RDRAND, val_16);
+
     assert_CF();
   }
 
@@ -79,6 +82,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDRAND_Ed(bxInstruction_c *i)
     val_32 <<= 8;
     val_32 |= rand() & 0xff;
 
+    val_32 = (Bit32u) bx_replay.value(BX_REPLAY_RDRAND, val_32);
+
     assert_CF();
   }
 
@@ -119,6 +124,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDRAND_Eq(bxInstruction_c *i)
     val_64 <<= 8;
     val_64 |= rand() & 0xff;
 
+    val_64 = (Bit64u) bx_replay.value(BX_REPLAY_RDRAND, val_64);
+
     assert_CF();
   }
 
@@ -147,6 +154,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDSEED_Ew(bxInstruction_c *i)
     val_16 <<= 8;
     val_16 |= rand() & 0xff;
 
+    val_16 = (Bit16u) bx_replay.value(BX_REPLAY_RDSEED, val_16);
+
     assert_CF();
   }
 
@@ -178,6 +187,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDSEED_Ed(bxInstruction_c *i)
     val_32 <<= 8;
     val_32 |= rand() & 0xff;
 
+    val_32 = (Bit32u) bx_replay.value(BX_REPLAY_RDSEED, val_32);
+
     assert_CF();
   }
 
@@ -218,6 +229,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::RDSEED_Eq(bxInstruction_c *i)
     val_64 <<= 8;
     val_64 |= rand() & 0xff;
 
+    val_64 = (Bit64u) bx_replay.value(BX_REPLAY_RDSEED, val_64);
+
     assert_CF();
   }
 
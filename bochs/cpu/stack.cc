@@ -143,7 +143,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::stack_write_byte(bx_address offset, Bit8u
   if (BX_CPU_THIS_PTR espHostPtr) {
     Bit8u *hostPageAddr = (Bit8u*)(BX_CPU_THIS_PTR espHostPtr + espBiased);
     bx_phy_address pAddr = BX_CPU_THIS_PTR pAddrStackPage + espBiased;
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset), pAddr, 1,
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset), pAddr, 1,
                                 MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_WRITE, (Bit8u*) &data);
 
 #if BX_SUPPORT_SMP == 0
@@ -176,7 +176,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::stack_write_word(bx_address offset, Bit16u
       exception(BX_AC_EXCEPTION, 0);
     }
 #endif
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset), pAddr, 2,
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset), pAddr, 2,
                                 MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_WRITE, (Bit8u*) &data);
 
 #if BX_SUPPORT_SMP == 0
@@ -209,7 +209,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::stack_write_dword(bx_address offset, Bit32
       exception(BX_AC_EXCEPTION, 0);
     }
 #endif
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset), pAddr, 4,
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset), pAddr, 4,
                                 MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_WRITE, (Bit8u*) &data);
 
 #if BX_SUPPORT_SMP == 0
@@ -242,7 +242,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::stack_write_qword(bx_address offset, Bit64
       exception(BX_AC_EXCEPTION, 0);
     }
 #endif
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset), pAddr, 8,
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset), pAddr, 8,
                                 MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_WRITE, (Bit8u*) &data);
 
 #if BX_SUPPORT_SMP == 0
@@ -269,7 +269,7 @@ Bit8u BX_CPP_AttrRegparmN(1) BX_CPU_C::stack_read_byte(bx_address offset)
   if (BX_CPU_THIS_PTR espHostPtr) {
     Bit8u *hostPageAddr = (Bit8u*)(BX_CPU_THIS_PTR espHostPtr + espBiased), data;
     data = *hostPageAddr;
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset),
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset),
         (BX_CPU_THIS_PTR pAddrStackPage + espBiased), 1,
          MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_READ, (Bit8u*) &data);
     return data;
@@ -300,7 +300,7 @@ Bit16u BX_CPP_AttrRegparmN(1) BX_CPU_C::stack_read_word(bx_address offset)
     }
 #endif
     ReadHostWordFromLittleEndian(hostPageAddr, data);
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset),
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset),
         (BX_CPU_THIS_PTR pAddrStackPage + espBiased), 2,
          MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_READ, (Bit8u*) &data);
     return data;
@@ -331,7 +331,7 @@ Bit32u BX_CPP_AttrRegparmN(1) BX_CPU_C::stack_read_dword(bx_address offset)
     }
 #endif
     ReadHostDWordFromLittleEndian(hostPageAddr, data);
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset),
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset),
         (BX_CPU_THIS_PTR pAddrStackPage + espBiased), 4,
          MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_READ, (Bit8u*) &data);
     return data;
@@ -362,7 +362,7 @@ Bit64u BX_CPP_AttrRegparmN(1) BX_CPU_C::stack_read_qword(bx_address offset)
     }
 #endif
     ReadHostQWordFromLittleEndian(hostPageAddr, data);
-    BX_NOTIFY_LIN_MEMORY_ACCESS(get_laddr(BX_SEG_REG_SS, offset),
+    BX_NOTIFY_LIN_MEMORY_ACCESS_HOSTPTR(get_laddr(BX_SEG_REG_SS, offset),
         (BX_CPU_THIS_PTR pAddrStackPage + espBiased), 8,
          MEMTYPE(BX_CPU_THIS_PTR espPageMemtype), BX_READ, (Bit8u*) &data);
     return data;
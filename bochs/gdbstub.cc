@@ -2,7 +2,7 @@
 // $Id$
 /////////////////////////////////////////////////////////////////////////
 //
-//  Copyright (C) 2002-2017  The Bochs Project Team
+//  Copyright (C) 2002-2026  The Bochs Project Team
 //
 //  This library is free software; you can redistribute it and/or
 //  modify it under the terms of the GNU Lesser General Public
@@ -26,8 +26,12 @@
 #if defined(__MINGW32__) || defined(_MSC_VER)
 #include <winsock2.h>
 #define SIGTRAP 5
+#ifndef SIGINT
+#define SIGINT 2
+#endif
 #else
 #include <sys/socket.h>
+#include <sys/select.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -41,6 +45,7 @@
 #include "bochs.h"
 #include "param_names.h"
 #include "cpu/cpu.h"
+#include "revexec.h"
 
 #define LOG_THIS gdbstublog->
 #define IFDBG(x) x
@@ -64,74 +69,115 @@ static int hex(char ch)
   return(-1);
 }
 
-static char buf[4096], *bufptr = buf;
+// Largest packet accepted from GDB, announced with qSupported. Memory is
+// transferred in blocks of up to half this size.
+#define GDBSTUB_PACKET_SIZE (0x10000)
+
+// Instructions executed between checks for a break request from GDB
+#define GDBSTUB_POLL_INTERVAL (0x4000)
+
+static char rx_buf[4096];
+static int rx_pos = 0, rx_len = 0;
+static int no_ack_mode = 0;
+
+static char in_packet[GDBSTUB_PACKET_SIZE + 1];
+static char obuf[GDBSTUB_PACKET_SIZE + 1];
+// a binary reply with every byte escaped, framing and checksum
+static char out_packet[GDBSTUB_PACKET_SIZE * 2 + 4];
+static Bit8u mem[GDBSTUB_PACKET_SIZE / 2];
 
-static void flush_debug_buffer()
+static void send_data(const char *p, int len)
 {
-  char *p = buf;
-  while (p != bufptr) {
-    int n = send(socket_fd, p, bufptr-p, 0);
+  while (len > 0) {
+    int n = send(socket_fd, p, len, 0);
     if (n == -1) {
       BX_ERROR(("error on debug socket: %m"));
       break;
     }
     p += n;
+    len -= n;
   }
-  bufptr = buf;
 }
 
-static void put_debug_char(char ch)
+// Read everything available from the socket into rx_buf. Unless wait is set
+// return immediately if there is nothing to read.
+static int fill_rx_buffer(int wait)
 {
-  if (bufptr == buf + sizeof buf)
-    flush_debug_buffer();
-  *bufptr++ = ch;
+  if (!wait) {
+    fd_set fds;
+    struct timeval tv = {0, 0};
+    FD_ZERO(&fds);
+    FD_SET(socket_fd, &fds);
+    if (select(socket_fd + 1, &fds, NULL, NULL, &tv) != 1)
+      return 0;
+  }
+
+  int n = recv(socket_fd, rx_buf, sizeof(rx_buf), 0);
+  if (n <= 0) {
+    BX_PANIC(("Debugger connection closed"));
+    return 0;
+  }
+  rx_pos = 0;
+  rx_len = n;
+  return n;
 }
 
 static char get_debug_char(void)
 {
-  char ch;
-
-  recv(socket_fd, &ch, 1, 0);
+  if ((rx_pos == rx_len) && !fill_rx_buffer(1))
+    return(0);
 
-  return(ch);
+  return(rx_buf[rx_pos++]);
 }
 
 static const char hexchars[]="0123456789abcdef";
 
-static void put_reply(const char* buffer)
+// Send a packet with a single send() call. '$', '#', '}' and '*' in the
+// data are escaped, so binary data can be sent as well.
+static void put_packet(const char* buffer, int len)
 {
-  unsigned char csum;
-  int i;
+  unsigned char csum = 0;
+  char *p = out_packet;
 
-  BX_DEBUG(("put_buffer '%s'", buffer));
+  *p++ = '$';
+  for (int i = 0; i < len; i++)
+  {
+    char ch = buffer[i];
+    if (ch == '$' || ch == '#' || ch == '}' || ch == '*')
+    {
+      *p++ = '}';
+      csum += '}';
+      ch ^= 0x20;
+    }
+    *p++ = ch;
+    csum += ch;
+  }
+  *p++ = '#';
+  *p++ = hexchars[csum >> 4];
+  *p++ = hexchars[csum % 16];
 
   do {
-    put_debug_char('$');
-
-    csum = 0;
+    send_data(out_packet, p - out_packet);
+  } while (!no_ack_mode && get_debug_char() != '+');
+}
 
-    i = 0;
-    while (buffer[i] != 0)
-    {
-      put_debug_char(buffer[i]);
-      csum = csum + buffer[i];
-      i++;
-    }
+static void put_reply(const char* buffer)
+{
+  BX_DEBUG(("put_buffer '%s'", buffer));
 
-    put_debug_char('#');
-    put_debug_char(hexchars[csum >> 4]);
-    put_debug_char(hexchars[csum % 16]);
-    flush_debug_buffer();
-  } while (get_debug_char() != '+');
+  put_packet(buffer, strlen(buffer));
 }
 
-static void get_command(char* buffer)
+// Receive a packet into buffer, escaped characters are decoded. Returns the
+// length of the data, the buffer is zero terminated as well.
+static int get_command(char* buffer)
 {
   unsigned char checksum;
   unsigned char xmitcsum;
   char ch;
   unsigned int count;
   unsigned int i;
+  int escape;
 
   do {
     while ((ch = get_debug_char()) != '$');
@@ -139,14 +185,28 @@ static void get_command(char* buffer)
     checksum = 0;
     xmitcsum = 0;
     count = 0;
+    escape = 0;
 
     while (1)
     {
       ch = get_debug_char();
       if (ch == '#') break;
       checksum = checksum + ch;
-      buffer[count] = ch;
-      count++;
+      if (escape)
+      {
+        ch ^= 0x20;
+        escape = 0;
+      }
+      else if (ch == '}')
+      {
+        escape = 1;
+        continue;
+      }
+      if (count < GDBSTUB_PACKET_SIZE)
+      {
+        buffer[count] = ch;
+        count++;
+      }
     }
     buffer[count] = 0;
 
@@ -160,27 +220,36 @@ static void get_command(char* buffer)
       }
     }
 
+    if (no_ack_mode)
+    {
+      break;
+    }
+
     if (checksum != xmitcsum)
     {
-      put_debug_char('-');
-      flush_debug_buffer();
+      send_data("-", 1);
     }
     else
     {
-      put_debug_char('+');
+      char ack[3];
+      int ack_len = 1;
+      ack[0] = '+';
       if (buffer[2] == ':')
       {
-        put_debug_char(buffer[0]);
-        put_debug_char(buffer[1]);
-        count = strlen(buffer);
+        ack[1] = buffer[0];
+        ack[2] = buffer[1];
+        ack_len = 3;
         for (i = 3; i <= count; i++)
         {
           buffer[i - 3] = buffer[i];
         }
+        count -= 3;
       }
-      flush_debug_buffer();
+      send_data(ack, ack_len);
     }
   } while (checksum != xmitcsum);
+
+  return(count);
 }
 
 void hex2mem(char* buf, unsigned char* mem, int count)
@@ -235,19 +304,60 @@ Bit64u read_little_endian_hex(char *&buf)
 static int continue_thread = -1;
 static int other_thread = 0;
 
-#if !BX_SUPPORT_X86_64
-#define NUMREGS (16)
-#define NUMREGSBYTES (NUMREGS * 4)
-static Bit32u registers[NUMREGS];
+// Register numbers of the target description sent to GDB: the general
+// purpose registers, the instruction pointer, eflags, the segment selectors,
+// the x87 data and control registers and for x86-64 the FS and GS base.
+#if BX_SUPPORT_X86_64
+#define GDBSTUB_NUM_GPRS    (16)
+#define GDBSTUB_REG_SIZE    (8)
+static const unsigned gdb_gpr_map[GDBSTUB_NUM_GPRS] = {
+  BX_64BIT_REG_RAX, BX_64BIT_REG_RBX, BX_64BIT_REG_RCX, BX_64BIT_REG_RDX,
+  BX_64BIT_REG_RSI, BX_64BIT_REG_RDI, BX_64BIT_REG_RBP, BX_64BIT_REG_RSP,
+  BX_64BIT_REG_R8,  BX_64BIT_REG_R9,  BX_64BIT_REG_R10, BX_64BIT_REG_R11,
+  BX_64BIT_REG_R12, BX_64BIT_REG_R13, BX_64BIT_REG_R14, BX_64BIT_REG_R15
+};
+static const char *gdb_gpr_names[GDBSTUB_NUM_GPRS] = {
+  "rax", "rbx", "rcx", "rdx", "rsi", "rdi", "rbp", "rsp",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+};
+#else
+#define GDBSTUB_NUM_GPRS    (8)   // same order as in Bochs
+#define GDBSTUB_REG_SIZE    (4)
+static const char *gdb_gpr_names[GDBSTUB_NUM_GPRS] = {
+  "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"
+};
 #endif
+#define GDBSTUB_REG_PC      (GDBSTUB_NUM_GPRS)
+#define GDBSTUB_REG_EFLAGS  (GDBSTUB_REG_PC + 1)
+#define GDBSTUB_REG_CS      (GDBSTUB_REG_PC + 2)
+#define GDBSTUB_REG_ST0     (GDBSTUB_REG_CS + 6)
+#define GDBSTUB_REG_FCTRL   (GDBSTUB_REG_ST0 + 8)
+#if BX_SUPPORT_X86_64
+#define GDBSTUB_REG_FS_BASE (GDBSTUB_REG_FCTRL + 8)
+#define GDBSTUB_NUM_REGS    (GDBSTUB_REG_FS_BASE + 2)
+#else
+#define GDBSTUB_NUM_REGS    (GDBSTUB_REG_FCTRL + 8)
+#endif
+
+static const unsigned gdb_seg_map[6] = {
+  BX_SEG_REG_CS, BX_SEG_REG_SS, BX_SEG_REG_DS,
+  BX_SEG_REG_ES, BX_SEG_REG_FS, BX_SEG_REG_GS
+};
+static const char *gdb_seg_names[6] = { "cs", "ss", "ds", "es", "fs", "gs" };
+static const char *gdb_fpu_ctrl_names[8] = {
+  "fctrl", "fstat", "ftag", "fiseg", "fioff", "foseg", "fooff", "fop"
+};
+
+static char target_xml[4096];
+static unsigned target_xml_len = 0;
 
 #define MAX_BREAKPOINTS (255)
 static Bit64u breakpoints[MAX_BREAKPOINTS] = {0,};
 static unsigned nr_breakpoints = 0;
 
 static int stub_trace_flag = 0;
-static int instr_count = 0;
-static int saved_eip = 0;
+static int poll_countdown = GDBSTUB_POLL_INTERVAL;
+static Bit64u saved_rip = 0;
 static int bx_enter_gdbstub = 0;
 
 void bx_gdbstub_break(void)
@@ -255,17 +365,28 @@ void bx_gdbstub_break(void)
   bx_enter_gdbstub = 1;
 }
 
-int bx_gdbstub_check(unsigned int eip)
+// Check for a break request from GDB while the guest is running. The socket
+// is only polled every GDBSTUB_POLL_INTERVAL calls and never blocks.
+int bx_gdbstub_poll(void)
+{
+  if (--poll_countdown > 0)
+    return 0;
+  poll_countdown = GDBSTUB_POLL_INTERVAL;
+
+  if ((rx_pos == rx_len) && !fill_rx_buffer(0))
+    return 0;
+
+  // GDB sends a single ^C byte, anything else is left for get_command()
+  BX_INFO(("Got byte %x", (unsigned) (Bit8u) rx_buf[rx_pos]));
+  if (rx_buf[rx_pos] == 0x03)
+    rx_pos++;
+  last_stop_reason = GDBSTUB_USER_BREAK;
+  return 1;
+}
+
+int bx_gdbstub_check(bx_address eip)
 {
   unsigned int i;
-  unsigned char ch;
-  int r;
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(_MSC_VER)
-  fd_set fds;
-  struct timeval tv = {0, 0};
-#else
-  long arg;
-#endif
 
   if (bx_enter_gdbstub)
   {
@@ -274,37 +395,16 @@ int bx_gdbstub_check(unsigned int eip)
     return GDBSTUB_EXECUTION_BREAKPOINT;
   }
 
-  instr_count++;
-
-  if ((instr_count % 500) == 0)
+  if (bx_gdbstub_poll())
   {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(_MSC_VER)
-    FD_ZERO(&fds);
-    FD_SET(socket_fd, &fds);
-    r = select(socket_fd + 1, &fds, NULL, NULL, &tv);
-    if (r == 1)
-    {
-      r = recv(socket_fd, (char *)&ch, 1, 0);
-    }
-#else
-    arg = fcntl(socket_fd, F_GETFL);
-    fcntl(socket_fd, F_SETFL, arg | O_NONBLOCK);
-    r = recv(socket_fd, &ch, 1, 0);
-    fcntl(socket_fd, F_SETFL, arg);
-#endif
-    if (r == 1)
-    {
-      BX_INFO(("Got byte %x", (unsigned int)ch));
-      last_stop_reason = GDBSTUB_USER_BREAK;
-      return GDBSTUB_USER_BREAK;
-    }
+    return GDBSTUB_USER_BREAK;
   }
 
   for (i = 0; i < nr_breakpoints; i++)
   {
     if (eip == breakpoints[i])
     {
-      BX_INFO(("found breakpoint at %x", eip));
+      BX_INFO(("found breakpoint at " FMT_ADDRX64, (Bit64u) eip));
       last_stop_reason = GDBSTUB_EXECUTION_BREAKPOINT;
       return GDBSTUB_EXECUTION_BREAKPOINT;
     }
@@ -401,44 +501,197 @@ static int access_linear(Bit64u laddress,
   bx_phy_address phys;
   bx_bool valid;
 
-  if (((laddress & 0xfff) + len) > 4096)
+  while (len > 0)
   {
-    valid = access_linear(laddress,
-                          4096 - (laddress & 0xfff),
-                          rw,
-                          data);
+    unsigned chunk = 4096 - (unsigned)(laddress & 0xfff);
+    if (chunk > len) chunk = len;
+
+    valid = BX_CPU(0)->dbg_xlate_linear2phy(laddress, (bx_phy_address*)&phys);
     if (!valid) return(0);
 
-    valid = access_linear(laddress,
-                          len + (laddress & 0xfff) - 4096,
-                          rw,
-                          (Bit8u *)(data + (4096 - (laddress & 0xfff))));
-    return(valid);
+    if (rw & 1) {
+      valid = BX_MEM(0)->dbg_set_mem(phys, chunk, data);
+    } else {
+      valid = BX_MEM(0)->dbg_fetch_mem(BX_CPU(0), phys, chunk, data);
+    }
+    if (!valid) return(0);
+
+    laddress += chunk;
+    data += chunk;
+    len -= chunk;
+  }
+
+  return(1);
+}
+
+static void write_memory(Bit64u addr, unsigned len, Bit8u* data)
+{
+  if (len == 1 && data[0] == 0xcc)
+  {
+    insert_breakpoint(addr);
+    put_reply("OK");
+  }
+  else if (remove_breakpoint(addr, len))
+  {
+    put_reply("OK");
+  }
+  else
+  {
+    if (access_linear(addr, len, BX_WRITE, data))
+    {
+      put_reply("OK");
+    }
+    else
+    {
+      put_reply("Eff");
+    }
   }
+}
+
+static void put_le(Bit8u *buf, Bit64u val, unsigned size)
+{
+  for (unsigned n = 0; n < size; n++)
+    buf[n] = (Bit8u)(val >> (n*8));
+}
+
+// Store register reg in target byte order, returns its size in bytes or 0
+// if there is no such register.
+static int get_register(unsigned reg, Bit8u *buf)
+{
+  Bit64u val = 0;
+  unsigned size = 4;
+
+  if (reg < GDBSTUB_NUM_GPRS)
+  {
+#if BX_SUPPORT_X86_64
+    val = BX_CPU_THIS_PTR get_reg64(gdb_gpr_map[reg]);
+#else
+    val = BX_CPU_THIS_PTR get_reg32(reg);
+#endif
+    size = GDBSTUB_REG_SIZE;
+  }
+  else if (reg == GDBSTUB_REG_PC)
+  {
+    val = RIP;
+    if (last_stop_reason == GDBSTUB_EXECUTION_BREAKPOINT)
+    {
+      ++val;
+    }
+    size = GDBSTUB_REG_SIZE;
+  }
+  else if (reg == GDBSTUB_REG_EFLAGS)
+  {
+    val = BX_CPU_THIS_PTR read_eflags();
+  }
+  else if (reg < GDBSTUB_REG_ST0)
+  {
+    val = BX_CPU_THIS_PTR sregs[gdb_seg_map[reg - GDBSTUB_REG_CS]].selector.value;
+  }
+  else if (reg < GDBSTUB_REG_FCTRL)
+  {
+#if BX_SUPPORT_FPU
+    floatx80 st = BX_CPU_THIS_PTR the_i387.FPU_read_regi(reg - GDBSTUB_REG_ST0);
+    put_le(buf, st.fraction, 8);
+    put_le(buf + 8, st.exp, 2);
+#else
+    memset(buf, 0, 10);
+#endif
+    return 10;
+  }
+  else if (reg < GDBSTUB_REG_FCTRL + 8)
+  {
+#if BX_SUPPORT_FPU
+    i387_t *fpu = &BX_CPU_THIS_PTR the_i387;
+    switch (reg - GDBSTUB_REG_FCTRL)
+    {
+      case 0: val = fpu->get_control_word(); break;
+      case 1: val = fpu->get_status_word(); break;
+      case 2: val = fpu->get_tag_word(); break;
+      case 3: val = fpu->fcs; break;
+      case 4: val = (Bit32u) fpu->fip; break;
+      case 5: val = fpu->fds; break;
+      case 6: val = (Bit32u) fpu->fdp; break;
+      case 7: val = fpu->foo; break;
+    }
+#endif
+  }
+#if BX_SUPPORT_X86_64
+  else if (reg < GDBSTUB_NUM_REGS)
+  {
+    val = (reg == GDBSTUB_REG_FS_BASE) ? MSR_FSBASE : MSR_GSBASE;
+    size = 8;
+  }
+#endif
+  else
+  {
+    return 0;
+  }
+
+  put_le(buf, val, size);
+  return size;
+}
+
+static void build_target_xml(void)
+{
+  char *p = target_xml;
+  char *end = target_xml + sizeof(target_xml);
+  int i;
 
-  valid = BX_CPU(0)->dbg_xlate_linear2phy(laddress, (bx_phy_address*)&phys);
-  if (!valid) return(0);
+#if BX_SUPPORT_X86_64
+  const char *arch = "i386:x86-64", *pc = "rip", *gpr_type = "int64";
+#else
+  const char *arch = "i386", *pc = "eip", *gpr_type = "int32";
+#endif
 
-  if (rw & 1) {
-    valid = BX_MEM(0)->dbg_set_mem(phys, len, data);
-  } else {
-    valid = BX_MEM(0)->dbg_fetch_mem(BX_CPU(0), phys, len, data);
+  p += snprintf(p, end - p, "<?xml version=\"1.0\"?>"
+                "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+                "<target><architecture>%s</architecture>"
+                "<feature name=\"org.gnu.gdb.i386.core\">", arch);
+  for (i = 0; i < GDBSTUB_NUM_GPRS; i++)
+  {
+    const char *type = gpr_type;
+    if (!strcmp(gdb_gpr_names[i] + 1, "bp") || !strcmp(gdb_gpr_names[i] + 1, "sp"))
+      type = "data_ptr";
+    p += snprintf(p, end - p, "<reg name=\"%s\" bitsize=\"%d\" type=\"%s\"/>",
+                  gdb_gpr_names[i], GDBSTUB_REG_SIZE * 8, type);
   }
+  p += snprintf(p, end - p, "<reg name=\"%s\" bitsize=\"%d\" type=\"code_ptr\"/>"
+                "<reg name=\"eflags\" bitsize=\"32\" type=\"int32\"/>",
+                pc, GDBSTUB_REG_SIZE * 8);
+  for (i = 0; i < 6; i++)
+    p += snprintf(p, end - p, "<reg name=\"%s\" bitsize=\"32\" type=\"int32\"/>", gdb_seg_names[i]);
+  for (i = 0; i < 8; i++)
+    p += snprintf(p, end - p, "<reg name=\"st%d\" bitsize=\"80\" type=\"i387_ext\"/>", i);
+  for (i = 0; i < 8; i++)
+    p += snprintf(p, end - p, "<reg name=\"%s\" bitsize=\"32\" type=\"int\" group=\"float\"/>",
+                  gdb_fpu_ctrl_names[i]);
+  p += snprintf(p, end - p, "</feature>");
+#if BX_SUPPORT_X86_64
+  p += snprintf(p, end - p, "<feature name=\"org.gnu.gdb.i386.segments\">"
+                "<reg name=\"fs_base\" bitsize=\"64\" type=\"int\"/>"
+                "<reg name=\"gs_base\" bitsize=\"64\" type=\"int\"/>"
+                "</feature>");
+#endif
+  p += snprintf(p, end - p, "</target>");
+  target_xml_len = p - target_xml;
+}
 
-  return(valid);
+// called for every stop of the cpu loop while replaying from a checkpoint
+static bx_bool gdbstub_revexec_stop_check(void)
+{
+  return (last_stop_reason == GDBSTUB_EXECUTION_BREAKPOINT);
 }
 
 static void debug_loop(void)
 {
-  char buffer[255];
-  char obuf[1024];
+  char *buffer = in_packet;
+  int count;
   int ne = 0;
-  Bit8u mem[255];
 
   while (ne == 0)
   {
     SIM->get_param_bool(BXPN_MOUSE_ENABLED)->set(0);
-    get_command(buffer);
+    count = get_command(buffer);
     BX_DEBUG(("get_buffer '%s'", buffer));
 
     // At a minimum, a stub is required to support the g and G commands for register access,
@@ -455,20 +708,25 @@ static void debug_loop(void)
       case 'c':
       {
         char buf[255];
-        Bit32u new_eip;
+        Bit64u new_rip;
 
         if (buffer[1] != 0)
         {
-          new_eip = (Bit32u) atoi(buffer + 1);
+          new_rip = strtoull(buffer + 1, NULL, 16);
 
-          BX_INFO(("continuing at %x", new_eip));
+          BX_INFO(("continuing at " FMT_ADDRX64, new_rip));
 
           for (int i=0; i<BX_SMP_PROCESSORS; i++) {
             BX_CPU(i)->invalidate_prefetch_q();
           }
 
-          saved_eip = EIP;
-          BX_CPU_THIS_PTR gen_reg[BX_32BIT_REG_EIP].dword.erx = new_eip;
+#if BX_SUPPORT_X86_64
+          saved_rip = RIP;
+          RIP = new_rip;
+#else
+          saved_rip = EIP;
+          EIP = (Bit32u) new_rip;
+#endif
         }
 
         stub_trace_flag = 0;
@@ -479,7 +737,11 @@ static void debug_loop(void)
         if (buffer[1] != 0)
         {
           bx_cpu.invalidate_prefetch_q();
-          BX_CPU_THIS_PTR gen_reg[BX_32BIT_REG_EIP].dword.erx = saved_eip;
+#if BX_SUPPORT_X86_64
+          RIP = saved_rip;
+#else
+          EIP = (Bit32u) saved_rip;
+#endif
         }
 
         BX_INFO(("stopped with %x", last_stop_reason));
@@ -489,6 +751,10 @@ static void debug_loop(void)
         {
           write_signal(&buf[1], SIGTRAP);
         }
+        else if (last_stop_reason == GDBSTUB_USER_BREAK)
+        {
+          write_signal(&buf[1], SIGINT);
+        }
         else
         {
           write_signal(&buf[1], 0);
@@ -524,38 +790,88 @@ static void debug_loop(void)
         break;
       }
 
+      // bs Backward single step.
+      // bc Backward continue, to the previous breakpoint hit.
+      // Both need the reverse execution checkpoints (gdbstub checkpoint_interval).
+      case 'b':
+      {
+        char buf[255];
+
+        if (!bx_revexec.enabled() || (buffer[1] != 's' && buffer[1] != 'c'))
+        {
+          put_reply("E01");
+          break;
+        }
+
+        stub_trace_flag = 0;
+        if (buffer[1] == 's')
+        {
+          BX_INFO(("stepping backward"));
+          if (bx_revexec.step_back(1, gdbstub_revexec_stop_check))
+            sprintf(buf, "S%02x", SIGTRAP);
+          else
+            sprintf(buf, "T%02xreplaylog:begin;", SIGTRAP);
+          last_stop_reason = GDBSTUB_TRACE;
+        }
+        else
+        {
+          BX_INFO(("continuing backward"));
+          if (bx_revexec.continue_back(gdbstub_revexec_stop_check) > 0)
+          {
+            sprintf(buf, "S%02x", SIGTRAP);
+            last_stop_reason = GDBSTUB_EXECUTION_BREAKPOINT;
+          }
+          else
+          {
+            sprintf(buf, "T%02xreplaylog:begin;", SIGTRAP);
+            last_stop_reason = GDBSTUB_TRACE;
+          }
+        }
+        SIM->refresh_vga();
+        BX_INFO(("stopped at icount " FMT_LL "u", BX_CPU(0)->get_icount()));
+        put_reply(buf);
+        break;
+      }
+
       // M addr,length:XX...
       // Write length bytes of memory starting at address addr. XX... is the data;
       // each byte is transmitted as a two-digit hexadecimal number.
       case 'M':
       {
-        unsigned char mem[255];
         char* ebuf;
 
         Bit64u addr = strtoull(&buffer[1], &ebuf, 16);
-        int len = strtoul(ebuf + 1, &ebuf, 16);
+        unsigned len = strtoul(ebuf + 1, &ebuf, 16);
+        if (len > sizeof(mem))
+        {
+          put_reply("E01");
+          break;
+        }
         hex2mem(ebuf + 1, mem, len);
+        write_memory(addr, len, mem);
+        break;
+      }
+
+      // X addr,length:XX...
+      // Write length bytes of memory starting at address addr. XX... is binary data.
+      case 'X':
+      {
+        char* ebuf;
 
-        if (len == 1 && mem[0] == 0xcc)
+        Bit64u addr = strtoull(&buffer[1], &ebuf, 16);
+        unsigned len = strtoul(ebuf + 1, &ebuf, 16);
+        if (*ebuf != ':' || (ebuf + 1 + len) > (buffer + count))
         {
-          insert_breakpoint(addr);
-          put_reply("OK");
+          put_reply("E01");
+          break;
         }
-        else if (remove_breakpoint(addr, len))
+        if (len == 0)
         {
+          // probe for binary download support
           put_reply("OK");
+          break;
         }
-        else
-        {
-          if (access_linear(addr, len, BX_WRITE, mem))
-          {
-            put_reply("OK");
-          }
-          else
-          {
-            put_reply("Eff");
-          }
-        }
+        write_memory(addr, len, (Bit8u*)(ebuf + 1));
         break;
       }
 
@@ -571,19 +887,71 @@ static void debug_loop(void)
       case 'm':
       {
         Bit64u addr;
-        int len;
+        unsigned len;
         char* ebuf;
 
         addr = strtoull(&buffer[1], &ebuf, 16);
         len = strtoul(ebuf + 1, NULL, 16);
-        BX_INFO(("addr " FMT_ADDRX64 " len %x", addr, len));
+        BX_DEBUG(("addr " FMT_ADDRX64 " len %x", addr, len));
+        if (len > sizeof(mem)) len = sizeof(mem);
 
-        access_linear(addr, len, BX_READ, mem);
-        mem2hex(mem, obuf, len);
-        put_reply(obuf);
+        if (access_linear(addr, len, BX_READ, mem))
+        {
+          mem2hex(mem, obuf, len);
+          put_reply(obuf);
+        }
+        else
+        {
+          put_reply("E01");
+        }
         break;
       }
 
+      // x addr,length
+      // Read length bytes of memory starting at address addr. The reply is 'b'
+      // followed by the binary data.
+      case 'x':
+      {
+        Bit64u addr;
+        unsigned len;
+        char* ebuf;
+
+        addr = strtoull(&buffer[1], &ebuf, 16);
+        len = strtoul(ebuf + 1, NULL, 16);
+        if (len > sizeof(mem)) len = sizeof(mem);
+
+        if (access_linear(addr, len, BX_READ, mem))
+        {
+          obuf[0] = 'b';
+          memcpy(obuf + 1, mem, len);
+          put_packet(obuf, len + 1);
+        }
+        else
+        {
+          put_reply("E01");
+        }
+        break;
+      }
+
+      // p n...
+      // Read the value of register n; n is in hex.
+      case 'p':
+      {
+        Bit8u reg[10];
+        int size = get_register(strtoul(&buffer[1], NULL, 16), reg);
+        if (size > 0)
+        {
+          mem2hex(reg, obuf, size);
+          put_reply(obuf);
+        }
+        else
+        {
+          put_reply("E01");
+        }
+        break;
+      }
+
+
       // P n...=r...
       // Write register n... with value r... The register number n is in hexadecimal,
       // and r... contains two hex digits for each byte in the register (target byte order).
@@ -598,59 +966,24 @@ static void debug_loop(void)
         value = read_little_endian_hex(ebuf);
 
         BX_INFO(("reg %d set to " FMT_ADDRX64, reg, value));
-#if BX_SUPPORT_X86_64 == 0
-        switch (reg)
-        {
-          case 0:
-          case 1:
-          case 2:
-          case 3:
-          case 4:
-          case 5:
-          case 6:
-          case 7:
-            BX_CPU_THIS_PTR set_reg32(reg, value);
-            break;
-
-          case 8:
-            EIP = value;
-            BX_CPU_THIS_PTR invalidate_prefetch_q();
-            break;
-
-          default:
-            break;
-        }
+        if (reg < GDBSTUB_NUM_GPRS)
+        {
+#if BX_SUPPORT_X86_64
+          BX_CPU_THIS_PTR set_reg64(gdb_gpr_map[reg], value);
 #else
-        switch (reg)
-        {
-          case 0:
-          case 1:
-          case 2:
-          case 3:
-          case 4:
-          case 5:
-          case 6:
-          case 7:
-          case 8:
-          case 9:
-          case 10:
-          case 11:
-          case 12:
-          case 13:
-          case 14:
-          case 15:
-            BX_CPU_THIS_PTR set_reg64(reg, value);
-            break;
-
-          case 16:
-            RIP = value;
-            BX_CPU_THIS_PTR invalidate_prefetch_q();
-            break;
-
-          default:
-            break;
+          BX_CPU_THIS_PTR set_reg32(reg, (Bit32u) value);
+#endif
         }
+        else if (reg == GDBSTUB_REG_PC)
+        {
+#if BX_SUPPORT_X86_64
+          RIP = value;
+#else
+          EIP = (Bit32u) value;
 #endif
+          BX_CPU_THIS_PTR invalidate_prefetch_q();
+        }
+
         put_reply("OK");
 
         break;
@@ -659,75 +992,12 @@ static void debug_loop(void)
       // g Read general registers.
       case 'g':
       {
-#if BX_SUPPORT_X86_64 == 0
-        WriteHostDWordToLittleEndian(registers + 0, EAX);
-        WriteHostDWordToLittleEndian(registers + 1, ECX);
-        WriteHostDWordToLittleEndian(registers + 2, EDX);
-        WriteHostDWordToLittleEndian(registers + 3, EBX);
-        WriteHostDWordToLittleEndian(registers + 4, ESP);
-        WriteHostDWordToLittleEndian(registers + 5, EBP);
-        WriteHostDWordToLittleEndian(registers + 6, ESI);
-        WriteHostDWordToLittleEndian(registers + 7, EDI);
-        if (last_stop_reason == GDBSTUB_EXECUTION_BREAKPOINT)
-        {
-          WriteHostDWordToLittleEndian(registers + 8, EIP + 1);
-        }
-        else
-        {
-          WriteHostDWordToLittleEndian(registers + 8, EIP);
-        }
-        WriteHostDWordToLittleEndian(registers + 9,
-                                     BX_CPU_THIS_PTR read_eflags());
-        WriteHostDWordToLittleEndian(registers + 10,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].selector.value);
-        WriteHostDWordToLittleEndian(registers + 11,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_SS].selector.value);
-        WriteHostDWordToLittleEndian(registers + 12,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_DS].selector.value);
-        WriteHostDWordToLittleEndian(registers + 13,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES].selector.value);
-        WriteHostDWordToLittleEndian(registers + 14,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_FS].selector.value);
-        WriteHostDWordToLittleEndian(registers + 15,
-          BX_CPU_THIS_PTR sregs[BX_SEG_REG_GS].selector.value);
-        mem2hex((const Bit8u*) registers, obuf, NUMREGSBYTES);
-#else
-#define PUTREG(buf, val, len) do { \
-         Bit64u u = (val); \
-         (buf) = mem2hex((const Bit8u*)&u, (buf), (len)); \
-      } while (0)
         char* buf = obuf;
-        PUTREG(buf, RAX, 8);
-        PUTREG(buf, RBX, 8);
-        PUTREG(buf, RCX, 8);
-        PUTREG(buf, RDX, 8);
-        PUTREG(buf, RSI, 8);
-        PUTREG(buf, RDI, 8);
-        PUTREG(buf, RBP, 8);
-        PUTREG(buf, RSP, 8);
-        PUTREG(buf, R8,  8);
-        PUTREG(buf, R9,  8);
-        PUTREG(buf, R10, 8);
-        PUTREG(buf, R11, 8);
-        PUTREG(buf, R12, 8);
-        PUTREG(buf, R13, 8);
-        PUTREG(buf, R14, 8);
-        PUTREG(buf, R15, 8);
-        Bit64u rip;
-        rip = RIP;
-        if (last_stop_reason == GDBSTUB_EXECUTION_BREAKPOINT)
-        {
-          ++rip;
-        }
-        PUTREG(buf, rip, 8);
-        PUTREG(buf, BX_CPU_THIS_PTR read_eflags(), 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].selector.value, 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_SS].selector.value, 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_DS].selector.value, 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES].selector.value, 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_FS].selector.value, 4);
-        PUTREG(buf, BX_CPU_THIS_PTR sregs[BX_SEG_REG_GS].selector.value, 4);
-#endif
+        Bit8u reg[10];
+        for (unsigned n = 0; n < GDBSTUB_NUM_REGS; n++)
+        {
+          buf = mem2hex(reg, buf, get_register(n, reg));
+        }
         put_reply(obuf);
         break;
       }
@@ -780,7 +1050,49 @@ static void debug_loop(void)
         }
         else if (strncmp(&buffer[1], "Supported", strlen("Supported")) == 0)
         {
-          put_reply("");
+          sprintf(obuf, "PacketSize=%x;qXfer:features:read+;QStartNoAckMode+%s",
+                  GDBSTUB_PACKET_SIZE,
+                  bx_revexec.enabled() ? ";ReverseStep+;ReverseContinue+" : "");
+          put_reply(obuf);
+        }
+        else if (strncmp(&buffer[1], "Xfer:features:read:target.xml:",
+                         strlen("Xfer:features:read:target.xml:")) == 0)
+        {
+          char* ebuf;
+          unsigned offset = strtoul(&buffer[1 + strlen("Xfer:features:read:target.xml:")], &ebuf, 16);
+          unsigned len = strtoul(ebuf + 1, NULL, 16);
+
+          if (offset >= target_xml_len)
+          {
+            put_reply("l");
+          }
+          else
+          {
+            if (len > GDBSTUB_PACKET_SIZE - 1) len = GDBSTUB_PACKET_SIZE - 1;
+            if (len >= target_xml_len - offset)
+            {
+              len = target_xml_len - offset;
+              obuf[0] = 'l';
+            }
+            else
+            {
+              obuf[0] = 'm';
+            }
+            memcpy(obuf + 1, target_xml + offset, len);
+            put_packet(obuf, len + 1);
+          }
+        }
+        else
+        {
+          put_reply(""); /* not supported */
+        }
+        break;
+
+      case 'Q':
+        if (strcmp(&buffer[1], "StartNoAckMode") == 0)
+        {
+          put_reply("OK");
+          no_ack_mode = 1;
         }
         else
         {
@@ -910,6 +1222,12 @@ void bx_gdbstub_init(void)
   WSAStartup(2, &wsaData);
 #endif
 
+  build_target_xml();
+
+  Bit32u interval = SIM->get_param_num("checkpoint_interval", gdbstub_list)->get();
+  if (interval > 0)
+    bx_revexec.enable(interval);
+
   /* Wait for connect */
   printf("Waiting for gdb connection on port %d\n", portn);
   wait_for_connect(portn);
@@ -222,20 +222,25 @@ static const char *BrkName[5] = {
    "Read Watchpoint",
 };
 
-bx_address BrkLAddr[BX_DBG_MAX_LIN_BPOINTS];
-unsigned BrkIdx[BX_DBG_MAX_LIN_BPOINTS];
+bx_address *BrkLAddr = NULL;
+unsigned *BrkIdx = NULL;
 int BreakCount = 0;
-
-// Breakpoint Dump Window stuff
-unsigned short BrkpIDMap[256];
+static unsigned BrkListSize = 0;
+
+// Breakpoint Dump Window stuff -- the window shows as many breakpoints as
+// fit into BRKP_ROWS rows (leaving room for the headers of the watchpoint
+// lists) and the first WP_SNAPSHOTS watchpoints of each type
+#define BRKP_ROWS       256
+#define WP_SNAPSHOTS    16
+unsigned short BrkpIDMap[BRKP_ROWS];
 unsigned short WWP_BaseEntry;
 unsigned short RWP_BaseEntry;
 unsigned short EndLinEntry;
 unsigned short EndPhyEntry;
 unsigned short WWPSnapCount;
 unsigned short RWPSnapCount;
-bx_phy_address WWP_Snapshot[16];
-bx_phy_address RWP_Snapshot[16];
+bx_phy_address WWP_Snapshot[WP_SNAPSHOTS];
+bx_phy_address RWP_Snapshot[WP_SNAPSHOTS];
 
 char *debug_cmd;
 bx_bool debug_cmd_ready;
@@ -711,6 +716,17 @@ void FillRegs()
     InPaging = NewPg;
 }
 
+// make room for n entries in the local linear breakpoint list
+static void GrowBrkList(unsigned n)
+{
+    if (n <= BrkListSize)
+        return;
+    while (BrkListSize < n)
+        BrkListSize = BrkListSize ? BrkListSize * 2 : 64;
+    BrkLAddr = (bx_address *) realloc(BrkLAddr, BrkListSize * sizeof(bx_address));
+    BrkIdx = (unsigned *) realloc(BrkIdx, BrkListSize * sizeof(unsigned));
+}
+
 // grab linear breakpoints out of internal debugger's bx_guard structures, and sort them
 void ParseBkpt()
 {
@@ -718,6 +734,7 @@ void ParseBkpt()
     int k;
     int j = 0;
     int i = bx_guard.iaddr.num_linear;
+    GrowBrkList(i);
     while (--i >= 0)
     {
         if (bx_guard.iaddr.lin[i].enabled != FALSE)
@@ -1893,10 +1910,10 @@ void FillBrkp()
     cols[15]= brktxt;
     cols[16]= brktxt;
     StartListUpdate(DUMP_WND);
-    i = 256;
+    i = BRKP_ROWS;
     while (--i >= 0)
         BrkpIDMap[i] = 0;
-    i = 16;
+    i = WP_SNAPSHOTS;
     while (--i >= 0)
     {
         WWP_Snapshot[i] = 0;
@@ -1919,9 +1936,8 @@ void FillBrkp()
             cols[1]= brktxt + 48;   // and can be "enabled"
             if (brktype == 0)
             {
-#if (BX_DBG_MAX_LIN_BPOINTS > 0)
                 totqty = bx_guard.iaddr.num_linear;
-                for (i = 0; i < totqty; i++)
+                for (i = 0; i < totqty && LineCount < BRKP_ROWS - 8; i++)
                 {
                     BrkpIDMap[LineCount] = bx_guard.iaddr.lin[i].bpoint_id;
                     prtbrk (0xf0000, (Bit64u) bx_guard.iaddr.lin[i].addr,
@@ -1929,14 +1945,12 @@ void FillBrkp()
                         bx_guard.iaddr.lin[i].enabled, cols);
                     InsertListRow(cols, 18, DUMP_WND, LineCount++, 8);
                 }
-#endif
                 EndLinEntry = LineCount;
             }
             else if (brktype == 1)
             {
-#if (BX_DBG_MAX_PHY_BPOINTS > 0)
                 totqty = bx_guard.iaddr.num_physical;
-                for (i = 0; i < totqty; i++)
+                for (i = 0; i < totqty && LineCount < BRKP_ROWS - 8; i++)
                 {
                     BrkpIDMap[LineCount] = bx_guard.iaddr.phy[i].bpoint_id;
                     prtbrk (0xf0000, (Bit64u) bx_guard.iaddr.phy[i].addr,
@@ -1944,14 +1958,12 @@ void FillBrkp()
                         bx_guard.iaddr.phy[i].enabled, cols);
                     InsertListRow(cols, 18, DUMP_WND, LineCount++, 8);
                 }
-#endif
                 EndPhyEntry = LineCount;
             }
             else
             {
-#if (BX_DBG_MAX_VIR_BPOINTS > 0)
                 totqty = bx_guard.iaddr.num_virtual;
-                for (i = 0; i < totqty; i++)
+                for (i = 0; i < totqty && LineCount < BRKP_ROWS - 8; i++)
                 {
                     BrkpIDMap[LineCount] = bx_guard.iaddr.vir[i].bpoint_id;
                     prtbrk (bx_guard.iaddr.vir[i].cs,
@@ -1960,14 +1972,15 @@ void FillBrkp()
                         bx_guard.iaddr.vir[i].enabled, cols);
                     InsertListRow(cols, 18, DUMP_WND, LineCount++, 8);
                 }
-#endif
             }
         }
         else if (brktype == 3)
         {
             WWP_BaseEntry = LineCount;
             totqty = num_write_watchpoints;
-            WWPSnapCount = num_write_watchpoints;
+            if (totqty > WP_SNAPSHOTS)
+                totqty = WP_SNAPSHOTS;
+            WWPSnapCount = totqty;
             for (i = 0; i < totqty; i++)
             {
                 WWP_Snapshot[i] = write_watchpoint[i].addr;
@@ -1979,7 +1992,9 @@ void FillBrkp()
         {
             RWP_BaseEntry = LineCount;
             totqty = num_read_watchpoints;
-            RWPSnapCount = num_read_watchpoints;
+            if (totqty > WP_SNAPSHOTS)
+                totqty = WP_SNAPSHOTS;
+            RWPSnapCount = totqty;
             for (i = 0; i < totqty; i++)
             {
                 RWP_Snapshot[i] = read_watchpoint[i].addr;
@@ -2636,6 +2651,7 @@ void SetBreak(int OneEntry)
             int BpId = bx_dbg_lbreakpoint_command(bkRegular, nbrk, NULL);
             if (BpId >= 0)
             {
+                GrowBrkList(BreakCount + 1);
                 // insertion sort the new Brkpt into the local list
                 i = BreakCount - 1;
                 while (i >= 0 && BrkLAddr[i] > nbrk)
@@ -2658,17 +2674,17 @@ void SetBreak(int OneEntry)
     Invalidate(ASM_WND);    // redraw the ASM window -- colors may have changed
 }
 
-void DelWatchpoint(bx_watchpoint *wp_array, unsigned *TotEntries, int i)
+void DelWatchpoint(int type, int i)
 {
-    while (++i < (int) *TotEntries)
-        wp_array[i-1] = wp_array[i];
-    -- *TotEntries;
+    bx_dbg_del_watchpoint(type, i);
 }
 
-void SetWatchpoint(unsigned *num_watchpoints, bx_watchpoint *watchpoint)
+// type is BX_READ or BX_WRITE
+void SetWatchpoint(int type)
 {
+    bx_watchpoint *watchpoint = (type == BX_READ) ? read_watchpoint : write_watchpoint;
     int iExist1 = -1;
-    int i = (int) *num_watchpoints;
+    int i = (int) ((type == BX_READ) ? num_read_watchpoints : num_write_watchpoints);
     if (AtBreak == FALSE || SA_valid == FALSE)
         return;
     // the list is unsorted -- test all of them
@@ -2683,19 +2699,12 @@ void SetWatchpoint(unsigned *num_watchpoints, bx_watchpoint *watchpoint)
     if (iExist1 >= 0)
     {
         // existing watchpoint, remove by copying the list down
-        DelWatchpoint(watchpoint, num_watchpoints, iExist1);
+        DelWatchpoint(type, iExist1);
     }
     else
     {
         // Set a watchpoint to last clicked address -- the list is not sorted
-        if (*num_watchpoints >= BX_DBG_MAX_WATCHPONTS) {
-            DispMessage("Too many of that type of watchpoint. Max: 16", "Table Overflow");
-        }
-        else {
-            watchpoint[*num_watchpoints].len  = 1;
-            watchpoint[*num_watchpoints].addr = (bx_phy_address) SelectedDataAddress;
-            ++(*num_watchpoints);
-        }
+        bx_dbg_add_watchpoint(type, (bx_phy_address) SelectedDataAddress, 1);
     }
     Invalidate(DUMP_WND);   // redraw the MemDump window -- colors may have changed
 }
@@ -2830,7 +2839,7 @@ int HotKey (int ww, int Alt, int Shift, int Control)
         else if (ww == VK_F6)       // AltF6 = Read Watchpt
         {
             if (DumpHasFocus != FALSE)
-                SetWatchpoint(&num_read_watchpoints,read_watchpoint);
+                SetWatchpoint(BX_READ);
         }
         else if (ww == VK_F7)           // Alt+F7 memdump hex toggle
         {
@@ -2992,14 +3001,14 @@ int HotKey (int ww, int Alt, int Shift, int Control)
                 if (DumpHasFocus == FALSE)
                     SetBreak(-1); // set or delete breakpoint(s) at the selected address(es)
                 else
-                    SetWatchpoint(&num_write_watchpoints,write_watchpoint);
+                    SetWatchpoint(BX_WRITE);
             }
             else
             {
                 if (DumpHasFocus == FALSE)      // F6 = Brkpt
                     SetBreak(-1); // set or delete breakpoint(s) at the selected address(es)
                 else
-                    SetWatchpoint(&num_write_watchpoints,write_watchpoint);
+                    SetWatchpoint(BX_WRITE);
             }
             break;
 
@@ -3130,11 +3139,11 @@ void ActivateMenuItem (int cmd)
             break;
 
         case CMD_WPTWR: // set or delete a data write watchpoint
-            SetWatchpoint(&num_write_watchpoints,write_watchpoint);
+            SetWatchpoint(BX_WRITE);
             break;
 
         case CMD_WPTRD: // set or delete a data read watchpoint
-            SetWatchpoint(&num_read_watchpoints,read_watchpoint);
+            SetWatchpoint(BX_READ);
             break;
 
         case CMD_FIND: // find -- Control-F
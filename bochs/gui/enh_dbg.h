@@ -51,8 +51,8 @@ void SetOutWinTxt();
 void ShowFW();
 void GetInputEntry(char *buf);
 void SelectHistory(int UpDown);
-void DelWatchpoint(bx_watchpoint *wp_array, unsigned *TotEntries, int i);
-void SetWatchpoint(unsigned *num_watchpoints, bx_watchpoint *watchpoint);
+void DelWatchpoint(int type, int i);
+void SetWatchpoint(int type);
 
 void HideTree();
 void FillPTree();
@@ -394,7 +394,7 @@ extern Bit8u RegColor[TOT_REG_NUM];    // specifies foreground and background co
 extern int RitemToRnum[TOT_REG_NUM];   // mapping from Reg List Item# to register number
 
 // do the linear breakpoint list as 2 arrays, rather than a structure -- much easier to search!
-extern bx_address BrkLAddr[BX_DBG_MAX_LIN_BPOINTS];
+extern bx_address *BrkLAddr;
 extern int BreakCount;
 
 // Breakpoint Dump Window stuff
@@ -1505,10 +1505,10 @@ void Mem_DblClick (GtkTreeView *treeview, GtkTreePath *path, GtkTreeViewColumn *
     if (DViewMode == VIEW_MEMDUMP)
     {
         if (KeyStateShft != 0 && LinearDump == FALSE)
-            SetWatchpoint(&num_write_watchpoints,write_watchpoint);
+            SetWatchpoint(BX_WRITE);
 
         else if (KeyStateAlt != 0 && LinearDump == FALSE)
-            SetWatchpoint(&num_read_watchpoints,read_watchpoint);
+            SetWatchpoint(BX_READ);
 
         else
 //L HIHI Fix how this works in the Windoze version to match GTK?
@@ -1537,13 +1537,13 @@ void Mem_DblClick (GtkTreeView *treeview, GtkTreePath *path, GtkTreeViewColumn *
             // if a watchpoint was clicked, get its index (0 to 15)
             int i = DumpSelRow - WWP_BaseEntry;
             if (WWP_Snapshot[i] == write_watchpoint[i].addr)
-                DelWatchpoint(write_watchpoint, &num_write_watchpoints, i);
+                DelWatchpoint(BX_WRITE, i);
         }
         else if (DumpSelRow >= RWP_BaseEntry && DumpSelRow < RWP_BaseEntry + RWPSnapCount)
         {
             int i = DumpSelRow - RWP_BaseEntry;
             if (RWP_Snapshot[i] == read_watchpoint[i].addr)
-                DelWatchpoint(read_watchpoint, &num_read_watchpoints, i);
+                DelWatchpoint(BX_READ, i);
         }
         RefreshDataWin();       // show the NEW set of break/watchpoints
     }
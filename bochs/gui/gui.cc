@@ -23,6 +23,7 @@
 #include "iodev.h"
 #include "virt_timer.h"
 #include "keymap.h"
+#include "replay.h"
 #include "gui/bitmaps/floppya.h"
 #include "gui/bitmaps/floppyb.h"
 #include "gui/bitmaps/mouse.h"
@@ -642,6 +643,10 @@ void bx_gui_c::paste_handler(void)
     BX_ERROR (("paste not implemented on this platform"));
     return;
   }
+  if (!bx_replay.paste_event(bytes, nbytes)) {
+    delete [] bytes;
+    return;
+  }
   BX_INFO (("pasting %d bytes", nbytes));
   DEV_kbd_paste_bytes (bytes, nbytes);
 }
@@ -0,0 +1,583 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// Display library that publishes the guest display in a shared memory
+// segment (see shmfb.h for the layout). There is no window and no input;
+// external viewers map the segment and sample it whenever they like. The
+// display is rendered into a private 32 bpp framebuffer and flush() only
+// copies the tiles changed since the last flush to the shared segment.
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#include "bochs.h"
+#include "plugin.h"
+#include "param_names.h"
+
+#if BX_WITH_SHMFB
+#include "icon_bochs.h"
+#include "font/vga.bitmap.h"
+#include "shmfb.h"
+
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
+class bx_shmfb_gui_c : public bx_gui_c {
+public:
+  bx_shmfb_gui_c (void) {}
+  DECLARE_GUI_VIRTUAL_METHODS()
+  DECLARE_GUI_NEW_VIRTUAL_METHODS()
+private:
+  bx_bool open_shm(const char *name);
+  void close_shm(void);
+  void mark_dirty(unsigned x0, unsigned y0, unsigned w, unsigned h);
+  void draw_char(unsigned x0, unsigned y0, unsigned w, unsigned h,
+                 unsigned fonty, const Bit8u *bmap, Bit32u fg, Bit32u bg,
+                 bx_bool gfxchar);
+};
+
+// declare one instance of the gui object and call macro to insert the
+// plugin code
+static bx_shmfb_gui_c *theGui = NULL;
+IMPLEMENT_GUI_PLUGIN_CODE(shmfb)
+
+#define LOG_THIS theGui->
+
+#if defined(__GNUC__)
+#define SHMFB_BARRIER() __sync_synchronize()
+#elif defined(_MSC_VER)
+#define SHMFB_BARRIER() MemoryBarrier()
+#else
+#define SHMFB_BARRIER()
+#endif
+
+static char shm_name[BX_PATHNAME_LEN];
+static Bit32u shm_size = 0;
+static Bit8u *shm = NULL;
+static volatile shmfb_header_t *header = NULL;
+static volatile Bit32u *shm_tilemap = NULL;
+static Bit8u *shm_fb = NULL;
+#ifdef WIN32
+static HANDLE shm_handle = NULL;
+#else
+static int shm_fd = -1;
+#endif
+
+static Bit8u *screen = NULL;
+static unsigned screen_pitch;
+static Bit32u shmfb_palette[256];
+static Bit8u *tile_dirty = NULL;
+static unsigned tiles_x, tiles_y;
+static bx_bool screen_dirty = 0;
+static bx_bool mode_changed = 0;
+
+static unsigned long cursor_x_old = 0xffff;
+static unsigned long cursor_y_old = 0xffff;
+static unsigned text_rows = 25, text_cols = 80;
+static unsigned font_height = 16, font_width = 8;
+
+
+// SHMFB implementation of the bx_gui_c methods (see nogui.cc for details)
+
+void bx_shmfb_gui_c::specific_init(int argc, char **argv, unsigned headerbar_y)
+{
+  int i;
+
+  put("SHMFB");
+  UNUSED(headerbar_y);
+  UNUSED(bochs_icon_bits);
+
+  sprintf(shm_name, "/bochs-fb-%d", (int)getpid());
+
+  // parse shmfb specific options
+  if (argc > 1) {
+    for (i = 1; i < argc; i++) {
+      if (!strncmp(argv[i], "name=", 5)) {
+        if ((argv[i][5] == 0) || (strlen(&argv[i][5]) >= sizeof(shm_name))) {
+          BX_PANIC(("invalid shared memory name '%s'", &argv[i][5]));
+        } else {
+          strcpy(shm_name, &argv[i][5]);
+        }
+      } else {
+        BX_PANIC(("Unknown shmfb option '%s'", argv[i]));
+      }
+    }
+  }
+
+  if (SIM->get_param_bool(BXPN_PRIVATE_COLORMAP)->get()) {
+    BX_ERROR(("private_colormap option ignored."));
+  }
+
+  for (i = 0; i < 256; i++) {
+    for (int j = 0; j < 16; j++) {
+      vga_charmap[i * 32 + j] = reverse_bitorder(bx_vgafont[i].data[j]);
+    }
+  }
+  memset(shmfb_palette, 0, sizeof(shmfb_palette));
+
+  screen_pitch = max_xres * 4;
+  screen = new Bit8u[screen_pitch * max_yres];
+  memset(screen, 0, screen_pitch * max_yres);
+  tiles_x = (max_xres + x_tilesize - 1) / x_tilesize;
+  tiles_y = (max_yres + y_tilesize - 1) / y_tilesize;
+  tile_dirty = new Bit8u[tiles_x * tiles_y];
+  memset(tile_dirty, 0, tiles_x * tiles_y);
+
+  if (!open_shm(shm_name)) {
+    BX_PANIC(("could not create shared framebuffer '%s'", shm_name));
+    return;
+  }
+  BX_INFO(("framebuffer exported to shared memory '%s' (%u bytes)", shm_name, shm_size));
+
+  new_gfx_api = 1;
+}
+
+void bx_shmfb_gui_c::handle_events(void)
+{
+}
+
+// Publish the tiles changed since the last call. The update is framed by
+// two increments of the sequence counter, so viewers can detect a sample
+// that overlapped it.
+void bx_shmfb_gui_c::flush(void)
+{
+  unsigned tx, ty, x0, y0, w, h, r;
+  Bit32u seq;
+  Bit8u *src, *dst;
+
+  if ((shm == NULL) || !screen_dirty) return;
+
+  seq = header->seq;
+  header->seq = seq + 1;
+  SHMFB_BARRIER();
+  if (mode_changed) {
+    header->xres = guest_xres;
+    header->yres = guest_yres;
+    header->textmode = guest_textmode;
+    mode_changed = 0;
+  }
+  seq += 2;
+  for (ty = 0; ty < tiles_y; ty++) {
+    for (tx = 0; tx < tiles_x; tx++) {
+      if (!tile_dirty[ty * tiles_x + tx]) continue;
+      tile_dirty[ty * tiles_x + tx] = 0;
+      x0 = tx * x_tilesize;
+      y0 = ty * y_tilesize;
+      w = ((x0 + x_tilesize) > max_xres) ? (max_xres - x0) : x_tilesize;
+      h = ((y0 + y_tilesize) > max_yres) ? (max_yres - y0) : y_tilesize;
+      src = screen + y0 * screen_pitch + x0 * 4;
+      dst = shm_fb + y0 * screen_pitch + x0 * 4;
+      for (r = 0; r < h; r++) {
+        memcpy(dst, src, w * 4);
+        src += screen_pitch;
+        dst += screen_pitch;
+      }
+      shm_tilemap[ty * tiles_x + tx] = seq;
+    }
+  }
+  SHMFB_BARRIER();
+  header->seq = seq;
+  screen_dirty = 0;
+}
+
+void bx_shmfb_gui_c::clear_screen(void)
+{
+  for (unsigned y = 0; y < guest_yres; y++) {
+    memset(screen + y * screen_pitch, 0, guest_xres * 4);
+  }
+  mark_dirty(0, 0, guest_xres, guest_yres);
+}
+
+void bx_shmfb_gui_c::text_update(Bit8u *old_text, Bit8u *new_text,
+                                 unsigned long cursor_x, unsigned long cursor_y,
+                                 bx_vga_tminfo_t *tm_info)
+{
+  Bit8u *old_line, *new_line;
+  Bit8u cAttr, cChar;
+  unsigned int curs, hchars, offset, rows, x, y, xc, yc, i;
+  bx_bool force_update = 0, gfxchar, blink_state, blink_mode;
+  Bit32u text_palette[16];
+  Bit32u fgcolor, bgcolor;
+
+  for (i = 0; i < 16; i++) {
+    text_palette[i] = shmfb_palette[tm_info->actl_palette[i]];
+  }
+
+  blink_mode = (tm_info->blink_flags & BX_TEXT_BLINK_MODE) > 0;
+  blink_state = (tm_info->blink_flags & BX_TEXT_BLINK_STATE) > 0;
+  if (blink_mode) {
+    if (tm_info->blink_flags & BX_TEXT_BLINK_TOGGLE)
+      force_update = 1;
+  }
+  if (charmap_updated) {
+    force_update = 1;
+    charmap_updated = 0;
+  }
+
+  // first invalidate character at previous and new cursor location
+  if ((cursor_y_old < text_rows) && (cursor_x_old < text_cols)) {
+    curs = cursor_y_old * tm_info->line_offset + cursor_x_old * 2;
+    old_text[curs] = ~new_text[curs];
+  }
+  if ((tm_info->cs_start <= tm_info->cs_end) && (tm_info->cs_start < font_height)
+      && (cursor_y < text_rows) && (cursor_x < text_cols)) {
+    curs = cursor_y * tm_info->line_offset + cursor_x * 2;
+    old_text[curs] = ~new_text[curs];
+  } else {
+    curs = 0xffff;
+  }
+
+  rows = text_rows;
+  y = 0;
+  do {
+    hchars = text_cols;
+    new_line = new_text;
+    old_line = old_text;
+    offset = y * tm_info->line_offset;
+    yc = y * font_height;
+    x = 0;
+    do {
+      if (force_update || (old_text[0] != new_text[0])
+          || (old_text[1] != new_text[1])) {
+        cChar = new_text[0];
+        if (blink_mode) {
+          cAttr = new_text[1] & 0x7F;
+          if (!blink_state && (new_text[1] & 0x80))
+            cAttr = (cAttr & 0x70) | (cAttr >> 4);
+        } else {
+          cAttr = new_text[1];
+        }
+        fgcolor = text_palette[cAttr & 0x0F];
+        bgcolor = text_palette[cAttr >> 4];
+        gfxchar = tm_info->line_graphics && ((cChar & 0xE0) == 0xC0);
+        xc = x * font_width;
+        draw_char(xc, yc, font_width, font_height, 0, &vga_charmap[cChar<<5],
+                  fgcolor, bgcolor, gfxchar);
+        if (offset == curs) {
+          draw_char(xc, yc + tm_info->cs_start, font_width,
+                    tm_info->cs_end - tm_info->cs_start + 1, tm_info->cs_start,
+                    &vga_charmap[cChar<<5], bgcolor, fgcolor, gfxchar);
+        }
+        mark_dirty(xc, yc, font_width, font_height);
+      }
+      x++;
+      new_text += 2;
+      old_text += 2;
+      offset += 2;
+    } while (--hchars);
+    y++;
+    new_text = new_line + tm_info->line_offset;
+    old_text = old_line + tm_info->line_offset;
+  } while (--rows);
+
+  cursor_x_old = cursor_x;
+  cursor_y_old = cursor_y;
+}
+
+int bx_shmfb_gui_c::get_clipboard_text(Bit8u **bytes, Bit32s *nbytes)
+{
+  UNUSED(bytes);
+  UNUSED(nbytes);
+  return 0;
+}
+
+int bx_shmfb_gui_c::set_clipboard_text(char *text_snapshot, Bit32u len)
+{
+  UNUSED(text_snapshot);
+  UNUSED(len);
+  return 0;
+}
+
+bx_bool bx_shmfb_gui_c::palette_change(Bit8u index, Bit8u red, Bit8u green, Bit8u blue)
+{
+  shmfb_palette[index] = ((Bit32u)red << 16) | ((Bit32u)green << 8) | blue;
+  return 1;
+}
+
+// standard VGA modes still deliver 8 bpp indexed tiles
+void bx_shmfb_gui_c::graphics_tile_update(Bit8u *tile, unsigned x0, unsigned y0)
+{
+  unsigned x, y, w, h;
+  Bit32u *dst;
+
+  w = ((x0 + x_tilesize) > guest_xres) ? (guest_xres - x0) : x_tilesize;
+  h = ((y0 + y_tilesize) > guest_yres) ? (guest_yres - y0) : y_tilesize;
+  for (y = 0; y < h; y++) {
+    dst = (Bit32u*)(screen + (y0 + y) * screen_pitch + x0 * 4);
+    for (x = 0; x < w; x++) {
+      dst[x] = shmfb_palette[tile[y * x_tilesize + x]];
+    }
+  }
+  mark_dirty(x0, y0, w, h);
+}
+
+void bx_shmfb_gui_c::dimension_update(unsigned x, unsigned y, unsigned fheight,
+                                      unsigned fwidth, unsigned bpp)
+{
+  if ((x > max_xres) || (y > max_yres)) {
+    BX_PANIC(("dimension_update(): shmfb doesn't support graphics mode %dx%d", x, y));
+    return;
+  }
+  guest_textmode = (fheight > 0);
+  guest_fsize = (fheight << 4) | fwidth;
+  guest_xres = x;
+  guest_yres = y;
+  guest_bpp = bpp;
+  if (guest_textmode) {
+    font_height = fheight;
+    font_width = fwidth;
+    text_cols = x / fwidth;
+    text_rows = y / fheight;
+  }
+  // the whole framebuffer is republished, including the area outside
+  // the new display size
+  memset(screen, 0, screen_pitch * max_yres);
+  mark_dirty(0, 0, max_xres, max_yres);
+  mode_changed = 1;
+}
+
+unsigned bx_shmfb_gui_c::create_bitmap(const unsigned char *bmap, unsigned xdim, unsigned ydim)
+{
+  UNUSED(bmap);
+  UNUSED(xdim);
+  UNUSED(ydim);
+  return 0;
+}
+
+unsigned bx_shmfb_gui_c::headerbar_bitmap(unsigned bmap_id, unsigned alignment, void (*f)(void))
+{
+  UNUSED(bmap_id);
+  UNUSED(alignment);
+  UNUSED(f);
+  return 0;
+}
+
+void bx_shmfb_gui_c::show_headerbar(void)
+{
+}
+
+void bx_shmfb_gui_c::replace_bitmap(unsigned hbar_id, unsigned bmap_id)
+{
+  UNUSED(hbar_id);
+  UNUSED(bmap_id);
+}
+
+void bx_shmfb_gui_c::exit(void)
+{
+  close_shm();
+#ifndef WIN32
+  shm_unlink(shm_name);
+#endif
+  if (screen != NULL) {
+    delete [] screen;
+    screen = NULL;
+  }
+  if (tile_dirty != NULL) {
+    delete [] tile_dirty;
+    tile_dirty = NULL;
+  }
+}
+
+void bx_shmfb_gui_c::mouse_enabled_changed_specific(bx_bool val)
+{
+}
+
+bx_svga_tileinfo_t *bx_shmfb_gui_c::graphics_tile_info(bx_svga_tileinfo_t *info)
+{
+  info->bpp = 32;
+  info->pitch = screen_pitch;
+  info->red_shift = 24;
+  info->green_shift = 16;
+  info->blue_shift = 8;
+  info->red_mask = 0xff0000;
+  info->green_mask = 0x00ff00;
+  info->blue_mask = 0x0000ff;
+  info->is_indexed = 0;
+#ifdef BX_LITTLE_ENDIAN
+  info->is_little_endian = 1;
+#else
+  info->is_little_endian = 0;
+#endif
+
+  return info;
+}
+
+Bit8u *bx_shmfb_gui_c::graphics_tile_get(unsigned x0, unsigned y0,
+                                         unsigned *w, unsigned *h)
+{
+  if (x0 + x_tilesize > guest_xres) {
+    *w = guest_xres - x0;
+  } else {
+    *w = x_tilesize;
+  }
+
+  if (y0 + y_tilesize > guest_yres) {
+    *h = guest_yres - y0;
+  } else {
+    *h = y_tilesize;
+  }
+
+  return screen + y0 * screen_pitch + x0 * 4;
+}
+
+void bx_shmfb_gui_c::graphics_tile_update_in_place(unsigned x0, unsigned y0,
+                                                   unsigned w, unsigned h)
+{
+  mark_dirty(x0, y0, w, h);
+}
+
+// shmfb private methods
+
+void bx_shmfb_gui_c::mark_dirty(unsigned x0, unsigned y0, unsigned w, unsigned h)
+{
+  unsigned tx, ty, tx1, ty1;
+
+  if ((w == 0) || (h == 0)) return;
+  if ((x0 + w) > max_xres) w = max_xres - x0;
+  if ((y0 + h) > max_yres) h = max_yres - y0;
+  tx1 = (x0 + w - 1) / x_tilesize;
+  ty1 = (y0 + h - 1) / y_tilesize;
+  for (ty = y0 / y_tilesize; ty <= ty1; ty++) {
+    for (tx = x0 / x_tilesize; tx <= tx1; tx++) {
+      tile_dirty[ty * tiles_x + tx] = 1;
+    }
+  }
+  screen_dirty = 1;
+}
+
+void bx_shmfb_gui_c::draw_char(unsigned x0, unsigned y0, unsigned w, unsigned h,
+                               unsigned fonty, const Bit8u *bmap, Bit32u fg,
+                               Bit32u bg, bx_bool gfxchar)
+{
+  Bit32u *dst;
+  Bit8u mask;
+  bx_bool dwidth = (w > 9);
+
+  if ((x0 + w) > max_xres) w = max_xres - x0;
+  if ((y0 + h) > max_yres) h = max_yres - y0;
+  for (unsigned y = 0; y < h; y++) {
+    dst = (Bit32u*)(screen + (y0 + y) * screen_pitch + x0 * 4);
+    mask = 0x80;
+    for (unsigned x = 0; x < w; x++) {
+      if (mask > 0) {
+        dst[x] = (bmap[fonty] & mask) ? fg : bg;
+      } else if (gfxchar) {
+        dst[x] = (bmap[fonty] & 0x01) ? fg : bg;
+      } else {
+        dst[x] = bg;
+      }
+      if (!dwidth || (x & 1)) mask >>= 1;
+    }
+    fonty++;
+  }
+}
+
+bx_bool bx_shmfb_gui_c::open_shm(const char *name)
+{
+  Bit32u tilemap_size = (tiles_x * tiles_y * 4 + 0xfff) & ~0xfff;
+  Bit32u fb_offset = SHMFB_HEADER_SIZE + tilemap_size;
+
+  shm_size = fb_offset + screen_pitch * max_yres;
+#ifdef WIN32
+  shm_handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                 0, shm_size, name);
+  if (shm_handle == NULL) {
+    BX_ERROR(("CreateFileMapping() failed: error %u", (unsigned)GetLastError()));
+    return 0;
+  }
+  shm = (Bit8u*)MapViewOfFile(shm_handle, FILE_MAP_ALL_ACCESS, 0, 0, shm_size);
+  if (shm == NULL) {
+    BX_ERROR(("MapViewOfFile() failed: error %u", (unsigned)GetLastError()));
+    close_shm();
+    return 0;
+  }
+#else
+  shm_fd = shm_open(name, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  if (shm_fd < 0) {
+    BX_ERROR(("shm_open('%s') failed: %s", name, strerror(errno)));
+    return 0;
+  }
+  // a segment left behind by an earlier run may have a different size
+  if (ftruncate(shm_fd, 0) < 0 || ftruncate(shm_fd, shm_size) < 0) {
+    BX_ERROR(("cannot resize '%s' to %u bytes", name, shm_size));
+    close_shm();
+    return 0;
+  }
+  void *ptr = mmap(NULL, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+  if (ptr == MAP_FAILED) {
+    BX_ERROR(("mmap('%s') failed: %s", name, strerror(errno)));
+    close_shm();
+    return 0;
+  }
+  shm = (Bit8u*)ptr;
+#endif
+
+  memset(shm, 0, fb_offset);
+  header = (volatile shmfb_header_t*)shm;
+  shm_tilemap = (volatile Bit32u*)(shm + SHMFB_HEADER_SIZE);
+  shm_fb = shm + fb_offset;
+  header->version = SHMFB_VERSION;
+  header->max_xres = max_xres;
+  header->max_yres = max_yres;
+  header->pitch = screen_pitch;
+  header->bpp = 32;
+  header->tile_w = x_tilesize;
+  header->tile_h = y_tilesize;
+  header->tiles_x = tiles_x;
+  header->tiles_y = tiles_y;
+  header->tilemap_offset = SHMFB_HEADER_SIZE;
+  header->fb_offset = fb_offset;
+  header->size = shm_size;
+  SHMFB_BARRIER();
+  header->magic = SHMFB_MAGIC;
+  return 1;
+}
+
+void bx_shmfb_gui_c::close_shm(void)
+{
+#ifdef WIN32
+  if (shm != NULL) {
+    UnmapViewOfFile(shm);
+  }
+  if (shm_handle != NULL) {
+    CloseHandle(shm_handle);
+    shm_handle = NULL;
+  }
+#else
+  if (shm != NULL) {
+    munmap(shm, shm_size);
+  }
+  if (shm_fd >= 0) {
+    ::close(shm_fd);
+    shm_fd = -1;
+  }
+#endif
+  shm = NULL;
+  header = NULL;
+  shm_tilemap = NULL;
+  shm_fb = NULL;
+}
+
+#endif /* if BX_WITH_SHMFB */
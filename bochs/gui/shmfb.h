@@ -0,0 +1,66 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_GUI_SHMFB_H
+#define BX_GUI_SHMFB_H
+
+// Shared memory layout of the "shmfb" display library: a header page,
+// followed by the tile stamp map and the framebuffer. All offsets are
+// relative to the start of the segment.
+//
+// The header field 'seq' is odd while Bochs updates the segment and even
+// when it is consistent. Each entry of the tile map holds the 'seq' value
+// that was published together with the last change of that tile, so any
+// number of viewers can find the tiles changed since their last sample
+// without modifying the segment. A viewer samples like this:
+//
+//   do {
+//     s1 = header->seq;                 // retry while odd
+//     copy tiles with stamp != own copy of the stamp, and the stamps
+//     s2 = header->seq;
+//   } while ((s1 & 1) || (s1 != s2));
+
+#define SHMFB_MAGIC       0x42464d53  // "SMFB"
+#define SHMFB_VERSION     1
+#define SHMFB_HEADER_SIZE 0x1000
+
+typedef struct {
+  Bit32u magic;
+  Bit32u version;
+  Bit32u seq;          // odd while an update is in progress
+  Bit32u max_xres;     // framebuffer dimensions (fixed)
+  Bit32u max_yres;
+  Bit32u pitch;        // bytes per framebuffer line
+  Bit32u bpp;          // always 32 (0x00RRGGBB in host byte order)
+  Bit32u xres;         // current guest display size
+  Bit32u yres;
+  Bit32u textmode;     // guest display is in text mode
+  Bit32u tile_w;       // tile dimensions in pixels
+  Bit32u tile_h;
+  Bit32u tiles_x;      // size of the tile map
+  Bit32u tiles_y;
+  Bit32u tilemap_offset;
+  Bit32u fb_offset;
+  Bit32u size;         // total size of the segment
+} shmfb_header_t;
+
+#endif
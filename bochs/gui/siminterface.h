@@ -562,9 +562,11 @@ enum {
   BX_HDIMAGE_MODE_VOLATILE,
   BX_HDIMAGE_MODE_VVFAT,
   BX_HDIMAGE_MODE_VPC,
-  BX_HDIMAGE_MODE_VBOX
+  BX_HDIMAGE_MODE_VBOX,
+  BX_HDIMAGE_MODE_QCOW2,
+  BX_HDIMAGE_MODE_DEDUP
 };
-#define BX_HDIMAGE_MODE_LAST     BX_HDIMAGE_MODE_VBOX
+#define BX_HDIMAGE_MODE_LAST     BX_HDIMAGE_MODE_DEDUP
 #define BX_HDIMAGE_MODE_UNKNOWN  -1
 
 enum {
@@ -1679,10 +1679,10 @@ LRESULT CALLBACK B_WP(HWND hh,UINT mm,WPARAM ww,LPARAM ll)
                     if (DViewMode == VIEW_MEMDUMP)  // Change values in memory locations
                     {
                         if (GetKeyState(VK_SHIFT) < 0)
-                            SetWatchpoint(&num_write_watchpoints,write_watchpoint);
+                            SetWatchpoint(BX_WRITE);
 
                         else if (GetKeyState(VK_MENU) < 0)  // ALT keys
-                            SetWatchpoint(&num_read_watchpoints,read_watchpoint);
+                            SetWatchpoint(BX_READ);
 
                         else
                         {
@@ -1699,12 +1699,12 @@ LRESULT CALLBACK B_WP(HWND hh,UINT mm,WPARAM ww,LPARAM ll)
                         if (SelectedBID >= 0x80000)         // read watchpoint
                         {
                             if (RWP_Snapshot[i] == read_watchpoint[i].addr)
-                                DelWatchpoint(read_watchpoint, &num_read_watchpoints, i);
+                                DelWatchpoint(BX_READ, i);
                         }
                         else if (SelectedBID >= 0x40000)    // write watchpoint
                         {
                             if (WWP_Snapshot[i] == write_watchpoint[i].addr)
-                                DelWatchpoint(write_watchpoint, &num_write_watchpoints, i);
+                                DelWatchpoint(BX_WRITE, i);
                         }
                         else
                         {
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// Binary trace format written by the "bintrace" instrumentation module and
+// read by the bxtrace decoder.
+//
+// The file starts with a bxtrace_header_t followed by a stream of records.
+// Each record starts with a tag byte, the record type is stored in the low
+// 3 bits, the other bits are type specific flags. Numbers are stored as
+// unsigned LEB128 varints, signed deltas are zigzag encoded first.
+//
+// INSN    zigzag(laddr - expected laddr), where the expected address is the
+//         one following the previous instruction of the same CPU.
+//         With BXTRACE_INSN_BYTES: length byte and the opcode bytes.
+// MEM     size, zigzag(laddr - previous access laddr), memtype byte if
+//         BXTRACE_MEM_MEMTYPE and zigzag(paddr - previous access paddr)
+//         unless BXTRACE_MEM_IDENTITY (paddr == laddr).
+// CPU     cpu number; all following records belong to this CPU.
+// EVENT   vector, the error code for exceptions.
+// RESET   reset type; the address deltas of the CPU start from 0 again.
+//
+// Opcode bytes are only written if the instruction at that address is not
+// found in the opcode cache of the CPU. Both the writer and the decoder
+// maintain the cache in the same way: a direct mapped table of
+// BXTRACE_OPCACHE_SIZE entries indexed with BXTRACE_OPCACHE_INDEX(laddr),
+// updated with every instruction that carries its opcode bytes.
+
+#ifndef BX_INSTR_BXTRACE_H
+#define BX_INSTR_BXTRACE_H
+
+#define BXTRACE_MAGIC        0x52545842  // "BXTR"
+#define BXTRACE_VERSION      1
+
+typedef struct {
+  Bit32u magic;
+  Bit32u version;
+  Bit32u header_size;
+  Bit32u ncpus;
+} bxtrace_header_t;
+
+enum {
+  BXTRACE_REC_INSN = 0,
+  BXTRACE_REC_MEM,
+  BXTRACE_REC_CPU,
+  BXTRACE_REC_EVENT,
+  BXTRACE_REC_RESET
+};
+
+#define BXTRACE_REC_TYPE(tag)    ((tag) & 0x07)
+
+// INSN flags
+#define BXTRACE_INSN_BYTES       0x08
+#define BXTRACE_INSN_IS32        0x10
+#define BXTRACE_INSN_IS64        0x20
+
+// MEM flags, the access type (BX_READ, BX_WRITE, BX_EXECUTE, BX_RW) is
+// stored in bits 3-4
+#define BXTRACE_MEM_RW(tag)      (((tag) >> 3) & 0x03)
+#define BXTRACE_MEM_IDENTITY     0x20
+#define BXTRACE_MEM_MEMTYPE      0x40
+
+// EVENT types in bits 3-4
+enum {
+  BXTRACE_EVENT_EXCEPTION = 0,
+  BXTRACE_EVENT_INTERRUPT,
+  BXTRACE_EVENT_HWINTERRUPT
+};
+#define BXTRACE_EVENT_TYPE(tag)  (((tag) >> 3) & 0x03)
+
+#define BXTRACE_MAX_OPCODE_LENGTH 16
+
+#define BXTRACE_OPCACHE_SIZE     32768  // must be a power of 2
+#define BXTRACE_OPCACHE_INDEX(laddr) \
+  ((unsigned)((laddr) ^ ((laddr) >> 15)) & (BXTRACE_OPCACHE_SIZE - 1))
+
+typedef struct bxtrace_opcache_entry_t {
+  Bit64u laddr;
+  Bit8u  len;      // 0 = empty entry
+  Bit8u  mode;     // BXTRACE_INSN_IS32 | BXTRACE_INSN_IS64
+  Bit8u  opcode[BXTRACE_MAX_OPCODE_LENGTH];
+} bxtrace_opcache_entry_t;
+
+#define BXTRACE_ZIGZAG(x)   (((Bit64u)(x) << 1) ^ (Bit64u)((Bit64s)(x) >> 63))
+#define BXTRACE_UNZIGZAG(x) ((Bit64s)((x) >> 1) ^ -(Bit64s)((x) & 1))
+
+#endif
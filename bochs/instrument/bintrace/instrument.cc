@@ -0,0 +1,351 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+#include <assert.h>
+
+#include "bochs.h"
+#include "bxthread.h"
+#include "cpu/cpu.h"
+#include "bxtrace.h"
+
+bxTraceCpu *icpu = NULL;
+
+static logfunctions *instrument_log = new logfunctions();
+#define LOG_THIS instrument_log->
+
+// bochsrc options: "bintrace: file=bochstrace.bin, active=1, mem=1"
+static char trace_filename[BX_PATHNAME_LEN] = "bochstrace.bin";
+static bx_bool trace_start_active = 1;
+static bx_bool trace_mem = 1;
+
+// The records are collected in one of two buffers. When it is full, it is
+// handed over to the writer thread and the other one is used. The CPUs are
+// simulated by a single thread, so only the hand-over needs the lock.
+
+#define BXTRACE_BUFFER_SIZE (1 << 20)
+#define BXTRACE_MAX_RECORD  64        // larger than any record
+
+static struct {
+  FILE *fp;
+  Bit8u *buffer[2];
+  unsigned cur;                 // buffer filled by the simulation
+  unsigned pos;
+  unsigned pending[2];          // bytes to be written by the writer thread
+  bx_bool stop;
+  bx_bool stopped;
+  unsigned last_cpu;
+} trace;
+
+BX_MUTEX(trace_mutex);
+static BX_THREAD_VAR(trace_thread);
+
+BX_THREAD_FUNC(bintrace_writer_thread, indata)
+{
+  unsigned idx = 0, len;
+  bx_bool stop;
+
+  UNUSED(indata);
+  for (;;) {
+    BX_LOCK(trace_mutex);
+    len = trace.pending[idx];
+    stop = trace.stop;
+    BX_UNLOCK(trace_mutex);
+    if (len > 0) {
+      if (fwrite(trace.buffer[idx], 1, len, trace.fp) != len) {
+        BX_ERROR(("error writing trace file '%s'", trace_filename));
+      }
+      BX_LOCK(trace_mutex);
+      trace.pending[idx] = 0;
+      BX_UNLOCK(trace_mutex);
+      idx ^= 1;
+    } else if (stop) {
+      break;
+    } else {
+      BX_MSLEEP(1);
+    }
+  }
+  BX_LOCK(trace_mutex);
+  trace.stopped = 1;
+  BX_UNLOCK(trace_mutex);
+  BX_THREAD_EXIT;
+}
+
+// Hands the current buffer over to the writer thread and waits until the
+// other one is free.
+static void bintrace_submit(void)
+{
+  bx_bool busy;
+
+  if (trace.pos == 0) return;
+
+  BX_LOCK(trace_mutex);
+  trace.pending[trace.cur] = trace.pos;
+  BX_UNLOCK(trace_mutex);
+  trace.cur ^= 1;
+  trace.pos = 0;
+  for (;;) {
+    BX_LOCK(trace_mutex);
+    busy = (trace.pending[trace.cur] != 0);
+    BX_UNLOCK(trace_mutex);
+    if (!busy) break;
+    BX_MSLEEP(1);
+  }
+}
+
+static bx_bool bintrace_open(void)
+{
+  bxtrace_header_t header;
+
+  trace.fp = fopen(trace_filename, "wb");
+  if (trace.fp == NULL) {
+    BX_ERROR(("could not open trace file '%s', tracing disabled", trace_filename));
+    return 0;
+  }
+  header.magic = BXTRACE_MAGIC;
+  header.version = BXTRACE_VERSION;
+  header.header_size = sizeof(header);
+  header.ncpus = BX_SMP_PROCESSORS;
+  fwrite(&header, sizeof(header), 1, trace.fp);
+
+  trace.buffer[0] = new Bit8u[BXTRACE_BUFFER_SIZE];
+  trace.buffer[1] = new Bit8u[BXTRACE_BUFFER_SIZE];
+  trace.cur = trace.pos = 0;
+  trace.pending[0] = trace.pending[1] = 0;
+  trace.stop = trace.stopped = 0;
+  trace.last_cpu = 0;
+  BX_INIT_MUTEX(trace_mutex);
+  BX_THREAD_CREATE(bintrace_writer_thread, NULL, trace_thread);
+  BX_INFO(("writing binary trace to '%s'", trace_filename));
+  return 1;
+}
+
+static void bintrace_close(void)
+{
+  bx_bool stopped = 0;
+
+  if (trace.fp == NULL) return;
+
+  bintrace_submit();
+  BX_LOCK(trace_mutex);
+  trace.stop = 1;
+  BX_UNLOCK(trace_mutex);
+  while (!stopped) {
+    BX_MSLEEP(1);
+    BX_LOCK(trace_mutex);
+    stopped = trace.stopped;
+    BX_UNLOCK(trace_mutex);
+  }
+  BX_FINI_MUTEX(trace_mutex);
+  fclose(trace.fp);
+  trace.fp = NULL;
+  delete [] trace.buffer[0];
+  delete [] trace.buffer[1];
+}
+
+static BX_CPP_INLINE Bit8u *put_varint(Bit8u *p, Bit64u val)
+{
+  while (val >= 0x80) {
+    *p++ = (Bit8u)(val | 0x80);
+    val >>= 7;
+  }
+  *p++ = (Bit8u)val;
+  return p;
+}
+
+static Bit32s bintrace_options_parser(const char *context, int num_params, char *params[])
+{
+  for (int i = 1; i < num_params; i++) {
+    if (!strncmp(params[i], "file=", 5)) {
+      strncpy(trace_filename, &params[i][5], BX_PATHNAME_LEN - 1);
+      trace_filename[BX_PATHNAME_LEN - 1] = 0;
+    } else if (!strncmp(params[i], "active=", 7)) {
+      trace_start_active = atoi(&params[i][7]) != 0;
+    } else if (!strncmp(params[i], "mem=", 4)) {
+      trace_mem = atoi(&params[i][4]) != 0;
+    } else {
+      BX_ERROR(("%s: unknown parameter for bintrace ignored.", context));
+    }
+  }
+  return 0;
+}
+
+static Bit32s bintrace_options_save(FILE *fp)
+{
+  fprintf(fp, "bintrace: file=%s, active=%d, mem=%d\n", trace_filename,
+          trace_start_active, trace_mem);
+  return 0;
+}
+
+void bx_instr_init_env(void)
+{
+  instrument_log->put("bintrace", "BTRC");
+  SIM->register_addon_option("bintrace", bintrace_options_parser, bintrace_options_save);
+}
+
+void bx_instr_exit_env(void)
+{
+  bintrace_close();
+  if (icpu != NULL) {
+    delete [] icpu;
+    icpu = NULL;
+  }
+  SIM->unregister_addon_option("bintrace");
+}
+
+void bx_instr_initialize(unsigned cpu)
+{
+  assert(cpu < BX_SMP_PROCESSORS);
+
+  if (icpu == NULL) {
+    icpu = new bxTraceCpu[BX_SMP_PROCESSORS];
+    bintrace_open();
+  }
+
+  icpu[cpu].init(cpu);
+}
+
+bxTraceCpu::~bxTraceCpu()
+{
+  delete [] opcache;
+}
+
+void bxTraceCpu::init(unsigned cpu)
+{
+  cpu_id = cpu;
+  if (opcache == NULL) {
+    opcache = new bxtrace_opcache_entry_t[BXTRACE_OPCACHE_SIZE];
+    memset(opcache, 0, BXTRACE_OPCACHE_SIZE * sizeof(bxtrace_opcache_entry_t));
+  }
+  active = trace_start_active && (trace.fp != NULL);
+}
+
+// Makes room for the next record and switches the stream to this CPU
+Bit8u *bxTraceCpu::begin_record(void)
+{
+  if (trace.pos > (BXTRACE_BUFFER_SIZE - 2 * BXTRACE_MAX_RECORD))
+    bintrace_submit();
+
+  Bit8u *p = trace.buffer[trace.cur] + trace.pos;
+  if (cpu_id != trace.last_cpu) {
+    *p++ = BXTRACE_REC_CPU;
+    p = put_varint(p, cpu_id);
+    trace.last_cpu = cpu_id;
+  }
+  return p;
+}
+
+#define END_RECORD(p) trace.pos = (unsigned)((p) - trace.buffer[trace.cur])
+
+void bxTraceCpu::bx_instr_reset(unsigned type)
+{
+  next_laddr = mem_laddr = mem_paddr = 0;
+  if (trace.fp == NULL) return;
+
+  Bit8u *p = begin_record();
+  *p++ = BXTRACE_REC_RESET;
+  p = put_varint(p, type);
+  END_RECORD(p);
+}
+
+void bxTraceCpu::bx_instr_before_execution(bxInstruction_c *i)
+{
+  if (!active) return;
+
+  Bit64u laddr = BX_CPU(cpu_id)->get_laddr(BX_SEG_REG_CS, BX_CPU(cpu_id)->get_instruction_pointer());
+  unsigned len = i->ilen();
+  const Bit8u *opcode = i->get_opcode_bytes();
+  Bit8u mode = 0;
+
+  if (BX_CPU(cpu_id)->sregs[BX_SEG_REG_CS].cache.u.segment.d_b)
+    mode |= BXTRACE_INSN_IS32;
+  if (BX_CPU(cpu_id)->long64_mode())
+    mode |= BXTRACE_INSN_IS64;
+
+  bxtrace_opcache_entry_t *entry = &opcache[BXTRACE_OPCACHE_INDEX(laddr)];
+  bx_bool known = (entry->laddr == laddr) && (entry->len == len) &&
+                  (entry->mode == mode) && !memcmp(entry->opcode, opcode, len);
+
+  Bit8u *p = begin_record();
+  *p++ = known ? BXTRACE_REC_INSN : (BXTRACE_REC_INSN | BXTRACE_INSN_BYTES | mode);
+  p = put_varint(p, BXTRACE_ZIGZAG(laddr - next_laddr));
+  if (!known) {
+    *p++ = (Bit8u) len;
+    memcpy(p, opcode, len);
+    p += len;
+    entry->laddr = laddr;
+    entry->len = (Bit8u) len;
+    entry->mode = mode;
+    memcpy(entry->opcode, opcode, len);
+  }
+  END_RECORD(p);
+  next_laddr = laddr + len;
+}
+
+void bxTraceCpu::bx_instr_interrupt(unsigned vector)
+{
+  if (!active) return;
+
+  Bit8u *p = begin_record();
+  *p++ = BXTRACE_REC_EVENT | (BXTRACE_EVENT_INTERRUPT << 3);
+  p = put_varint(p, vector);
+  END_RECORD(p);
+}
+
+void bxTraceCpu::bx_instr_exception(unsigned vector, unsigned error_code)
+{
+  if (!active) return;
+
+  Bit8u *p = begin_record();
+  *p++ = BXTRACE_REC_EVENT | (BXTRACE_EVENT_EXCEPTION << 3);
+  p = put_varint(p, vector);
+  p = put_varint(p, error_code);
+  END_RECORD(p);
+}
+
+void bxTraceCpu::bx_instr_hwinterrupt(unsigned vector, Bit16u cs, bx_address eip)
+{
+  if (!active) return;
+
+  Bit8u *p = begin_record();
+  *p++ = BXTRACE_REC_EVENT | (BXTRACE_EVENT_HWINTERRUPT << 3);
+  p = put_varint(p, vector);
+  END_RECORD(p);
+}
+
+void bxTraceCpu::bx_instr_lin_access(bx_address lin, bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw)
+{
+  if (!active || !trace_mem) return;
+
+  Bit8u tag = BXTRACE_REC_MEM | ((rw & 0x03) << 3);
+  if ((Bit64u) phy == (Bit64u) lin) tag |= BXTRACE_MEM_IDENTITY;
+  if (memtype != 0) tag |= BXTRACE_MEM_MEMTYPE;
+
+  Bit8u *p = begin_record();
+  *p++ = tag;
+  p = put_varint(p, len);
+  p = put_varint(p, BXTRACE_ZIGZAG((Bit64u) lin - mem_laddr));
+  if (memtype != 0)
+    *p++ = (Bit8u) memtype;
+  if (!(tag & BXTRACE_MEM_IDENTITY))
+    p = put_varint(p, BXTRACE_ZIGZAG((Bit64u) phy - mem_paddr));
+  END_RECORD(p);
+  mem_laddr = lin;
+  mem_paddr = phy;
+}
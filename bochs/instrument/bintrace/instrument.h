@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Instrumentation module writing a compact binary instruction and memory
+// access trace. See bxtrace.h for the format and misc/bxtrace.cc for the
+// decoder.
+
+#if BX_INSTRUMENTATION
+
+class bxInstruction_c;
+
+// define if you want to store instruction opcode bytes in bxInstruction_c
+#define BX_INSTR_STORE_OPCODE_BYTES
+
+void bx_instr_init_env(void);
+void bx_instr_exit_env(void);
+void bx_instr_initialize(unsigned cpu);
+
+struct bxtrace_opcache_entry_t;
+
+class bxTraceCpu {
+public:
+  unsigned cpu_id;
+
+  bx_bool active;
+
+  Bit64u next_laddr;    // address following the previous instruction
+  Bit64u mem_laddr;     // addresses of the previous memory access
+  Bit64u mem_paddr;
+
+  bxtrace_opcache_entry_t *opcache;
+
+public:
+  bxTraceCpu(): cpu_id(0), active(0), next_laddr(0), mem_laddr(0), mem_paddr(0), opcache(NULL) {}
+  ~bxTraceCpu();
+
+  void init(unsigned cpu);
+
+  void activate() { active = 1; }
+  void deactivate() { active = 0; }
+  void toggle_active() { active = !active; }
+  bx_bool is_active() const { return active; }
+
+  void bx_instr_reset(unsigned type);
+
+  void bx_instr_before_execution(bxInstruction_c *i);
+
+  void bx_instr_interrupt(unsigned vector);
+  void bx_instr_exception(unsigned vector, unsigned error_code);
+  void bx_instr_hwinterrupt(unsigned vector, Bit16u cs, bx_address eip);
+
+  void bx_instr_lin_access(bx_address lin, bx_phy_address phy, unsigned len, unsigned memtype, unsigned rw);
+
+private:
+  Bit8u *begin_record(void);
+};
+
+extern bxTraceCpu *icpu;
+
+/* initialization/deinitialization of instrumentalization*/
+#define BX_INSTR_INIT_ENV() bx_instr_init_env()
+#define BX_INSTR_EXIT_ENV() bx_instr_exit_env()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)      bx_instr_initialize(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)
+#define BX_INSTR_RESET(cpu_id, type)     icpu[cpu_id].bx_instr_reset(type)
+#define BX_INSTR_HLT(cpu_id)
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags)
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()
+#define BX_INSTR_DEBUG_CMD(cmd)
+
+/* branch resolution */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, branch_eip, new_eip)
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id, branch_eip)
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, branch_eip, new_eip)
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, prev_cs, prev_eip, new_cs, new_eip)
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, i, opcode, len, is32, is64)
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code) \
+                       icpu[cpu_id].bx_instr_exception(vector, error_code)
+
+#define BX_INSTR_INTERRUPT(cpu_id, vector) icpu[cpu_id].bx_instr_interrupt(vector)
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip) icpu[cpu_id].bx_instr_hwinterrupt(vector, cs, eip)
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr)
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what)
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3)
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset)
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i) icpu[cpu_id].bx_instr_before_execution(i)
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
+
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
+/* memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw) \
+                    icpu[cpu_id].bx_instr_lin_access(lin, phy, len, memtype, rw)
+
+#define BX_INSTR_PHY_ACCESS(cpu_id, phy, len, memtype, rw)
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len)
+#define BX_INSTR_INP2(addr, len, val)
+#define BX_INSTR_OUTP(addr, len, val)
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value)
+
+/* vmexit callback */
+#define BX_INSTR_VMEXIT(cpu_id, reason, qualification)
+
+#else // BX_INSTRUMENTATION
+
+/* initialization/deinitialization of instrumentalization */
+#define BX_INSTR_INIT_ENV()
+#define BX_INSTR_EXIT_ENV()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)
+#define BX_INSTR_RESET(cpu_id, type)
+#define BX_INSTR_HLT(cpu_id)
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags)
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()
+#define BX_INSTR_DEBUG_CMD(cmd)
+
+/* branch resolution */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, branch_eip, new_eip)
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id, branch_eip)
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, branch_eip, new_eip)
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, prev_cs, prev_eip, new_cs, new_eip)
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, i, opcode, len, is32, is64)
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code)
+#define BX_INSTR_INTERRUPT(cpu_id, vector)
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip)
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr)
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what)
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3)
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset)
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i)
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
+
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
+/* linear memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
+
+/* physical memory access */
+#define BX_INSTR_PHY_ACCESS(cpu_id, phy, len, memtype, rw)
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len)
+#define BX_INSTR_INP2(addr, len, val)
+#define BX_INSTR_OUTP(addr, len, val)
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value)
+
+/* vmexit callback */
+#define BX_INSTR_VMEXIT(cpu_id, reason, qualification)
+
+#endif // BX_INSTRUMENTATION
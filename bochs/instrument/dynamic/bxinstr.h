@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_INSTR_BXINSTR_H
+#define BX_INSTR_BXINSTR_H
+
+// Interface between Bochs and instrumentation tools loaded at runtime
+//
+// A tool is a shared library exporting the function BX_INSTR_TOOL_ENTRY.
+// Bochs calls it once after loading the tool and gets a table of callback
+// functions back. The callbacks have the same arguments as the bx_instr_*
+// functions of a compiled-in instrumentation library (see
+// instrument/instrumentation.txt). Unused callbacks are left NULL.
+//
+// Bochs only calls the callbacks enabled in the callback mask, this is a
+// single test of a global variable at each instrumentation point. The tool
+// sets the initial mask in the table and may change it later with the
+// set_mask() function of the host interface, for example to start tracing
+// after a certain event.
+//
+// The version is increased on incompatible changes. New callbacks are
+// added at the end of the table, Bochs treats callbacks beyond the size
+// reported by an older tool as NULL. Tools must include config.h of the
+// Bochs build before this file.
+
+#define BX_INSTR_API_VERSION 1
+
+#define BX_INSTR_TOOL_ENTRY "bx_instr_tool_init"
+
+#if defined(WIN32) || defined(__CYGWIN__)
+#  define BX_INSTR_TOOL_EXPORT extern "C" __declspec(dllexport)
+#else
+#  define BX_INSTR_TOOL_EXPORT extern "C"
+#endif
+
+// callback kinds, one bit each in the callback mask
+enum {
+  BX_INSTR_CB_INITIALIZE,
+  BX_INSTR_CB_EXIT,
+  BX_INSTR_CB_RESET,
+  BX_INSTR_CB_HLT,
+  BX_INSTR_CB_MWAIT,
+  BX_INSTR_CB_DEBUG_PROMPT,
+  BX_INSTR_CB_DEBUG_CMD,
+  BX_INSTR_CB_CNEAR_BRANCH_TAKEN,
+  BX_INSTR_CB_CNEAR_BRANCH_NOT_TAKEN,
+  BX_INSTR_CB_UCNEAR_BRANCH,
+  BX_INSTR_CB_FAR_BRANCH,
+  BX_INSTR_CB_OPCODE,
+  BX_INSTR_CB_INTERRUPT,
+  BX_INSTR_CB_EXCEPTION,
+  BX_INSTR_CB_HWINTERRUPT,
+  BX_INSTR_CB_TLB_CNTRL,
+  BX_INSTR_CB_CACHE_CNTRL,
+  BX_INSTR_CB_PREFETCH_HINT,
+  BX_INSTR_CB_CLFLUSH,
+  BX_INSTR_CB_BEFORE_EXECUTION,
+  BX_INSTR_CB_AFTER_EXECUTION,
+  BX_INSTR_CB_REPEAT_ITERATION,
+  BX_INSTR_CB_INP,
+  BX_INSTR_CB_INP2,
+  BX_INSTR_CB_OUTP,
+  BX_INSTR_CB_LIN_ACCESS,
+  BX_INSTR_CB_PHY_ACCESS,
+  BX_INSTR_CB_WRMSR,
+  BX_INSTR_CB_VMEXIT,
+  BX_INSTR_CB_TRACE_DECODED,
+  BX_INSTR_CB_TRACE_ENTRY,
+  BX_INSTR_CB_COUNT
+};
+
+#define BX_INSTR_MASK(kind) (((Bit64u) 1) << (kind))
+#define BX_INSTR_MASK_ALL   (BX_INSTR_MASK(BX_INSTR_CB_COUNT) - 1)
+
+class bxInstruction_c;
+struct bxICacheEntry_c;
+
+// levels for the log function of the host interface
+enum {
+  BX_INSTR_LOG_INFO,
+  BX_INSTR_LOG_ERROR,
+  BX_INSTR_LOG_PANIC
+};
+
+// services of Bochs offered to the tool
+typedef struct {
+  Bit32u api_version;
+  Bit32u size;
+  unsigned num_cpus;
+  // bochsrc parameters of the "instrument" option not used by Bochs itself
+  // ("name=value" strings), only valid during the call of the entry function
+  int argc;
+  char **argv;
+  void (*set_mask)(Bit64u mask);
+  Bit64u (*get_mask)(void);
+  void (*log)(int level, const char *msg);
+} bx_instr_host_t;
+
+// table of callbacks returned by the tool
+typedef struct {
+  Bit32u api_version;
+  Bit32u size;           // sizeof(bx_instr_tool_t) the tool was built with
+  const char *name;
+  Bit64u mask;           // callbacks enabled initially
+
+  void (*exit_env)(void);
+
+  void (*initialize)(unsigned cpu);
+  void (*exit)(unsigned cpu);
+  void (*reset)(unsigned cpu, unsigned type);
+  void (*hlt)(unsigned cpu);
+  void (*mwait)(unsigned cpu, bx_phy_address addr, unsigned len, Bit32u flags);
+
+  void (*debug_promt)(void);
+  void (*debug_cmd)(const char *cmd);
+
+  void (*cnear_branch_taken)(unsigned cpu, bx_address branch_eip, bx_address new_eip);
+  void (*cnear_branch_not_taken)(unsigned cpu, bx_address branch_eip);
+  void (*ucnear_branch)(unsigned cpu, unsigned what, bx_address branch_eip, bx_address new_eip);
+  void (*far_branch)(unsigned cpu, unsigned what, Bit16u prev_cs, bx_address prev_eip, Bit16u new_cs, bx_address new_eip);
+
+  void (*opcode)(unsigned cpu, bxInstruction_c *i, const Bit8u *opcode, unsigned len, bx_bool is32, bx_bool is64);
+
+  void (*interrupt)(unsigned cpu, unsigned vector);
+  void (*exception)(unsigned cpu, unsigned vector, unsigned error_code);
+  void (*hwinterrupt)(unsigned cpu, unsigned vector, Bit16u cs, bx_address eip);
+
+  void (*tlb_cntrl)(unsigned cpu, unsigned what, bx_phy_address new_cr3);
+  void (*cache_cntrl)(unsigned cpu, unsigned what);
+  void (*prefetch_hint)(unsigned cpu, unsigned what, unsigned seg, bx_address offset);
+  void (*clflush)(unsigned cpu, bx_address laddr, bx_phy_address paddr);
+
+  void (*before_execution)(unsigned cpu, bxInstruction_c *i);
+  void (*after_execution)(unsigned cpu, bxInstruction_c *i);
+  void (*repeat_iteration)(unsigned cpu, bxInstruction_c *i);
+
+  void (*inp)(Bit16u addr, unsigned len);
+  void (*inp2)(Bit16u addr, unsigned len, unsigned val);
+  void (*outp)(Bit16u addr, unsigned len, unsigned val);
+
+  void (*lin_access)(unsigned cpu, bx_address lin, bx_address phy, unsigned len, unsigned memtype, unsigned rw);
+  void (*phy_access)(unsigned cpu, bx_address phy, unsigned len, unsigned memtype, unsigned rw);
+
+  void (*wrmsr)(unsigned cpu, unsigned addr, Bit64u value);
+
+  void (*vmexit)(unsigned cpu, Bit32u reason, Bit64u qualification);
+
+  void (*trace_decoded)(unsigned cpu, bxICacheEntry_c *entry);
+  void (*trace_entry)(unsigned cpu, bxICacheEntry_c *entry);
+} bx_instr_tool_t;
+
+// Entry function of the tool. Returns NULL if the tool can't work with
+// the given host interface.
+typedef const bx_instr_tool_t *(*bx_instr_tool_init_t)(const bx_instr_host_t *host);
+
+#endif
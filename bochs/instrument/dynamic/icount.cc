@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Example instrumentation tool for the dynamic instrumentation module.
+// Counts the executed instructions, taken branches, entered and decoded
+// traces, interrupts and exceptions of each CPU and reports them when
+// Bochs exits. With the parameter "branches=0" the branch callbacks are
+// left disabled.
+//
+//   instrument: tool=./icount.so, branches=1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "osdep.h"
+#include "bxinstr.h"
+
+static const bx_instr_host_t *host;
+
+static struct icount_t {
+  Bit64u insns;
+  Bit64u branches;
+  Bit64u traces;
+  Bit64u decoded;
+  Bit64u interrupts;
+  Bit64u exceptions;
+} *icount = NULL;
+
+static void icount_before_execution(unsigned cpu, bxInstruction_c *i)
+{
+  icount[cpu].insns++;
+}
+
+static void icount_cnear_branch_taken(unsigned cpu, bx_address branch_eip, bx_address new_eip)
+{
+  icount[cpu].branches++;
+}
+
+static void icount_ucnear_branch(unsigned cpu, unsigned what, bx_address branch_eip, bx_address new_eip)
+{
+  icount[cpu].branches++;
+}
+
+static void icount_far_branch(unsigned cpu, unsigned what, Bit16u prev_cs, bx_address prev_eip, Bit16u new_cs, bx_address new_eip)
+{
+  icount[cpu].branches++;
+}
+
+static void icount_trace_decoded(unsigned cpu, bxICacheEntry_c *entry)
+{
+  icount[cpu].decoded++;
+}
+
+static void icount_trace_entry(unsigned cpu, bxICacheEntry_c *entry)
+{
+  icount[cpu].traces++;
+}
+
+static void icount_interrupt(unsigned cpu, unsigned vector)
+{
+  icount[cpu].interrupts++;
+}
+
+static void icount_exception(unsigned cpu, unsigned vector, unsigned error_code)
+{
+  icount[cpu].exceptions++;
+}
+
+static void icount_exit_env(void)
+{
+  char msg[192];
+
+  for (unsigned cpu = 0; cpu < host->num_cpus; cpu++) {
+    sprintf(msg, "cpu %u: " FMT_LL "u instructions, " FMT_LL "u branches, " FMT_LL "u interrupts, " FMT_LL "u exceptions",
+      cpu, icount[cpu].insns, icount[cpu].branches, icount[cpu].interrupts, icount[cpu].exceptions);
+    host->log(BX_INSTR_LOG_INFO, msg);
+    sprintf(msg, "cpu %u: " FMT_LL "u traces entered, " FMT_LL "u traces decoded",
+      cpu, icount[cpu].traces, icount[cpu].decoded);
+    host->log(BX_INSTR_LOG_INFO, msg);
+  }
+  free(icount);
+  icount = NULL;
+}
+
+static bx_instr_tool_t icount_tool;
+
+BX_INSTR_TOOL_EXPORT const bx_instr_tool_t *bx_instr_tool_init(const bx_instr_host_t *h)
+{
+  bx_bool branches = 1;
+
+  if (h->api_version != BX_INSTR_API_VERSION) return NULL;
+
+  for (int n = 0; n < h->argc; n++) {
+    if (!strncmp(h->argv[n], "branches=", 9)) {
+      branches = atoi(&h->argv[n][9]) != 0;
+    } else {
+      h->log(BX_INSTR_LOG_ERROR, "icount: unknown parameter ignored");
+    }
+  }
+
+  host = h;
+  icount = (icount_t *) calloc(h->num_cpus, sizeof(icount_t));
+
+  memset(&icount_tool, 0, sizeof(icount_tool));
+  icount_tool.api_version = BX_INSTR_API_VERSION;
+  icount_tool.size = sizeof(icount_tool);
+  icount_tool.name = "icount";
+  icount_tool.exit_env = icount_exit_env;
+  icount_tool.before_execution = icount_before_execution;
+  icount_tool.cnear_branch_taken = icount_cnear_branch_taken;
+  icount_tool.ucnear_branch = icount_ucnear_branch;
+  icount_tool.far_branch = icount_far_branch;
+  icount_tool.interrupt = icount_interrupt;
+  icount_tool.exception = icount_exception;
+  icount_tool.trace_decoded = icount_trace_decoded;
+  icount_tool.trace_entry = icount_trace_entry;
+
+  icount_tool.mask = BX_INSTR_MASK(BX_INSTR_CB_BEFORE_EXECUTION) |
+                     BX_INSTR_MASK(BX_INSTR_CB_INTERRUPT) |
+                     BX_INSTR_MASK(BX_INSTR_CB_EXCEPTION) |
+                     BX_INSTR_MASK(BX_INSTR_CB_TRACE_DECODED) |
+                     BX_INSTR_MASK(BX_INSTR_CB_TRACE_ENTRY);
+  if (branches) {
+    icount_tool.mask |= BX_INSTR_MASK(BX_INSTR_CB_CNEAR_BRANCH_TAKEN) |
+                        BX_INSTR_MASK(BX_INSTR_CB_UCNEAR_BRANCH) |
+                        BX_INSTR_MASK(BX_INSTR_CB_FAR_BRANCH);
+  }
+  return &icount_tool;
+}
@@ -0,0 +1,348 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+#include <stddef.h>
+
+#include "bochs.h"
+
+#if BX_HAVE_DLFCN_H
+#include <dlfcn.h>
+#endif
+
+Bit64u bx_instr_mask = 0;
+bx_instr_tool_t bx_instr_tool;
+
+static logfunctions *instrument_log = new logfunctions();
+#define LOG_THIS instrument_log->
+
+// bochsrc option: "instrument: tool=libtool.so, mask=name|name|..., ..."
+// Other parameters are passed to the tool. The tool is loaded when the
+// first CPU is initialized, the number of CPUs isn't known before.
+#define BX_INSTR_MAX_ARGS 16
+
+static char tool_filename[BX_PATHNAME_LEN];
+static Bit64u option_mask = BX_INSTR_MASK_ALL;
+static Bit64u avail_mask = 0;    // callbacks present in the table
+static char *tool_args[BX_INSTR_MAX_ARGS];
+static int tool_argc = 0;
+static bx_instr_host_t host;     // kept by the tool
+
+#if defined(WIN32)
+static HMODULE tool_handle = NULL;
+#else
+static void *tool_handle = NULL;
+#endif
+
+static const char *callback_name[BX_INSTR_CB_COUNT] = {
+  "initialize",
+  "exit",
+  "reset",
+  "hlt",
+  "mwait",
+  "debug_prompt",
+  "debug_cmd",
+  "cnear_branch_taken",
+  "cnear_branch_not_taken",
+  "ucnear_branch",
+  "far_branch",
+  "opcode",
+  "interrupt",
+  "exception",
+  "hwinterrupt",
+  "tlb_cntrl",
+  "cache_cntrl",
+  "prefetch_hint",
+  "clflush",
+  "before_execution",
+  "after_execution",
+  "repeat_iteration",
+  "inp",
+  "inp2",
+  "outp",
+  "lin_access",
+  "phy_access",
+  "wrmsr",
+  "vmexit",
+  "trace_decoded",
+  "trace_entry"
+};
+
+// host interface
+
+static void host_set_mask(Bit64u mask)
+{
+  bx_instr_mask = mask & avail_mask & option_mask;
+}
+
+static Bit64u host_get_mask(void)
+{
+  return bx_instr_mask;
+}
+
+static void host_log(int level, const char *msg)
+{
+  if (level == BX_INSTR_LOG_PANIC) {
+    BX_PANIC(("%s", msg));
+  } else if (level == BX_INSTR_LOG_ERROR) {
+    BX_ERROR(("%s", msg));
+  } else {
+    BX_INFO(("%s", msg));
+  }
+}
+
+// shared library access
+
+static bx_bool tool_open(const char *path)
+{
+#if defined(WIN32)
+  tool_handle = LoadLibrary(path);
+#elif BX_HAVE_DLFCN_H
+  tool_handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (tool_handle == NULL)
+    BX_ERROR(("%s", dlerror()));
+#endif
+  return tool_handle != NULL;
+}
+
+static bx_instr_tool_init_t tool_entry(void)
+{
+#if defined(WIN32)
+  return (bx_instr_tool_init_t) GetProcAddress(tool_handle, BX_INSTR_TOOL_ENTRY);
+#elif BX_HAVE_DLFCN_H
+  return (bx_instr_tool_init_t) dlsym(tool_handle, BX_INSTR_TOOL_ENTRY);
+#else
+  return NULL;
+#endif
+}
+
+static void tool_close(void)
+{
+  if (tool_handle == NULL) return;
+#if defined(WIN32)
+  FreeLibrary(tool_handle);
+#elif BX_HAVE_DLFCN_H
+  dlclose(tool_handle);
+#endif
+  tool_handle = NULL;
+}
+
+#define BX_INSTR_AVAIL(kind, func) \
+  if (bx_instr_tool.func != NULL) avail_mask |= BX_INSTR_MASK(BX_INSTR_CB_##kind)
+
+static void tool_get_avail_mask(void)
+{
+  avail_mask = 0;
+  BX_INSTR_AVAIL(INITIALIZE, initialize);
+  BX_INSTR_AVAIL(EXIT, exit);
+  BX_INSTR_AVAIL(RESET, reset);
+  BX_INSTR_AVAIL(HLT, hlt);
+  BX_INSTR_AVAIL(MWAIT, mwait);
+  BX_INSTR_AVAIL(DEBUG_PROMPT, debug_promt);
+  BX_INSTR_AVAIL(DEBUG_CMD, debug_cmd);
+  BX_INSTR_AVAIL(CNEAR_BRANCH_TAKEN, cnear_branch_taken);
+  BX_INSTR_AVAIL(CNEAR_BRANCH_NOT_TAKEN, cnear_branch_not_taken);
+  BX_INSTR_AVAIL(UCNEAR_BRANCH, ucnear_branch);
+  BX_INSTR_AVAIL(FAR_BRANCH, far_branch);
+  BX_INSTR_AVAIL(OPCODE, opcode);
+  BX_INSTR_AVAIL(INTERRUPT, interrupt);
+  BX_INSTR_AVAIL(EXCEPTION, exception);
+  BX_INSTR_AVAIL(HWINTERRUPT, hwinterrupt);
+  BX_INSTR_AVAIL(TLB_CNTRL, tlb_cntrl);
+  BX_INSTR_AVAIL(CACHE_CNTRL, cache_cntrl);
+  BX_INSTR_AVAIL(PREFETCH_HINT, prefetch_hint);
+  BX_INSTR_AVAIL(CLFLUSH, clflush);
+  BX_INSTR_AVAIL(BEFORE_EXECUTION, before_execution);
+  BX_INSTR_AVAIL(AFTER_EXECUTION, after_execution);
+  BX_INSTR_AVAIL(REPEAT_ITERATION, repeat_iteration);
+  BX_INSTR_AVAIL(INP, inp);
+  BX_INSTR_AVAIL(INP2, inp2);
+  BX_INSTR_AVAIL(OUTP, outp);
+  BX_INSTR_AVAIL(LIN_ACCESS, lin_access);
+  BX_INSTR_AVAIL(PHY_ACCESS, phy_access);
+  BX_INSTR_AVAIL(WRMSR, wrmsr);
+  BX_INSTR_AVAIL(VMEXIT, vmexit);
+  BX_INSTR_AVAIL(TRACE_DECODED, trace_decoded);
+  BX_INSTR_AVAIL(TRACE_ENTRY, trace_entry);
+}
+
+static void tool_unload(void)
+{
+  bx_instr_mask = 0;
+  if (bx_instr_tool.exit_env != NULL)
+    bx_instr_tool.exit_env();
+  memset(&bx_instr_tool, 0, sizeof(bx_instr_tool));
+  avail_mask = 0;
+  tool_close();
+}
+
+static void tool_load(void)
+{
+  if (!tool_open(tool_filename)) {
+    BX_PANIC(("could not load instrumentation tool '%s'", tool_filename));
+    return;
+  }
+  bx_instr_tool_init_t init = tool_entry();
+  if (init == NULL) {
+    BX_PANIC(("'%s' is not an instrumentation tool", tool_filename));
+    tool_close();
+    return;
+  }
+
+  host.api_version = BX_INSTR_API_VERSION;
+  host.size = sizeof(host);
+  host.num_cpus = BX_SMP_PROCESSORS;
+  host.argc = tool_argc;
+  host.argv = tool_args;
+  host.set_mask = host_set_mask;
+  host.get_mask = host_get_mask;
+  host.log = host_log;
+  const bx_instr_tool_t *tool = init(&host);
+  if (tool == NULL) {
+    BX_PANIC(("instrumentation tool '%s' failed to initialize", tool_filename));
+    tool_close();
+    return;
+  }
+  if ((tool->api_version != BX_INSTR_API_VERSION) ||
+      (tool->size < offsetof(bx_instr_tool_t, initialize))) {
+    BX_PANIC(("instrumentation tool '%s' was built for interface version %u, version %u required",
+      tool_filename, tool->api_version, BX_INSTR_API_VERSION));
+    tool_close();
+    return;
+  }
+
+  // callbacks missing in the table of an older tool stay NULL
+  memset(&bx_instr_tool, 0, sizeof(bx_instr_tool));
+  memcpy(&bx_instr_tool, tool, BX_MIN(tool->size, sizeof(bx_instr_tool)));
+  tool_get_avail_mask();
+  host_set_mask(bx_instr_tool.mask);
+
+  BX_INFO(("loaded instrumentation tool '%s' from '%s'",
+    (bx_instr_tool.name != NULL) ? bx_instr_tool.name : "unnamed", tool_filename));
+  for (int n = 0; n < BX_INSTR_CB_COUNT; n++) {
+    if (bx_instr_mask & BX_INSTR_MASK(n))
+      BX_INFO(("  %s callback enabled", callback_name[n]));
+  }
+}
+
+static bx_bool parse_mask(char *str)
+{
+  char *name = strtok(str, "|");
+
+  option_mask = 0;
+  while (name != NULL) {
+    int n;
+    for (n = 0; n < BX_INSTR_CB_COUNT; n++) {
+      if (!strcmp(name, callback_name[n])) break;
+    }
+    if (n == BX_INSTR_CB_COUNT) {
+      if (!strcmp(name, "all")) {
+        option_mask = BX_INSTR_MASK_ALL;
+      } else {
+        return 0;
+      }
+    } else {
+      option_mask |= BX_INSTR_MASK(n);
+    }
+    name = strtok(NULL, "|");
+  }
+  return 1;
+}
+
+static void free_tool_args(void)
+{
+  for (int i = 0; i < tool_argc; i++) {
+    free(tool_args[i]);
+  }
+  tool_argc = 0;
+}
+
+static Bit32s instrument_options_parser(const char *context, int num_params, char *params[])
+{
+  if (tool_handle != NULL) {
+    BX_ERROR(("%s: instrumentation tool '%s' already loaded, option ignored", context, tool_filename));
+    return 0;
+  }
+  tool_filename[0] = 0;
+  option_mask = BX_INSTR_MASK_ALL;
+  free_tool_args();
+  for (int i = 1; i < num_params; i++) {
+    if (!strncmp(params[i], "tool=", 5)) {
+      strncpy(tool_filename, &params[i][5], BX_PATHNAME_LEN - 1);
+      tool_filename[BX_PATHNAME_LEN - 1] = 0;
+    } else if (!strncmp(params[i], "mask=", 5)) {
+      if (!parse_mask(&params[i][5])) {
+        BX_PANIC(("%s: unknown callback in instrument mask", context));
+      }
+    } else if (tool_argc < BX_INSTR_MAX_ARGS) {
+      tool_args[tool_argc++] = strdup(params[i]);
+    } else {
+      BX_ERROR(("%s: too many parameters for instrumentation tool", context));
+    }
+  }
+  if (tool_filename[0] == 0) {
+    BX_PANIC(("%s: instrument directive malformed, tool filename missing", context));
+  }
+  return 0;
+}
+
+static Bit32s instrument_options_save(FILE *fp)
+{
+  if (tool_filename[0] == 0) return 0;
+
+  fprintf(fp, "instrument: tool=%s", tool_filename);
+  if (option_mask != BX_INSTR_MASK_ALL) {
+    char sep = '=';
+    fprintf(fp, ", mask");
+    for (int n = 0; n < BX_INSTR_CB_COUNT; n++) {
+      if (option_mask & BX_INSTR_MASK(n)) {
+        fprintf(fp, "%c%s", sep, callback_name[n]);
+        sep = '|';
+      }
+    }
+  }
+  for (int i = 0; i < tool_argc; i++) {
+    fprintf(fp, ", %s", tool_args[i]);
+  }
+  fprintf(fp, "\n");
+  return 0;
+}
+
+void bx_instr_init_env(void)
+{
+  instrument_log->put("instrument", "INSTR");
+  memset(&bx_instr_tool, 0, sizeof(bx_instr_tool));
+  tool_filename[0] = 0;
+  SIM->register_addon_option("instrument", instrument_options_parser, instrument_options_save);
+}
+
+void bx_instr_exit_env(void)
+{
+  tool_unload();
+  free_tool_args();
+  SIM->unregister_addon_option("instrument");
+}
+
+void bx_instr_initialize(unsigned cpu)
+{
+  if ((cpu == 0) && (tool_handle == NULL) && (tool_filename[0] != 0))
+    tool_load();
+
+  BX_INSTR_CALL(INITIALIZE, initialize(cpu));
+}
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+// Instrumentation module forwarding the callbacks to a tool loaded at
+// runtime. See bxinstr.h for the interface of the tool.
+
+#if BX_INSTRUMENTATION
+
+#include "bxinstr.h"
+
+// define if you want to store instruction opcode bytes in bxInstruction_c
+//#define BX_INSTR_STORE_OPCODE_BYTES
+
+void bx_instr_init_env(void);
+void bx_instr_exit_env(void);
+void bx_instr_initialize(unsigned cpu);
+
+// callbacks enabled by the tool and the table of the tool
+extern Bit64u bx_instr_mask;
+extern bx_instr_tool_t bx_instr_tool;
+
+#define BX_INSTR_CALL(kind, call) do { \
+  if (bx_instr_mask & BX_INSTR_MASK(BX_INSTR_CB_##kind)) bx_instr_tool.call; \
+} while (0)
+
+/* initialization/deinitialization of instrumentalization*/
+#define BX_INSTR_INIT_ENV() bx_instr_init_env()
+#define BX_INSTR_EXIT_ENV() bx_instr_exit_env()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)      bx_instr_initialize(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)            BX_INSTR_CALL(EXIT, exit(cpu_id))
+#define BX_INSTR_RESET(cpu_id, type)     BX_INSTR_CALL(RESET, reset(cpu_id, type))
+#define BX_INSTR_HLT(cpu_id)             BX_INSTR_CALL(HLT, hlt(cpu_id))
+
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags) \
+                       BX_INSTR_CALL(MWAIT, mwait(cpu_id, addr, len, flags))
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()          BX_INSTR_CALL(DEBUG_PROMPT, debug_promt())
+#define BX_INSTR_DEBUG_CMD(cmd)          BX_INSTR_CALL(DEBUG_CMD, debug_cmd(cmd))
+
+/* branch resolution */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, branch_eip, new_eip) \
+                       BX_INSTR_CALL(CNEAR_BRANCH_TAKEN, cnear_branch_taken(cpu_id, branch_eip, new_eip))
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id, branch_eip) \
+                       BX_INSTR_CALL(CNEAR_BRANCH_NOT_TAKEN, cnear_branch_not_taken(cpu_id, branch_eip))
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, branch_eip, new_eip) \
+                       BX_INSTR_CALL(UCNEAR_BRANCH, ucnear_branch(cpu_id, what, branch_eip, new_eip))
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, prev_cs, prev_eip, new_cs, new_eip) \
+                       BX_INSTR_CALL(FAR_BRANCH, far_branch(cpu_id, what, prev_cs, prev_eip, new_cs, new_eip))
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, i, bytes, len, is32, is64) \
+                       BX_INSTR_CALL(OPCODE, opcode(cpu_id, i, bytes, len, is32, is64))
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code) \
+                       BX_INSTR_CALL(EXCEPTION, exception(cpu_id, vector, error_code))
+
+#define BX_INSTR_INTERRUPT(cpu_id, vector) BX_INSTR_CALL(INTERRUPT, interrupt(cpu_id, vector))
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip) \
+                       BX_INSTR_CALL(HWINTERRUPT, hwinterrupt(cpu_id, vector, cs, eip))
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr)    BX_INSTR_CALL(CLFLUSH, clflush(cpu_id, laddr, paddr))
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what)        BX_INSTR_CALL(CACHE_CNTRL, cache_cntrl(cpu_id, what))
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3) BX_INSTR_CALL(TLB_CNTRL, tlb_cntrl(cpu_id, what, new_cr3))
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset) \
+                       BX_INSTR_CALL(PREFETCH_HINT, prefetch_hint(cpu_id, what, seg, offset))
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i)  BX_INSTR_CALL(BEFORE_EXECUTION, before_execution(cpu_id, i))
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i)   BX_INSTR_CALL(AFTER_EXECUTION, after_execution(cpu_id, i))
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i)  BX_INSTR_CALL(REPEAT_ITERATION, repeat_iteration(cpu_id, i))
+
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry) BX_INSTR_CALL(TRACE_DECODED, trace_decoded(cpu_id, entry))
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)   BX_INSTR_CALL(TRACE_ENTRY, trace_entry(cpu_id, entry))
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      (bx_instr_mask & BX_INSTR_MASK(BX_INSTR_CB_TRACE_ENTRY))
+
+/* linear memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw) \
+                       BX_INSTR_CALL(LIN_ACCESS, lin_access(cpu_id, lin, phy, len, memtype, rw))
+
+/* physical memory access */
+#define BX_INSTR_PHY_ACCESS(cpu_id, phy, len, memtype, rw) \
+                       BX_INSTR_CALL(PHY_ACCESS, phy_access(cpu_id, phy, len, memtype, rw))
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len)               BX_INSTR_CALL(INP, inp(addr, len))
+#define BX_INSTR_INP2(addr, len, val)         BX_INSTR_CALL(INP2, inp2(addr, len, val))
+#define BX_INSTR_OUTP(addr, len, val)         BX_INSTR_CALL(OUTP, outp(addr, len, val))
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value)   BX_INSTR_CALL(WRMSR, wrmsr(cpu_id, addr, value))
+
+/* vmexit callback */
+#define BX_INSTR_VMEXIT(cpu_id, reason, qualification) \
+                       BX_INSTR_CALL(VMEXIT, vmexit(cpu_id, reason, qualification))
+
+#else // BX_INSTRUMENTATION
+
+/* initialization/deinitialization of instrumentalization */
+#define BX_INSTR_INIT_ENV()
+#define BX_INSTR_EXIT_ENV()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)
+#define BX_INSTR_RESET(cpu_id, type)
+#define BX_INSTR_HLT(cpu_id)
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags)
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()
+#define BX_INSTR_DEBUG_CMD(cmd)
+
+/* branch resolution */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, branch_eip, new_eip)
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id, branch_eip)
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, branch_eip, new_eip)
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, prev_cs, prev_eip, new_cs, new_eip)
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, i, opcode, len, is32, is64)
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code)
+#define BX_INSTR_INTERRUPT(cpu_id, vector)
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip)
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr)
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what)
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3)
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset)
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i)
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
+
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
+/* linear memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
+
+/* physical memory access */
+#define BX_INSTR_PHY_ACCESS(cpu_id, phy, len, memtype, rw)
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len)
+#define BX_INSTR_INP2(addr, len, val)
+#define BX_INSTR_OUTP(addr, len, val)
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value)
+
+/* vmexit callback */
+#define BX_INSTR_VMEXIT(cpu_id, reason, qualification)
+
+#endif // BX_INSTRUMENTATION
@@ -91,6 +91,11 @@ void bx_instr_lin_access(unsigned cpu, bx_address lin, bx_phy_address phy, unsig
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i) bx_instr_after_execution(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw) \
                 bx_instr_lin_access(cpu_id, lin, phy, len, memtype, rw)
@@ -150,6 +155,11 @@ void bx_instr_lin_access(unsigned cpu, bx_address lin, bx_phy_address phy, unsig
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
 
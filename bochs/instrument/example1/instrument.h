@@ -142,6 +142,11 @@ extern bxInstrumentation *icpu;
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i) icpu[cpu_id].bx_instr_after_execution(i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw) \
                     icpu[cpu_id].bx_instr_lin_access(lin, phy, len, memtype, rw)
@@ -201,6 +206,11 @@ extern bxInstrumentation *icpu;
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
 
@@ -81,6 +81,11 @@ void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i);
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
 
@@ -141,6 +146,11 @@ void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i);
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
 
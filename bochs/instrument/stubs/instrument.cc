@@ -56,6 +56,9 @@ void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i) {}
 void bx_instr_after_execution(unsigned cpu, bxInstruction_c *i) {}
 void bx_instr_repeat_iteration(unsigned cpu, bxInstruction_c *i) {}
 
+void bx_instr_trace_decoded(unsigned cpu, bxICacheEntry_c *entry) {}
+void bx_instr_trace_entry(unsigned cpu, bxICacheEntry_c *entry) {}
+
 void bx_instr_inp(Bit16u addr, unsigned len) {}
 void bx_instr_inp2(Bit16u addr, unsigned len, unsigned val) {}
 void bx_instr_outp(Bit16u addr, unsigned len, unsigned val) {}
@@ -22,6 +22,7 @@
 #if BX_INSTRUMENTATION
 
 class bxInstruction_c;
+struct bxICacheEntry_c;
 
 // define if you want to store instruction opcode bytes in bxInstruction_c
 //#define BX_INSTR_STORE_OPCODE_BYTES
@@ -60,6 +61,9 @@ void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i);
 void bx_instr_after_execution(unsigned cpu, bxInstruction_c *i);
 void bx_instr_repeat_iteration(unsigned cpu, bxInstruction_c *i);
 
+void bx_instr_trace_decoded(unsigned cpu, bxICacheEntry_c *entry);
+void bx_instr_trace_entry(unsigned cpu, bxICacheEntry_c *entry);
+
 void bx_instr_inp(Bit16u addr, unsigned len);
 void bx_instr_inp2(Bit16u addr, unsigned len, unsigned val);
 void bx_instr_outp(Bit16u addr, unsigned len, unsigned val);
@@ -118,6 +122,11 @@ void bx_instr_vmexit(unsigned cpu, Bit32u reason, Bit64u qualification);
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)   bx_instr_after_execution(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)  bx_instr_repeat_iteration(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry) bx_instr_trace_decoded(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)   bx_instr_trace_entry(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      1
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)  bx_instr_lin_access(cpu_id, lin, phy, len, memtype, rw)
 
@@ -186,6 +195,11 @@ void bx_instr_vmexit(unsigned cpu, Bit32u reason, Bit64u qualification);
 #define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
 #define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
 
+/* trace decoded and trace entered */
+#define BX_INSTR_TRACE_DECODED(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY(cpu_id, entry)
+#define BX_INSTR_TRACE_ENTRY_ENABLED()      0
+
 /* linear memory access */
 #define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, memtype, rw)
 
@@ -30,6 +30,7 @@
 #include "iodev/sound/soundmod.h"
 #include "iodev/network/netmod.h"
 #include "iodev/usb/usb_common.h"
+#include "replay.h"
 
 #define LOG_THIS bx_devices.
 
@@ -54,6 +55,8 @@ bx_devices_c::bx_devices_c()
   io_read_handlers.handler_name = NULL;
   io_write_handlers.next = NULL;
   io_write_handlers.handler_name = NULL;
+  io_read_block_handlers = NULL;
+  io_write_block_handlers = NULL;
   init_stubs();
 
   for (unsigned i=0; i < BX_MAX_IRQS; i++) {
@@ -309,11 +312,6 @@ void bx_devices_c::init(BX_MEM_C *newmem)
       (unsigned) BX_IODEV_HANDLER_PERIOD, 1, 1, "devices.cc");
   }
 
-  // Clear fields for bulk IO acceleration transfers.
-  bulkIOHostAddr = 0;
-  bulkIOQuantumsRequested = 0;
-  bulkIOQuantumsTransferred = 0;
-
   bx_init_plugins();
 
   /* now perform checksum of CMOS memory */
@@ -396,6 +394,19 @@ void bx_devices_c::exit()
     delete [] curr->handler_name;
     delete curr;
   }
+  struct io_block_handler_struct *io_block_handler;
+  while (io_read_block_handlers != NULL) {
+    io_block_handler = io_read_block_handlers;
+    io_read_block_handlers = io_block_handler->next;
+    delete [] io_block_handler->handler_name;
+    delete io_block_handler;
+  }
+  while (io_write_block_handlers != NULL) {
+    io_block_handler = io_write_block_handlers;
+    io_write_block_handlers = io_block_handler->next;
+    delete [] io_block_handler->handler_name;
+    delete io_block_handler;
+  }
 
   bx_virt_timer.setup();
   bx_slowdown_timer.exit();
@@ -568,8 +579,9 @@ void bx_devices_c::timer_handler(void *this_ptr)
 void bx_devices_c::timer()
 {
   SIM->periodic();
+  // host input is logged or taken from the replay log
   if (!bx_pc_system.kill_bochs_request)
-    bx_gui->handle_events();
+    bx_replay.handle_gui_events();
 }
 
 bx_bool bx_devices_c::register_irq(unsigned irq, const char *name)
@@ -875,6 +887,66 @@ bx_bool bx_devices_c::register_default_io_write_handler(void *this_ptr, bx_write
   return 1;
 }
 
+bx_bool bx_devices_c::register_io_read_block_handler(void *this_ptr, bx_read_block_handler_t f,
+                                                     Bit32u addr, const char *name, Bit8u mask)
+{
+  addr &= 0xffff;
+
+  if (!f)
+    return 0;
+
+  struct io_block_handler_struct *curr = io_read_block_handlers;
+  while (curr != NULL) {
+    if (curr->addr == addr) {
+      BX_ERROR(("IO block handler conflict(read) at IO address %Xh", (unsigned) addr));
+      BX_ERROR(("  conflicting devices: %s & %s", curr->handler_name, name));
+      return 0;
+    }
+    curr = curr->next;
+  }
+
+  curr = new struct io_block_handler_struct;
+  curr->funct = (void *)f;
+  curr->this_ptr = this_ptr;
+  curr->handler_name = new char[strlen(name)+1];
+  strcpy(curr->handler_name, name);
+  curr->addr = (Bit16u) addr;
+  curr->mask = mask;
+  curr->next = io_read_block_handlers;
+  io_read_block_handlers = curr;
+  return 1;
+}
+
+bx_bool bx_devices_c::register_io_write_block_handler(void *this_ptr, bx_write_block_handler_t f,
+                                                      Bit32u addr, const char *name, Bit8u mask)
+{
+  addr &= 0xffff;
+
+  if (!f)
+    return 0;
+
+  struct io_block_handler_struct *curr = io_write_block_handlers;
+  while (curr != NULL) {
+    if (curr->addr == addr) {
+      BX_ERROR(("IO block handler conflict(write) at IO address %Xh", (unsigned) addr));
+      BX_ERROR(("  conflicting devices: %s & %s", curr->handler_name, name));
+      return 0;
+    }
+    curr = curr->next;
+  }
+
+  curr = new struct io_block_handler_struct;
+  curr->funct = (void *)f;
+  curr->this_ptr = this_ptr;
+  curr->handler_name = new char[strlen(name)+1];
+  strcpy(curr->handler_name, name);
+  curr->addr = (Bit16u) addr;
+  curr->mask = mask;
+  curr->next = io_write_block_handlers;
+  io_write_block_handlers = curr;
+  return 1;
+}
+
 bx_bool bx_devices_c::unregister_io_read_handler(void *this_ptr, bx_read_handler_t f,
                                          Bit32u addr, Bit8u mask)
 {
@@ -1006,7 +1078,9 @@ bx_devices_c::inp(Bit16u addr, unsigned io_len)
 
   io_read_handler = read_port_to_handler[addr];
   if (io_read_handler->mask & io_len) {
+    BX_LOCK_DEVICES();
     ret = ((bx_read_handler_t)io_read_handler->funct)(io_read_handler->this_ptr, (Bit32u)addr, io_len);
+    BX_UNLOCK_DEVICES();
   } else {
     switch (io_len) {
       case 1: ret = 0xff; break;
@@ -1039,12 +1113,102 @@ bx_devices_c::outp(Bit16u addr, Bit32u value, unsigned io_len)
 
   io_write_handler = write_port_to_handler[addr];
   if (io_write_handler->mask & io_len) {
+    BX_LOCK_DEVICES();
     ((bx_write_handler_t)io_write_handler->funct)(io_write_handler->this_ptr, (Bit32u)addr, value, io_len);
+    BX_UNLOCK_DEVICES();
   } else if (addr != 0x0cf8) { // don't flood the logfile when probing PCI
     BX_ERROR(("write to port 0x%04x with len %d ignored", addr, io_len));
   }
 }
 
+#if BX_INSTRUMENTATION || BX_DEBUGGER
+/*
+ * Report the quantums of a block transfer one by one, like inp() and
+ * outp() do for each single access.
+ */
+
+static void report_io_block(Bit16u addr, unsigned io_len, unsigned rw, const Bit8u *data, Bit32u count)
+{
+  for (Bit32u n = 0; n < count; n++, data += io_len) {
+    Bit32u value;
+    switch (io_len) {
+      case 1: value = *data; break;
+      case 2: { Bit16u val16; ReadHostWordFromLittleEndian(data, val16); value = val16; break; }
+      default: ReadHostDWordFromLittleEndian(data, value); break;
+    }
+    if (rw == BX_READ) {
+      BX_INSTR_INP(addr, io_len);
+      BX_INSTR_INP2(addr, io_len, value);
+    } else {
+      BX_INSTR_OUTP(addr, io_len, value);
+    }
+    BX_DBG_IO_REPORT(addr, io_len, rw, value);
+  }
+}
+#endif
+
+/*
+ * Transfer a block of 'count' quantums of 'io_len' bytes from an IO port
+ * into a host buffer. Returns the number of quantums transferred, which is
+ * 0 if the port has no block handler or the device could not take the fast
+ * path in its current state. The caller must then fall back to inp().
+ */
+
+Bit32u bx_devices_c::inp_block(Bit16u addr, unsigned io_len, Bit8u *data, Bit32u count)
+{
+  struct io_block_handler_struct *io_block_handler = io_read_block_handlers;
+  Bit32u ret = 0;
+
+  while (io_block_handler != NULL) {
+    if (io_block_handler->addr == addr) {
+      if (io_block_handler->mask & io_len) {
+        BX_LOCK_DEVICES();
+        ret = ((bx_read_block_handler_t)io_block_handler->funct)(io_block_handler->this_ptr,
+                (Bit32u)addr, io_len, data, count);
+        BX_UNLOCK_DEVICES();
+#if BX_INSTRUMENTATION || BX_DEBUGGER
+        report_io_block(addr, io_len, BX_READ, data, ret);
+#endif
+      }
+      break;
+    }
+    io_block_handler = io_block_handler->next;
+  }
+
+  return ret;
+}
+
+/*
+ * Transfer a block of 'count' quantums of 'io_len' bytes from a host buffer
+ * to an IO port. Same return convention as inp_block().
+ */
+
+Bit32u bx_devices_c::outp_block(Bit16u addr, unsigned io_len, const Bit8u *data, Bit32u count)
+{
+  struct io_block_handler_struct *io_block_handler = io_write_block_handlers;
+  Bit32u ret = 0;
+
+  while (io_block_handler != NULL) {
+    if (io_block_handler->addr == addr) {
+      if (io_block_handler->mask & io_len) {
+        BX_LOCK_DEVICES();
+        ret = ((bx_write_block_handler_t)io_block_handler->funct)(io_block_handler->this_ptr,
+                (Bit32u)addr, io_len, data, count);
+        BX_UNLOCK_DEVICES();
+        // reported after the transfer, a device refusing the block gets
+        // the quantums again through outp()
+#if BX_INSTRUMENTATION || BX_DEBUGGER
+        report_io_block(addr, io_len, BX_WRITE, data, ret);
+#endif
+      }
+      break;
+    }
+    io_block_handler = io_block_handler->next;
+  }
+
+  return ret;
+}
+
 bx_bool bx_devices_c::is_harddrv_enabled(void)
 {
   char pname[24];
@@ -1139,6 +1303,9 @@ void bx_devices_c::gen_scancode(Bit32u key)
 {
   bx_bool ret = 0;
 
+  if (!bx_replay.key_event(key))
+    return;
+
   bx_keyboard.bxkey_state[key & 0xff] = ((key & BX_KEY_RELEASED) == 0);
   if (bx_keyboard.dev != NULL) {
     ret = bx_keyboard.gen_scancode(bx_keyboard.dev, key);
@@ -1161,6 +1328,9 @@ void bx_devices_c::release_keys()
 // common mouse device handlers
 void bx_devices_c::mouse_enabled_changed(bx_bool enabled)
 {
+  if (!bx_replay.mouse_enable_event(enabled))
+    return;
+
   mouse_captured = enabled;
 
   if ((bx_mouse[1].dev != NULL) && (bx_mouse[1].enabled_changed != NULL)) {
@@ -1180,6 +1350,9 @@ void bx_devices_c::mouse_motion(int delta_x, int delta_y, int delta_z, unsigned
   if (!mouse_captured)
     return;
 
+  if (!bx_replay.mouse_event(delta_x, delta_y, delta_z, button_state, absxy))
+    return;
+
   // if a removable mouse is connected, redirect mouse data to the device
   if (bx_mouse[1].dev != NULL) {
     bx_mouse[1].enq_event(bx_mouse[1].dev, delta_x, delta_y, delta_z, button_state, absxy);
@@ -1274,7 +1447,8 @@ bx_bool bx_devices_c::register_pci_handlers(bx_pci_device_c *dev,
 }
 
 bx_bool bx_devices_c::pci_set_base_mem(void *this_ptr, memory_handler_t f1, memory_handler_t f2,
-                                       Bit32u *addr, Bit8u *pci_conf, unsigned size)
+                                       Bit32u *addr, Bit8u *pci_conf, unsigned size,
+                                       memory_direct_access_handler_t f3)
 {
   Bit32u newbase;
 
@@ -1295,7 +1469,11 @@ bx_bool bx_devices_c::pci_set_base_mem(void *this_ptr, memory_handler_t f1, memo
       DEV_unregister_memory_handlers(this_ptr, oldbase, oldbase + size - 1);
     }
     if (newbase > 0) {
-      DEV_register_memory_handlers(this_ptr, f1, f2, newbase, newbase + size - 1);
+      mem->registerMemoryHandlers(this_ptr, f1, f2, f3, newbase, newbase + size - 1);
+    }
+    if (f3 != NULL) {
+      // the CPUs may hold host pointers to the old location in their TLB
+      bx_pc_system.MemoryMappingChanged();
     }
     *addr = newbase;
     return 1;
@@ -1374,13 +1552,14 @@ void bx_pci_device_c::init_bar_io(Bit8u num, Bit16u size, bx_read_handler_t rh,
 }
 
 void bx_pci_device_c::init_bar_mem(Bit8u num, Bit32u size, memory_handler_t rh,
-                                   memory_handler_t wh)
+                                   memory_handler_t wh, memory_direct_access_handler_t dah)
 {
   if (num < 6) {
     pci_bar[num].type = BX_PCI_BAR_TYPE_MEM;
     pci_bar[num].size = size;
     pci_bar[num].mem.rh = rh;
     pci_bar[num].mem.wh = wh;
+    pci_bar[num].mem.dah = dah;
   }
 }
 
@@ -1393,9 +1572,9 @@ void bx_pci_device_c::after_restore_pci_state(memory_handler_t mem_read_handler)
 {
   for (int i = 0; i < 6; i++) {
     if (pci_bar[i].type == BX_PCI_BAR_TYPE_MEM) {
-      if (DEV_pci_set_base_mem(this, pci_bar[i].mem.rh, pci_bar[i].mem.wh,
-                           &pci_bar[i].addr, &pci_conf[0x10 + i * 4],
-                           pci_bar[i].size)) {
+      if (DEV_pci_set_base_mem2(this, pci_bar[i].mem.rh, pci_bar[i].mem.wh,
+                                &pci_bar[i].addr, &pci_conf[0x10 + i * 4],
+                                pci_bar[i].size, pci_bar[i].mem.dah)) {
         BX_INFO(("BAR #%d: mem base address = 0x%08x", i, pci_bar[i].addr));
         pci_bar_change_notify();
       }
@@ -1513,9 +1692,9 @@ void bx_pci_device_c::pci_write_handler_common(Bit8u address, Bit32u value, unsi
             pci_bar_change_notify();
           }
         } else {
-          if (DEV_pci_set_base_mem(this, pci_bar[bnum].mem.rh, pci_bar[bnum].mem.wh,
-                                   &pci_bar[bnum].addr, &pci_conf[0x10 + bnum * 4],
-                                   pci_bar[bnum].size)) {
+          if (DEV_pci_set_base_mem2(this, pci_bar[bnum].mem.rh, pci_bar[bnum].mem.wh,
+                                    &pci_bar[bnum].addr, &pci_conf[0x10 + bnum * 4],
+                                    pci_bar[bnum].size, pci_bar[bnum].mem.dah)) {
             BX_INFO(("BAR #%d: mem base address = 0x%08x", bnum, pci_bar[bnum].addr));
             pci_bar_change_notify();
           }
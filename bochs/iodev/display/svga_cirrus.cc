@@ -704,8 +704,7 @@ void bx_svga_cirrus_c::mem_write(bx_phy_address addr, Bit8u value)
         }
       }
       BX_CIRRUS_THIS svga_needs_update_tile = 1;
-      SET_TILE_UPDATED(BX_CIRRUS_THIS, ((offset % BX_CIRRUS_THIS svga_pitch) / (BX_CIRRUS_THIS svga_bpp / 8)) / X_TILESIZE,
-                       (offset / BX_CIRRUS_THIS svga_pitch) / Y_TILESIZE, 1);
+      SET_PAGE_DIRTY(BX_CIRRUS_THIS, offset);
       return;
     } else if ((addr >= BX_CIRRUS_THIS pci_bar[1].addr) &&
                (addr < (BX_CIRRUS_THIS pci_bar[1].addr + CIRRUS_PNPMMIO_SIZE))) {
@@ -758,8 +757,7 @@ void bx_svga_cirrus_c::mem_write(bx_phy_address addr, Bit8u value)
         }
       }
       BX_CIRRUS_THIS svga_needs_update_tile = 1;
-      SET_TILE_UPDATED(BX_CIRRUS_THIS, ((offset % BX_CIRRUS_THIS svga_pitch) / (BX_CIRRUS_THIS svga_bpp / 8)) / X_TILESIZE,
-                       (offset / BX_CIRRUS_THIS svga_pitch) / Y_TILESIZE, 1);
+      SET_PAGE_DIRTY(BX_CIRRUS_THIS, offset);
     }
   } else if (addr >= 0xB8000 && addr < 0xB8100) {
     // memory-mapped I/O.
@@ -1186,12 +1184,15 @@ void bx_svga_cirrus_c::update(void)
     return;
   }
   BX_CIRRUS_THIS svga_needs_update_tile = 0;
+  BX_CIRRUS_THIS update_dirty_pages((Bit32u)(BX_CIRRUS_THIS disp_ptr - BX_CIRRUS_THIS s.memory),
+                                    pitch, (BX_CIRRUS_THIS svga_bpp + 7) >> 3, width, height,
+                                    BX_CIRRUS_THIS s.y_doublescan);
 
   unsigned xc, yc, xti, yti;
   unsigned r, c, w, h;
   int i;
   Bit8u red, green, blue;
-  Bit32u colour;
+  Bit32u colour, host_colour[256];
   Bit8u * vid_ptr, * vid_ptr2;
   Bit8u * tile_ptr, * tile_ptr2;
   bx_svga_tileinfo_t info;
@@ -1260,6 +1261,13 @@ void bx_svga_cirrus_c::update(void)
           BX_ERROR(("cannot draw 4bpp SVGA"));
           break;
         case 8:
+          // convert the palette to the host pixel format once
+          for (c=0; c<256; c++) {
+            host_colour[c] = MAKE_COLOUR(
+              BX_CIRRUS_THIS s.pel.data[c].red, 6, info.red_shift, info.red_mask,
+              BX_CIRRUS_THIS s.pel.data[c].green, 6, info.green_shift, info.green_mask,
+              BX_CIRRUS_THIS s.pel.data[c].blue, 6, info.blue_shift, info.blue_mask);
+          }
           for (yc=0, yti = 0; yc<height; yc+=Y_TILESIZE, yti++) {
             for (xc=0, xti = 0; xc<width; xc+=X_TILESIZE, xti++) {
               if (GET_TILE_UPDATED (xti, yti)) {
@@ -1273,11 +1281,7 @@ void bx_svga_cirrus_c::update(void)
                   vid_ptr2  = vid_ptr;
                   tile_ptr2 = tile_ptr;
                   for (c=0; c<w; c++) {
-                    colour = *(vid_ptr2++);
-                    colour = MAKE_COLOUR(
-                      BX_CIRRUS_THIS s.pel.data[colour].red, 6, info.red_shift, info.red_mask,
-                      BX_CIRRUS_THIS s.pel.data[colour].green, 6, info.green_shift, info.green_mask,
-                      BX_CIRRUS_THIS s.pel.data[colour].blue, 6, info.blue_shift, info.blue_mask);
+                    colour = host_colour[*(vid_ptr2++)];
                     if (info.is_little_endian) {
                       for (i=0; i<info.bpp; i+=8) {
                         *(tile_ptr2++) = colour >> i;
@@ -333,6 +333,7 @@ void bx_vga_c::update(void)
       unsigned r, c, w, h;
       int i;
       unsigned long red, green, blue, colour;
+      Bit32u host_colour[256];
       Bit8u * vid_ptr, * vid_ptr2;
       Bit8u * tile_ptr, * tile_ptr2;
       bx_svga_tileinfo_t info;
@@ -342,6 +343,8 @@ void bx_vga_c::update(void)
       iHeight=BX_VGA_THIS vbe.yres;
       pitch = BX_VGA_THIS s.line_offset;
       Bit8u *disp_ptr = &BX_VGA_THIS s.memory[BX_VGA_THIS vbe.virtual_start];
+      BX_VGA_THIS update_dirty_pages(BX_VGA_THIS vbe.virtual_start, pitch,
+                                     BX_VGA_THIS vbe.bpp_multiplier, iWidth, iHeight, 0);
 
       if (bx_gui->graphics_tile_info_common(&info)) {
         if (info.snapshot_mode) {
@@ -403,6 +406,13 @@ void bx_vga_c::update(void)
               BX_ERROR(("cannot draw 4bpp SVGA"));
               break;
             case 8:
+              // convert the palette to the host pixel format once
+              for (c=0; c<256; c++) {
+                host_colour[c] = MAKE_COLOUR(
+                  BX_VGA_THIS s.pel.data[c].red, dac_size, info.red_shift, info.red_mask,
+                  BX_VGA_THIS s.pel.data[c].green, dac_size, info.green_shift, info.green_mask,
+                  BX_VGA_THIS s.pel.data[c].blue, dac_size, info.blue_shift, info.blue_mask);
+              }
               for (yc=0, yti = 0; yc<iHeight; yc+=Y_TILESIZE, yti++) {
                 for (xc=0, xti = 0; xc<iWidth; xc+=X_TILESIZE, xti++) {
                   if (GET_TILE_UPDATED (xti, yti)) {
@@ -412,11 +422,7 @@ void bx_vga_c::update(void)
                       vid_ptr2  = vid_ptr;
                       tile_ptr2 = tile_ptr;
                       for (c=0; c<w; c++) {
-                        colour = *(vid_ptr2++);
-                        colour = MAKE_COLOUR(
-                          BX_VGA_THIS s.pel.data[colour].red, dac_size, info.red_shift, info.red_mask,
-                          BX_VGA_THIS s.pel.data[colour].green, dac_size, info.green_shift, info.green_mask,
-                          BX_VGA_THIS s.pel.data[colour].blue, dac_size, info.blue_shift, info.blue_mask);
+                        colour = host_colour[*(vid_ptr2++)];
                         if (info.is_little_endian) {
                           for (i=0; i<info.bpp; i+=8) {
                             *(tile_ptr2++) = (Bit8u)(colour >> i);
@@ -770,7 +776,6 @@ bx_vga_c::vbe_mem_read(bx_phy_address addr)
 bx_vga_c::vbe_mem_write(bx_phy_address addr, Bit8u value)
 {
   Bit32u offset;
-  unsigned x_tileno, y_tileno;
 
   if (BX_VGA_THIS vbe.lfb_enabled)
   {
@@ -799,6 +804,11 @@ bx_vga_c::vbe_mem_write(bx_phy_address addr, Bit8u value)
   if (offset < VBE_DISPI_TOTAL_VIDEO_MEMORY_BYTES)
   {
     BX_VGA_THIS s.memory[offset]=value;
+    // update() converts the dirty pages into tile updates
+    SET_PAGE_DIRTY(BX_VGA_THIS, offset);
+    // only update the UI when writing 'onscreen'
+    if ((offset - BX_VGA_THIS vbe.virtual_start) < BX_VGA_THIS vbe.visible_screen_size)
+      BX_VGA_THIS s.vga_mem_updated = 1;
   }
   else
   {
@@ -810,21 +820,6 @@ bx_vga_c::vbe_mem_write(bx_phy_address addr, Bit8u value)
       BX_INFO(("VBE_mem_write out of video memory write at %x",offset));
     }
   }
-
-  offset-=BX_VGA_THIS vbe.virtual_start;
-
-  // only update the UI when writing 'onscreen'
-  if (offset < BX_VGA_THIS vbe.visible_screen_size)
-  {
-    y_tileno = ((offset / BX_VGA_THIS vbe.bpp_multiplier) / BX_VGA_THIS vbe.virtual_xres) / Y_TILESIZE;
-    x_tileno = ((offset / BX_VGA_THIS vbe.bpp_multiplier) % BX_VGA_THIS vbe.virtual_xres) / X_TILESIZE;
-
-    if ((y_tileno < BX_VGA_THIS s.num_y_tiles) && (x_tileno < BX_VGA_THIS s.num_x_tiles))
-    {
-      BX_VGA_THIS s.vga_mem_updated = 1;
-      SET_TILE_UPDATED(BX_VGA_THIS, x_tileno, y_tileno, 1);
-    }
-  }
 }
 
 Bit32u bx_vga_c::vbe_read_handler(void *this_ptr, Bit32u address, unsigned io_len)
@@ -78,6 +78,10 @@ bx_vgacore_c::~bx_vgacore_c()
     delete [] s.vga_tile_updated;
     s.vga_tile_updated = NULL;
   }
+  if (s.vga_page_dirty != NULL) {
+    delete [] s.vga_page_dirty;
+    s.vga_page_dirty = NULL;
+  }
   SIM->get_param_num(BXPN_VGA_UPDATE_FREQUENCY)->set_handler(NULL);
 }
 
@@ -106,6 +110,9 @@ void bx_vgacore_c::init(void)
   for (y = 0; y < BX_VGA_THIS s.num_y_tiles; y++)
     for (x = 0; x < BX_VGA_THIS s.num_x_tiles; x++)
       SET_TILE_UPDATED(BX_VGA_THIS, x, y, 0);
+  x = (BX_VGA_THIS s.memsize >> (VGA_PAGE_SHIFT + 5)) + 1;
+  BX_VGA_THIS s.vga_page_dirty = new Bit32u[x];
+  memset(BX_VGA_THIS s.vga_page_dirty, 0, x * sizeof(Bit32u));
 
   if (!BX_VGA_THIS pci_enabled) {
     BX_MEM(0)->load_ROM(SIM->get_param_string(BXPN_VGA_ROM_PATH)->getptr(), 0xc0000, 1);
@@ -241,12 +248,18 @@ void bx_vgacore_c::init_iohandlers(bx_read_handler_t f_read, bx_write_handler_t
 void bx_vgacore_c::init_systemtimer(void)
 {
   BX_VGA_THIS update_realtime = SIM->get_param_bool(BXPN_VGA_REALTIME)->get();
+  BX_VGA_THIS headless = SIM->get_param_bool(BXPN_VGA_HEADLESS)->get();
   bx_param_num_c *vga_update_freq = SIM->get_param_num(BXPN_VGA_UPDATE_FREQUENCY);
   Bit32u update_interval = (Bit32u)(1000000 / vga_update_freq->get());
-  BX_INFO(("interval=%u, mode=%s", update_interval, BX_VGA_THIS update_realtime ? "realtime":"standard"));
+  if (BX_VGA_THIS headless) {
+    BX_INFO(("headless mode: display updates on demand only"));
+  } else {
+    BX_INFO(("interval=%u, mode=%s", update_interval, BX_VGA_THIS update_realtime ? "realtime":"standard"));
+  }
   if (BX_VGA_THIS timer_id == BX_NULL_TIMER_HANDLE) {
+    // in headless mode the timer stays inactive
     BX_VGA_THIS timer_id = bx_virt_timer.register_timer(this, vga_timer_handler,
-       update_interval, 1, 1, BX_VGA_THIS update_realtime, "vga");
+       update_interval, 1, !BX_VGA_THIS headless, BX_VGA_THIS update_realtime, "vga");
     vga_update_freq->set_handler(vga_param_handler);
     vga_update_freq->set_device_param(this);
   }
@@ -371,8 +384,10 @@ void bx_vgacore_c::after_restore_state(void)
     BX_VGA_THIS s.last_yres = BX_VGA_THIS s.max_yres;
     BX_VGA_THIS vga_redraw_area(0, 0, BX_VGA_THIS s.max_xres, BX_VGA_THIS s.max_yres);
   }
-  BX_VGA_THIS update();
-  bx_gui->flush();
+  if (!BX_VGA_THIS headless) {
+    BX_VGA_THIS update();
+    bx_gui->flush();
+  }
 }
 
 void bx_vgacore_c::determine_screen_dimensions(unsigned *piHeight, unsigned *piWidth)
@@ -1742,6 +1757,53 @@ void bx_vgacore_c::update(void)
   }
 }
 
+// Convert the video memory pages written since the last call into tile
+// updates for a linear framebuffer at 'start' and clear their dirty bits.
+void bx_vgacore_c::update_dirty_pages(Bit32u start, unsigned pitch, unsigned bytespp,
+                                      unsigned xres, unsigned yres, bx_bool doublescan)
+{
+  unsigned i, b, nwords, xti, yti, x0, x1, y0, y1;
+  Bit32u bits, p0, p1, end;
+
+  nwords = (BX_VGA_THIS s.memsize >> (VGA_PAGE_SHIFT + 5)) + 1;
+  if (doublescan) yres >>= 1;
+  end = start + pitch * yres;
+  for (i = 0; i < nwords; i++) {
+    bits = BX_VGA_THIS s.vga_page_dirty[i];
+    if (bits == 0) continue;
+    BX_VGA_THIS s.vga_page_dirty[i] = 0;
+    if ((pitch == 0) || (bytespp == 0)) continue;
+    for (b = 0; b < 32; b++) {
+      if ((bits & (1u << b)) == 0) continue;
+      p0 = ((i << 5) + b) << VGA_PAGE_SHIFT;
+      p1 = p0 + (1 << VGA_PAGE_SHIFT) - 1;
+      if ((p1 < start) || (p0 >= end)) continue;
+      if (p0 < start) p0 = start;
+      if (p1 >= end) p1 = end - 1;
+      y0 = (p0 - start) / pitch;
+      y1 = (p1 - start) / pitch;
+      if (y0 == y1) {
+        x0 = ((p0 - start) % pitch) / bytespp;
+        x1 = ((p1 - start) % pitch) / bytespp;
+        if (x0 >= xres) continue;
+        if (x1 >= xres) x1 = xres - 1;
+      } else {
+        x0 = 0;
+        x1 = xres - 1;
+      }
+      if (doublescan) {
+        y0 <<= 1;
+        y1 = (y1 << 1) + 1;
+      }
+      for (yti = y0 / Y_TILESIZE; yti <= y1 / Y_TILESIZE; yti++) {
+        for (xti = x0 / X_TILESIZE; xti <= x1 / X_TILESIZE; xti++) {
+          SET_TILE_UPDATED(BX_VGA_THIS, xti, yti, 1);
+        }
+      }
+    }
+  }
+}
+
 bx_bool bx_vgacore_c::mem_read_handler(bx_phy_address addr, unsigned len, void *data, void *param)
 {
   bx_vgacore_c *class_ptr = (bx_vgacore_c *) param;
@@ -1889,6 +1951,7 @@ void bx_vgacore_c::mem_write(bx_phy_address addr, Bit8u value)
 
       /* CGA 320x200x4 / 640x200x2 start */
       BX_VGA_THIS s.memory[offset] = value;
+      if (BX_VGA_THIS headless) return;
       offset -= start_addr;
       if (offset>=0x2000) {
         y_tileno = offset - 0x2000;
@@ -1942,7 +2005,7 @@ void bx_vgacore_c::mem_write(bx_phy_address addr, Bit8u value)
 
       // 320 x 200 256 color mode: chained pixel representation
       BX_VGA_THIS s.memory[(offset & ~0x03) + (offset % 4)*65536] = value;
-      if (BX_VGA_THIS s.line_offset > 0) {
+      if ((BX_VGA_THIS s.line_offset > 0) && !BX_VGA_THIS headless) {
         offset -= start_addr;
         x_tileno = (offset % BX_VGA_THIS s.line_offset) / (X_TILESIZE/2);
         if (BX_VGA_THIS s.y_doublescan) {
@@ -2222,6 +2285,9 @@ void bx_vgacore_c::mem_write(bx_phy_address addr, Bit8u value)
     if (BX_VGA_THIS s.sequencer.map_mask & 0x08)
       plane3[offset] = new_val[3];
 
+    // the screen is redrawn completely on demand
+    if (BX_VGA_THIS headless) return;
+
     unsigned x_tileno, y_tileno;
 
     if (BX_VGA_THIS s.graphics_ctrl.shift_reg == 2) {
@@ -2280,6 +2346,16 @@ void bx_vgacore_c::get_text_snapshot(Bit8u **text_snapshot, unsigned *txHeight,
     MSL = BX_VGA_THIS s.CRTC.reg[0x09] & 0x1f;
     *txHeight = (VDE+1)/(MSL+1);
     *txWidth = BX_VGA_THIS s.CRTC.reg[1] + 1;
+    if (BX_VGA_THIS headless) {
+      // the text snapshot is not maintained by update(), so take it from
+      // the current VGA memory contents
+      unsigned start_address = 2*((BX_VGA_THIS s.CRTC.reg[12] << 8) +
+                               BX_VGA_THIS s.CRTC.reg[13]);
+      unsigned len = (BX_VGA_THIS s.CRTC.reg[0x13] << 2) * (*txHeight);
+      if (len > sizeof(BX_VGA_THIS s.text_snapshot))
+        len = sizeof(BX_VGA_THIS s.text_snapshot);
+      memcpy(BX_VGA_THIS s.text_snapshot, &BX_VGA_THIS s.memory[start_address], len);
+    }
   } else {
     *txHeight = 0;
     *txWidth = 0;
@@ -2441,8 +2517,10 @@ Bit64s bx_vgacore_c::vga_param_handler(bx_param_c *param, int set, Bit64s val)
     Bit32u update_interval = (Bit32u)(1000000 / val);
     bx_vgacore_c *vgadev = (bx_vgacore_c *)param->get_device_param();
     BX_INFO(("Changing timer interval to %d", update_interval));
-    vga_timer_handler(vgadev);
-    bx_virt_timer.activate_timer(vgadev->timer_id, update_interval, 1);
+    if (!vgadev->headless) {
+      vga_timer_handler(vgadev);
+      bx_virt_timer.activate_timer(vgadev->timer_id, update_interval, 1);
+    }
     if (update_interval < 266666) {
       vgadev->s.blink_counter = 266666 / (unsigned)update_interval;
     } else {
@@ -53,6 +53,16 @@
       thisp s.vga_tile_updated[(xtile)+(ytile)* thisp s.num_x_tiles] = value; \
   } while (0)
 
+// Linear framebuffer writes only mark the 4K page of video memory they
+// touch. The caller must make sure that the offset is within the memory.
+// update_dirty_pages() turns the dirty pages into tile updates.
+#define VGA_PAGE_SHIFT 12
+#define SET_PAGE_DIRTY(thisp, offset)                                         \
+  do {                                                                        \
+    thisp s.vga_page_dirty[(offset) >> (VGA_PAGE_SHIFT + 5)] |=               \
+      (1u << (((offset) >> VGA_PAGE_SHIFT) & 0x1f));                          \
+  } while (0)
+
 // Only reference the array if the tile numbers are within the bounds
 // of the array.  If out of bounds, return 0.
 #define GET_TILE_UPDATED(xtile,ytile)                        \
@@ -123,6 +133,8 @@ protected:
   void determine_screen_dimensions(unsigned *piHeight, unsigned *piWidth);
   void calculate_retrace_timing(void);
   bx_bool skip_update(void);
+  void update_dirty_pages(Bit32u start, unsigned pitch, unsigned bytespp,
+                          unsigned xres, unsigned yres, bx_bool doublescan);
 
   struct {
     struct {
@@ -225,6 +237,7 @@ protected:
     unsigned vertical_display_end;
     unsigned blink_counter;
     bx_bool  *vga_tile_updated;
+    Bit32u *vga_page_dirty;
     Bit8u *memory;
     Bit32u memsize;
     Bit8u text_snapshot[128 * 1024]; // current text snapshot
@@ -265,6 +278,7 @@ protected:
 
   int timer_id;
   bx_bool update_realtime;
+  bx_bool headless;
   bx_bool vsync_realtime;
   bx_param_string_c *vgaext;
   bx_bool pci_enabled;
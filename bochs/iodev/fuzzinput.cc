@@ -0,0 +1,518 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// PCI fuzz input device
+//
+// The test case buffer lives in a host shared memory object that an external
+// fuzzing harness maps as well. The harness writes the next case into the
+// buffer, stores its length in the control page and bumps 'case_seq'. The
+// guest agent maps BAR #1 to read the case directly, and rings the doorbell
+// in BAR #0 once it is done with it. No disk image or guest page table is
+// touched on the host side for each case.
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#include "iodev.h"
+#if BX_SUPPORT_PCI && BX_SUPPORT_FUZZINPUT
+
+#include "pci.h"
+#include "fuzzinput.h"
+
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
+#define LOG_THIS theFuzzInputDevice->
+
+bx_fuzzinput_c* theFuzzInputDevice = NULL;
+
+// builtin configuration handling functions
+
+void fuzzinput_init_options(void)
+{
+  bx_param_c *pci = SIM->get_param("pci");
+  bx_list_c *menu = new bx_list_c(pci, "fuzzinput", "Fuzz Input Device");
+  menu->set_options(menu->SHOW_PARENT);
+
+  bx_param_bool_c *enabled = new bx_param_bool_c(menu,
+    "enabled",
+    "Enable fuzz input device",
+    "Enables the PCI fuzz input device",
+    0);
+  new bx_param_string_c(menu,
+    "buffer",
+    "Shared memory name",
+#ifdef WIN32
+    "Name of the file mapping object holding the test case buffer",
+    "Local\\bochs_fuzzinput",
+#else
+    "Path of the shared memory file holding the test case buffer",
+    "/dev/shm/bochs_fuzzinput",
+#endif
+    BX_PATHNAME_LEN);
+  new bx_param_num_c(menu,
+    "size",
+    "Buffer size (KB)",
+    "Size of the test case buffer in kilobytes (rounded up to a power of 2)",
+    4, 256 * 1024,
+    1024);
+  new bx_param_num_c(menu,
+    "poll",
+    "Poll interval (usec)",
+    "Interval for checking the control page for new test cases (0 = on register access only)",
+    0, 1000000,
+    1000);
+  enabled->set_dependent_list(menu->clone());
+}
+
+Bit32s fuzzinput_options_parser(const char *context, int num_params, char *params[])
+{
+  if (!strcmp(params[0], "fuzzinput")) {
+    bx_list_c *base = (bx_list_c*) SIM->get_param(BXPN_FUZZINPUT);
+    for (int i = 1; i < num_params; i++) {
+      if (SIM->parse_param_from_list(context, params[i], base) < 0) {
+        BX_ERROR(("%s: unknown parameter for fuzzinput ignored.", context));
+      }
+    }
+  } else {
+    BX_PANIC(("%s: unknown directive '%s'", context, params[0]));
+  }
+  return 0;
+}
+
+Bit32s fuzzinput_options_save(FILE *fp)
+{
+  return SIM->write_param_list(fp, (bx_list_c*) SIM->get_param(BXPN_FUZZINPUT), NULL, 0);
+}
+
+// device plugin entry points
+
+int CDECL libfuzzinput_LTX_plugin_init(plugin_t *plugin, plugintype_t type)
+{
+  theFuzzInputDevice = new bx_fuzzinput_c();
+  BX_REGISTER_DEVICE_DEVMODEL(plugin, type, theFuzzInputDevice, BX_PLUGIN_FUZZINPUT);
+  // add new configuration parameter for the config interface
+  fuzzinput_init_options();
+  // register add-on option for bochsrc and command line
+  SIM->register_addon_option("fuzzinput", fuzzinput_options_parser, fuzzinput_options_save);
+  return 0; // Success
+}
+
+void CDECL libfuzzinput_LTX_plugin_fini(void)
+{
+  SIM->unregister_addon_option("fuzzinput");
+  bx_list_c *menu = (bx_list_c*)SIM->get_param("pci");
+  menu->remove("fuzzinput");
+  delete theFuzzInputDevice;
+}
+
+// the device object
+
+bx_fuzzinput_c::bx_fuzzinput_c()
+{
+  put("fuzzinput", "FUZZ");
+  memset(&s, 0, sizeof(bx_fuzz_t));
+  s.timer_index = BX_NULL_TIMER_HANDLE;
+  buffer_size = 0;
+  shm = NULL;
+  header = NULL;
+  buffer = NULL;
+#ifdef WIN32
+  shm_handle = NULL;
+#else
+  shm_fd = -1;
+#endif
+}
+
+bx_fuzzinput_c::~bx_fuzzinput_c()
+{
+  close_shm();
+  SIM->get_bochs_root()->remove("fuzzinput");
+  BX_DEBUG(("Exit"));
+}
+
+void bx_fuzzinput_c::init(void)
+{
+  // Read in values from config interface
+  bx_list_c *base = (bx_list_c*) SIM->get_param(BXPN_FUZZINPUT);
+  // Check if the device is disabled or not configured
+  if (!SIM->get_param_bool("enabled", base)->get()) {
+    BX_INFO(("Fuzz input device disabled"));
+    // mark unused plugin for removal
+    ((bx_param_bool_c*)((bx_list_c*)SIM->get_param(BXPN_PLUGIN_CTRL))->get_by_name("fuzzinput"))->set(0);
+    return;
+  }
+
+  // the buffer is a memory BAR, so its size must be a power of 2
+  Bit32u size = 0x1000;
+  while (size < ((Bit32u)SIM->get_param_num("size", base)->get() << 10)) {
+    size <<= 1;
+  }
+  const char *name = SIM->get_param_string("buffer", base)->getptr();
+  if (!BX_FUZZ_THIS open_shm(name, size)) {
+    BX_PANIC(("could not map fuzz input buffer '%s'", name));
+    return;
+  }
+
+  BX_FUZZ_THIS s.devfunc = 0x00;
+  DEV_register_pci_handlers(this, &BX_FUZZ_THIS s.devfunc, BX_PLUGIN_FUZZINPUT,
+                            "Fuzz input device");
+
+  // initialize readonly registers
+  init_pci_conf(FUZZ_PCI_VENDOR, FUZZ_PCI_DEVICE, 0x01, 0xff0000, 0x00, BX_PCI_INTA);
+
+  BX_FUZZ_THIS init_bar_mem(0, FUZZ_REG_BAR_SIZE, reg_read_handler, reg_write_handler);
+  BX_FUZZ_THIS init_bar_mem(1, BX_FUZZ_THIS buffer_size, buf_read_handler, buf_write_handler,
+                            buf_direct_handler);
+  BX_FUZZ_THIS pci_conf[0x14] = 0x08; // prefetchable
+
+  Bit32u poll = (Bit32u)SIM->get_param_num("poll", base)->get();
+  if ((poll > 0) && (BX_FUZZ_THIS s.timer_index == BX_NULL_TIMER_HANDLE)) {
+    BX_FUZZ_THIS s.timer_index = DEV_register_timer(BX_FUZZ_THIS_PTR,
+      fuzz_timer_handler, poll, 1, 1, "fuzzinput");
+  }
+
+  BX_INFO(("Fuzz input device initialized: buffer '%s', %u KB", name,
+           BX_FUZZ_THIS buffer_size >> 10));
+}
+
+void bx_fuzzinput_c::reset(unsigned type)
+{
+  unsigned i;
+
+  static const struct reset_vals_t {
+    unsigned      addr;
+    unsigned char val;
+  } reset_vals[] = {
+    { 0x04, 0x00 }, { 0x05, 0x00 }, // command
+    { 0x06, 0x00 }, { 0x07, 0x00 }, // status
+    { 0x3c, 0x00 },                 // IRQ
+  };
+  for (i = 0; i < sizeof(reset_vals) / sizeof(*reset_vals); ++i) {
+    BX_FUZZ_THIS pci_conf[reset_vals[i].addr] = reset_vals[i].val;
+  }
+
+  // a case published before reset is picked up again by the next poll
+  BX_FUZZ_THIS s.case_seq = BX_FUZZ_THIS header->done_seq;
+  BX_FUZZ_THIS s.case_len = 0;
+  BX_FUZZ_THIS s.status = 0;
+  BX_FUZZ_THIS s.irq_mask = 0;
+  BX_FUZZ_THIS s.result = 0;
+
+  // Deassert IRQ
+  set_irq_level(0);
+}
+
+void bx_fuzzinput_c::register_state(void)
+{
+  // the buffer itself belongs to the harness and is not saved
+  bx_list_c *list = new bx_list_c(SIM->get_bochs_root(), "fuzzinput", "Fuzz Input Device State");
+  BXRS_HEX_PARAM_FIELD(list, case_seq, BX_FUZZ_THIS s.case_seq);
+  BXRS_HEX_PARAM_FIELD(list, case_len, BX_FUZZ_THIS s.case_len);
+  BXRS_HEX_PARAM_FIELD(list, status, BX_FUZZ_THIS s.status);
+  BXRS_HEX_PARAM_FIELD(list, irq_mask, BX_FUZZ_THIS s.irq_mask);
+  BXRS_HEX_PARAM_FIELD(list, result, BX_FUZZ_THIS s.result);
+  register_pci_state(list);
+}
+
+void bx_fuzzinput_c::after_restore_state(void)
+{
+  bx_pci_device_c::after_restore_pci_state(NULL);
+  BX_FUZZ_THIS update_irq();
+}
+
+bx_bool bx_fuzzinput_c::open_shm(const char *name, Bit32u size)
+{
+  Bit32u total = FUZZ_SHM_HEADER_SIZE + size;
+
+#ifdef WIN32
+  // opens the mapping if the harness has already created it
+  BX_FUZZ_THIS shm_handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL,
+                              PAGE_READWRITE, 0, total, name);
+  if (BX_FUZZ_THIS shm_handle == NULL) {
+    BX_ERROR(("CreateFileMapping() failed: error %u", (unsigned)GetLastError()));
+    return 0;
+  }
+  BX_FUZZ_THIS shm = (Bit8u*)MapViewOfFile(BX_FUZZ_THIS shm_handle,
+                              FILE_MAP_ALL_ACCESS, 0, 0, total);
+  if (BX_FUZZ_THIS shm == NULL) {
+    BX_ERROR(("MapViewOfFile() failed: error %u", (unsigned)GetLastError()));
+    close_shm();
+    return 0;
+  }
+#else
+  struct stat stat_buf;
+
+  BX_FUZZ_THIS shm_fd = ::open(name, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+  if (BX_FUZZ_THIS shm_fd < 0) {
+    BX_ERROR(("open('%s') failed: %s", name, strerror(errno)));
+    return 0;
+  }
+  if ((fstat(BX_FUZZ_THIS shm_fd, &stat_buf) < 0) ||
+      (((Bit64u)stat_buf.st_size < total) && (ftruncate(BX_FUZZ_THIS shm_fd, total) < 0))) {
+    BX_ERROR(("cannot resize '%s' to %u bytes", name, total));
+    close_shm();
+    return 0;
+  }
+  void *ptr = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED,
+                   BX_FUZZ_THIS shm_fd, 0);
+  if (ptr == MAP_FAILED) {
+    BX_ERROR(("mmap('%s') failed: %s", name, strerror(errno)));
+    close_shm();
+    return 0;
+  }
+  BX_FUZZ_THIS shm = (Bit8u*)ptr;
+#endif
+
+  BX_FUZZ_THIS buffer_size = size;
+  BX_FUZZ_THIS header = (volatile fuzz_shm_header_t*)BX_FUZZ_THIS shm;
+  BX_FUZZ_THIS buffer = BX_FUZZ_THIS shm + FUZZ_SHM_HEADER_SIZE;
+  // keep the harness state if it has set up the control page already
+  if (BX_FUZZ_THIS header->magic != FUZZ_SHM_MAGIC) {
+    memset(BX_FUZZ_THIS shm, 0, FUZZ_SHM_HEADER_SIZE);
+    BX_FUZZ_THIS header->magic = FUZZ_SHM_MAGIC;
+  }
+  BX_FUZZ_THIS header->version = FUZZ_SHM_VERSION;
+  BX_FUZZ_THIS header->buffer_size = size;
+  return 1;
+}
+
+void bx_fuzzinput_c::close_shm(void)
+{
+#ifdef WIN32
+  if (BX_FUZZ_THIS shm != NULL) {
+    UnmapViewOfFile(BX_FUZZ_THIS shm);
+  }
+  if (BX_FUZZ_THIS shm_handle != NULL) {
+    CloseHandle(BX_FUZZ_THIS shm_handle);
+    BX_FUZZ_THIS shm_handle = NULL;
+  }
+#else
+  if (BX_FUZZ_THIS shm != NULL) {
+    munmap(BX_FUZZ_THIS shm, FUZZ_SHM_HEADER_SIZE + BX_FUZZ_THIS buffer_size);
+  }
+  if (BX_FUZZ_THIS shm_fd >= 0) {
+    ::close(BX_FUZZ_THIS shm_fd);
+    BX_FUZZ_THIS shm_fd = -1;
+  }
+#endif
+  BX_FUZZ_THIS shm = NULL;
+  BX_FUZZ_THIS header = NULL;
+  BX_FUZZ_THIS buffer = NULL;
+}
+
+// latch a newly published test case from the control page
+void bx_fuzzinput_c::poll_case(void)
+{
+  Bit32u seq = BX_FUZZ_THIS header->case_seq;
+
+  if ((seq != BX_FUZZ_THIS s.case_seq) && (seq != BX_FUZZ_THIS header->done_seq)) {
+    BX_FUZZ_THIS s.case_seq = seq;
+    BX_FUZZ_THIS s.case_len = BX_FUZZ_THIS header->case_len;
+    if (BX_FUZZ_THIS s.case_len > BX_FUZZ_THIS buffer_size) {
+      BX_ERROR(("test case length %u exceeds buffer size", BX_FUZZ_THIS s.case_len));
+      BX_FUZZ_THIS s.case_len = BX_FUZZ_THIS buffer_size;
+    }
+    BX_FUZZ_THIS s.status |= FUZZ_STATUS_CASE;
+    BX_FUZZ_THIS update_irq();
+  }
+}
+
+// the guest is done with the current case: report back and look for the next
+void bx_fuzzinput_c::doorbell(void)
+{
+  BX_FUZZ_THIS header->result = BX_FUZZ_THIS s.result;
+  BX_FUZZ_THIS header->done_seq = BX_FUZZ_THIS s.case_seq;
+  BX_FUZZ_THIS header->doorbells++;
+  BX_FUZZ_THIS s.case_len = 0;
+  BX_FUZZ_THIS s.status &= ~FUZZ_STATUS_CASE;
+  BX_FUZZ_THIS poll_case();
+  BX_FUZZ_THIS update_irq();
+}
+
+void bx_fuzzinput_c::update_irq(void)
+{
+  set_irq_level((BX_FUZZ_THIS s.status & BX_FUZZ_THIS s.irq_mask) != 0);
+}
+
+void bx_fuzzinput_c::set_irq_level(bx_bool level)
+{
+  DEV_pci_set_irq(BX_FUZZ_THIS s.devfunc, BX_FUZZ_THIS pci_conf[0x3d], level);
+}
+
+void bx_fuzzinput_c::fuzz_timer_handler(void *this_ptr)
+{
+  bx_fuzzinput_c *class_ptr = (bx_fuzzinput_c *) this_ptr;
+  class_ptr->poll_case();
+}
+
+bx_bool bx_fuzzinput_c::reg_read_handler(bx_phy_address addr, unsigned len,
+                                         void *data, void *param)
+{
+  Bit32u offset = (Bit32u)(addr & (FUZZ_REG_BAR_SIZE - 1));
+  Bit32u value = BX_FUZZ_THIS reg_read(offset & ~3) >> ((offset & 3) << 3);
+
+  switch (len) {
+    case 1:
+      *((Bit8u*)data) = (Bit8u)value;
+      break;
+    case 2:
+      *((Bit16u*)data) = (Bit16u)value;
+      break;
+    case 4:
+      *((Bit32u*)data) = value;
+      break;
+    default:
+      memset(data, 0, len);
+      *((Bit32u*)data) = value;
+  }
+  return 1;
+}
+
+bx_bool bx_fuzzinput_c::reg_write_handler(bx_phy_address addr, unsigned len,
+                                          void *data, void *param)
+{
+  Bit32u offset = (Bit32u)(addr & (FUZZ_REG_BAR_SIZE - 1));
+
+  if ((len != 4) || (offset & 3)) {
+    BX_ERROR(("unsupported register write: offset=0x%03x len=%u", offset, len));
+    return 1;
+  }
+  BX_FUZZ_THIS reg_write(offset, *((Bit32u*)data));
+  return 1;
+}
+
+Bit32u bx_fuzzinput_c::reg_read(Bit32u offset)
+{
+  switch (offset) {
+    case FUZZ_REG_ID:
+      return FUZZ_SHM_MAGIC;
+    case FUZZ_REG_SIZE:
+      return BX_FUZZ_THIS buffer_size;
+    case FUZZ_REG_LENGTH:
+      BX_FUZZ_THIS poll_case();
+      return BX_FUZZ_THIS s.case_len;
+    case FUZZ_REG_SEQ:
+      return BX_FUZZ_THIS s.case_seq;
+    case FUZZ_REG_STATUS:
+      BX_FUZZ_THIS poll_case();
+      return BX_FUZZ_THIS s.status;
+    case FUZZ_REG_IRQ_MASK:
+      return BX_FUZZ_THIS s.irq_mask;
+    case FUZZ_REG_RESULT:
+      return BX_FUZZ_THIS s.result;
+    default:
+      return 0;
+  }
+}
+
+void bx_fuzzinput_c::reg_write(Bit32u offset, Bit32u value)
+{
+  switch (offset) {
+    case FUZZ_REG_STATUS:
+      BX_FUZZ_THIS s.status &= ~value;
+      BX_FUZZ_THIS update_irq();
+      break;
+    case FUZZ_REG_IRQ_MASK:
+      BX_FUZZ_THIS s.irq_mask = value & FUZZ_STATUS_CASE;
+      BX_FUZZ_THIS update_irq();
+      break;
+    case FUZZ_REG_RESULT:
+      BX_FUZZ_THIS s.result = value;
+      break;
+    case FUZZ_REG_DOORBELL:
+      BX_FUZZ_THIS doorbell();
+      break;
+    default:
+      BX_DEBUG(("write to read-only register 0x%02x ignored", offset));
+  }
+}
+
+bx_bool bx_fuzzinput_c::buf_read_handler(bx_phy_address addr, unsigned len,
+                                         void *data, void *param)
+{
+  Bit32u offset = (Bit32u)(addr & (BX_FUZZ_THIS buffer_size - 1));
+
+  if ((offset + len) <= BX_FUZZ_THIS buffer_size) {
+    memcpy(data, BX_FUZZ_THIS buffer + offset, len);
+  } else {
+    memset(data, 0xff, len);
+  }
+  return 1;
+}
+
+bx_bool bx_fuzzinput_c::buf_write_handler(bx_phy_address addr, unsigned len,
+                                          void *data, void *param)
+{
+  Bit32u offset = (Bit32u)(addr & (BX_FUZZ_THIS buffer_size - 1));
+
+  // the guest may use the buffer for output as well
+  if ((offset + len) <= BX_FUZZ_THIS buffer_size) {
+    memcpy(BX_FUZZ_THIS buffer + offset, data, len);
+  }
+  return 1;
+}
+
+// The buffer is mapped into the guest address space like RAM, the CPU reads
+// it through its TLB without calling the handlers above. These are only used
+// for accesses that can't be done directly (e.g. crossing the BAR end).
+Bit8u* bx_fuzzinput_c::buf_direct_handler(bx_phy_address addr, unsigned rw, void *param)
+{
+  // the harness changes the buffer without invalidating decoded code
+  if (rw == BX_EXECUTE)
+    return NULL;
+
+  return BX_FUZZ_THIS buffer + (Bit32u)(addr & (BX_FUZZ_THIS buffer_size - 1));
+}
+
+// pci configuration space write callback handler
+void bx_fuzzinput_c::pci_write_handler(Bit8u address, Bit32u value, unsigned io_len)
+{
+  if ((address >= 0x10) && (address < 0x34))
+    return;
+
+  BX_DEBUG_PCI_WRITE(address, value, io_len);
+  for (unsigned i=0; i<io_len; i++) {
+    Bit8u value8 = (value >> (i*8)) & 0xFF;
+    switch (address+i) {
+      case 0x04:
+        value8 &= 0x06; // memory space and bus master only
+        BX_FUZZ_THIS pci_conf[address+i] = value8;
+        break;
+      case 0x05:
+        value8 &= 0x04; // interrupt disable
+        BX_FUZZ_THIS pci_conf[address+i] = value8;
+        break;
+      case 0x3d:
+      case 0x06:
+      case 0x07:
+        break;
+      default:
+        BX_FUZZ_THIS pci_conf[address+i] = value8;
+    }
+  }
+}
+
+#endif // BX_SUPPORT_PCI && BX_SUPPORT_FUZZINPUT
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_IODEV_FUZZINPUT_H
+#define BX_IODEV_FUZZINPUT_H
+
+#if BX_USE_FUZZINPUT_SMF
+#  define BX_FUZZ_SMF  static
+#  define BX_FUZZ_THIS theFuzzInputDevice->
+#  define BX_FUZZ_THIS_PTR theFuzzInputDevice
+#else
+#  define BX_FUZZ_SMF
+#  define BX_FUZZ_THIS this->
+#  define BX_FUZZ_THIS_PTR this
+#endif
+
+#define FUZZ_PCI_VENDOR  0x1234
+#define FUZZ_PCI_DEVICE  0xf022
+
+// Shared memory layout: a control page used by the harness and the device,
+// followed by the test case buffer that BAR #1 maps into the guest.
+#define FUZZ_SHM_MAGIC       0x5a5a5546  // "FUZZ"
+#define FUZZ_SHM_VERSION     1
+#define FUZZ_SHM_HEADER_SIZE 0x1000
+
+typedef struct {
+  Bit32u magic;
+  Bit32u version;
+  Bit32u buffer_size;  // size of the test case buffer (set by the device)
+  Bit32u case_seq;     // harness: bumped after a new test case has been written
+  Bit32u case_len;     // harness: length of the test case in bytes
+  Bit32u done_seq;     // device: case_seq of the last case the guest finished
+  Bit32u result;       // device: result code the guest reported for it
+  Bit32u doorbells;    // device: number of guest doorbell writes
+} fuzz_shm_header_t;
+
+// BAR #0 registers
+#define FUZZ_REG_ID         0x00  // r/o: FUZZ_SHM_MAGIC
+#define FUZZ_REG_SIZE       0x04  // r/o: test case buffer size
+#define FUZZ_REG_LENGTH     0x08  // r/o: length of the current test case
+#define FUZZ_REG_SEQ        0x0c  // r/o: sequence number of the current test case
+#define FUZZ_REG_STATUS     0x10  // r/w1c: pending events
+#define FUZZ_REG_IRQ_MASK   0x14  // r/w: events that raise INTA
+#define FUZZ_REG_RESULT     0x18  // r/w: result code passed on with the doorbell
+#define FUZZ_REG_DOORBELL   0x1c  // w/o: current case done, fetch the next one
+#define FUZZ_REG_BAR_SIZE   0x1000
+
+#define FUZZ_STATUS_CASE    0x01  // a new test case is available
+
+typedef struct {
+  Bit32u case_seq;     // latched from the control page
+  Bit32u case_len;
+  Bit32u status;
+  Bit32u irq_mask;
+  Bit32u result;
+  Bit8u  devfunc;
+  int    timer_index;
+} bx_fuzz_t;
+
+class bx_fuzzinput_c : public bx_pci_device_c {
+public:
+  bx_fuzzinput_c();
+  virtual ~bx_fuzzinput_c();
+  virtual void init(void);
+  virtual void reset(unsigned type);
+  virtual void register_state(void);
+  virtual void after_restore_state(void);
+
+  virtual void pci_write_handler(Bit8u address, Bit32u value, unsigned io_len);
+
+private:
+  bx_fuzz_t s;
+
+  Bit32u buffer_size;
+  Bit8u *shm;
+  volatile fuzz_shm_header_t *header;
+  Bit8u *buffer;
+#ifdef WIN32
+  HANDLE shm_handle;
+#else
+  int shm_fd;
+#endif
+
+  BX_FUZZ_SMF bx_bool open_shm(const char *name, Bit32u size);
+  BX_FUZZ_SMF void close_shm(void);
+  BX_FUZZ_SMF void poll_case(void);
+  BX_FUZZ_SMF void doorbell(void);
+  BX_FUZZ_SMF void update_irq(void);
+  BX_FUZZ_SMF void set_irq_level(bx_bool level);
+
+  static void fuzz_timer_handler(void *);
+
+  static bx_bool reg_read_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  static bx_bool reg_write_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  static bx_bool buf_read_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  static bx_bool buf_write_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  static Bit8u* buf_direct_handler(bx_phy_address addr, unsigned rw, void *param);
+  BX_FUZZ_SMF Bit32u reg_read(Bit32u offset);
+  BX_FUZZ_SMF void reg_write(Bit32u offset, Bit32u value);
+};
+
+#endif
@@ -218,6 +218,10 @@ void bx_hard_drive_c::init(void)
                            BX_HD_THIS channels[channel].ioaddr1, string, 6);
       DEV_register_iowrite_handler(this, write_handler,
                            BX_HD_THIS channels[channel].ioaddr1, string, 6);
+      DEV_register_ioread_block_handler(this, read_block_handler,
+                           BX_HD_THIS channels[channel].ioaddr1, string, 6);
+      DEV_register_iowrite_block_handler(this, write_block_handler,
+                           BX_HD_THIS channels[channel].ioaddr1, string, 6);
       for (unsigned addr=0x1; addr<=0x7; addr++) {
         DEV_register_ioread_handler(this, read_handler,
                              BX_HD_THIS channels[channel].ioaddr1+addr, string, 1);
@@ -824,24 +828,6 @@ Bit32u bx_hard_drive_c::read(Bit32u address, unsigned io_len)
           if (controller->buffer_index >= controller->buffer_size)
             BX_PANIC(("IO read(0x%04x): buffer_index >= %d", address, controller->buffer_size));
 
-#if BX_SUPPORT_REPEAT_SPEEDUPS
-          if (DEV_bulk_io_quantum_requested()) {
-            unsigned transferLen, quantumsMax;
-            quantumsMax = (controller->buffer_size - controller->buffer_index) / io_len;
-            if (quantumsMax == 0)
-              BX_PANIC(("IO read(0x%04x): not enough space for read", address));
-            DEV_bulk_io_quantum_transferred() = DEV_bulk_io_quantum_requested();
-            if (quantumsMax < DEV_bulk_io_quantum_transferred())
-              DEV_bulk_io_quantum_transferred() = quantumsMax;
-            transferLen = io_len * DEV_bulk_io_quantum_transferred();
-            memcpy((Bit8u*) DEV_bulk_io_host_addr(),
-              &controller->buffer[controller->buffer_index], transferLen);
-            DEV_bulk_io_host_addr() += transferLen;
-            controller->buffer_index += transferLen;
-            value32 = 0; // Value returned not important;
-          }
-          else
-#endif
           {
             value32 = 0L;
             switch(io_len){
@@ -1199,23 +1185,6 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
           if (controller->buffer_index >= controller->buffer_size)
             BX_PANIC(("IO write(0x%04x): buffer_index >= %d", address, controller->buffer_size));
 
-#if BX_SUPPORT_REPEAT_SPEEDUPS
-          if (DEV_bulk_io_quantum_requested()) {
-            unsigned transferLen, quantumsMax;
-            quantumsMax = (controller->buffer_size - controller->buffer_index) / io_len;
-            if (quantumsMax == 0)
-              BX_PANIC(("IO write(0x%04x): not enough space for write", address));
-            DEV_bulk_io_quantum_transferred() = DEV_bulk_io_quantum_requested();
-            if (quantumsMax < DEV_bulk_io_quantum_transferred())
-              DEV_bulk_io_quantum_transferred() = quantumsMax;
-            transferLen = io_len * DEV_bulk_io_quantum_transferred();
-            memcpy(&controller->buffer[controller->buffer_index],
-              (Bit8u*) DEV_bulk_io_host_addr(), transferLen);
-            DEV_bulk_io_host_addr() += transferLen;
-            controller->buffer_index += transferLen;
-          }
-          else
-#endif
           {
             switch(io_len) {
               case 4:
@@ -2604,6 +2573,133 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
     }
 }
 
+// static IO port block read callback handler for the REP INSW/INSD fast path
+// copies data port reads straight out of the controller buffer
+
+Bit32u bx_hard_drive_c::read_block_handler(void *this_ptr, Bit32u address, unsigned io_len,
+                                           Bit8u *data, Bit32u count)
+{
+#if !BX_USE_HD_SMF
+  bx_hard_drive_c *class_ptr = (bx_hard_drive_c *) this_ptr;
+  return class_ptr->read_block(address, io_len, data, count);
+}
+
+Bit32u bx_hard_drive_c::read_block(Bit32u address, unsigned io_len, Bit8u *data, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_HD_SMF
+  Bit8u channel;
+
+  for (channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    if (address == BX_HD_THIS channels[channel].ioaddr1)
+      break;
+  }
+  if (channel == BX_MAX_ATA_CHANNEL)
+    return 0;
+
+  controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
+  if (controller->status.drq == 0)
+    return 0;
+
+  switch (controller->current_command) {
+    case 0x20: // READ SECTORS, with retries
+    case 0x21: // READ SECTORS, without retries
+    case 0xC4: // READ MULTIPLE SECTORS
+    case 0x24: // READ SECTORS EXT
+    case 0x29: // READ MULTIPLE EXT
+      break;
+    default: // let the regular handler deal with everything else
+      return 0;
+  }
+
+  if (controller->buffer_index >= controller->buffer_size)
+    return 0;
+  Bit32u quantumsMax = (controller->buffer_size - controller->buffer_index) / io_len;
+  if (quantumsMax == 0)
+    return 0;
+  if (count > quantumsMax)
+    count = quantumsMax;
+
+  // All but the last quantum are a plain copy. The last one goes through the
+  // regular handler so that the end of buffer processing (loading the next
+  // sector, raising the interrupt) is done in one place only.
+  Bit32u transferLen = (count - 1) * io_len;
+  memcpy(data, &controller->buffer[controller->buffer_index], transferLen);
+  controller->buffer_index += transferLen;
+  data += transferLen;
+
+  Bit32u value32 = read_handler(BX_HD_THIS_PTR, address, io_len);
+  data[0] = (Bit8u) value32;
+  data[1] = (Bit8u)(value32 >> 8);
+  if (io_len == 4) {
+    data[2] = (Bit8u)(value32 >> 16);
+    data[3] = (Bit8u)(value32 >> 24);
+  }
+  return count;
+}
+
+// static IO port block write callback handler for the REP OUTSW/OUTSD fast
+// path copies data port writes straight into the controller buffer
+
+Bit32u bx_hard_drive_c::write_block_handler(void *this_ptr, Bit32u address, unsigned io_len,
+                                            const Bit8u *data, Bit32u count)
+{
+#if !BX_USE_HD_SMF
+  bx_hard_drive_c *class_ptr = (bx_hard_drive_c *) this_ptr;
+  return class_ptr->write_block(address, io_len, data, count);
+}
+
+Bit32u bx_hard_drive_c::write_block(Bit32u address, unsigned io_len, const Bit8u *data, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_HD_SMF
+  Bit8u channel;
+
+  for (channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    if (address == BX_HD_THIS channels[channel].ioaddr1)
+      break;
+  }
+  if (channel == BX_MAX_ATA_CHANNEL)
+    return 0;
+
+  controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
+  if (controller->status.drq == 0)
+    return 0;
+
+  switch (controller->current_command) {
+    case 0x30: // WRITE SECTORS
+    case 0xC5: // WRITE MULTIPLE SECTORS
+    case 0x34: // WRITE SECTORS EXT
+    case 0x39: // WRITE MULTIPLE EXT
+      break;
+    default: // let the regular handler deal with everything else
+      return 0;
+  }
+
+  if (controller->buffer_index >= controller->buffer_size)
+    return 0;
+  Bit32u quantumsMax = (controller->buffer_size - controller->buffer_index) / io_len;
+  if (quantumsMax == 0)
+    return 0;
+  if (count > quantumsMax)
+    count = quantumsMax;
+
+  // see read_block() for why the last quantum takes the regular path
+  Bit32u transferLen = (count - 1) * io_len;
+  memcpy(&controller->buffer[controller->buffer_index], data, transferLen);
+  controller->buffer_index += transferLen;
+  data += transferLen;
+
+  Bit32u value32 = data[0] | (data[1] << 8);
+  if (io_len == 4) {
+    value32 |= (data[2] << 16) | ((Bit32u) data[3] << 24);
+  }
+  write_handler(BX_HD_THIS_PTR, address, value32, io_len);
+  return count;
+}
+
   bx_bool BX_CPP_AttrRegparmN(2)
 bx_hard_drive_c::calculate_logical_address(Bit8u channel, Bit64s *sector)
 {
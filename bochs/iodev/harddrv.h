@@ -191,10 +191,16 @@ public:
 #if !BX_USE_HD_SMF
   Bit32u read(Bit32u address, unsigned io_len);
   void   write(Bit32u address, Bit32u value, unsigned io_len);
+  Bit32u read_block(Bit32u address, unsigned io_len, Bit8u *data, Bit32u count);
+  Bit32u write_block(Bit32u address, unsigned io_len, const Bit8u *data, Bit32u count);
 #endif
 
   static Bit32u read_handler(void *this_ptr, Bit32u address, unsigned io_len);
   static void   write_handler(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len);
+  static Bit32u read_block_handler(void *this_ptr, Bit32u address, unsigned io_len,
+                                   Bit8u *data, Bit32u count);
+  static Bit32u write_block_handler(void *this_ptr, Bit32u address, unsigned io_len,
+                                    const Bit8u *data, Bit32u count);
 
   static void seek_timer_handler(void *);
   BX_HD_SMF void seek_timer(void);
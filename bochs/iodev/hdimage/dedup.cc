@@ -0,0 +1,732 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// Deduplicated disk image support
+//
+// The image file only contains a header and the block map. The disk data is
+// kept in 64 KB blocks in a chunk store that can be shared by any number of
+// images: '<store>' holds the block data and '<store>.idx' one 64-bit content
+// hash per block. Blocks are only ever appended to the store, so the block
+// map of an image stays valid forever and a new variant of an image is
+// created by simply copying the (small) image file. Store blocks are mapped
+// read-only on demand, so identical blocks of all variants share the host
+// page cache. All-zero blocks are not stored at all.
+//
+// Modified blocks are buffered and hashed when they are evicted or the image
+// is closed. If a block with the same contents already exists in the store it
+// is referenced, otherwise the block is appended. Unreferenced blocks are
+// never removed from the store.
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#ifdef BXIMAGE
+#include "config.h"
+#include "misc/bxcompat.h"
+#include "misc/bswap.h"
+#include "osdep.h"
+#else
+#include "iodev.h"
+#endif
+#include "hdimage.h"
+#include "dedup.h"
+
+#if BX_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef WIN32
+#include <io.h>
+#else
+#include <sys/file.h>
+#endif
+
+#ifndef O_ACCMODE
+#define O_ACCMODE (O_WRONLY | O_RDWR)
+#endif
+
+#define LOG_THIS bx_devices.pluginHDImageCtl->
+
+#define DEDUP_NO_BLOCK 0xffffffff
+
+// Serializes appends to a chunk store shared by several Bochs processes.
+// Windows locks are mandatory, so a byte far beyond the end of the index
+// is locked instead of the file contents.
+static void dedup_lock_store(int fd, bx_bool lock)
+{
+#ifdef WIN32
+  OVERLAPPED ov;
+  memset(&ov, 0, sizeof(ov));
+  ov.Offset = 0xffffffff;
+  ov.OffsetHigh = 0x7fffffff;
+  if (lock) {
+    LockFileEx((HANDLE) _get_osfhandle(fd), LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &ov);
+  } else {
+    UnlockFileEx((HANDLE) _get_osfhandle(fd), 0, 1, 0, &ov);
+  }
+#else
+  flock(fd, lock ? LOCK_EX : LOCK_UN);
+#endif
+}
+
+// Only used to find candidate blocks, contents are always compared.
+static Bit64u dedup_hash_block(const Bit8u *data, Bit32u len)
+{
+  const Bit64u *p = (const Bit64u *) data;
+  Bit64u hash = BX_CONST64(0xcbf29ce484222325);
+
+  for (Bit32u i = 0; i < (len >> 3); i++) {
+    hash = (hash ^ dtoh64(p[i])) * BX_CONST64(0x100000001b3);
+    hash ^= hash >> 32;
+  }
+  return hash;
+}
+
+static bx_bool dedup_is_zero_block(const Bit8u *data, Bit32u len)
+{
+  const Bit64u *p = (const Bit64u *) data;
+
+  for (Bit32u i = 0; i < (len >> 3); i++) {
+    if (p[i] != 0) return 0;
+  }
+  return 1;
+}
+
+dedup_image_t::dedup_image_t()
+  : fd(-1),
+  pathname(NULL),
+  read_only(0),
+  block_map(NULL),
+  store_name(NULL),
+  store_fd(-1),
+  store_index_fd(-1),
+  store_blocks(0),
+  store_hash(NULL),
+  store_hash_size(0),
+  hash_table(NULL),
+  hash_table_mask(0),
+  window(NULL),
+  num_windows(0),
+  bounce(NULL),
+  dirty_counter(0),
+  position(0)
+{
+  for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+    dirty[i].index = DEDUP_NO_BLOCK;
+    dirty[i].last_used = 0;
+    dirty[i].data = NULL;
+  }
+}
+
+dedup_image_t::~dedup_image_t()
+{
+  close();
+}
+
+int dedup_image_t::open(const char* _pathname, int flags)
+{
+  dedup_header_t header;
+  Bit64u imgsize = 0;
+
+  pathname = _pathname;
+  close();
+
+  fd = hdimage_open_file(pathname, flags, &imgsize, &mtime);
+  if (fd < 0)
+    return -1;
+
+  if (check_format(fd, imgsize) != HDIMAGE_FORMAT_OK) {
+    BX_ERROR(("dedup image format not detected in file '%s'", pathname));
+    close();
+    return -1;
+  }
+  bx_read_image(fd, 0, &header, sizeof(header));
+
+  read_only = ((flags & O_ACCMODE) == O_RDONLY);
+  block_size = dtoh32(header.specific.block);
+  for (block_bits = 9; block_bits < 24; block_bits++) {
+    if ((1U << block_bits) == block_size) break;
+  }
+  hd_size = dtoh64(header.specific.disk);
+  map_size = dtoh32(header.specific.count);
+  if ((block_bits == 24) ||
+      (map_size != (Bit32u)((hd_size + block_size - 1) >> block_bits)) ||
+      (imgsize < (STANDARD_HEADER_SIZE + (Bit64u) map_size * 4))) {
+    BX_ERROR(("dedup: invalid header in file '%s'", pathname));
+    close();
+    return -1;
+  }
+
+  block_map = new Bit32u[map_size];
+  if (bx_read_image(fd, STANDARD_HEADER_SIZE, block_map, map_size * 4) != (ssize_t)(map_size * 4)) {
+    BX_ERROR(("dedup: could not read block map"));
+    close();
+    return -1;
+  }
+  for (Bit32u i = 0; i < map_size; i++) {
+    block_map[i] = dtoh32(block_map[i]);
+  }
+
+  header.specific.store[DEDUP_STORE_NAME_LEN - 1] = 0;
+  if (!open_store((const char*) header.specific.store)) {
+    close();
+    return -1;
+  }
+  for (Bit32u i = 0; i < map_size; i++) {
+    if (block_map[i] > store_blocks) {
+      BX_ERROR(("dedup: block %d refers to a block beyond the end of store '%s'", i, store_name));
+      close();
+      return -1;
+    }
+  }
+
+  bounce = new Bit8u[block_size];
+  if (!read_only) {
+    for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+      dirty[i].index = DEDUP_NO_BLOCK;
+      dirty[i].data = new Bit8u[block_size];
+    }
+  }
+
+  BX_INFO(("dedup: opened image '%s'", pathname));
+  BX_DEBUG(("   .size         = " FMT_LL "d", hd_size));
+  BX_DEBUG(("   .block_size   = %d", block_size));
+  BX_DEBUG(("   .store        = %s (%d blocks)", store_name, store_blocks));
+
+  return 1;
+}
+
+void dedup_image_t::close()
+{
+  if (fd > -1) {
+    if (!flush()) {
+      BX_ERROR(("dedup: failed to write back modified blocks of '%s'", pathname));
+    }
+  }
+  for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+    delete [] dirty[i].data;
+    dirty[i].data = NULL;
+    dirty[i].index = DEDUP_NO_BLOCK;
+  }
+  delete [] bounce; bounce = NULL;
+  delete [] block_map; block_map = NULL;
+  close_store();
+
+  if (fd > -1) {
+    bx_close_image(fd, pathname);
+    fd = -1;
+  }
+}
+
+Bit64s dedup_image_t::lseek(Bit64s offset, int whence)
+{
+  switch (whence) {
+    case SEEK_SET:
+      position = offset;
+      break;
+    case SEEK_CUR:
+      position += offset;
+      break;
+    case SEEK_END:
+      position = hd_size + offset;
+      break;
+    default:
+      BX_ERROR(("unknown 'whence' value (%d) when trying to seek dedup image", whence));
+      return -1;
+  }
+  if ((position < 0) || ((Bit64u) position > hd_size)) {
+    BX_ERROR(("dedup: seek to offset " FMT_LL "d out of range", position));
+    return -1;
+  }
+  return position;
+}
+
+ssize_t dedup_image_t::read(void* buf, size_t count)
+{
+  Bit8u *cbuf = (Bit8u*) buf;
+  size_t left = count;
+
+  while ((left > 0) && ((Bit64u) position < hd_size)) {
+    Bit32u index = (Bit32u)(position >> block_bits);
+    Bit32u offset = (Bit32u)(position & (block_size - 1));
+    Bit32u n = block_size - offset;
+    if (n > left) n = (Bit32u) left;
+
+    int slot = find_dirty_block(index);
+    if (slot >= 0) {
+      memcpy(cbuf, dirty[slot].data + offset, n);
+    } else if (block_map[index] == DEDUP_BLOCK_NOT_ALLOCATED) {
+      memset(cbuf, 0, n);
+    } else if (!read_store_block(block_map[index] - 1, offset, cbuf, n)) {
+      BX_ERROR(("dedup: could not read block %d from store", block_map[index] - 1));
+      return -1;
+    }
+    cbuf += n;
+    position += n;
+    left -= n;
+  }
+  return count - left;
+}
+
+ssize_t dedup_image_t::write(const void* buf, size_t count)
+{
+  const Bit8u *cbuf = (const Bit8u*) buf;
+  size_t left = count;
+
+  if (read_only) {
+    BX_ERROR(("dedup: image '%s' is opened read-only", pathname));
+    return -1;
+  }
+
+  while ((left > 0) && ((Bit64u) position < hd_size)) {
+    Bit32u index = (Bit32u)(position >> block_bits);
+    Bit32u offset = (Bit32u)(position & (block_size - 1));
+    Bit32u n = block_size - offset;
+    if (n > left) n = (Bit32u) left;
+
+    int slot = find_dirty_block(index);
+    if (slot < 0) {
+      slot = get_dirty_block(index, n < block_size);
+      if (slot < 0)
+        return -1;
+    }
+    memcpy(dirty[slot].data + offset, cbuf, n);
+    dirty[slot].last_used = ++dirty_counter;
+    cbuf += n;
+    position += n;
+    left -= n;
+  }
+  return count - left;
+}
+
+Bit32u dedup_image_t::get_capabilities(void)
+{
+  Bit32u caps = HDIMAGE_AUTO_GEOMETRY;
+  if (read_only)
+    caps |= HDIMAGE_READONLY;
+  return caps;
+}
+
+int dedup_image_t::check_format(int fd, Bit64u imgsize)
+{
+  dedup_header_t temp_header;
+
+  if (bx_read_image(fd, 0, &temp_header, sizeof(dedup_header_t)) != STANDARD_HEADER_SIZE)
+    return HDIMAGE_READ_ERROR;
+
+  if (strcmp((char*)temp_header.standard.magic, STANDARD_HEADER_MAGIC) != 0)
+    return HDIMAGE_NO_SIGNATURE;
+
+  if ((strcmp((char*)temp_header.standard.type, DEDUP_TYPE) != 0) ||
+      (strcmp((char*)temp_header.standard.subtype, DEDUP_SUBTYPE_MAP) != 0))
+    return HDIMAGE_TYPE_ERROR;
+
+  if (dtoh32(temp_header.standard.version) != STANDARD_HEADER_VERSION)
+    return HDIMAGE_VERSION_ERROR;
+
+  return HDIMAGE_FORMAT_OK;
+}
+
+// Opens (and creates if necessary) the chunk store and loads its hash index.
+// Relative names are relative to the directory of the image.
+bx_bool dedup_image_t::open_store(const char *name)
+{
+  dedup_header_t header;
+  struct stat stat_buf;
+
+  const char *sep = strrchr(pathname, '/');
+#ifdef WIN32
+  const char *sep2 = strrchr(pathname, '\\');
+  if (sep2 > sep) sep = sep2;
+  bx_bool absolute = (name[0] == '/') || (name[0] == '\\') || (name[0] && (name[1] == ':'));
+#else
+  bx_bool absolute = (name[0] == '/');
+#endif
+  size_t dirlen = (absolute || (sep == NULL)) ? 0 : (sep - pathname + 1);
+  store_name = new char[dirlen + strlen(name) + strlen(DEDUP_INDEX_EXTENSION) + 1];
+  memcpy(store_name, pathname, dirlen);
+  strcpy(store_name + dirlen, name);
+
+  // the store is shared, so the usual image lock file is not used here
+  int flags = (read_only ? O_RDONLY : (O_RDWR | O_CREAT))
+#ifdef O_BINARY
+              | O_BINARY
+#endif
+              ;
+  store_fd = ::open(store_name, flags, S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP);
+  strcat(store_name, DEDUP_INDEX_EXTENSION);
+  store_index_fd = ::open(store_name, flags, S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP);
+  store_name[dirlen + strlen(name)] = 0;
+  if ((store_fd < 0) || (store_index_fd < 0)) {
+    BX_ERROR(("dedup: could not open chunk store '%s'", store_name));
+    return 0;
+  }
+
+  if ((fstat(store_index_fd, &stat_buf) == 0) && (stat_buf.st_size == 0) && !read_only) {
+    memset(&header, 0, sizeof(header));
+    strcpy((char*)header.standard.magic, STANDARD_HEADER_MAGIC);
+    strcpy((char*)header.standard.type, DEDUP_TYPE);
+    strcpy((char*)header.standard.subtype, DEDUP_SUBTYPE_STORE);
+    header.standard.version = htod32(STANDARD_HEADER_VERSION);
+    header.standard.header = htod32(STANDARD_HEADER_SIZE);
+    header.specific.block = htod32(block_size);
+    if (bx_write_image(store_index_fd, 0, &header, sizeof(header)) != sizeof(header)) {
+      BX_ERROR(("dedup: could not create chunk store '%s'", store_name));
+      return 0;
+    }
+    BX_INFO(("dedup: created chunk store '%s'", store_name));
+  } else if ((bx_read_image(store_index_fd, 0, &header, sizeof(header)) != sizeof(header)) ||
+             (strcmp((char*)header.standard.magic, STANDARD_HEADER_MAGIC) != 0) ||
+             (strcmp((char*)header.standard.type, DEDUP_TYPE) != 0) ||
+             (strcmp((char*)header.standard.subtype, DEDUP_SUBTYPE_STORE) != 0)) {
+    BX_ERROR(("dedup: '%s' is not a chunk store", store_name));
+    return 0;
+  } else if (dtoh32(header.specific.block) != block_size) {
+    BX_ERROR(("dedup: block size of chunk store '%s' does not match", store_name));
+    return 0;
+  }
+
+  if (fstat(store_index_fd, &stat_buf) != 0) {
+    return 0;
+  }
+  return load_store_index((Bit32u)((stat_buf.st_size - STANDARD_HEADER_SIZE) >> 3));
+}
+
+void dedup_image_t::close_store()
+{
+  for (Bit32u i = 0; i < num_windows; i++) {
+    if (window[i] != NULL) {
+#ifdef WIN32
+      UnmapViewOfFile(window[i]);
+#elif defined(_POSIX_MAPPED_FILES)
+      munmap(window[i], (size_t) block_size << DEDUP_WINDOW_BITS);
+#endif
+    }
+  }
+  delete [] window; window = NULL;
+  num_windows = 0;
+  delete [] hash_table; hash_table = NULL;
+  hash_table_mask = 0;
+  delete [] store_hash; store_hash = NULL;
+  store_hash_size = 0;
+  store_blocks = 0;
+  if (store_fd > -1) {
+    ::close(store_fd);
+    store_fd = -1;
+  }
+  if (store_index_fd > -1) {
+    ::close(store_index_fd);
+    store_index_fd = -1;
+  }
+  delete [] store_name; store_name = NULL;
+}
+
+// Adds the index entries appended to the store (possibly by another process)
+// since the index was last read.
+bx_bool dedup_image_t::load_store_index(Bit32u count)
+{
+  Bit64u hashes[512];
+
+  while (store_blocks < count) {
+    Bit32u n = count - store_blocks;
+    if (n > 512) n = 512;
+    if (bx_read_image(store_index_fd, STANDARD_HEADER_SIZE + (Bit64s) store_blocks * 8,
+                      hashes, n * 8) != (int)(n * 8)) {
+      BX_ERROR(("dedup: could not read index of chunk store '%s'", store_name));
+      return 0;
+    }
+    for (Bit32u i = 0; i < n; i++) {
+      add_store_hash(dtoh64(hashes[i]));
+    }
+  }
+  return 1;
+}
+
+void dedup_image_t::add_store_hash(Bit64u hash)
+{
+  if (store_blocks == store_hash_size) {
+    store_hash_size = store_hash_size ? (store_hash_size * 2) : 1024;
+    Bit64u *new_hash = new Bit64u[store_hash_size];
+    if (store_blocks > 0)
+      memcpy(new_hash, store_hash, store_blocks * 8);
+    delete [] store_hash;
+    store_hash = new_hash;
+  }
+  store_hash[store_blocks++] = hash;
+
+  // keep the hash table at most half full
+  if ((store_blocks * 2) > hash_table_mask) {
+    delete [] hash_table;
+    hash_table_mask = hash_table_mask ? (hash_table_mask * 2 + 1) : 4095;
+    hash_table = new Bit32u[hash_table_mask + 1];
+    memset(hash_table, 0, (hash_table_mask + 1) * 4);
+    for (Bit32u block = 0; block < store_blocks; block++) {
+      Bit32u i = (Bit32u) store_hash[block] & hash_table_mask;
+      while (hash_table[i] != 0) i = (i + 1) & hash_table_mask;
+      hash_table[i] = block + 1;
+    }
+  } else {
+    Bit32u i = (Bit32u) hash & hash_table_mask;
+    while (hash_table[i] != 0) i = (i + 1) & hash_table_mask;
+    hash_table[i] = store_blocks;
+  }
+}
+
+bx_bool dedup_image_t::find_store_block(Bit64u hash, const Bit8u *data, Bit32u *entry)
+{
+  if (hash_table == NULL)
+    return 0;
+
+  for (Bit32u i = (Bit32u) hash & hash_table_mask; hash_table[i] != 0; i = (i + 1) & hash_table_mask) {
+    Bit32u block = hash_table[i] - 1;
+    if (store_hash[block] != hash)
+      continue;
+    const Bit8u *contents = map_store_block(block);
+    if (contents == NULL) {
+      if (!read_store_block(block, 0, bounce, block_size))
+        continue;
+      contents = bounce;
+    }
+    if (memcmp(contents, data, block_size) == 0) {
+      *entry = block + 1;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Returns the block map entry for the given block contents, appending the
+// block to the store if no identical block exists yet.
+bx_bool dedup_image_t::store_block(const Bit8u *data, Bit32u *entry)
+{
+  struct stat stat_buf;
+  bx_bool ret = 0;
+
+  if (dedup_is_zero_block(data, block_size)) {
+    *entry = DEDUP_BLOCK_NOT_ALLOCATED;
+    return 1;
+  }
+  Bit64u hash = dedup_hash_block(data, block_size);
+  if (find_store_block(hash, data, entry))
+    return 1;
+
+  dedup_lock_store(store_index_fd, 1);
+  // pick up blocks appended by other users of the store in the meantime
+  if (fstat(store_index_fd, &stat_buf) == 0) {
+    Bit32u count = (Bit32u)((stat_buf.st_size - STANDARD_HEADER_SIZE) >> 3);
+    if ((count > store_blocks) && load_store_index(count) &&
+        find_store_block(hash, data, entry)) {
+      ret = 1;
+    } else if (store_blocks < 0xffffffff) {
+      // the data must be in place before the index entry announces it
+      Bit64u disk_hash = htod64(hash);
+      Bit32u block = store_blocks;
+      if ((bx_write_image(store_fd, (Bit64s) block << block_bits, (void*) data, block_size) == (int) block_size) &&
+          (bx_write_image(store_index_fd, STANDARD_HEADER_SIZE + (Bit64s) block * 8, &disk_hash, 8) == 8)) {
+        add_store_hash(hash);
+        *entry = block + 1;
+        ret = 1;
+      }
+    }
+  }
+  dedup_lock_store(store_index_fd, 0);
+  if (!ret) {
+    BX_ERROR(("dedup: could not write to chunk store '%s'", store_name));
+  }
+  return ret;
+}
+
+// Returns a pointer to the contents of a store block or NULL if the store
+// can't be mapped.
+const Bit8u *dedup_image_t::map_store_block(Bit32u block)
+{
+#if defined(_POSIX_MAPPED_FILES) || defined(WIN32)
+  Bit32u w = block >> DEDUP_WINDOW_BITS;
+
+  if (w >= num_windows) {
+    Bit32u new_num = (num_windows * 2 > w) ? (num_windows * 2) : (w + 1);
+    Bit8u **new_window = new Bit8u*[new_num];
+    for (Bit32u i = 0; i < new_num; i++) {
+      new_window[i] = (i < num_windows) ? window[i] : NULL;
+    }
+    delete [] window;
+    window = new_window;
+    num_windows = new_num;
+  }
+  if (window[w] == NULL) {
+    size_t len = (size_t) block_size << DEDUP_WINDOW_BITS;
+#ifdef WIN32
+    // a read-only view can't reach beyond the end of the store, the blocks
+    // of the last partial window are read instead
+    Bit64u offset = (Bit64u) w * len;
+    HANDLE fh = (HANDLE) _get_osfhandle(store_fd);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || ((Bit64u) size.QuadPart < (offset + len))) {
+      return NULL;
+    }
+    HANDLE hmap = CreateFileMapping(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hmap == NULL) {
+      return NULL;
+    }
+    void *ptr = MapViewOfFile(hmap, FILE_MAP_READ, (DWORD)(offset >> 32), (DWORD) offset, len);
+    CloseHandle(hmap); // the view keeps the mapping alive
+    if (ptr == NULL) {
+      return NULL;
+    }
+#else
+    // the window may reach beyond the end of the store, only the blocks
+    // known from the index are accessed
+    void *ptr = mmap(NULL, len, PROT_READ, MAP_SHARED, store_fd, (off_t) w * len);
+    if (ptr == MAP_FAILED) {
+      return NULL;
+    }
+#endif
+    window[w] = (Bit8u*) ptr;
+  }
+  return window[w] + ((block & ((1 << DEDUP_WINDOW_BITS) - 1)) << block_bits);
+#else
+  return NULL;
+#endif
+}
+
+bx_bool dedup_image_t::read_store_block(Bit32u block, Bit32u offset, void *buf, Bit32u count)
+{
+  const Bit8u *contents = map_store_block(block);
+  if (contents != NULL) {
+    memcpy(buf, contents + offset, count);
+    return 1;
+  }
+  return (bx_read_image(store_fd, ((Bit64s) block << block_bits) + offset, buf, count) == (int) count);
+}
+
+int dedup_image_t::find_dirty_block(Bit32u index)
+{
+  if (read_only)
+    return -1;
+
+  for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+    if (dirty[i].index == index)
+      return i;
+  }
+  return -1;
+}
+
+// Returns a free slot for a modified block, writing back the least recently
+// used one if necessary. If 'fill' is set, the slot is loaded with the
+// current contents of the block.
+int dedup_image_t::get_dirty_block(Bit32u index, bx_bool fill)
+{
+  int slot = -1;
+
+  for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+    if (dirty[i].index == DEDUP_NO_BLOCK) {
+      slot = i;
+      break;
+    }
+    if ((slot < 0) || (dirty[i].last_used < dirty[slot].last_used))
+      slot = i;
+  }
+  if (!flush_dirty_block(slot))
+    return -1;
+
+  if (fill) {
+    if (block_map[index] == DEDUP_BLOCK_NOT_ALLOCATED) {
+      memset(dirty[slot].data, 0, block_size);
+    } else if (!read_store_block(block_map[index] - 1, 0, dirty[slot].data, block_size)) {
+      BX_ERROR(("dedup: could not read block %d from store", block_map[index] - 1));
+      return -1;
+    }
+  }
+  dirty[slot].index = index;
+  return slot;
+}
+
+bx_bool dedup_image_t::flush_dirty_block(int slot)
+{
+  Bit32u index = dirty[slot].index;
+  Bit32u entry;
+
+  if (index == DEDUP_NO_BLOCK)
+    return 1;
+
+  if (!store_block(dirty[slot].data, &entry))
+    return 0;
+  if (entry != block_map[index]) {
+    Bit32u disk_entry = htod32(entry);
+    if (bx_write_image(fd, STANDARD_HEADER_SIZE + (Bit64s) index * 4, &disk_entry, 4) != 4) {
+      BX_ERROR(("dedup: could not update block map"));
+      return 0;
+    }
+    block_map[index] = entry;
+  }
+  dirty[slot].index = DEDUP_NO_BLOCK;
+  return 1;
+}
+
+bx_bool dedup_image_t::flush()
+{
+  bx_bool ret = 1;
+
+  if (!read_only) {
+    for (int i = 0; i < DEDUP_DIRTY_BLOCKS; i++) {
+      if (!flush_dirty_block(i))
+        ret = 0;
+    }
+  }
+  return ret;
+}
+
+#ifndef BXIMAGE
+// Store blocks are never modified or removed, so the block map is all that
+// needs to be saved.
+bx_bool dedup_image_t::save_state(const char *backup_fname)
+{
+  if (!flush())
+    return 0;
+  return hdimage_backup_file(fd, backup_fname);
+}
+
+void dedup_image_t::restore_state(const char *backup_fname)
+{
+  int temp_fd;
+  Bit64u imgsize;
+
+  if ((temp_fd = hdimage_open_file(backup_fname, O_RDONLY, &imgsize, NULL)) < 0) {
+    BX_PANIC(("Cannot open dedup image backup '%s'", backup_fname));
+    return;
+  }
+
+  if (check_format(temp_fd, imgsize) < HDIMAGE_FORMAT_OK) {
+    ::close(temp_fd);
+    BX_PANIC(("Cannot detect dedup image header"));
+    return;
+  }
+  ::close(temp_fd);
+  close();
+  if (!hdimage_copy_file(backup_fname, pathname)) {
+    BX_PANIC(("Failed to restore dedup image '%s'", pathname));
+    return;
+  }
+  device_image_t::open(pathname);
+}
+#endif
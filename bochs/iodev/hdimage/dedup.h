@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// Deduplicated disk image support (block map + shared chunk store)
+
+#ifndef BX_DEDUP_H
+#define BX_DEDUP_H
+
+#define DEDUP_TYPE            "Dedup"
+#define DEDUP_SUBTYPE_MAP     "Blockmap"
+#define DEDUP_SUBTYPE_STORE   "Store"
+
+#define DEDUP_BLOCK_SIZE      (64 * 1024)
+#define DEDUP_STORE_NAME_LEN  256
+#define DEDUP_DEFAULT_STORE   "dedup.store"
+#define DEDUP_INDEX_EXTENSION ".idx"
+
+// block map entries hold the store block number + 1
+#define DEDUP_BLOCK_NOT_ALLOCATED 0
+
+// store blocks are mapped 256 at a time (16 MB with 64 KB blocks)
+#define DEDUP_WINDOW_BITS     8
+
+// number of modified blocks buffered before they are hashed and stored
+#define DEDUP_DIRTY_BLOCKS    16
+
+ typedef struct
+ {
+   // the fields in the header are kept in little endian
+   Bit32u  block;      // block size in bytes
+   Bit32u  count;      // #entries in the block map (image only)
+   Bit64u  disk;       // disk size in bytes (image only)
+   Bit8u   store[DEDUP_STORE_NAME_LEN]; // chunk store, relative to the image (image only)
+ } dedup_specific_header_t;
+
+ typedef struct
+ {
+   standard_header_t standard;
+   dedup_specific_header_t specific;
+
+   Bit8u padding[STANDARD_HEADER_SIZE - (sizeof (standard_header_t) + sizeof (dedup_specific_header_t))];
+ } dedup_header_t;
+
+class dedup_image_t : public device_image_t
+{
+  public:
+    dedup_image_t();
+    virtual ~dedup_image_t();
+
+    int open(const char* pathname, int flags);
+    void close();
+    Bit64s lseek(Bit64s offset, int whence);
+    ssize_t read(void* buf, size_t count);
+    ssize_t write(const void* buf, size_t count);
+
+    Bit32u get_capabilities();
+    static int check_format(int fd, Bit64u imgsize);
+
+#ifndef BXIMAGE
+    bx_bool save_state(const char *backup_fname);
+    void restore_state(const char *backup_fname);
+#endif
+
+  private:
+    bx_bool open_store(const char *name);
+    void close_store();
+    bx_bool load_store_index(Bit32u count);
+    void add_store_hash(Bit64u hash);
+    bx_bool find_store_block(Bit64u hash, const Bit8u *data, Bit32u *entry);
+    bx_bool store_block(const Bit8u *data, Bit32u *entry);
+    const Bit8u *map_store_block(Bit32u block);
+    bx_bool read_store_block(Bit32u block, Bit32u offset, void *buf, Bit32u count);
+
+    int find_dirty_block(Bit32u index);
+    int get_dirty_block(Bit32u index, bx_bool fill);
+    bx_bool flush_dirty_block(int slot);
+    bx_bool flush();
+
+    int fd;
+    const char *pathname;
+    bx_bool read_only;
+    Bit32u block_size;
+    Bit32u block_bits;
+    Bit32u map_size;
+    Bit32u *block_map;          // kept in host endianness
+
+    // chunk store, shared by all images naming it
+    char *store_name;
+    int store_fd;               // block data
+    int store_index_fd;         // content hash of each block
+    Bit32u store_blocks;
+    Bit64u *store_hash;         // kept in host endianness
+    Bit32u store_hash_size;
+    Bit32u *hash_table;         // open addressing, store block number + 1
+    Bit32u hash_table_mask;
+    Bit8u **window;             // read-only mappings of the block data
+    Bit32u num_windows;
+    Bit8u *bounce;
+
+    struct {
+      Bit32u index;             // disk block, 0xffffffff if unused
+      Bit64u last_used;
+      Bit8u *data;
+    } dirty[DEDUP_DIRTY_BLOCKS];
+    Bit64u dirty_counter;
+
+    Bit64s position;
+};
+
+#endif
@@ -43,6 +43,8 @@
 #include "vvfat.h"
 #include "vpc-img.h"
 #include "vbox.h"
+#include "qcow2.h"
+#include "dedup.h"
 
 #if BX_HAVE_SYS_MMAN_H
 #include <sys/mman.h>
@@ -147,6 +149,14 @@ device_image_t* bx_hdimage_ctl_c::init_image(Bit8u image_mode, Bit64u disk_size,
       hdimage = new vbox_image_t();
       break;
 
+    case BX_HDIMAGE_MODE_QCOW2:
+      hdimage = new qcow2_image_t();
+      break;
+
+    case BX_HDIMAGE_MODE_DEDUP:
+      hdimage = new dedup_image_t();
+      break;
+
     default:
       BX_PANIC(("Disk image mode '%s' not available", hdimage_mode_names[image_mode]));
       break;
@@ -314,6 +324,10 @@ int hdimage_detect_image_mode(const char *pathname)
     result = BX_HDIMAGE_MODE_VPC;
   } else if (vbox_image_t::check_format(fd, image_size) >= HDIMAGE_FORMAT_OK) {
     result = BX_HDIMAGE_MODE_VBOX;
+  } else if (qcow2_image_t::check_format(fd, image_size) >= HDIMAGE_FORMAT_OK) {
+    result = BX_HDIMAGE_MODE_QCOW2;
+  } else if (dedup_image_t::check_format(fd, image_size) == HDIMAGE_FORMAT_OK) {
+    result = BX_HDIMAGE_MODE_DEDUP;
   } else if (flat_image_t::check_format(fd, image_size) == HDIMAGE_FORMAT_OK) {
     result = BX_HDIMAGE_MODE_FLAT;
   }
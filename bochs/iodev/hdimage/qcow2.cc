@@ -0,0 +1,701 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// QEMU copy-on-write version 2 (qcow2) disk image support
+//
+// Supported are version 2 and 3 images with 16-bit refcounts, read-write
+// access and backing files. Newly written clusters are always appended to
+// the end of the image and the refcounts are updated write-through, so the
+// image stays consistent for qemu-img. Compressed and encrypted clusters are
+// not supported. Images with internal snapshots are opened read-only, use
+// them as base image of an 'undoable' or 'volatile' disk instead.
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#ifdef BXIMAGE
+#include "config.h"
+#include "misc/bxcompat.h"
+#include "misc/bswap.h"
+#include "osdep.h"
+#else
+#include "iodev.h"
+#endif
+#include "hdimage.h"
+#include "qcow2.h"
+
+#ifndef O_ACCMODE
+#define O_ACCMODE (O_WRONLY | O_RDWR)
+#endif
+
+#define LOG_THIS bx_devices.pluginHDImageCtl->
+
+// be*_to_cpu : convert disk (big) to host endianness
+#if defined (BX_LITTLE_ENDIAN)
+#define qcow2_be16(val) bx_bswap16(val)
+#define qcow2_be32(val) bx_bswap32(val)
+#define qcow2_be64(val) bx_bswap64(val)
+#else
+#define qcow2_be16(val) (val)
+#define qcow2_be32(val) (val)
+#define qcow2_be64(val) (val)
+#endif
+
+qcow2_image_t::qcow2_image_t()
+  : fd(-1),
+  pathname(NULL),
+  read_only(0),
+  l1_table(NULL),
+  refcount_table(NULL),
+  refcount_block(NULL),
+  refcount_block_offset(0),
+  l2_cache_counter(0),
+  backing_image(NULL),
+  backing_name(NULL),
+  position(0)
+{
+  for (int i = 0; i < QCOW2_L2_CACHE_SIZE; i++) {
+    l2_cache[i].offset = 0;
+    l2_cache[i].last_used = 0;
+    l2_cache[i].table = NULL;
+  }
+}
+
+qcow2_image_t::~qcow2_image_t()
+{
+  close();
+}
+
+int qcow2_image_t::open(const char* _pathname, int flags)
+{
+  Bit64u imgsize = 0;
+
+  pathname = _pathname;
+  close();
+
+  fd = hdimage_open_file(pathname, flags, &imgsize, &mtime);
+  if (fd < 0)
+    return -1;
+
+  if (!read_header()) {
+    BX_ERROR(("unable to read qcow2 header from file '%s'", pathname));
+    close();
+    return -1;
+  }
+
+  read_only = ((flags & O_ACCMODE) == O_RDONLY);
+  if (!read_only && (header.nb_snapshots > 0)) {
+    BX_ERROR(("qcow2 image '%s' has internal snapshots, opening read-only", pathname));
+    read_only = 1;
+  }
+
+  cluster_bits = header.cluster_bits;
+  cluster_size = 1 << cluster_bits;
+  l2_bits = cluster_bits - 3;
+  l2_size = 1 << l2_bits;
+
+  unsigned l1_shift = cluster_bits + l2_bits;
+  Bit64u l1_needed = (header.size >> l1_shift) + ((header.size & ((BX_CONST64(1) << l1_shift) - 1)) != 0);
+  if ((header.l1_size < l1_needed) || (l1_needed * 8 > QCOW2_MAX_L1_SIZE)) {
+    BX_ERROR(("qcow2: invalid L1 table size %u", header.l1_size));
+    close();
+    return -1;
+  }
+  // a grown image may have a larger table, the entries beyond the disk size
+  // are never used
+  l1_size = (Bit32u) l1_needed;
+  l1_table = new Bit64u[l1_size];
+  if (bx_read_image(fd, header.l1_table_offset, l1_table, l1_size * 8) != (ssize_t)(l1_size * 8)) {
+    BX_ERROR(("qcow2: could not read L1 table"));
+    close();
+    return -1;
+  }
+
+  if ((header.refcount_table_clusters == 0) ||
+      (header.refcount_table_clusters > (QCOW2_MAX_REFTABLE_SIZE >> cluster_bits))) {
+    BX_ERROR(("qcow2: invalid refcount table size %u", header.refcount_table_clusters));
+    close();
+    return -1;
+  }
+  refcount_table_size = header.refcount_table_clusters << (cluster_bits - 3);
+  refcount_table = new Bit64u[refcount_table_size];
+  if (bx_read_image(fd, header.refcount_table_offset, refcount_table, refcount_table_size * 8) !=
+      (ssize_t)(refcount_table_size * 8)) {
+    BX_ERROR(("qcow2: could not read refcount table"));
+    close();
+    return -1;
+  }
+  refcount_block = new Bit16u[cluster_size / 2];
+  refcount_block_offset = 0;
+
+  for (int i = 0; i < QCOW2_L2_CACHE_SIZE; i++) {
+    l2_cache[i].offset = 0;
+    l2_cache[i].last_used = 0;
+    l2_cache[i].table = new Bit64u[l2_size];
+  }
+  l2_cache_counter = 0;
+
+  free_cluster_offset = (imgsize + cluster_size - 1) & ~((Bit64u) cluster_size - 1);
+
+  if ((header.backing_file_offset != 0) && !open_backing_file()) {
+    close();
+    return -1;
+  }
+
+  hd_size = header.size;
+  sect_size = 512;
+  cylinders = 0;
+  heads = 16;
+  spt = 63;
+  position = 0;
+
+  BX_DEBUG(("qcow2 disk image:"));
+  BX_DEBUG(("   .version      = %d", header.version));
+  BX_DEBUG(("   .size         = " FMT_LL "d", hd_size));
+  BX_DEBUG(("   .cluster_size = %d", cluster_size));
+  BX_DEBUG(("   .l1_size      = %d", l1_size));
+  BX_DEBUG(("   .backing_file = %s", backing_name ? backing_name : "none"));
+
+  return 1;
+}
+
+void qcow2_image_t::close()
+{
+  if (backing_image != NULL) {
+    backing_image->close();
+    delete backing_image;
+    backing_image = NULL;
+  }
+  delete [] backing_name; backing_name = NULL;
+  delete [] l1_table; l1_table = NULL;
+  delete [] refcount_table; refcount_table = NULL;
+  delete [] refcount_block; refcount_block = NULL;
+  for (int i = 0; i < QCOW2_L2_CACHE_SIZE; i++) {
+    delete [] l2_cache[i].table;
+    l2_cache[i].table = NULL;
+    l2_cache[i].offset = 0;
+  }
+
+  if (fd > -1) {
+    bx_close_image(fd, pathname);
+    fd = -1;
+  }
+}
+
+Bit64s qcow2_image_t::lseek(Bit64s offset, int whence)
+{
+  switch (whence) {
+    case SEEK_SET:
+      position = offset;
+      break;
+    case SEEK_CUR:
+      position += offset;
+      break;
+    case SEEK_END:
+      position = hd_size + offset;
+      break;
+    default:
+      BX_ERROR(("unknown 'whence' value (%d) when trying to seek qcow2 image", whence));
+      return -1;
+  }
+  if ((position < 0) || ((Bit64u) position > hd_size)) {
+    BX_ERROR(("qcow2: seek to offset " FMT_LL "d out of range", position));
+    return -1;
+  }
+  return position;
+}
+
+ssize_t qcow2_image_t::read(void* buf, size_t count)
+{
+  Bit8u *cbuf = (Bit8u*) buf;
+  ssize_t total = 0;
+
+  while (count > 0) {
+    if ((Bit64u) position >= hd_size) {
+      BX_ERROR(("qcow2: read beyond end of disk at offset " FMT_LL "d", position));
+      return -1;
+    }
+    Bit32u cluster_offset = (Bit32u)(position & (cluster_size - 1));
+    size_t n = cluster_size - cluster_offset;
+    if (n > count) n = count;
+
+    Bit64u *entry;
+    if (!get_l2_entry(position, 0, &entry, NULL))
+      return -1;
+    Bit64u l2_entry = (entry != NULL) ? qcow2_be64(*entry) : 0;
+    Bit64u host_offset = l2_entry & QCOW2_OFFSET_MASK;
+
+    if (l2_entry & QCOW2_OFLAG_COMPRESSED) {
+      BX_ERROR(("qcow2: compressed clusters are not supported"));
+      return -1;
+    } else if (l2_entry & QCOW2_OFLAG_ZERO) {
+      memset(cbuf, 0, n);
+    } else if (host_offset == 0) {
+      if (backing_image != NULL) {
+        if (read_backing(position, cbuf, n) < 0)
+          return -1;
+      } else {
+        memset(cbuf, 0, n);
+      }
+    } else {
+      // extend the read over guest clusters that are contiguous in the image
+      while (n < count) {
+        Bit64u next_entry;
+        if (!get_l2_entry(position + n, 0, &entry, NULL))
+          return -1;
+        if (entry == NULL)
+          break;
+        next_entry = qcow2_be64(*entry);
+        if ((next_entry & (QCOW2_OFLAG_COMPRESSED | QCOW2_OFLAG_ZERO)) ||
+            ((next_entry & QCOW2_OFFSET_MASK) != (host_offset + cluster_offset + n)))
+          break;
+        n += cluster_size;
+        if (n > count) n = count;
+      }
+      if (bx_read_image(fd, host_offset + cluster_offset, cbuf, (int) n) != (ssize_t) n) {
+        BX_ERROR(("qcow2: read error at offset " FMT_LL "d", position));
+        return -1;
+      }
+    }
+
+    position += n;
+    total += n;
+    cbuf += n;
+    count -= n;
+  }
+  return total;
+}
+
+ssize_t qcow2_image_t::write(const void* buf, size_t count)
+{
+  const Bit8u *cbuf = (const Bit8u*) buf;
+  ssize_t total = 0;
+
+  if (read_only) {
+    BX_ERROR(("qcow2: write to read-only image '%s'", pathname));
+    return -1;
+  }
+
+  while (count > 0) {
+    if ((Bit64u) position >= hd_size) {
+      BX_ERROR(("qcow2: write beyond end of disk at offset " FMT_LL "d", position));
+      return -1;
+    }
+    Bit32u cluster_offset = (Bit32u)(position & (cluster_size - 1));
+    size_t n = cluster_size - cluster_offset;
+    if (n > count) n = count;
+
+    Bit64u entry_offset;
+    Bit64u *entry;
+    if (!get_l2_entry(position, 1, &entry, &entry_offset))
+      return -1;
+    Bit64u l2_entry = qcow2_be64(*entry);
+    Bit64u host_offset = l2_entry & QCOW2_OFFSET_MASK;
+
+    if (l2_entry & QCOW2_OFLAG_COMPRESSED) {
+      BX_ERROR(("qcow2: compressed clusters are not supported"));
+      return -1;
+    }
+
+    if ((host_offset != 0) && (l2_entry & QCOW2_OFLAG_COPIED) && !(l2_entry & QCOW2_OFLAG_ZERO)) {
+      // cluster is owned by this image only, overwrite in place
+      if (bx_write_image(fd, host_offset + cluster_offset, (void*) cbuf, (int) n) != (ssize_t) n) {
+        BX_ERROR(("qcow2: write error at offset " FMT_LL "d", position));
+        return -1;
+      }
+    } else {
+      // copy on write into a newly allocated cluster
+      Bit64u new_offset = alloc_cluster();
+      if (new_offset == 0)
+        return -1;
+      if (n < cluster_size) {
+        Bit64u guest_cluster = position - cluster_offset;
+        Bit8u *cluster = new Bit8u[cluster_size];
+        ssize_t ret = cluster_size;
+        if ((l2_entry & QCOW2_OFLAG_ZERO) || ((host_offset == 0) && (backing_image == NULL))) {
+          memset(cluster, 0, cluster_size);
+        } else if (host_offset == 0) {
+          ret = read_backing(guest_cluster, cluster, cluster_size);
+        } else {
+          ret = bx_read_image(fd, host_offset, cluster, cluster_size);
+        }
+        memcpy(cluster + cluster_offset, cbuf, n);
+        if ((ret != (ssize_t) cluster_size) ||
+            (bx_write_image(fd, new_offset, cluster, cluster_size) != (ssize_t) cluster_size)) {
+          BX_ERROR(("qcow2: copy on write failed at offset " FMT_LL "d", position));
+          delete [] cluster;
+          return -1;
+        }
+        delete [] cluster;
+      } else if (bx_write_image(fd, new_offset, (void*) cbuf, cluster_size) != (ssize_t) cluster_size) {
+        BX_ERROR(("qcow2: write error at offset " FMT_LL "d", position));
+        return -1;
+      }
+      *entry = qcow2_be64(new_offset | QCOW2_OFLAG_COPIED);
+      if (bx_write_image(fd, entry_offset, entry, 8) != 8) {
+        BX_ERROR(("qcow2: could not update L2 table"));
+        return -1;
+      }
+      if (host_offset != 0)
+        update_refcount(host_offset, -1);
+    }
+
+    position += n;
+    total += n;
+    cbuf += n;
+    count -= n;
+  }
+  return total;
+}
+
+Bit32u qcow2_image_t::get_capabilities(void)
+{
+  Bit32u caps = HDIMAGE_AUTO_GEOMETRY;
+  if (read_only)
+    caps |= HDIMAGE_READONLY;
+  return caps;
+}
+
+int qcow2_image_t::check_format(int fd, Bit64u imgsize)
+{
+  qcow2_header_t temp_header;
+
+  if (bx_read_image(fd, 0, &temp_header, QCOW2_HEADER_V2_SIZE) != QCOW2_HEADER_V2_SIZE)
+    return HDIMAGE_READ_ERROR;
+
+  if (qcow2_be32(temp_header.magic) != QCOW2_MAGIC)
+    return HDIMAGE_NO_SIGNATURE;
+
+  Bit32u version = qcow2_be32(temp_header.version);
+  if ((version != 2) && (version != 3))
+    return HDIMAGE_VERSION_ERROR;
+
+  Bit32u bits = qcow2_be32(temp_header.cluster_bits);
+  if ((bits < QCOW2_MIN_CLUSTER_BITS) || (bits > QCOW2_MAX_CLUSTER_BITS) ||
+      (temp_header.crypt_method != 0))
+    return HDIMAGE_TYPE_ERROR;
+
+  if (version == 3) {
+    if (bx_read_image(fd, 0, &temp_header, QCOW2_HEADER_V3_SIZE) != QCOW2_HEADER_V3_SIZE)
+      return HDIMAGE_READ_ERROR;
+    // no incompatible features (dirty, corrupt, external data file, ...)
+    // and 16-bit refcounts only
+    if ((temp_header.incompatible_features != 0) ||
+        (qcow2_be32(temp_header.refcount_order) != 4))
+      return HDIMAGE_TYPE_ERROR;
+  }
+
+  return HDIMAGE_FORMAT_OK;
+}
+
+bx_bool qcow2_image_t::read_header()
+{
+  int ret;
+
+  if ((ret = check_format(fd, 0)) != HDIMAGE_FORMAT_OK) {
+    switch (ret) {
+      case HDIMAGE_READ_ERROR:
+        BX_ERROR(("qcow2 image read error"));
+        break;
+      case HDIMAGE_NO_SIGNATURE:
+        BX_ERROR(("not a qcow2 image"));
+        break;
+      case HDIMAGE_VERSION_ERROR:
+        BX_ERROR(("unsupported qcow2 image version"));
+        break;
+      case HDIMAGE_TYPE_ERROR:
+        BX_ERROR(("unsupported qcow2 image features"));
+        break;
+    }
+    return 0;
+  }
+
+  memset(&header, 0, sizeof(header));
+  if (bx_read_image(fd, 0, &header, QCOW2_HEADER_V2_SIZE) != QCOW2_HEADER_V2_SIZE)
+    return 0;
+
+  header.magic = qcow2_be32(header.magic);
+  header.version = qcow2_be32(header.version);
+  header.backing_file_offset = qcow2_be64(header.backing_file_offset);
+  header.backing_file_size = qcow2_be32(header.backing_file_size);
+  header.cluster_bits = qcow2_be32(header.cluster_bits);
+  header.size = qcow2_be64(header.size);
+  header.crypt_method = qcow2_be32(header.crypt_method);
+  header.l1_size = qcow2_be32(header.l1_size);
+  header.l1_table_offset = qcow2_be64(header.l1_table_offset);
+  header.refcount_table_offset = qcow2_be64(header.refcount_table_offset);
+  header.refcount_table_clusters = qcow2_be32(header.refcount_table_clusters);
+  header.nb_snapshots = qcow2_be32(header.nb_snapshots);
+  header.snapshots_offset = qcow2_be64(header.snapshots_offset);
+  header.refcount_order = 4;
+
+  return 1;
+}
+
+bx_bool qcow2_image_t::open_backing_file()
+{
+  if ((header.backing_file_size == 0) || (header.backing_file_size > 1023)) {
+    BX_ERROR(("qcow2: invalid backing file name size %d", header.backing_file_size));
+    return 0;
+  }
+
+  char *name = new char[header.backing_file_size + 1];
+  if (bx_read_image(fd, header.backing_file_offset, name, header.backing_file_size) !=
+      (ssize_t) header.backing_file_size) {
+    BX_ERROR(("qcow2: could not read backing file name"));
+    delete [] name;
+    return 0;
+  }
+  name[header.backing_file_size] = 0;
+
+  // relative names are relative to the directory of this image
+  const char *sep = strrchr(pathname, '/');
+#ifdef WIN32
+  const char *sep2 = strrchr(pathname, '\\');
+  if (sep2 > sep) sep = sep2;
+  bx_bool absolute = (name[0] == '/') || (name[0] == '\\') || (name[0] && (name[1] == ':'));
+#else
+  bx_bool absolute = (name[0] == '/');
+#endif
+  if (absolute || (sep == NULL)) {
+    backing_name = name;
+  } else {
+    size_t dirlen = sep - pathname + 1;
+    backing_name = new char[dirlen + strlen(name) + 1];
+    memcpy(backing_name, pathname, dirlen);
+    strcpy(backing_name + dirlen, name);
+    delete [] name;
+  }
+
+  int mode = hdimage_detect_image_mode(backing_name);
+  if (mode == BX_HDIMAGE_MODE_UNKNOWN) {
+    BX_ERROR(("qcow2: backing file '%s' mode not detected", backing_name));
+    return 0;
+  }
+  backing_image = DEV_hdimage_init_image(mode, 0, NULL);
+  if ((backing_image == NULL) || (backing_image->open(backing_name, O_RDONLY) < 0)) {
+    BX_ERROR(("qcow2: could not open backing file '%s'", backing_name));
+    delete backing_image;
+    backing_image = NULL;
+    return 0;
+  }
+  BX_INFO(("qcow2: backing file '%s' (%s)", backing_name, hdimage_mode_names[mode]));
+  return 1;
+}
+
+// Returns the L2 table at the given image offset from the cache, loading it
+// into the least recently used slot if necessary. A newly allocated table is
+// not read from the image, it is known to be zero.
+Bit64u *qcow2_image_t::get_l2_table(Bit64u l2_offset, bx_bool is_new)
+{
+  int i, victim = 0;
+
+  for (i = 0; i < QCOW2_L2_CACHE_SIZE; i++) {
+    if (l2_cache[i].offset == l2_offset) {
+      l2_cache[i].last_used = ++l2_cache_counter;
+      return l2_cache[i].table;
+    }
+    if (l2_cache[i].last_used < l2_cache[victim].last_used)
+      victim = i;
+  }
+
+  l2_cache[victim].offset = 0;
+  if (is_new) {
+    memset(l2_cache[victim].table, 0, cluster_size);
+  } else if (bx_read_image(fd, l2_offset, l2_cache[victim].table, cluster_size) != (ssize_t) cluster_size) {
+    BX_ERROR(("qcow2: could not read L2 table at offset " FMT_LL "d", l2_offset));
+    return NULL;
+  }
+  l2_cache[victim].offset = l2_offset;
+  l2_cache[victim].last_used = ++l2_cache_counter;
+  return l2_cache[victim].table;
+}
+
+// Looks up the cached L2 entry of a guest offset and returns 0 on failure.
+// 'entry' is set to NULL if there is no L2 table for it, unless 'alloc' is
+// set. Then a new L2 table is allocated and 'entry_offset' receives the image
+// offset of the entry.
+bx_bool qcow2_image_t::get_l2_entry(Bit64u guest_offset, bx_bool alloc, Bit64u **entry, Bit64u *entry_offset)
+{
+  Bit64u l1_index = guest_offset >> (l2_bits + cluster_bits);
+  Bit32u l2_index = (Bit32u)((guest_offset >> cluster_bits) & (l2_size - 1));
+  bx_bool is_new = 0;
+
+  *entry = NULL;
+  if (l1_index >= l1_size) {
+    BX_ERROR(("qcow2: offset " FMT_LL "d not covered by L1 table", guest_offset));
+    return 0;
+  }
+
+  Bit64u l2_offset = qcow2_be64(l1_table[l1_index]) & QCOW2_OFFSET_MASK;
+  if (l2_offset == 0) {
+    if (!alloc)
+      return 1;
+    l2_offset = alloc_cluster();
+    if ((l2_offset == 0) || !write_zero_cluster(l2_offset))
+      return 0;
+    l1_table[l1_index] = qcow2_be64(l2_offset | QCOW2_OFLAG_COPIED);
+    if (bx_write_image(fd, header.l1_table_offset + l1_index * 8, &l1_table[l1_index], 8) != 8) {
+      BX_ERROR(("qcow2: could not update L1 table"));
+      return 0;
+    }
+    is_new = 1;
+  }
+
+  Bit64u *table = get_l2_table(l2_offset, is_new);
+  if (table == NULL)
+    return 0;
+  if (entry_offset != NULL)
+    *entry_offset = l2_offset + l2_index * 8;
+  *entry = &table[l2_index];
+  return 1;
+}
+
+// Appends a cluster to the image and returns its offset (0 on failure)
+Bit64u qcow2_image_t::alloc_cluster()
+{
+  Bit64u offset = free_cluster_offset;
+
+  // reserved first, a new refcount block for it is appended behind it
+  free_cluster_offset += cluster_size;
+  if (!update_refcount(offset, 1)) {
+    if (free_cluster_offset == (offset + cluster_size))
+      free_cluster_offset = offset;
+    return 0;
+  }
+  return offset;
+}
+
+bx_bool qcow2_image_t::write_zero_cluster(Bit64u host_offset)
+{
+  Bit8u *zero = new Bit8u[cluster_size];
+  memset(zero, 0, cluster_size);
+  bx_bool ret = (bx_write_image(fd, host_offset, zero, cluster_size) == (ssize_t) cluster_size);
+  delete [] zero;
+  if (!ret)
+    BX_ERROR(("qcow2: could not write cluster at offset " FMT_LL "d", host_offset));
+  return ret;
+}
+
+bx_bool qcow2_image_t::update_refcount(Bit64u host_offset, int delta)
+{
+  Bit64u cluster_index = host_offset >> cluster_bits;
+  Bit64u table_index = cluster_index >> (cluster_bits - 1);
+  Bit32u block_index = (Bit32u)(cluster_index & ((cluster_size / 2) - 1));
+
+  if (table_index >= refcount_table_size) {
+    BX_ERROR(("qcow2: refcount table of '%s' is full", pathname));
+    return 0;
+  }
+
+  Bit64u block_offset = qcow2_be64(refcount_table[table_index]) & QCOW2_OFFSET_MASK;
+  if (block_offset == 0) {
+    // the new refcount block is appended and counts for itself
+    block_offset = free_cluster_offset;
+    if (!write_zero_cluster(block_offset))
+      return 0;
+    free_cluster_offset += cluster_size;
+    refcount_table[table_index] = qcow2_be64(block_offset);
+    if (bx_write_image(fd, header.refcount_table_offset + table_index * 8,
+                       &refcount_table[table_index], 8) != 8) {
+      BX_ERROR(("qcow2: could not update refcount table"));
+      return 0;
+    }
+    if (!update_refcount(block_offset, 1))
+      return 0;
+  }
+
+  if (refcount_block_offset != block_offset) {
+    refcount_block_offset = 0;
+    if (bx_read_image(fd, block_offset, refcount_block, cluster_size) != (ssize_t) cluster_size) {
+      BX_ERROR(("qcow2: could not read refcount block at offset " FMT_LL "d", block_offset));
+      return 0;
+    }
+    refcount_block_offset = block_offset;
+  }
+
+  int refcount = qcow2_be16(refcount_block[block_index]) + delta;
+  if ((refcount < 0) || (refcount > 0xffff)) {
+    BX_ERROR(("qcow2: refcount overflow for cluster at offset " FMT_LL "d", host_offset));
+    return 0;
+  }
+  refcount_block[block_index] = qcow2_be16((Bit16u) refcount);
+  if (bx_write_image(fd, block_offset + block_index * 2, &refcount_block[block_index], 2) != 2) {
+    BX_ERROR(("qcow2: could not update refcount block"));
+    return 0;
+  }
+  return 1;
+}
+
+// Reads from the backing file. The backing file may be smaller than this
+// image, the part beyond its end reads as zero.
+ssize_t qcow2_image_t::read_backing(Bit64u offset, void *buf, size_t count)
+{
+  size_t n = 0;
+
+  if (offset < backing_image->hd_size) {
+    n = count;
+    if ((offset + n) > backing_image->hd_size)
+      n = (size_t)(backing_image->hd_size - offset);
+    if ((backing_image->lseek(offset, SEEK_SET) < 0) ||
+        (backing_image->read(buf, n) != (ssize_t) n)) {
+      BX_ERROR(("qcow2: read error in backing file '%s'", backing_name));
+      return -1;
+    }
+  }
+  if (n < count)
+    memset((Bit8u*) buf + n, 0, count - n);
+  return count;
+}
+
+#ifndef BXIMAGE
+bx_bool qcow2_image_t::save_state(const char *backup_fname)
+{
+  return hdimage_backup_file(fd, backup_fname);
+}
+
+void qcow2_image_t::restore_state(const char *backup_fname)
+{
+  int temp_fd;
+  Bit64u imgsize;
+
+  if ((temp_fd = hdimage_open_file(backup_fname, O_RDONLY, &imgsize, NULL)) < 0) {
+    BX_PANIC(("Cannot open qcow2 image backup '%s'", backup_fname));
+    return;
+  }
+
+  if (check_format(temp_fd, imgsize) < HDIMAGE_FORMAT_OK) {
+    ::close(temp_fd);
+    BX_PANIC(("Cannot detect qcow2 image header"));
+    return;
+  }
+  ::close(temp_fd);
+  close();
+  if (!hdimage_copy_file(backup_fname, pathname)) {
+    BX_PANIC(("Failed to restore qcow2 image '%s'", pathname));
+    return;
+  }
+  device_image_t::open(pathname);
+}
+#endif
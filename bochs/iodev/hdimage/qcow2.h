@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// QEMU copy-on-write version 2 (qcow2) disk image support
+
+#ifndef BX_QCOW2_H
+#define BX_QCOW2_H
+
+#define QCOW2_MAGIC            0x514649fb  // 'Q' 'F' 'I' 0xfb
+#define QCOW2_HEADER_V2_SIZE   72
+#define QCOW2_HEADER_V3_SIZE   104
+
+#define QCOW2_MIN_CLUSTER_BITS 9
+#define QCOW2_MAX_CLUSTER_BITS 21
+
+// limits of the tables loaded into memory (same as qemu)
+#define QCOW2_MAX_L1_SIZE       0x2000000
+#define QCOW2_MAX_REFTABLE_SIZE 0x800000
+
+// L1 / L2 table entry flags
+#define QCOW2_OFLAG_COPIED     BX_CONST64(0x8000000000000000)
+#define QCOW2_OFLAG_COMPRESSED BX_CONST64(0x4000000000000000)
+#define QCOW2_OFLAG_ZERO       BX_CONST64(0x0000000000000001)
+#define QCOW2_OFFSET_MASK      BX_CONST64(0x00fffffffffffe00)
+
+// number of L2 tables kept in memory
+#define QCOW2_L2_CACHE_SIZE    16
+
+#if defined(_MSC_VER) && (_MSC_VER<1300)
+#pragma pack(push, 1)
+#elif defined(__MWERKS__) && defined(macintosh)
+#pragma options align=packed
+#endif
+
+// always big-endian
+typedef
+#if defined(_MSC_VER) && (_MSC_VER>=1300)
+__declspec(align(1))
+#endif
+struct qcow2_header_t {
+    Bit32u  magic;
+    Bit32u  version;
+    Bit64u  backing_file_offset;
+    Bit32u  backing_file_size;
+    Bit32u  cluster_bits;
+    Bit64u  size;
+    Bit32u  crypt_method;
+    Bit32u  l1_size;
+    Bit64u  l1_table_offset;
+    Bit64u  refcount_table_offset;
+    Bit32u  refcount_table_clusters;
+    Bit32u  nb_snapshots;
+    Bit64u  snapshots_offset;
+
+    // version 3 only
+    Bit64u  incompatible_features;
+    Bit64u  compatible_features;
+    Bit64u  autoclear_features;
+    Bit32u  refcount_order;
+    Bit32u  header_length;
+}
+#if !defined(_MSC_VER)
+GCC_ATTRIBUTE((packed))
+#endif
+qcow2_header_t;
+
+#if defined(_MSC_VER) && (_MSC_VER<1300)
+#pragma pack(pop)
+#elif defined(__MWERKS__) && defined(macintosh)
+#pragma options align=reset
+#endif
+
+class qcow2_image_t : public device_image_t
+{
+  public:
+    qcow2_image_t();
+    virtual ~qcow2_image_t();
+
+    int open(const char* pathname, int flags);
+    void close();
+    Bit64s lseek(Bit64s offset, int whence);
+    ssize_t read(void* buf, size_t count);
+    ssize_t write(const void* buf, size_t count);
+
+    Bit32u get_capabilities();
+    static int check_format(int fd, Bit64u imgsize);
+
+#ifndef BXIMAGE
+    bx_bool save_state(const char *backup_fname);
+    void restore_state(const char *backup_fname);
+#endif
+
+  private:
+    bx_bool read_header();
+    bx_bool open_backing_file();
+    Bit64u *get_l2_table(Bit64u l2_offset, bx_bool is_new);
+    bx_bool get_l2_entry(Bit64u guest_offset, bx_bool alloc, Bit64u **entry, Bit64u *entry_offset);
+    Bit64u alloc_cluster();
+    bx_bool update_refcount(Bit64u host_offset, int delta);
+    bx_bool write_zero_cluster(Bit64u host_offset);
+    ssize_t read_backing(Bit64u offset, void *buf, size_t count);
+
+    int fd;
+    const char *pathname;
+    bx_bool read_only;
+    qcow2_header_t header;      // kept in host endianness
+
+    Bit32u cluster_bits;
+    Bit32u cluster_size;
+    Bit32u l2_bits;
+    Bit32u l2_size;
+
+    Bit64u *l1_table;           // kept in disk (big) endianness
+    Bit32u l1_size;
+    Bit64u *refcount_table;     // kept in disk (big) endianness
+    Bit32u refcount_table_size;
+    Bit16u *refcount_block;     // single cached refcount block
+    Bit64u refcount_block_offset;
+    Bit64u free_cluster_offset; // new clusters are appended to the image
+
+    // LRU cache of L2 tables, kept in disk (big) endianness
+    struct {
+      Bit64u offset;
+      Bit64u last_used;
+      Bit64u *table;
+    } l2_cache[QCOW2_L2_CACHE_SIZE];
+    Bit64u l2_cache_counter;
+
+    device_image_t *backing_image;
+    char *backing_name;
+
+    Bit64s position;
+};
+
+#endif
@@ -349,6 +349,18 @@ vvfat_image_t::vvfat_image_t(Bit64u size, const char* _redolog_name)
   memset(&first_sectors[0], 0, 0xc000);
 
   hd_size = size;
+  cluster_to_mapping = NULL;
+  cluster_to_mapping_size = 0;
+  cache_counter = 0;
+  for (int i = 0; i < VVFAT_FD_CACHE_SIZE; i++) {
+    fd_cache[i].mapping_index = -1;
+    fd_cache[i].last_used = 0;
+  }
+  for (int i = 0; i < VVFAT_CACHE_LINES; i++) {
+    line_cache[i].count = 0;
+    line_cache[i].last_used = 0;
+    line_cache[i].data = NULL;
+  }
   redolog = new redolog_t();
   redolog_temp = NULL;
   redolog_name = NULL;
@@ -908,7 +920,7 @@ int vvfat_image_t::init_directories(const char* dirname)
   Bit64u volume_sector_count = 0, tmpsc;
 
   cluster_size   = sectors_per_cluster * 0x200;
-  cluster_buffer = new Bit8u[cluster_size];
+  clusters_per_line = VVFAT_CACHE_LINE_SIZE / cluster_size;
 
   bootsector = (bootsector_t*)(first_sectors + offset_to_bootsector * 0x200);
 
@@ -1015,6 +1027,17 @@ int vvfat_image_t::init_directories(const char* dirname)
   mapping = (mapping_t*)array_get(&this->mapping, 0);
   assert((fat_type == 32) || (mapping->end == 2));
 
+  // the mappings don't change anymore, so the cluster lookup can be flat
+  cluster_to_mapping_size = cluster_count + 2;
+  cluster_to_mapping = new int[cluster_to_mapping_size];
+  for (i = 0; i < cluster_to_mapping_size; i++)
+    cluster_to_mapping[i] = -1;
+  for (i = 0; i < this->mapping.next; i++) {
+    mapping = (mapping_t*)array_get(&this->mapping, i);
+    for (cluster = mapping->begin; (cluster < mapping->end) && (cluster < cluster_to_mapping_size); cluster++)
+      cluster_to_mapping[cluster] = i;
+  }
+
   // the FAT signature
   fat_set(0, max_fat_value);
   fat_set(1, max_fat_value);
@@ -1324,8 +1347,7 @@ int vvfat_image_t::open(const char* dirname, int flags)
     }
   }
 
-  current_cluster = 0xffff;
-  current_fd = 0;
+  current_cluster = 0xffffffff;
 
   if ((!use_mbr_file) && (offset_to_bootsector > 0))
     init_mbr();
@@ -1691,6 +1713,8 @@ void vvfat_image_t::commit_changes(void)
   mapping_t *mapping;
   int i;
 
+  // the host files are going to be modified
+  close_files();
   // read modified FAT
   fat2 = malloc(sectors_per_fat * 0x200);
   lseek(offset_to_fat * 0x200, SEEK_SET);
@@ -1741,8 +1765,13 @@ void vvfat_image_t::close(void)
     free(mapping->path);
   }
   array_free(&this->mapping);
-  if (cluster_buffer != NULL)
-    delete [] cluster_buffer;
+  close_files();
+  for (int i = 0; i < VVFAT_CACHE_LINES; i++) {
+    delete [] line_cache[i].data;
+    line_cache[i].data = NULL;
+  }
+  delete [] cluster_to_mapping;
+  cluster_to_mapping = NULL;
 
   redolog->close();
 
@@ -1773,53 +1802,31 @@ Bit64s vvfat_image_t::lseek(Bit64s offset, int whence)
   return 0;
 }
 
-void vvfat_image_t::close_current_file(void)
+// closes all cached host files and drops the cached file data
+void vvfat_image_t::close_files(void)
 {
-  if(current_mapping) {
-    current_mapping = NULL;
-    if (current_fd) {
-      ::close(current_fd);
-      current_fd = 0;
+  for (int i = 0; i < VVFAT_FD_CACHE_SIZE; i++) {
+    if (fd_cache[i].mapping_index >= 0) {
+      ::close(fd_cache[i].fd);
+      fd_cache[i].mapping_index = -1;
     }
+    fd_cache[i].last_used = 0;
   }
-  current_cluster = 0xffff;
-}
-
-// mappings between index1 and index2-1 are supposed to be ordered
-// return value is the index of the last mapping for which end>cluster_num
-int vvfat_image_t::find_mapping_for_cluster_aux(int cluster_num, int index1, int index2)
-{
-  while(1) {
-    int index3;
-    mapping_t* mapping;
-    index3 = (index1+index2) / 2;
-    mapping = (mapping_t*)array_get(&this->mapping, index3);
-    assert(mapping->begin < mapping->end);
-    if (mapping->begin >= (unsigned int)cluster_num) {
-      assert(index2 != index3 || index2 == 0);
-      if (index2 == index3)
-        return index1;
-      index2 = index3;
-    } else {
-      if (index1 == index3)
-        return (mapping->end <= (unsigned int)cluster_num) ? index2 : index1;
-      index1 = index3;
-    }
-    assert(index1 <= index2);
+  for (int i = 0; i < VVFAT_CACHE_LINES; i++) {
+    line_cache[i].count = 0;
+    line_cache[i].last_used = 0;
   }
+  current_cluster = 0xffffffff;
 }
 
 mapping_t* vvfat_image_t::find_mapping_for_cluster(int cluster_num)
 {
-  int index = find_mapping_for_cluster_aux(cluster_num, 0, mapping.next);
-  mapping_t* mapping;
-  if (index >= (int)this->mapping.next)
+  if ((cluster_num < 0) || ((Bit32u)cluster_num >= cluster_to_mapping_size))
     return NULL;
-  mapping = (mapping_t*)array_get(&this->mapping, index);
-  if ((int)mapping->begin > cluster_num)
+  int index = cluster_to_mapping[cluster_num];
+  if (index < 0)
     return NULL;
-  assert(((int)mapping->begin <= cluster_num) && ((int)mapping->end > cluster_num));
-  return mapping;
+  return (mapping_t*)array_get(&this->mapping, index);
 }
 
 // This function simply compares path == mapping->path. Since the mappings
@@ -1836,77 +1843,101 @@ mapping_t* vvfat_image_t::find_mapping_for_path(const char* path)
     return NULL;
 }
 
-int vvfat_image_t::open_file(mapping_t* mapping)
+// returns the host file descriptor for a mapping, opening the file and
+// closing the least recently used one if necessary
+int vvfat_image_t::open_file(int mapping_index)
 {
-  if (!mapping)
-    return -1;
-  if (!current_mapping ||
-    strcmp(current_mapping->path, mapping->path)) {
-    /* open file */
-    int fd = ::open(mapping->path, O_RDONLY
+  int i, slot = 0;
+
+  for (i = 0; i < VVFAT_FD_CACHE_SIZE; i++) {
+    if (fd_cache[i].mapping_index == mapping_index) {
+      fd_cache[i].last_used = ++cache_counter;
+      return fd_cache[i].fd;
+    }
+    if (fd_cache[i].last_used < fd_cache[slot].last_used)
+      slot = i;
+  }
+  mapping_t* mapping = (mapping_t*)array_get(&this->mapping, mapping_index);
+  int fd = ::open(mapping->path, O_RDONLY
 #ifdef O_BINARY
-                    | O_BINARY
+                  | O_BINARY
 #endif
 #ifdef O_LARGEFILE
-                    | O_LARGEFILE
+                  | O_LARGEFILE
 #endif
-                    );
-    if (fd < 0)
-      return -1;
-    close_current_file();
-    current_fd = fd;
-    current_mapping = mapping;
-  }
-  return 0;
+                  );
+  if (fd < 0)
+    return -1;
+  if (fd_cache[slot].mapping_index >= 0)
+    ::close(fd_cache[slot].fd);
+  fd_cache[slot].mapping_index = mapping_index;
+  fd_cache[slot].fd = fd;
+  fd_cache[slot].last_used = ++cache_counter;
+  return fd;
 }
 
 int vvfat_image_t::read_cluster(int cluster_num)
 {
   mapping_t* mapping;
+  off_t offset;
+  int i, slot = 0;
 
-  if (current_cluster != cluster_num) {
-    int result=0;
-    off_t offset;
-    assert(!current_mapping || current_fd || (current_mapping->mode & MODE_DIRECTORY));
-    if (!current_mapping
-        || ((int)current_mapping->begin > cluster_num)
-        || ((int)current_mapping->end <= cluster_num)) {
-      // binary search of mappings for file
-      mapping = find_mapping_for_cluster(cluster_num);
-
-      assert(!mapping || ((cluster_num >= (int)mapping->begin) && (cluster_num < (int)mapping->end)));
-
-      if (mapping && mapping->mode & MODE_DIRECTORY) {
-        close_current_file();
-        current_mapping = mapping;
-read_cluster_directory:
-        offset = cluster_size * (cluster_num - current_mapping->begin);
-        cluster = (unsigned char*)directory.pointer+offset
-                     + 0x20 * current_mapping->info.dir.first_dir_index;
-        assert(((cluster -(unsigned char*)directory.pointer) % cluster_size) == 0);
-        assert((char*)cluster + cluster_size <= directory.pointer + directory.next * directory.item_size);
-        current_cluster = cluster_num;
-        return 0;
-      }
+  if (current_cluster == (Bit32u)cluster_num)
+    return 0;
 
-      if (open_file(mapping))
-        return -2;
-    } else if (current_mapping->mode & MODE_DIRECTORY)
-      goto read_cluster_directory;
+  mapping = find_mapping_for_cluster(cluster_num);
+  if (mapping == NULL)
+    return -2;
 
-    assert(current_fd);
+  if (mapping->mode & MODE_DIRECTORY) {
+    offset = cluster_size * (cluster_num - mapping->begin);
+    cluster = (unsigned char*)directory.pointer+offset
+                 + 0x20 * mapping->info.dir.first_dir_index;
+    assert(((cluster -(unsigned char*)directory.pointer) % cluster_size) == 0);
+    assert((char*)cluster + cluster_size <= directory.pointer + directory.next * directory.item_size);
+    current_cluster = cluster_num;
+    return 0;
+  }
 
-    offset = cluster_size * (cluster_num - current_mapping->begin) + current_mapping->info.file.offset;
-    if (::lseek(current_fd, offset, SEEK_SET) != offset)
-      return -3;
-    cluster = cluster_buffer;
-    result = ::read(current_fd, cluster, cluster_size);
-    if (result < 0) {
-      current_cluster = 0xffff;
-      return -1;
+  for (i = 0; i < VVFAT_CACHE_LINES; i++) {
+    if ((line_cache[i].count > 0) && ((Bit32u)cluster_num >= line_cache[i].first) &&
+        ((Bit32u)cluster_num < (line_cache[i].first + line_cache[i].count))) {
+      line_cache[i].last_used = ++cache_counter;
+      cluster = line_cache[i].data + (cluster_num - line_cache[i].first) * cluster_size;
+      current_cluster = cluster_num;
+      return 0;
     }
-    current_cluster = cluster_num;
+    if (line_cache[i].last_used < line_cache[slot].last_used)
+      slot = i;
   }
+
+  // not cached: read ahead up to a line of clusters from the same file
+  int fd = open_file(cluster_to_mapping[cluster_num]);
+  if (fd < 0)
+    return -2;
+  Bit32u count = mapping->end - cluster_num;
+  if (count > clusters_per_line)
+    count = clusters_per_line;
+  if (line_cache[slot].data == NULL)
+    line_cache[slot].data = new Bit8u[clusters_per_line * cluster_size];
+  line_cache[slot].count = 0;
+  current_cluster = 0xffffffff;
+
+  offset = cluster_size * (cluster_num - mapping->begin) + mapping->info.file.offset;
+  if (::lseek(fd, offset, SEEK_SET) != offset)
+    return -3;
+  int len = count * cluster_size;
+  int result = ::read(fd, line_cache[slot].data, len);
+  if (result < 0)
+    return -1;
+  // the last cluster of a file is only partially used
+  if (result < len)
+    memset(line_cache[slot].data + result, 0, len - result);
+  line_cache[slot].first = cluster_num;
+  line_cache[slot].count = count;
+  line_cache[slot].last_used = ++cache_counter;
+  cluster = line_cache[slot].data;
+  current_cluster = cluster_num;
   return 0;
 }
 
@@ -31,6 +31,12 @@
 #ifndef BX_VVFAT_H
 #define BX_VVFAT_H
 
+// number of host files kept open
+#define VVFAT_FD_CACHE_SIZE   16
+// file data is read ahead in lines of up to 64 KB, the last 32 lines are kept
+#define VVFAT_CACHE_LINE_SIZE 0x10000
+#define VVFAT_CACHE_LINES     32
+
 typedef struct array_t {
   char *pointer;
   unsigned int size, next, item_size;
@@ -146,9 +152,8 @@ class vvfat_image_t : public device_image_t
     direntry_t* read_direntry(Bit8u *buffer, char *filename);
     void parse_directory(const char *path, Bit32u start_cluster);
     void commit_changes(void);
-    void close_current_file(void);
-    int open_file(mapping_t* mapping);
-    int find_mapping_for_cluster_aux(int cluster_num, int index1, int index2);
+    void close_files(void);
+    int open_file(int mapping_index);
     mapping_t* find_mapping_for_cluster(int cluster_num);
     mapping_t* find_mapping_for_path(const char* path);
     int read_cluster(int cluster_num);
@@ -172,11 +177,25 @@ class vvfat_image_t : public device_image_t
     Bit8u  fat_type;
     array_t fat, directory, mapping;
 
-    int current_fd;
     mapping_t* current_mapping;
     Bit8u  *cluster; // points to current cluster
-    Bit8u  *cluster_buffer; // points to a buffer to hold temp data
-    Bit16u current_cluster;
+    Bit32u current_cluster;
+
+    int    *cluster_to_mapping; // mapping index of each cluster, -1 if unused
+    Bit32u cluster_to_mapping_size;
+    Bit32u clusters_per_line;
+    Bit64u cache_counter;
+    struct {
+      int    mapping_index; // -1 if unused
+      int    fd;
+      Bit64u last_used;
+    } fd_cache[VVFAT_FD_CACHE_SIZE];
+    struct {
+      Bit32u first;         // first cluster in this line
+      Bit32u count;         // number of clusters, 0 if unused
+      Bit64u last_used;
+      Bit8u  *data;
+    } line_cache[VVFAT_CACHE_LINES];
 
     const char *vvfat_path;
     Bit32u sector_num;
@@ -44,6 +44,10 @@
 
 typedef Bit32u (*bx_read_handler_t)(void *, Bit32u, unsigned);
 typedef void   (*bx_write_handler_t)(void *, Bit32u, Bit32u, unsigned);
+// block handlers move up to 'count' quantums of 'io_len' bytes between the
+// port and a host buffer and return the number of quantums transferred
+typedef Bit32u (*bx_read_block_handler_t)(void *, Bit32u, unsigned, Bit8u *, Bit32u);
+typedef Bit32u (*bx_write_block_handler_t)(void *, Bit32u, unsigned, const Bit8u *, Bit32u);
 
 typedef bx_bool (*bx_kbd_gen_scancode_t)(void *, Bit32u);
 typedef void (*bx_mouse_enq_t)(void *, int, int, int, unsigned, bx_bool);
@@ -116,7 +120,7 @@ typedef struct {
     struct {
       memory_handler_t rh;
       memory_handler_t wh;
-      const Bit8u *dummy;
+      memory_direct_access_handler_t dah;
     } mem;
     struct {
       bx_read_handler_t rh;
@@ -144,7 +148,8 @@ public:
                      Bit8u headt, Bit8u intpin);
   void init_bar_io(Bit8u num, Bit16u size, bx_read_handler_t rh,
                    bx_write_handler_t wh, const Bit8u *mask);
-  void init_bar_mem(Bit8u num, Bit32u size, memory_handler_t rh, memory_handler_t wh);
+  void init_bar_mem(Bit8u num, Bit32u size, memory_handler_t rh, memory_handler_t wh,
+                    memory_direct_access_handler_t dah = NULL);
   void register_pci_state(bx_list_c *list);
   void after_restore_pci_state(memory_handler_t mem_read_handler);
   void load_pci_rom(const char *path);
@@ -426,10 +431,16 @@ public:
                                             Bit32u begin, Bit32u end, Bit8u mask);
   bx_bool register_default_io_read_handler(void *this_ptr, bx_read_handler_t f, const char *name, Bit8u mask);
   bx_bool register_default_io_write_handler(void *this_ptr, bx_write_handler_t f, const char *name, Bit8u mask);
+  bx_bool register_io_read_block_handler(void *this_ptr, bx_read_block_handler_t f,
+                                         Bit32u addr, const char *name, Bit8u mask);
+  bx_bool register_io_write_block_handler(void *this_ptr, bx_write_block_handler_t f,
+                                          Bit32u addr, const char *name, Bit8u mask);
   bx_bool register_irq(unsigned irq, const char *name);
   bx_bool unregister_irq(unsigned irq, const char *name);
   Bit32u inp(Bit16u addr, unsigned io_len) BX_CPP_AttrRegparmN(2);
   void   outp(Bit16u addr, Bit32u value, unsigned io_len) BX_CPP_AttrRegparmN(3);
+  Bit32u inp_block(Bit16u addr, unsigned io_len, Bit8u *data, Bit32u count);
+  Bit32u outp_block(Bit16u addr, unsigned io_len, const Bit8u *data, Bit32u count);
 
   void register_removable_keyboard(void *dev, bx_kbd_gen_scancode_t kbd_gen_scancode);
   void unregister_removable_keyboard(void *dev);
@@ -446,7 +457,8 @@ public:
   bx_bool register_pci_handlers(bx_pci_device_c *device, Bit8u *devfunc,
                                 const char *name, const char *descr, Bit8u bus = 0);
   bx_bool pci_set_base_mem(void *this_ptr, memory_handler_t f1, memory_handler_t f2,
-                           Bit32u *addr, Bit8u *pci_conf, unsigned size);
+                           Bit32u *addr, Bit8u *pci_conf, unsigned size,
+                           memory_direct_access_handler_t f3 = NULL);
   bx_bool pci_set_base_io(void *this_ptr, bx_read_handler_t f1, bx_write_handler_t f2,
                           Bit32u *addr, Bit8u *pci_conf, unsigned size,
                           const Bit8u *iomask, const char *name);
@@ -507,16 +519,6 @@ public:
   bx_acpi_ctrl_stub_c stubACPIController;
 #endif
 
-  // Some info to pass to devices which can handled bulk IO.  This allows
-  // the interface to remain the same for IO devices which can't handle
-  // bulk IO.  We should probably implement special INPBulk() and OUTBulk()
-  // functions which stick these values in the bx_devices_c class, and
-  // then call the normal functions rather than having gross globals
-  // variables.
-  Bit8u*   bulkIOHostAddr;
-  unsigned bulkIOQuantumsRequested;
-  unsigned bulkIOQuantumsTransferred;
-
 private:
 
   struct io_handler_struct {
@@ -534,6 +536,19 @@ private:
   struct io_handler_struct **read_port_to_handler;
   struct io_handler_struct **write_port_to_handler;
 
+  // Block transfer handlers used by the REP INS/OUTS fast path. Only a few
+  // ports (the ATA data registers) have one, so a short list is enough.
+  struct io_block_handler_struct {
+    struct io_block_handler_struct *next;
+    void *funct;
+    void *this_ptr;
+    char *handler_name;  // name of device
+    Bit16u addr;
+    Bit8u mask;          // io_len mask
+  };
+  struct io_block_handler_struct *io_read_block_handlers;
+  struct io_block_handler_struct *io_write_block_handlers;
+
   // more for informative purposes, the names of the devices which
   // are use each of the IRQ 0..15 lines are stored here
   char *irq_handler_name[BX_MAX_IRQS];
@@ -602,16 +617,16 @@ BX_CPP_INLINE void DEV_MEM_READ_PHYSICAL(bx_phy_address phy_addr, unsigned len,
   }
 }
 
+// DMA accesses may cross pages, contiguous host memory is copied in one go
 BX_CPP_INLINE void DEV_MEM_READ_PHYSICAL_DMA(bx_phy_address phy_addr, unsigned len, Bit8u *ptr)
 {
-  while(len > 0) { 
-    unsigned remainingInPage = 0x1000 - (phy_addr & 0xfff);
-    if (len < remainingInPage) remainingInPage = len;
-    BX_MEM(0)->dmaReadPhysicalPage(phy_addr, remainingInPage, ptr);
-    ptr += remainingInPage;
-    phy_addr += remainingInPage;
-    len -= remainingInPage;
-  }
+  bx_dma_sg_t sg = {phy_addr, len};
+  BX_MEM(0)->dma_read_sg(&sg, 1, ptr);
+}
+
+BX_CPP_INLINE void DEV_MEM_READ_PHYSICAL_SG(const bx_dma_sg_t *sg, unsigned count, Bit8u *ptr)
+{
+  BX_MEM(0)->dma_read_sg(sg, count, ptr);
 }
 
 // memory stub has an assumption that there are no memory accesses splitting 4K page
@@ -632,14 +647,13 @@ BX_CPP_INLINE void DEV_MEM_WRITE_PHYSICAL(bx_phy_address phy_addr, unsigned len,
 
 BX_CPP_INLINE void DEV_MEM_WRITE_PHYSICAL_DMA(bx_phy_address phy_addr, unsigned len, Bit8u *ptr)
 {
-  while(len > 0) { 
-    unsigned remainingInPage = 0x1000 - (phy_addr & 0xfff);
-    if (len < remainingInPage) remainingInPage = len;
-    BX_MEM(0)->dmaWritePhysicalPage(phy_addr, remainingInPage, ptr);
-    ptr += remainingInPage;
-    phy_addr += remainingInPage;
-    len -= remainingInPage;
-  }
+  bx_dma_sg_t sg = {phy_addr, len};
+  BX_MEM(0)->dma_write_sg(&sg, 1, ptr);
+}
+
+BX_CPP_INLINE void DEV_MEM_WRITE_PHYSICAL_SG(const bx_dma_sg_t *sg, unsigned count, const Bit8u *ptr)
+{
+  BX_MEM(0)->dma_write_sg(sg, count, ptr);
 }
 
 BOCHSAPI extern bx_devices_c bx_devices;
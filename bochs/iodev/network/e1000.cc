@@ -57,6 +57,7 @@ const Bit8u e1000_iomask[64] = {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 #define E1000_MDIC     0x00020  // MDI Control - RW
 #define E1000_VET      0x00038  // VLAN Ether Type - RW
 #define E1000_ICR      0x000C0  // Interrupt Cause Read - R/clr
+#define E1000_ITR      0x000C4  // Interrupt Throttling Rate - RW
 #define E1000_ICS      0x000C8  // Interrupt Cause Set - WO
 #define E1000_IMS      0x000D0  // Interrupt Mask Set - RW
 #define E1000_IMC      0x000D8  // Interrupt Mask Clear - WO
@@ -69,12 +70,16 @@ const Bit8u e1000_iomask[64] = {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 #define E1000_RDLEN    0x02808  // RX Descriptor Length - RW
 #define E1000_RDH      0x02810  // RX Descriptor Head - RW
 #define E1000_RDT      0x02818  // RX Descriptor Tail - RW
+#define E1000_RDTR     0x02820  // RX Delay Timer - RW
+#define E1000_RADV     0x0282C  // RX Interrupt Absolute Delay Timer - RW
 #define E1000_TDBAL    0x03800  // TX Descriptor Base Address Low - RW
 #define E1000_TDBAH    0x03804  // TX Descriptor Base Address High - RW
 #define E1000_TDLEN    0x03808  // TX Descriptor Length - RW
 #define E1000_TDH      0x03810  // TX Descriptor Head - RW
 #define E1000_TDT      0x03818  // TX Descripotr Tail - RW
+#define E1000_TIDV     0x03820  // TX Interrupt Delay Value - RW
 #define E1000_TXDCTL   0x03828  // TX Descriptor Control - RW
+#define E1000_TADV     0x0382C  // TX Interrupt Absolute Delay Val - RW
 #define E1000_CRCERRS  0x04000  // CRC Error Count - R/clr
 #define E1000_MPC      0x04010  // Missed Packet Count - R/clr
 #define E1000_GPRC     0x04074  // Good Packets RX Count - R/clr
@@ -185,6 +190,7 @@ const Bit8u e1000_iomask[64] = {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 #define E1000_TXD_CMD_RPS    0x10000000 // Report Packet Sent
 #define E1000_TXD_CMD_VLE    0x40000000 // Add VLAN tag
 #define E1000_TXD_CMD_DEXT   0x20000000 // Descriptor extension (0 = legacy)
+#define E1000_TXD_CMD_IDE    0x80000000 // Enable Tidv register
 #define E1000_TXD_STAT_DD    0x00000001 // Descriptor Done
 #define E1000_TXD_STAT_EC    0x00000002 // Excess Collisions
 #define E1000_TXD_STAT_LC    0x00000004 // Late Collisions
@@ -196,15 +202,6 @@ const Bit8u e1000_iomask[64] = {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 
 #define E1000_TCTL_EN     0x00000002    // enable tx
 
-struct e1000_rx_desc {
-  Bit64u buffer_addr; // Address of the descriptor's data buffer
-  Bit16u length;      // Length of data DMAed into data buffer
-  Bit16u csum;       // Packet checksum
-  Bit8u status;      // Descriptor status
-  Bit8u errors;      // Descriptor Errors
-  Bit16u special;
-};
-
 #define E1000_RXD_STAT_DD       0x01    // Descriptor Done
 #define E1000_RXD_STAT_EOP      0x02    // End of Packet
 #define E1000_RXD_STAT_IXSM     0x04    // Ignore checksum
@@ -263,7 +260,8 @@ enum {
   defreg(TORH),  defreg(TORL),  defreg(TOTH),   defreg(TOTL),
   defreg(TPR),   defreg(TPT),   defreg(TXDCTL), defreg(WUFC),
   defreg(RA),    defreg(MTA),   defreg(CRCERRS),defreg(VFTA),
-  defreg(VET),
+  defreg(VET),   defreg(ITR),   defreg(RDTR),   defreg(RADV),
+  defreg(TIDV),  defreg(TADV),
 };
 
 enum { PHY_R = 1, PHY_W = 2, PHY_RW = PHY_R | PHY_W };
@@ -407,6 +405,7 @@ bx_e1000_c::bx_e1000_c()
   put("E1000");
   memset(&s, 0, sizeof(bx_e1000_t));
   s.tx_timer_index = BX_NULL_TIMER_HANDLE;
+  s.mit_timer_index = BX_NULL_TIMER_HANDLE;
   ethdev = NULL;
 }
 
@@ -475,6 +474,10 @@ void bx_e1000_c::init(void)
     BX_E1000_THIS s.tx_timer_index =
       DEV_register_timer(this, tx_timer_handler, 0, 0, 0, "e1000"); // one-shot, inactive
   }
+  if (BX_E1000_THIS s.mit_timer_index == BX_NULL_TIMER_HANDLE) {
+    BX_E1000_THIS s.mit_timer_index =
+      DEV_register_timer(this, mit_timer_handler, 0, 0, 0, "e1000 mit"); // one-shot, inactive
+  }
   BX_E1000_THIS s.statusbar_id = bx_gui->register_statusitem("E1000", 1);
 
   // Attach to the selected ethernet module
@@ -537,6 +540,14 @@ void bx_e1000_c::reset(unsigned type)
   BX_E1000_THIS s.tx.vlan = saved_ptr;
   BX_E1000_THIS s.tx.data = BX_E1000_THIS s.tx.vlan + 4;
 
+  BX_E1000_THIS s.rx_desc_count = 0;
+  BX_E1000_THIS s.mit_cause = 0;
+  BX_E1000_THIS s.itr_time = 0;
+  BX_E1000_THIS s.itr_pending = 0;
+  if (BX_E1000_THIS s.mit_timer_index != BX_NULL_TIMER_HANDLE) {
+    bx_pc_system.deactivate_timer(BX_E1000_THIS s.mit_timer_index);
+  }
+
   // Deassert IRQ
   set_irq_level(0);
 }
@@ -589,13 +600,23 @@ void bx_e1000_c::register_state(void)
   BXRS_DEC_PARAM_FIELD(eecds, bitnum_out, BX_E1000_THIS s.eecd_state.bitnum_out);
   BXRS_PARAM_BOOL(eecds, reading, BX_E1000_THIS s.eecd_state.reading);
   BXRS_HEX_PARAM_FIELD(eecds, old_eecd, BX_E1000_THIS s.eecd_state.old_eecd);
+  bx_list_c *mit = new bx_list_c(list, "mit", "");
+  BXRS_HEX_PARAM_FIELD(mit, cause, BX_E1000_THIS s.mit_cause);
+  BXRS_DEC_PARAM_FIELD(mit, time, BX_E1000_THIS s.mit_time);
+  BXRS_DEC_PARAM_FIELD(mit, abs_time, BX_E1000_THIS s.mit_abs_time);
+  BXRS_DEC_PARAM_FIELD(mit, itr_time, BX_E1000_THIS s.itr_time);
+  BXRS_PARAM_BOOL(mit, itr_pending, BX_E1000_THIS s.itr_pending);
 
   register_pci_state(list);
 }
 
 void bx_e1000_c::after_restore_state(void)
 {
+  BX_E1000_THIS s.rx_desc_count = 0;
   bx_pci_device_c::after_restore_pci_state(mem_read_handler);
+  if (BX_E1000_THIS ethdev != NULL) {
+    BX_E1000_THIS ethdev->after_restore_state();
+  }
 }
 
 bx_bool bx_e1000_c::mem_read_handler(bx_phy_address addr, unsigned len,
@@ -662,6 +683,11 @@ bx_bool bx_e1000_c::mem_read_handler(bx_phy_address addr, unsigned len,
       case E1000_RDBAL:
       case E1000_TDLEN:
       case E1000_RDLEN:
+      case E1000_ITR:
+      case E1000_RDTR:
+      case E1000_RADV:
+      case E1000_TIDV:
+      case E1000_TADV:
         value = BX_E1000_THIS s.mac_reg[index];
         break;
       case E1000_TOTH:
@@ -730,15 +756,36 @@ bx_bool bx_e1000_c::mem_write_handler(bx_phy_address addr, unsigned len,
       case E1000_TDBAL:
       case E1000_TDBAH:
       case E1000_TXDCTL:
-      case E1000_RDBAH:
-      case E1000_RDBAL:
       case E1000_LEDCTL:
       case E1000_VET:
+      case E1000_TIDV:
+        BX_E1000_THIS s.mac_reg[index] = value;
+        break;
+      case E1000_RDTR:
+        BX_E1000_THIS s.mac_reg[index] = value & 0xffff;
+        // FPD: flush partial descriptor block, report pending packets now
+        if ((value & 0x80000000) && (BX_E1000_THIS s.mit_cause & E1000_ICS_RXT0)) {
+          BX_E1000_THIS s.mit_cause &= ~E1000_ICS_RXT0;
+          set_ics(E1000_ICS_RXT0);
+          update_mit_timer();
+        }
+        break;
+      case E1000_ITR:
+      case E1000_RADV:
+      case E1000_TADV:
+        BX_E1000_THIS s.mac_reg[index] = value & 0xffff;
+        break;
+      case E1000_RDBAH:
+      case E1000_RDBAL:
         BX_E1000_THIS s.mac_reg[index] = value;
+        BX_E1000_THIS s.rx_desc_count = 0;
         break;
       case E1000_TDLEN:
+        BX_E1000_THIS s.mac_reg[index] = value & 0xfff80;
+        break;
       case E1000_RDLEN:
         BX_E1000_THIS s.mac_reg[index] = value & 0xfff80;
+        BX_E1000_THIS s.rx_desc_count = 0;
         break;
       case E1000_TCTL:
       case E1000_TDT:
@@ -753,8 +800,11 @@ bx_bool bx_e1000_c::mem_write_handler(bx_phy_address addr, unsigned len,
         set_ics(value);
         break;
       case E1000_TDH:
+        BX_E1000_THIS s.mac_reg[index] = value & 0xffff;
+        break;
       case E1000_RDH:
         BX_E1000_THIS s.mac_reg[index] = value & 0xffff;
+        BX_E1000_THIS s.rx_desc_count = 0;
         break;
       case E1000_RDT:
         BX_E1000_THIS s.check_rxov = 0;
@@ -851,11 +901,25 @@ void bx_e1000_c::set_irq_level(bx_bool level)
 
 void bx_e1000_c::set_interrupt_cause(Bit32u value)
 {
+  bx_bool level;
+
   if (value != 0)
     value |= E1000_ICR_INT_ASSERTED;
   BX_E1000_THIS s.mac_reg[ICR] = value;
   BX_E1000_THIS s.mac_reg[ICS] = value;
-  set_irq_level((BX_E1000_THIS s.mac_reg[IMS] & BX_E1000_THIS s.mac_reg[ICR]) != 0);
+  level = (BX_E1000_THIS s.mac_reg[IMS] & BX_E1000_THIS s.mac_reg[ICR]) != 0;
+  if (level && (BX_E1000_THIS s.mac_reg[ITR] != 0)) {
+    // ITR: minimum interval between interrupts in 256 ns units
+    Bit64u now = bx_pc_system.time_usec();
+    if (now < BX_E1000_THIS s.itr_time) {
+      BX_E1000_THIS s.itr_pending = 1;
+      update_mit_timer();
+      return;
+    }
+    BX_E1000_THIS s.itr_time = now + ((BX_E1000_THIS s.mac_reg[ITR] * 256 + 999) / 1000);
+    BX_E1000_THIS s.itr_pending = 0;
+  }
+  set_irq_level(level);
 }
 
 void bx_e1000_c::set_ics(Bit32u value)
@@ -865,6 +929,65 @@ void bx_e1000_c::set_ics(Bit32u value)
   set_interrupt_cause(value | BX_E1000_THIS s.mac_reg[ICR]);
 }
 
+// Report 'value' after 'delay' (restarted with each event) but not later than
+// 'abs_delay' after the first event. Both are in 1.024 usec units, 0 disables
+// the absolute limit.
+void bx_e1000_c::delay_ics(Bit32u value, Bit32u delay, Bit32u abs_delay)
+{
+  Bit64u now = bx_pc_system.time_usec();
+
+  if (BX_E1000_THIS s.mit_cause == 0) {
+    BX_E1000_THIS s.mit_abs_time = (abs_delay != 0) ? now + ((abs_delay * 1024) / 1000) : 0;
+  }
+  BX_E1000_THIS s.mit_cause |= value;
+  BX_E1000_THIS s.mit_time = now + ((delay * 1024) / 1000);
+  if ((BX_E1000_THIS s.mit_abs_time != 0) &&
+      (BX_E1000_THIS s.mit_time > BX_E1000_THIS s.mit_abs_time)) {
+    BX_E1000_THIS s.mit_time = BX_E1000_THIS s.mit_abs_time;
+  }
+  update_mit_timer();
+}
+
+void bx_e1000_c::update_mit_timer(void)
+{
+  Bit64u now = bx_pc_system.time_usec(), next = BX_MAX_BIT64U;
+
+  if (BX_E1000_THIS s.mit_cause != 0) {
+    next = BX_E1000_THIS s.mit_time;
+  }
+  if (BX_E1000_THIS s.itr_pending && (BX_E1000_THIS s.itr_time < next)) {
+    next = BX_E1000_THIS s.itr_time;
+  }
+  if (next == BX_MAX_BIT64U) {
+    bx_pc_system.deactivate_timer(BX_E1000_THIS s.mit_timer_index);
+  } else {
+    bx_pc_system.activate_timer(BX_E1000_THIS s.mit_timer_index,
+                                (next > now) ? (Bit32u)(next - now) : 1, 0); // not continuous
+  }
+}
+
+void bx_e1000_c::mit_timer_handler(void *this_ptr)
+{
+  bx_e1000_c *class_ptr = (bx_e1000_c *) this_ptr;
+  class_ptr->mit_timer();
+}
+
+void bx_e1000_c::mit_timer(void)
+{
+  Bit64u now = bx_pc_system.time_usec();
+  Bit32u cause = 0;
+
+  if ((BX_E1000_THIS s.mit_cause != 0) && (now >= BX_E1000_THIS s.mit_time)) {
+    cause = BX_E1000_THIS s.mit_cause;
+    BX_E1000_THIS s.mit_cause = 0;
+  }
+  if ((cause != 0) || (BX_E1000_THIS s.itr_pending && (now >= BX_E1000_THIS s.itr_time))) {
+    BX_E1000_THIS s.itr_pending = 0;
+    set_ics(cause);
+  }
+  update_mit_timer();
+}
+
 int bx_e1000_c::rxbufsize(Bit32u v)
 {
   v &= E1000_RCTL_BSEX | E1000_RCTL_SZ_16384 | E1000_RCTL_SZ_8192 |
@@ -1162,7 +1285,7 @@ void bx_e1000_c::process_tx_desc(struct e1000_tx_desc *dp)
   tp->cptse = 0;
 }
 
-Bit32u bx_e1000_c::txdesc_writeback(bx_phy_address base, struct e1000_tx_desc *dp)
+Bit32u bx_e1000_c::txdesc_writeback(struct e1000_tx_desc *dp)
 {
   Bit32u txd_upper, txd_lower = le32_to_cpu(dp->lower.data);
 
@@ -1171,8 +1294,6 @@ Bit32u bx_e1000_c::txdesc_writeback(bx_phy_address base, struct e1000_tx_desc *d
   txd_upper = (le32_to_cpu(dp->upper.data) | E1000_TXD_STAT_DD) &
               ~(E1000_TXD_STAT_EC | E1000_TXD_STAT_LC | E1000_TXD_STAT_TU);
   dp->upper.data = cpu_to_le32(txd_upper);
-  DEV_MEM_WRITE_PHYSICAL_DMA(base + ((char *)&dp->upper - (char *)dp),
-                             sizeof(dp->upper), (Bit8u *)&dp->upper);
   return E1000_ICR_TXDW;
 }
 
@@ -1187,37 +1308,73 @@ Bit64u bx_e1000_c::tx_desc_base()
 void bx_e1000_c::start_xmit()
 {
   bx_phy_address base;
-  struct e1000_tx_desc desc;
+  struct e1000_tx_desc desc[E1000_DESC_BATCH];
   Bit32u tdh_start = BX_E1000_THIS s.mac_reg[TDH], cause = E1000_ICS_TXQE;
+  Bit32u ring_size, end, count, i, wb_first, wb_last;
+  bx_bool delayed = 0, wrapped = 0;
 
   if (!(BX_E1000_THIS s.mac_reg[TCTL] & E1000_TCTL_EN)) {
     BX_DEBUG(("tx disabled"));
     return;
   }
 
-  while (BX_E1000_THIS s.mac_reg[TDH] != BX_E1000_THIS s.mac_reg[TDT]) {
+  ring_size = BX_E1000_THIS s.mac_reg[TDLEN] / sizeof(struct e1000_tx_desc);
+  while (!wrapped && (BX_E1000_THIS s.mac_reg[TDH] != BX_E1000_THIS s.mac_reg[TDT])) {
+    // fetch the descriptors up to TDT or the end of the ring at once
+    end = (BX_E1000_THIS s.mac_reg[TDT] > BX_E1000_THIS s.mac_reg[TDH]) ?
+          BX_E1000_THIS s.mac_reg[TDT] : ring_size;
+    count = (end > BX_E1000_THIS s.mac_reg[TDH]) ? (end - BX_E1000_THIS s.mac_reg[TDH]) : 1;
+    if (count > E1000_DESC_BATCH)
+      count = E1000_DESC_BATCH;
     base = tx_desc_base() +
            sizeof(struct e1000_tx_desc) * BX_E1000_THIS s.mac_reg[TDH];
-    DEV_MEM_READ_PHYSICAL_DMA(base, sizeof(struct e1000_tx_desc), (Bit8u *)&desc);
-    BX_DEBUG(("index %d: %p : %x %x", BX_E1000_THIS s.mac_reg[TDH],
-              (void *)desc.buffer_addr, desc.lower.data,
-               desc.upper.data));
-
-    process_tx_desc(&desc);
-    cause |= txdesc_writeback(base, &desc);
-
-    if (++BX_E1000_THIS s.mac_reg[TDH] * sizeof(desc) >= BX_E1000_THIS s.mac_reg[TDLEN])
-        BX_E1000_THIS s.mac_reg[TDH] = 0;
-    /*
-     * the following could happen only if guest sw assigns
-     * bogus values to TDT/TDLEN.
-     * there's nothing too intelligent we could do about this.
-     */
-    if (BX_E1000_THIS s.mac_reg[TDH] == tdh_start) {
-      BX_ERROR(("TDH wraparound @%x, TDT %x, TDLEN %x", tdh_start,
-                BX_E1000_THIS s.mac_reg[TDT], BX_E1000_THIS s.mac_reg[TDLEN]));
-      break;
+    DEV_MEM_READ_PHYSICAL_DMA(base, count * sizeof(struct e1000_tx_desc), (Bit8u *)desc);
+
+    wb_first = count;
+    wb_last = 0;
+    for (i = 0; i < count; i++) {
+      BX_DEBUG(("index %d: %p : %x %x", BX_E1000_THIS s.mac_reg[TDH],
+                (void *)desc[i].buffer_addr, desc[i].lower.data,
+                 desc[i].upper.data));
+
+      process_tx_desc(&desc[i]);
+      if (txdesc_writeback(&desc[i]) != 0) {
+        if (wb_first == count)
+          wb_first = i;
+        wb_last = i;
+        // TIDV only applies to descriptors with the IDE bit set
+        if ((le32_to_cpu(desc[i].lower.data) & E1000_TXD_CMD_IDE) &&
+            (BX_E1000_THIS s.mac_reg[TIDV] & 0xffff)) {
+          delayed = 1;
+        } else {
+          cause |= E1000_ICR_TXDW;
+        }
+      }
+
+      if (++BX_E1000_THIS s.mac_reg[TDH] * sizeof(struct e1000_tx_desc) >= BX_E1000_THIS s.mac_reg[TDLEN])
+          BX_E1000_THIS s.mac_reg[TDH] = 0;
+      /*
+       * the following could happen only if guest sw assigns
+       * bogus values to TDT/TDLEN.
+       * there's nothing too intelligent we could do about this.
+       */
+      if (BX_E1000_THIS s.mac_reg[TDH] == tdh_start) {
+        BX_ERROR(("TDH wraparound @%x, TDT %x, TDLEN %x", tdh_start,
+                  BX_E1000_THIS s.mac_reg[TDT], BX_E1000_THIS s.mac_reg[TDLEN]));
+        wrapped = 1;
+        break;
+      }
     }
+    // write back the status of the batch at once
+    if (wb_first < count) {
+      DEV_MEM_WRITE_PHYSICAL_DMA(base + wb_first * sizeof(struct e1000_tx_desc),
+                                 (wb_last - wb_first + 1) * sizeof(struct e1000_tx_desc),
+                                 (Bit8u *)&desc[wb_first]);
+    }
+  }
+  if (delayed) {
+    delay_ics(E1000_ICR_TXDW, BX_E1000_THIS s.mac_reg[TIDV] & 0xffff,
+              BX_E1000_THIS s.mac_reg[TADV]);
   }
   BX_E1000_THIS s.tx.int_cause = cause;
   bx_pc_system.activate_timer(BX_E1000_THIS s.tx_timer_index, 10, 0); // not continuous
@@ -1312,6 +1469,32 @@ Bit64u bx_e1000_c::rx_desc_base()
   return (bah << 32) + bal;
 }
 
+// Read the descriptor at ring index 'index', which must be RDH. Descriptors
+// between RDH and RDT belong to the device, so they are fetched in batches.
+void bx_e1000_c::rx_desc_fetch(Bit32u index, struct e1000_rx_desc *desc)
+{
+  Bit32u ring_size, end, count;
+
+  if ((BX_E1000_THIS s.rx_desc_count == 0) || (index != BX_E1000_THIS s.rx_desc_next)) {
+    ring_size = BX_E1000_THIS s.mac_reg[RDLEN] / sizeof(struct e1000_rx_desc);
+    end = (BX_E1000_THIS s.mac_reg[RDT] > index) ? BX_E1000_THIS s.mac_reg[RDT] : ring_size;
+    count = (end > index) ? (end - index) : 1;
+    if (count > E1000_DESC_BATCH)
+      count = E1000_DESC_BATCH;
+    DEV_MEM_READ_PHYSICAL_DMA(rx_desc_base() + sizeof(struct e1000_rx_desc) * index,
+                              count * sizeof(struct e1000_rx_desc),
+                              (Bit8u *)BX_E1000_THIS s.rx_desc);
+    BX_E1000_THIS s.rx_desc_next = index;
+    BX_E1000_THIS s.rx_desc_pos = 0;
+    BX_E1000_THIS s.rx_desc_count = count;
+  }
+  // the guest owns the descriptor after the write-back, so drop it here
+  memcpy(desc, &BX_E1000_THIS s.rx_desc[BX_E1000_THIS s.rx_desc_pos], sizeof(*desc));
+  BX_E1000_THIS s.rx_desc_next++;
+  BX_E1000_THIS s.rx_desc_pos++;
+  BX_E1000_THIS s.rx_desc_count--;
+}
+
 /*
  * Callback from the eth system driver to check if the device can receive
  */
@@ -1341,9 +1524,8 @@ void bx_e1000_c::rx_handler(void *arg, const void *buf, unsigned len)
 
 void bx_e1000_c::rx_frame(const void *buf, unsigned buf_size)
 {
-  struct e1000_rx_desc desc;
-  bx_phy_address base;
-  unsigned int n, rdt;
+  struct e1000_rx_desc desc, wb[E1000_DESC_BATCH];
+  unsigned int n, rdt, wb_first = 0, wb_count = 0;
   Bit32u rdh_start;
   Bit16u vlan_special = 0;
   Bit8u vlan_status = 0, vlan_offset = 0;
@@ -1386,8 +1568,9 @@ void bx_e1000_c::rx_frame(const void *buf, unsigned buf_size)
     if (desc_size > BX_E1000_THIS s.rxbuf_size) {
         desc_size = BX_E1000_THIS s.rxbuf_size;
     }
-    base = rx_desc_base() + sizeof(desc) * BX_E1000_THIS s.mac_reg[RDH];
-    DEV_MEM_READ_PHYSICAL_DMA(base, sizeof(desc), (Bit8u *)&desc);
+    if (wb_count == 0)
+      wb_first = BX_E1000_THIS s.mac_reg[RDH];
+    rx_desc_fetch(BX_E1000_THIS s.mac_reg[RDH], &desc);
     desc.special = vlan_special;
     desc.status |= (vlan_status | E1000_RXD_STAT_DD);
     if (desc.buffer_addr) {
@@ -1411,10 +1594,17 @@ void bx_e1000_c::rx_frame(const void *buf, unsigned buf_size)
     } else { // as per intel docs; skip descriptors with null buf addr
       BX_ERROR(("Null RX descriptor!!"));
     }
-    DEV_MEM_WRITE_PHYSICAL_DMA(base, sizeof(desc), (Bit8u *)&desc);
+    wb[wb_count++] = desc;
     if (++BX_E1000_THIS s.mac_reg[RDH] * sizeof(desc) >= BX_E1000_THIS s.mac_reg[RDLEN])
         BX_E1000_THIS s.mac_reg[RDH] = 0;
     BX_E1000_THIS s.check_rxov = 1;
+    // write back contiguous descriptors at once
+    if ((wb_count == E1000_DESC_BATCH) || (BX_E1000_THIS s.mac_reg[RDH] == 0) ||
+        (BX_E1000_THIS s.mac_reg[RDH] == rdh_start) || (desc_offset >= total_size)) {
+      DEV_MEM_WRITE_PHYSICAL_DMA(rx_desc_base() + sizeof(desc) * wb_first,
+                                 wb_count * sizeof(desc), (Bit8u *)wb);
+      wb_count = 0;
+    }
     /* see comment in start_xmit; same here */
     if (BX_E1000_THIS s.mac_reg[RDH] == rdh_start) {
         BX_DEBUG(("RDH wraparound @%x, RDT %x, RDLEN %x",
@@ -1442,7 +1632,15 @@ void bx_e1000_c::rx_frame(const void *buf, unsigned buf_size)
       BX_E1000_THIS s.rxbuf_min_shift)
     n |= E1000_ICS_RXDMT0;
 
-  set_ics(n);
+  if (BX_E1000_THIS s.mac_reg[RDTR] & 0xffff) {
+    // RDTR delays the receive timer interrupt, RADV limits the delay
+    if (n & ~E1000_ICS_RXT0)
+      set_ics(n & ~E1000_ICS_RXT0);
+    delay_ics(E1000_ICS_RXT0, BX_E1000_THIS s.mac_reg[RDTR] & 0xffff,
+              BX_E1000_THIS s.mac_reg[RADV]);
+  } else {
+    set_ics(n);
+  }
 
   bx_gui->statusbar_setitem(BX_E1000_THIS s.statusbar_id, 1);
 }
@@ -42,6 +42,9 @@
 #  define BX_E1000_THIS_PTR this
 #endif
 
+// number of descriptors fetched / written back with one DMA transfer
+#define E1000_DESC_BATCH 16
+
 struct e1000_tx_desc {
   Bit64u buffer_addr;   // Address of the descriptor's data buffer
   union {
@@ -87,6 +90,15 @@ typedef struct {
   Bit32u  int_cause;
 } e1000_tx;
 
+struct e1000_rx_desc {
+  Bit64u buffer_addr; // Address of the descriptor's data buffer
+  Bit16u length;      // Length of data DMAed into data buffer
+  Bit16u csum;       // Packet checksum
+  Bit8u status;      // Descriptor status
+  Bit8u errors;      // Descriptor Errors
+  Bit16u special;
+};
+
 typedef struct {
   Bit32u *mac_reg;
   Bit16u phy_reg[0x20];
@@ -98,6 +110,19 @@ typedef struct {
 
   e1000_tx tx;
 
+  // prefetched rx descriptors, not part of the saved state
+  struct e1000_rx_desc rx_desc[E1000_DESC_BATCH];
+  Bit32u  rx_desc_next;   // ring index of the next prefetched descriptor
+  Bit32u  rx_desc_pos;    // its position in rx_desc[]
+  Bit32u  rx_desc_count;  // number of prefetched descriptors left
+
+  // interrupt moderation (ITR, RDTR/RADV, TIDV/TADV)
+  Bit32u  mit_cause;      // causes waiting for the delay timers
+  Bit64u  mit_time;       // usec when they are reported
+  Bit64u  mit_abs_time;   // absolute delay limit, 0 if none
+  Bit64u  itr_time;       // usec before INTA must not be asserted again
+  bx_bool itr_pending;
+
   struct {
     Bit32u  val_in; // shifted in from guest driver
     Bit16u  bitnum_in;
@@ -107,6 +132,7 @@ typedef struct {
   } eecd_state;
 
   int tx_timer_index;
+  int mit_timer_index;
   int statusbar_id;
 
   Bit8u devfunc;
@@ -132,6 +158,8 @@ private:
   BX_E1000_SMF void    set_irq_level(bx_bool level);
   BX_E1000_SMF void    set_interrupt_cause(Bit32u val);
   BX_E1000_SMF void    set_ics(Bit32u value);
+  BX_E1000_SMF void    delay_ics(Bit32u value, Bit32u delay, Bit32u abs_delay);
+  BX_E1000_SMF void    update_mit_timer(void);
   BX_E1000_SMF int     rxbufsize(Bit32u v);
   BX_E1000_SMF void    set_rx_control(Bit32u value);
   BX_E1000_SMF void    set_mdic(Bit32u value);
@@ -146,16 +174,19 @@ private:
   BX_E1000_SMF int     fcs_len(void);
   BX_E1000_SMF void    xmit_seg(void);
   BX_E1000_SMF void    process_tx_desc(struct e1000_tx_desc *dp);
-  BX_E1000_SMF Bit32u  txdesc_writeback(bx_phy_address base, struct e1000_tx_desc *dp);
+  BX_E1000_SMF Bit32u  txdesc_writeback(struct e1000_tx_desc *dp);
   BX_E1000_SMF Bit64u  tx_desc_base(void);
   BX_E1000_SMF void    start_xmit(void);
 
   static void tx_timer_handler(void *);
   void tx_timer(void);
+  static void mit_timer_handler(void *);
+  void mit_timer(void);
 
   BX_E1000_SMF int     receive_filter(const Bit8u *buf, int size);
   BX_E1000_SMF bx_bool e1000_has_rxbufs(size_t total_size);
   BX_E1000_SMF Bit64u  rx_desc_base(void);
+  BX_E1000_SMF void    rx_desc_fetch(Bit32u index, struct e1000_rx_desc *desc);
 
   static Bit32u rx_status_handler(void *arg);
   BX_E1000_SMF Bit32u rx_status(void);
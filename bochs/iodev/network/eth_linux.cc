@@ -77,6 +77,7 @@ extern "C" {
 };
 
 #define BX_PACKET_POLL  1000    // Poll for a frame every 1000 usecs
+#define BX_LINUX_RX_VLEN   8    // frames per recvmmsg() call
 
 // template filter for a unicast mac address and all
 // multicast/broadcast frames
@@ -110,6 +111,7 @@ public:
                       eth_rx_status_t rxstat,
                       bx_devmodel_c *dev,
                       const char *script);
+  virtual ~bx_linux_pktmover_c();
   void sendpkt(void *buf, unsigned io_len);
 
 private:
@@ -118,6 +120,7 @@ private:
   int ifindex;
   static void rx_timer_handler(void *);
   void rx_timer(void);
+  void rx_frame(const struct sockaddr_ll *sll, Bit8u *rxbuf, int nbytes);
   int rx_timer_index;
   struct sock_filter filter[BX_LSF_ICNT];
 };
@@ -238,15 +241,32 @@ bx_linux_pktmover_c::bx_linux_pktmover_c(const char *netif,
   }
 
   // Start the rx poll
-  this->rx_timer_index =
-    DEV_register_timer(this, this->rx_timer_handler, BX_PACKET_POLL, 1, 1,
-                       "eth_linux"); // continuous, active
+  this->rx_timer_index = BX_NULL_TIMER_HANDLE;
+#if BX_HAVE_EPOLL
+  if (!bx_netmod_ctl.register_rx_fd(this->fd, this->rx_timer_handler, this))
+#endif
+  {
+    this->rx_timer_index =
+      DEV_register_timer(this, this->rx_timer_handler, BX_PACKET_POLL, 1, 1,
+                         "eth_linux"); // continuous, active
+  }
 
   this->rxh    = rxh;
   this->rxstat = rxstat;
   BX_INFO(("linux network driver initialized: using interface %s", netif));
 }
 
+// the destructor
+bx_linux_pktmover_c::~bx_linux_pktmover_c()
+{
+  if (this->fd != -1) {
+#if BX_HAVE_EPOLL
+    bx_netmod_ctl.unregister_rx_fd(this->fd);
+#endif
+    close(this->fd);
+  }
+}
+
 // the output routine - called with pre-formatted ethernet frame.
 void
 bx_linux_pktmover_c::sendpkt(void *buf, unsigned io_len)
@@ -272,26 +292,67 @@ bx_linux_pktmover_c::rx_timer_handler(void *this_ptr)
 void
 bx_linux_pktmover_c::rx_timer(void)
 {
-  int nbytes = 0;
-  Bit8u rxbuf[BX_PACKET_BUFSIZE];
-  struct sockaddr_ll sll;
-  socklen_t fromlen;
+  unsigned count = 0;
 
   if (this->fd == -1)
     return;
 
-  fromlen = sizeof(sll);
-  nbytes = recvfrom(this->fd, rxbuf, sizeof(rxbuf), 0, (struct sockaddr *)&sll, &fromlen);
-
-  if (nbytes == -1) {
-    if (errno != EAGAIN)
-      BX_INFO(("eth_linux: error receiving packet: %s\n", strerror(errno)));
-    return;
+  // Drain up to BX_NETDEV_RX_BATCH frames per poll. Frames are left in the
+  // socket queue as long as the device is not ready to take them.
+  while ((count < BX_NETDEV_RX_BATCH) &&
+         (this->rxstat(this->netdev) & BX_NETDEV_RXREADY)) {
+#if BX_HAVE_RECVMMSG
+    Bit8u rxbuf[BX_LINUX_RX_VLEN][BX_PACKET_BUFSIZE];
+    struct sockaddr_ll sll[BX_LINUX_RX_VLEN];
+    struct iovec iov[BX_LINUX_RX_VLEN];
+    struct mmsghdr msg[BX_LINUX_RX_VLEN];
+    int i, n;
+
+    memset(msg, 0, sizeof(msg));
+    for (i = 0; i < BX_LINUX_RX_VLEN; i++) {
+      iov[i].iov_base = rxbuf[i];
+      iov[i].iov_len = BX_PACKET_BUFSIZE;
+      msg[i].msg_hdr.msg_name = &sll[i];
+      msg[i].msg_hdr.msg_namelen = sizeof(sll[i]);
+      msg[i].msg_hdr.msg_iov = &iov[i];
+      msg[i].msg_hdr.msg_iovlen = 1;
+    }
+    n = recvmmsg(this->fd, msg, BX_LINUX_RX_VLEN, MSG_DONTWAIT, NULL);
+    if (n == -1) {
+      if (errno != EAGAIN)
+        BX_INFO(("eth_linux: error receiving packet: %s\n", strerror(errno)));
+      return;
+    }
+    for (i = 0; i < n; i++) {
+      rx_frame(&sll[i], rxbuf[i], msg[i].msg_len);
+    }
+    count += n;
+    if (n < BX_LINUX_RX_VLEN)
+      break;
+#else
+    Bit8u rxbuf[BX_PACKET_BUFSIZE];
+    struct sockaddr_ll sll;
+    socklen_t fromlen = sizeof(sll);
+    int nbytes;
+
+    nbytes = recvfrom(this->fd, rxbuf, sizeof(rxbuf), 0, (struct sockaddr *)&sll, &fromlen);
+    if (nbytes == -1) {
+      if (errno != EAGAIN)
+        BX_INFO(("eth_linux: error receiving packet: %s\n", strerror(errno)));
+      return;
+    }
+    rx_frame(&sll, rxbuf, nbytes);
+    count++;
+#endif
   }
+}
 
+void
+bx_linux_pktmover_c::rx_frame(const struct sockaddr_ll *sll, Bit8u *rxbuf, int nbytes)
+{
   // this should be done with LSF someday
   // filter out packets sourced by us
-  if (memcmp(sll.sll_addr, this->linux_macaddr, 6) == 0)
+  if (memcmp(sll->sll_addr, this->linux_macaddr, 6) == 0)
     return;
   // let through broadcast, multicast, and our mac address
 //  if ((memcmp(rxbuf, broadcast_macaddr, 6) == 0) || (memcmp(rxbuf, this->linux_macaddr, 6) == 0) || rxbuf[0] & 0x01) {
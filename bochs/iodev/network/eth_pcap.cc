@@ -0,0 +1,367 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// pcap replay / record packetmover
+//
+// Frames from the pcap file named by 'ethdev' are handed to the guest at
+// emulated time offsets taken from the capture timestamps. Timing is based
+// on CPU ticks only, so a replay is reproducible byte for byte. The replay
+// position is part of the save/restore state and the file is read again on
+// restore, so a fuzzer can put a new case into the file (e.g. on tmpfs) and
+// restore a snapshot to run it.
+// Frames sent by the guest are recorded to the pcap file named by 'script'
+// using the emulated time as timestamp.
+
+#define BX_PLUGGABLE
+
+#include "iodev.h"
+#include "netmod.h"
+
+#if BX_NETWORKING
+
+// network driver plugin entry points
+
+int CDECL libpcap_net_plugin_init(plugin_t *plugin, plugintype_t type)
+{
+  // Nothing here yet
+  return 0; // Success
+}
+
+void CDECL libpcap_net_plugin_fini(void)
+{
+  // Nothing here yet
+}
+
+// network driver implementation
+
+#define LOG_THIS netdev->
+
+#define PCAP_MAGIC_USEC      0xa1b2c3d4
+#define PCAP_MAGIC_NSEC      0xa1b23c4d
+#define PCAP_VERSION_MAJOR   2
+#define PCAP_VERSION_MINOR   4
+#define PCAP_LINKTYPE_ETHER  1
+#define PCAP_HEADER_SIZE     24
+#define PCAP_RECORD_SIZE     16
+
+// delay before the first frame and between retries while the device is busy
+#define BX_PCAP_RETRY_USEC   1000
+
+//
+//  Define the class. This is private to this module
+//
+class bx_pcap_pktmover_c : public eth_pktmover_c {
+public:
+  bx_pcap_pktmover_c(const char *netif, const char *macaddr,
+                     eth_rx_handler_t rxh,
+                     eth_rx_status_t rxstat,
+                     bx_devmodel_c *dev, const char *script);
+  virtual ~bx_pcap_pktmover_c();
+  void sendpkt(void *buf, unsigned io_len);
+  void after_restore_state(void);
+private:
+  bx_bool load_feed(void);
+  Bit32u get_feed32(Bit32u offset);
+  Bit64u get_timestamp(Bit32u offset);
+  Bit64u usec_to_ticks(Bit64u usec);
+  void schedule(Bit64u usec);
+  static void rx_timer_handler(void *);
+  void rx_timer(void);
+
+  char *feed_name;
+  Bit8u *feed;
+  Bit32u feed_size;
+  bx_bool feed_swapped;
+  bx_bool feed_nsec;
+  Bit32u feed_pos;    // file offset of the next record to deliver
+  Bit32u frames;      // number of frames delivered
+  Bit64u ips;
+  int rx_timer_index;
+  FILE *txlog;
+  char state_name[32];
+};
+
+
+//
+//  Define the static class that registers the derived pktmover class,
+// and allocates one on request.
+//
+class bx_pcap_locator_c : public eth_locator_c {
+public:
+  bx_pcap_locator_c(void) : eth_locator_c("pcap") {}
+protected:
+  eth_pktmover_c *allocate(const char *netif, const char *macaddr,
+                           eth_rx_handler_t rxh, eth_rx_status_t rxstat,
+                           bx_devmodel_c *dev, const char *script) {
+    return (new bx_pcap_pktmover_c(netif, macaddr, rxh, rxstat, dev, script));
+  }
+} bx_pcap_match;
+
+
+//
+// Define the methods for the bx_pcap_pktmover derived class
+//
+
+// the constructor
+bx_pcap_pktmover_c::bx_pcap_pktmover_c(const char *netif,
+                                       const char *macaddr,
+                                       eth_rx_handler_t rxh,
+                                       eth_rx_status_t rxstat,
+                                       bx_devmodel_c *dev,
+                                       const char *script)
+{
+  this->netdev = dev;
+  this->rxh    = rxh;
+  this->rxstat = rxstat;
+  BX_INFO(("pcap network driver"));
+  feed_name = NULL;
+  feed = NULL;
+  feed_size = 0;
+  feed_swapped = 0;
+  feed_nsec = 0;
+  feed_pos = PCAP_HEADER_SIZE;
+  frames = 0;
+  txlog = NULL;
+  ips = SIM->get_param_num(BXPN_IPS)->get();
+
+  this->rx_timer_index =
+    bx_pc_system.register_timer_ticks(this, this->rx_timer_handler, 1, 0, 0,
+                                      "eth_pcap"); // one-shot, inactive
+
+  if ((netif != NULL) && (strlen(netif) > 0) && strcmp(netif, "none")) {
+    feed_name = strdup(netif);
+    if (load_feed()) {
+      BX_INFO(("pcap: replaying '%s' (%u bytes)", feed_name, feed_size));
+    }
+    // a missing feed may still show up before a restore
+    schedule(BX_PCAP_RETRY_USEC);
+  }
+
+  if ((script != NULL) && (strlen(script) > 0) && strcmp(script, "none")) {
+    txlog = fopen(script, "wb");
+    if (txlog == NULL) {
+      BX_PANIC(("pcap: could not create '%s'", script));
+    } else {
+      Bit32u hdr[6];
+      hdr[0] = PCAP_MAGIC_USEC;
+      hdr[1] = PCAP_VERSION_MAJOR | (PCAP_VERSION_MINOR << 16);
+      hdr[2] = 0; // thiszone
+      hdr[3] = 0; // sigfigs
+      hdr[4] = BX_PACKET_BUFSIZE;
+      hdr[5] = PCAP_LINKTYPE_ETHER;
+      fwrite(hdr, sizeof(hdr), 1, txlog);
+      fflush(txlog);
+      BX_INFO(("pcap: recording guest frames to '%s'", script));
+    }
+  }
+
+  // replay position, the timer state is saved in pc_system
+  sprintf(state_name, "eth_pcap_%s", dev->get_name());
+  bx_list_c *list = new bx_list_c(SIM->get_bochs_root(), state_name, "pcap packetmover");
+  BXRS_DEC_PARAM_SIMPLE(list, feed_pos);
+  BXRS_DEC_PARAM_SIMPLE(list, frames);
+}
+
+bx_pcap_pktmover_c::~bx_pcap_pktmover_c()
+{
+  bx_pc_system.deactivate_timer(rx_timer_index);
+  bx_pc_system.unregisterTimer(rx_timer_index);
+  SIM->get_bochs_root()->remove(state_name);
+  if (feed != NULL) {
+    delete [] feed;
+  }
+  if (feed_name != NULL) {
+    free(feed_name);
+  }
+  if (txlog != NULL) {
+    fclose(txlog);
+  }
+}
+
+bx_bool bx_pcap_pktmover_c::load_feed(void)
+{
+  FILE *fp;
+  long size;
+  Bit32u magic;
+
+  if (feed != NULL) {
+    delete [] feed;
+    feed = NULL;
+  }
+  feed_size = 0;
+  fp = fopen(feed_name, "rb");
+  if (fp == NULL) {
+    BX_ERROR(("pcap: could not open '%s'", feed_name));
+    return 0;
+  }
+  fseek(fp, 0, SEEK_END);
+  size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (size < PCAP_HEADER_SIZE) {
+    BX_ERROR(("pcap: '%s' is too short", feed_name));
+    fclose(fp);
+    return 0;
+  }
+  feed = new Bit8u[size];
+  if (fread(feed, 1, size, fp) != (size_t)size) {
+    BX_ERROR(("pcap: could not read '%s'", feed_name));
+    fclose(fp);
+    return 0;
+  }
+  fclose(fp);
+  feed_size = (Bit32u)size;
+
+  memcpy(&magic, feed, 4);
+  feed_swapped = 0;
+  if ((magic == bx_bswap32(PCAP_MAGIC_USEC)) || (magic == bx_bswap32(PCAP_MAGIC_NSEC))) {
+    feed_swapped = 1;
+    magic = bx_bswap32(magic);
+  }
+  if ((magic != PCAP_MAGIC_USEC) && (magic != PCAP_MAGIC_NSEC)) {
+    BX_ERROR(("pcap: '%s' is not a pcap file", feed_name));
+    feed_size = 0;
+    return 0;
+  }
+  feed_nsec = (magic == PCAP_MAGIC_NSEC);
+  if (get_feed32(20) != PCAP_LINKTYPE_ETHER) {
+    BX_ERROR(("pcap: '%s' has unsupported link type %u", feed_name, get_feed32(20)));
+    feed_size = 0;
+    return 0;
+  }
+  return 1;
+}
+
+// read a 32 bit value in the byte order of the capture file
+Bit32u bx_pcap_pktmover_c::get_feed32(Bit32u offset)
+{
+  Bit32u val;
+
+  memcpy(&val, feed + offset, 4);
+  return feed_swapped ? bx_bswap32(val) : val;
+}
+
+Bit64u bx_pcap_pktmover_c::get_timestamp(Bit32u offset)
+{
+  Bit64u frac = get_feed32(offset + 4);
+
+  if (feed_nsec) frac /= 1000;
+  return (Bit64u)get_feed32(offset) * 1000000 + frac;
+}
+
+Bit64u bx_pcap_pktmover_c::usec_to_ticks(Bit64u usec)
+{
+  Bit64u ticks = usec * ips / 1000000;
+
+  return (ticks > 0) ? ticks : 1;
+}
+
+void bx_pcap_pktmover_c::schedule(Bit64u usec)
+{
+  bx_pc_system.activate_timer_ticks(this->rx_timer_index, usec_to_ticks(usec), 0);
+}
+
+void bx_pcap_pktmover_c::rx_timer_handler(void *this_ptr)
+{
+  bx_pcap_pktmover_c *class_ptr = (bx_pcap_pktmover_c *) this_ptr;
+
+  class_ptr->rx_timer();
+}
+
+void bx_pcap_pktmover_c::rx_timer(void)
+{
+  Bit8u rxbuf[BX_PACKET_BUFSIZE];
+  Bit32u len, next;
+  Bit64u ts;
+
+  if ((feed_pos + PCAP_RECORD_SIZE) > feed_size)
+    return;
+  len = get_feed32(feed_pos + 8);
+  if ((len > BX_PACKET_BUFSIZE) || ((feed_pos + PCAP_RECORD_SIZE + len) > feed_size)) {
+    BX_ERROR(("pcap: bad record at offset %u, replay stopped", feed_pos));
+    feed_pos = feed_size;
+    return;
+  }
+  if (!(this->rxstat(this->netdev) & BX_NETDEV_RXREADY)) {
+    // frames are never dropped, so the replay does not depend on timing
+    schedule(BX_PCAP_RETRY_USEC);
+    return;
+  }
+  memcpy(rxbuf, feed + feed_pos + PCAP_RECORD_SIZE, len);
+  if (len < MIN_RX_PACKET_LEN) {
+    memset(rxbuf + len, 0, MIN_RX_PACKET_LEN - len);
+    len = MIN_RX_PACKET_LEN;
+  }
+  ts = get_timestamp(feed_pos);
+  next = feed_pos + PCAP_RECORD_SIZE + get_feed32(feed_pos + 8);
+  feed_pos = next;
+  frames++;
+  BX_DEBUG(("pcap: frame %u: %u bytes", frames, len));
+  this->rxh(this->netdev, rxbuf, len);
+
+  if ((next + PCAP_RECORD_SIZE) <= feed_size) {
+    Bit64u ts_next = get_timestamp(next);
+    schedule((ts_next > ts) ? (ts_next - ts) : 0);
+  } else {
+    BX_INFO(("pcap: replay finished after %u frames", frames));
+  }
+}
+
+// The file is read again on restore, it may have been replaced since the
+// state was saved. The saved position must still be a record boundary of
+// the new file, otherwise the replay starts over.
+void bx_pcap_pktmover_c::after_restore_state(void)
+{
+  if (feed_name == NULL)
+    return;
+
+  load_feed();
+  Bit32u pos = PCAP_HEADER_SIZE;
+  while (((pos + PCAP_RECORD_SIZE) <= feed_size) && (pos < feed_pos)) {
+    pos += PCAP_RECORD_SIZE + get_feed32(pos + 8);
+  }
+  if (pos != feed_pos) {
+    BX_ERROR(("pcap: saved position %u is not a record of '%s', replay restarted",
+      feed_pos, feed_name));
+    feed_pos = PCAP_HEADER_SIZE;
+  }
+  // the saved rx timer may be inactive (replay finished or no file at that
+  // time), arm it if a record of the new file is pending
+  if (((feed_pos + PCAP_RECORD_SIZE) <= feed_size) &&
+      !bx_pc_system.timerActive(this->rx_timer_index)) {
+    schedule(BX_PCAP_RETRY_USEC);
+  }
+}
+
+void bx_pcap_pktmover_c::sendpkt(void *buf, unsigned io_len)
+{
+  if (txlog != NULL) {
+    Bit64u usec = bx_pc_system.time_usec();
+    Bit32u rec[4];
+    rec[0] = (Bit32u)(usec / 1000000);
+    rec[1] = (Bit32u)(usec % 1000000);
+    rec[2] = io_len;
+    rec[3] = io_len;
+    fwrite(rec, sizeof(rec), 1, txlog);
+    fwrite(buf, io_len, 1, txlog);
+    fflush(txlog);
+  }
+}
+
+#endif /* if BX_NETWORKING */
@@ -131,6 +131,7 @@ private:
   struct sockaddr_in sin, sout;            // target address for RX / TX
   static void rx_timer_handler(void *);
   void rx_timer(void);
+  bx_bool rx_packet(void);
   int rx_timer_index;
 };
 
@@ -268,9 +269,15 @@ bx_socket_pktmover_c::bx_socket_pktmover_c(const char *netif,
 
   // Start the rx poll
   //
-  this->rx_timer_index =
-    DEV_register_timer(this, this->rx_timer_handler, BX_PACKET_POLL, 1, 1,
-                       "eth_socket"); // continuous, active
+  this->rx_timer_index = BX_NULL_TIMER_HANDLE;
+#if BX_HAVE_EPOLL
+  if (!bx_netmod_ctl.register_rx_fd(this->fd, this->rx_timer_handler, this))
+#endif
+  {
+    this->rx_timer_index =
+      DEV_register_timer(this, this->rx_timer_handler, BX_PACKET_POLL, 1, 1,
+                         "eth_socket"); // continuous, active
+  }
 
   this->rxh    = rxh;
   this->rxstat = rxstat;
@@ -282,6 +289,12 @@ bx_socket_pktmover_c::bx_socket_pktmover_c(const char *netif,
 //
 bx_socket_pktmover_c::~bx_socket_pktmover_c()
 {
+  if (this->fd != INVALID_SOCKET) {
+#if BX_HAVE_EPOLL
+    bx_netmod_ctl.unregister_rx_fd(this->fd);
+#endif
+    closesocket(this->fd);
+  }
 #ifdef WIN32
   WSACleanup();
 #endif
@@ -315,14 +328,24 @@ void bx_socket_pktmover_c::rx_timer_handler(void *this_ptr)
 
 void bx_socket_pktmover_c::rx_timer(void)
 {
-  int nbytes = 0;
-  socklen_t slen = sizeof(sin);
-  Bit8u rxbuf[BX_PACKET_BUFSIZE];
-
   // is socket open and bound?
   if (this->fd == INVALID_SOCKET)
     return;
 
+  // Drain up to BX_NETDEV_RX_BATCH frames per poll. Frames are left in the
+  // socket queue as long as the device is not ready to take them.
+  for (unsigned count = 0; count < BX_NETDEV_RX_BATCH; count++) {
+    if (!(this->rxstat(this->netdev) & BX_NETDEV_RXREADY) || !rx_packet())
+      break;
+  }
+}
+
+bx_bool bx_socket_pktmover_c::rx_packet(void)
+{
+  int nbytes = 0;
+  socklen_t slen = sizeof(sin);
+  Bit8u rxbuf[BX_PACKET_BUFSIZE];
+
   // receive packet
   nbytes = recvfrom(this->fd, (char*)rxbuf, sizeof(rxbuf), MSG_NOSIGNAL,
                     (struct sockaddr*) &sin, &slen);
@@ -335,18 +358,17 @@ void bx_socket_pktmover_c::rx_timer(void)
     if (errno != EAGAIN)
       BX_INFO(("eth_socket: error receiving packet: %s", strerror(errno)));
 #endif
-    return;
+    return 0;
   }
 
   // let through broadcast and our mac address
   if ((memcmp(rxbuf, this->socket_macaddr, 6) != 0) &&
       (memcmp(rxbuf, broadcast_macaddr, 6) != 0)) {
-    return;
+    return 1;
   }
 
-  if (this->rxstat(this->netdev) & BX_NETDEV_RXREADY) {
-    BX_DEBUG(("eth_socket: got packet: %d bytes, dst=%x:%x:%x:%x:%x:%x, src=%x:%x:%x:%x:%x:%x", nbytes, rxbuf[0], rxbuf[1], rxbuf[2], rxbuf[3], rxbuf[4], rxbuf[5], rxbuf[6], rxbuf[7], rxbuf[8], rxbuf[9], rxbuf[10], rxbuf[11]));
-    this->rxh(this->netdev, rxbuf, nbytes);
-  }
+  BX_DEBUG(("eth_socket: got packet: %d bytes, dst=%x:%x:%x:%x:%x:%x, src=%x:%x:%x:%x:%x:%x", nbytes, rxbuf[0], rxbuf[1], rxbuf[2], rxbuf[3], rxbuf[4], rxbuf[5], rxbuf[6], rxbuf[7], rxbuf[8], rxbuf[9], rxbuf[10], rxbuf[11]));
+  this->rxh(this->netdev, rxbuf, nbytes);
+  return 1;
 }
 #endif /* if BX_NETWORKING && BX_NETMOD_SOCKET */
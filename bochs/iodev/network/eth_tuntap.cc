@@ -98,6 +98,7 @@ private:
   int rx_timer_index;
   static void rx_timer_handler(void *);
   void rx_timer ();
+  bx_bool rx_packet ();
   Bit8u guest_macaddr[6];
 #if BX_ETH_TUNTAP_LOGGING
   FILE *txlog, *txlog_txt, *rxlog, *rxlog_txt;
@@ -203,9 +204,15 @@ bx_tuntap_pktmover_c::bx_tuntap_pktmover_c(const char *netif,
   }
 
   // Start the rx poll
-  this->rx_timer_index =
-    DEV_register_timer(this, this->rx_timer_handler, 1000, 1, 1,
-                       "eth_tuntap"); // continuous, active
+  this->rx_timer_index = BX_NULL_TIMER_HANDLE;
+#if BX_HAVE_EPOLL
+  if (!bx_netmod_ctl.register_rx_fd(fd, this->rx_timer_handler, this))
+#endif
+  {
+    this->rx_timer_index =
+      DEV_register_timer(this, this->rx_timer_handler, 1000, 1, 1,
+                         "eth_tuntap"); // continuous, active
+  }
   this->rxh    = rxh;
   this->rxstat = rxstat;
   memcpy(&guest_macaddr[0], macaddr, 6);
@@ -241,6 +248,12 @@ bx_tuntap_pktmover_c::bx_tuntap_pktmover_c(const char *netif,
 
 bx_tuntap_pktmover_c::~bx_tuntap_pktmover_c()
 {
+  if (fd >= 0) {
+#if BX_HAVE_EPOLL
+    bx_netmod_ctl.unregister_rx_fd(fd);
+#endif
+    close(fd);
+  }
 #if BX_ETH_TUNTAP_LOGGING
   fclose(txlog);
   fclose(txlog_txt);
@@ -297,11 +310,22 @@ void bx_tuntap_pktmover_c::rx_timer_handler (void *this_ptr)
 }
 
 void bx_tuntap_pktmover_c::rx_timer()
+{
+  if (fd<0) return;
+
+  // Drain up to BX_NETDEV_RX_BATCH frames per poll. Frames are left in the
+  // device queue as long as the guest NIC is not ready to take them.
+  for (unsigned count = 0; count < BX_NETDEV_RX_BATCH; count++) {
+    if (!(this->rxstat(this->netdev) & BX_NETDEV_RXREADY) || !rx_packet())
+      break;
+  }
+}
+
+bx_bool bx_tuntap_pktmover_c::rx_packet()
 {
   int nbytes;
   Bit8u buf[BX_PACKET_BUFSIZE];
   Bit8u *rxbuf;
-  if (fd<0) return;
 
 #ifdef __APPLE__ //FIXME:hack
   nbytes = 14;
@@ -341,7 +365,7 @@ void bx_tuntap_pktmover_c::rx_timer()
 #endif
     if (errno != EAGAIN)
       BX_ERROR(("tuntap read error: %s", strerror(errno)));
-    return;
+    return 0;
   }
 #if BX_ETH_TUNTAP_LOGGING
   if (nbytes > 0) {
@@ -361,11 +385,8 @@ void bx_tuntap_pktmover_c::rx_timer()
     BX_INFO(("packet too short (%d), padding to %d", nbytes, MIN_RX_PACKET_LEN));
     nbytes = MIN_RX_PACKET_LEN;
   }
-  if (this->rxstat(this->netdev) & BX_NETDEV_RXREADY) {
-    this->rxh(this->netdev, rxbuf, nbytes);
-  } else {
-    BX_ERROR(("device not ready to receive data"));
-  }
+  this->rxh(this->netdev, rxbuf, nbytes);
+  return 1;
 }
 
 int tun_alloc(char *dev)
@@ -436,14 +436,17 @@ void bx_ne2k_c::register_state(void)
 #endif
 }
 
-#if BX_SUPPORT_PCI
 void bx_ne2k_c::after_restore_state(void)
 {
+#if BX_SUPPORT_PCI
   if (BX_NE2K_THIS s.pci_enabled) {
     bx_pci_device_c::after_restore_pci_state(mem_read_handler);
   }
-}
 #endif
+  if (BX_NE2K_THIS ethdev != NULL) {
+    BX_NE2K_THIS ethdev->after_restore_state();
+  }
+}
 
 //
 // read_cr/write_cr - utility routines for handling reads/writes to
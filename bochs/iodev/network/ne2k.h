@@ -210,9 +210,7 @@ public:
   virtual void init(void);
   virtual void reset(unsigned type);
   virtual void register_state(void);
-#if BX_SUPPORT_PCI
   virtual void after_restore_state(void);
-#endif
 #if BX_DEBUGGER
   virtual void debug_dump(int argc, char **argv);
 #endif
@@ -30,6 +30,16 @@
 
 #include "netmod.h"
 
+#if BX_HAVE_EPOLL
+extern "C" {
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+};
+
+#define BX_NETMOD_RX_POLL  1000    // Check for pending frames every 1000 usecs
+#endif
+
 #define LOG_THIS bx_netmod_ctl.
 
 bx_netmod_ctl_c bx_netmod_ctl;
@@ -37,6 +47,13 @@ bx_netmod_ctl_c bx_netmod_ctl;
 bx_netmod_ctl_c::bx_netmod_ctl_c()
 {
   put("netmodctl", "NETCTL");
+#if BX_HAVE_EPOLL
+  epoll_fd = -1;
+  rx_poll_timer = BX_NULL_TIMER_HANDLE;
+  for (int i = 0; i < BX_NETMOD_MAX_RX_FD; i++) {
+    rx_fd[i].fd = -1;
+  }
+#endif
 }
 
 void bx_netmod_ctl_c::init(void)
@@ -47,6 +64,17 @@ void bx_netmod_ctl_c::init(void)
 void bx_netmod_ctl_c::exit(void)
 {
   eth_locator_c::cleanup();
+#if BX_HAVE_EPOLL
+  if (epoll_fd >= 0) {
+    close(epoll_fd);
+    epoll_fd = -1;
+  }
+  for (int i = 0; i < BX_NETMOD_MAX_RX_FD; i++) {
+    rx_fd[i].fd = -1;
+  }
+  // the timer itself is released with all others at exit
+  rx_poll_timer = BX_NULL_TIMER_HANDLE;
+#endif
 }
 
 void* bx_netmod_ctl_c::init_module(bx_list_c *base, void *rxh, void *rxstat, bx_devmodel_c *netdev)
@@ -82,6 +110,80 @@ void* bx_netmod_ctl_c::init_module(bx_list_c *base, void *rxh, void *rxstat, bx_
   return ethmod;
 }
 
+#if BX_HAVE_EPOLL
+bx_bool bx_netmod_ctl_c::register_rx_fd(int fd, void (*handler)(void *), void *param)
+{
+  struct epoll_event ev;
+  int i;
+
+  for (i = 0; i < BX_NETMOD_MAX_RX_FD; i++) {
+    if (rx_fd[i].fd < 0) break;
+  }
+  if (i == BX_NETMOD_MAX_RX_FD) {
+    BX_ERROR(("too many receive descriptors, using a private poll timer"));
+    return 0;
+  }
+  if (epoll_fd < 0) {
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+      BX_ERROR(("epoll_create1() failed: %s", strerror(errno)));
+      return 0;
+    }
+  }
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.u32 = i;
+  if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+    BX_ERROR(("epoll_ctl() failed for fd %d: %s", fd, strerror(errno)));
+    return 0;
+  }
+  rx_fd[i].fd = fd;
+  rx_fd[i].handler = handler;
+  rx_fd[i].param = param;
+  if (rx_poll_timer == BX_NULL_TIMER_HANDLE) {
+    rx_poll_timer = DEV_register_timer(this, rx_poll_timer_handler,
+                                       BX_NETMOD_RX_POLL, 1, 1, "netmod"); // continuous, active
+  }
+  return 1;
+}
+
+void bx_netmod_ctl_c::unregister_rx_fd(int fd)
+{
+  for (int i = 0; i < BX_NETMOD_MAX_RX_FD; i++) {
+    if (rx_fd[i].fd == fd) {
+      epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+      rx_fd[i].fd = -1;
+      break;
+    }
+  }
+}
+
+void bx_netmod_ctl_c::rx_poll_timer_handler(void *this_ptr)
+{
+  ((bx_netmod_ctl_c *) this_ptr)->rx_poll();
+}
+
+void bx_netmod_ctl_c::rx_poll(void)
+{
+  struct epoll_event ev[BX_NETMOD_MAX_RX_FD];
+  int n;
+
+  // a single non-blocking check for all modules
+  n = epoll_wait(epoll_fd, ev, BX_NETMOD_MAX_RX_FD, 0);
+  if (n < 0) {
+    if (errno != EINTR)
+      BX_ERROR(("epoll_wait() failed: %s", strerror(errno)));
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    unsigned idx = ev[i].data.u32;
+    if (rx_fd[idx].fd >= 0) {
+      rx_fd[idx].handler(rx_fd[idx].param);
+    }
+  }
+}
+#endif
+
 eth_locator_c *eth_locator_c::all;
 
 //
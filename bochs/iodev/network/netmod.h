@@ -27,6 +27,8 @@
 #ifndef BX_NETMOD_H
 #define BX_NETMOD_H
 
+#define BX_NETMOD_MAX_RX_FD 8
+
 #ifndef BXHUB
 // Pseudo device that loads the lowlevel networking module
 class BOCHSAPI bx_netmod_ctl_c : public logfunctions {
@@ -36,12 +38,29 @@ public:
   void init(void);
   void exit(void);
   virtual void* init_module(bx_list_c *base, void* rxh, void* rxstat, bx_devmodel_c *dev);
+#if BX_HAVE_EPOLL
+  // Host descriptors of all pktmovers share one epoll set that is checked
+  // once per poll period. The handler is only called if data is pending.
+  bx_bool register_rx_fd(int fd, void (*handler)(void *), void *param);
+  void unregister_rx_fd(int fd);
+private:
+  static void rx_poll_timer_handler(void *);
+  void rx_poll(void);
+  int epoll_fd;
+  int rx_poll_timer;
+  struct {
+    int fd;                    // -1 if unused
+    void (*handler)(void *);
+    void *param;
+  } rx_fd[BX_NETMOD_MAX_RX_FD];
+#endif
 };
 
 BOCHSAPI extern bx_netmod_ctl_c bx_netmod_ctl;
 #endif
 
 #define BX_PACKET_BUFSIZE 2048 // Enough for an ether frame
+#define BX_NETDEV_RX_BATCH 32  // max. number of frames received per poll
 
 // device receive status definitions
 #define BX_NETDEV_RXREADY  0x0001
@@ -103,6 +122,8 @@ BX_CPP_INLINE void put_net4(Bit8u *buf,Bit32u data)
 class eth_pktmover_c {
 public:
   virtual void sendpkt(void *buf, unsigned io_len) = 0;
+  // called by the chip emulation after the simulation state is restored
+  virtual void after_restore_state() {}
   virtual ~eth_pktmover_c () {}
 protected:
   bx_devmodel_c *netdev;
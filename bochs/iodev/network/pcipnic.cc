@@ -235,6 +235,9 @@ void bx_pcipnic_c::register_state(void)
 void bx_pcipnic_c::after_restore_state(void)
 {
   bx_pci_device_c::after_restore_pci_state(mem_read_handler);
+  if (BX_PNIC_THIS ethdev != NULL) {
+    BX_PNIC_THIS ethdev->after_restore_state();
+  }
 }
 
 void bx_pcipnic_c::set_irq_level(bx_bool level)
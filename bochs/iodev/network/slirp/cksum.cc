@@ -40,106 +40,72 @@
 /*
  * Checksum routine for Internet Protocol family headers (Portable Version).
  *
- * This routine is very heavily used in the network
- * code and should be modified for each CPU to be as fast as possible.
+ * This routine is very heavily used in the network code.  The one's
+ * complement sum is accumulated 32 bits at a time into a 64-bit register,
+ * four words per iteration without carries between them, so the main loop
+ * is a plain sum of independent additions that the compiler can unroll or
+ * vectorize.  Loads go through memcpy(), so any alignment of the data is
+ * fine and no byte swapping is needed for odd start addresses.
  *
  * XXX Since we will never span more than 1 mbuf, we can optimise this
  */
 
-#define ADDCARRY(x)  (x > 65535 ? x -= 65535 : x)
-#define REDUCE {l_util.l = sum; sum = l_util.s[0] + l_util.s[1];        \
-        (void)ADDCARRY(sum);}
-
 int cksum(struct mbuf *m, int len)
 {
-	register uint16_t *w;
-	register int sum = 0;
-	register int mlen = 0;
-	int byte_swapped = 0;
-
-	union {
-		uint8_t  c[2];
-		uint16_t s;
-	} s_util;
-	union {
-		uint16_t s[2];
-		uint32_t l;
-	} l_util;
+	const uint8_t *p;
+	uint64_t sum = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	uint32_t w[4];
+	uint16_t h;
+	int mlen;
 
 	if (m->m_len == 0)
-	   goto cont;
-	w = mtod(m, uint16_t *);
+	   return 0xffff;
+	p = mtod(m, const uint8_t *);
 
 	mlen = m->m_len;
 
 	if (len < mlen)
 	   mlen = len;
 #ifdef DEBUG
-	len -= mlen;
+	if (len > mlen) {
+		DEBUG_ERROR((dfd, "cksum: out of data\n"));
+		DEBUG_ERROR((dfd, " len = %d\n", len - mlen));
+	}
 #endif
-	/*
-	 * Force to even boundary.
-	 */
-	if ((1 & (uintptr_t)w) && (mlen > 0)) {
-		REDUCE;
-		sum <<= 8;
-		s_util.c[0] = *(uint8_t *)w;
-		w = (uint16_t *)((int8_t *)w + 1);
-		mlen--;
-		byte_swapped = 1;
+
+	while (mlen >= 16) {
+		memcpy(w, p, 16);
+		s0 += w[0]; s1 += w[1]; s2 += w[2]; s3 += w[3];
+		p += 16;
+		mlen -= 16;
 	}
-	/*
-	 * Unroll the loop to make overhead from
-	 * branches &c small.
-	 */
-	while ((mlen -= 32) >= 0) {
-		sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
-		sum += w[4]; sum += w[5]; sum += w[6]; sum += w[7];
-		sum += w[8]; sum += w[9]; sum += w[10]; sum += w[11];
-		sum += w[12]; sum += w[13]; sum += w[14]; sum += w[15];
-		w += 16;
+	sum = s0 + s1 + s2 + s3;
+	while (mlen >= 4) {
+		memcpy(w, p, 4);
+		sum += w[0];
+		p += 4;
+		mlen -= 4;
 	}
-	mlen += 32;
-	while ((mlen -= 8) >= 0) {
-		sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
-		w += 4;
+	if (mlen >= 2) {
+		memcpy(&h, p, 2);
+		sum += h;
+		p += 2;
+		mlen -= 2;
 	}
-	mlen += 8;
-	if (mlen == 0 && byte_swapped == 0)
-	   goto cont;
-	REDUCE;
-	while ((mlen -= 2) >= 0) {
-		sum += *w++;
+	if (mlen > 0) {
+		/* The last byte is an odd one. Follow the standard
+		   and pad it with a zero byte in memory order */
+		uint8_t c[2] = { *p, 0 };
+		memcpy(&h, c, 2);
+		sum += h;
 	}
 
-	if (byte_swapped) {
-		REDUCE;
-		sum <<= 8;
-		if (mlen == -1) {
-			s_util.c[1] = *(uint8_t *)w;
-			sum += s_util.s;
-			mlen = 0;
-		} else
-
-		   mlen = -1;
-	} else if (mlen == -1)
-	   s_util.c[0] = *(uint8_t *)w;
-
-cont:
-#ifdef DEBUG
-	if (len) {
-		DEBUG_ERROR((dfd, "cksum: out of data\n"));
-		DEBUG_ERROR((dfd, " len = %d\n", len));
-	}
-#endif
-	if (mlen == -1) {
-		/* The last mbuf has odd # of bytes. Follow the
-		 standard (the odd byte may be shifted left by 8 bits
-			   or not as determined by endian-ness of the machine) */
-		s_util.c[1] = 0;
-		sum += s_util.s;
-	}
-	REDUCE;
+	/* fold 64 -> 16 bits */
+	sum = (sum >> 32) + (sum & 0xffffffff);
+	sum = (sum >> 32) + (sum & 0xffffffff);
+	sum = (sum >> 16) + (sum & 0xffff);
+	sum = (sum >> 16) + (sum & 0xffff);
+	sum = (sum >> 16) + (sum & 0xffff);
 	return (~sum & 0xffff);
 }
 
@@ -22,7 +22,12 @@
 
 #if BX_NETWORKING && BX_NETMOD_SLIRP
 
-#define MBUF_THRESH 30
+/*
+ * Number of mbufs allocated in one block by m_init().  They stay on the
+ * free list for the lifetime of the slirp instance; mbufs allocated beyond
+ * this are marked M_DOFREE.
+ */
+#define MBUF_THRESH 64
 
 /*
  * Find a nice value for msize
@@ -30,16 +35,96 @@
  */
 #define SLIRP_MSIZE (IF_MTU + IF_MAXLINKHDR + offsetof(struct mbuf, m_dat) + 6)
 
+/* keep the preallocated mbufs properly aligned */
+#define MBUF_ARENA_STRIDE ((SLIRP_MSIZE + 15) & ~15)
+
 void
 m_init(Slirp *slirp)
 {
+    struct mbuf *m;
+    int i;
+
     slirp->m_freelist.m_next = slirp->m_freelist.m_prev = &slirp->m_freelist;
     slirp->m_usedlist.m_next = slirp->m_usedlist.m_prev = &slirp->m_usedlist;
+
+    for (i = 0; i < M_EXT_CLASSES; i++) {
+        slirp->m_ext_free[i] = NULL;
+        slirp->m_ext_cached[i] = 0;
+    }
+    slirp->mbuf_alloced = 0;
+    slirp->m_arena = (char *)malloc(MBUF_THRESH * MBUF_ARENA_STRIDE);
+    if (slirp->m_arena == NULL)
+        return;
+    for (i = 0; i < MBUF_THRESH; i++) {
+        m = (struct mbuf *)(slirp->m_arena + i * MBUF_ARENA_STRIDE);
+        m->slirp = slirp;
+        m->m_flags = M_FREELIST;
+        insque(m, &slirp->m_freelist);
+    }
+    slirp->mbuf_alloced = MBUF_THRESH;
+}
+
+static inline bool m_in_arena(Slirp *slirp, struct mbuf *m)
+{
+    return (slirp->m_arena != NULL) && ((char *)m >= slirp->m_arena) &&
+           ((char *)m < slirp->m_arena + MBUF_THRESH * MBUF_ARENA_STRIDE);
+}
+
+/*
+ * Return the size class for an external buffer of (at least) size bytes,
+ * or -1 if it is too large to be cached.
+ */
+static int m_ext_class(int size)
+{
+    int n = 0;
+
+    while ((1 << (M_EXT_MIN_SHIFT + n)) < size) {
+        if (++n == M_EXT_CLASSES)
+            return -1;
+    }
+    return n;
+}
+
+/*
+ * Allocate an external buffer of at least *size bytes. On return *size
+ * holds the real capacity of the buffer.
+ */
+static char *m_ext_alloc(Slirp *slirp, int *size)
+{
+    char *buf;
+    int n = m_ext_class(*size);
+
+    if (n < 0)
+        return (char *)malloc(*size);
+
+    *size = 1 << (M_EXT_MIN_SHIFT + n);
+    buf = slirp->m_ext_free[n];
+    if (buf != NULL) {
+        memcpy(&slirp->m_ext_free[n], buf, sizeof(char *));
+        slirp->m_ext_cached[n]--;
+        return buf;
+    }
+    return (char *)malloc(*size);
+}
+
+static void m_ext_release(Slirp *slirp, char *buf, int size)
+{
+    int n = m_ext_class(size);
+
+    if ((n < 0) || (slirp->m_ext_cached[n] >= M_EXT_CACHE)) {
+        free(buf);
+        return;
+    }
+    memcpy(buf, &slirp->m_ext_free[n], sizeof(char *));
+    slirp->m_ext_free[n] = buf;
+    slirp->m_ext_cached[n]++;
 }
 
 void m_cleanup(Slirp *slirp)
 {
     struct mbuf *m, *next;
+    char *buf;
+    int i;
 
     m = slirp->m_usedlist.m_next;
     while (m != &slirp->m_usedlist) {
@@ -47,23 +132,35 @@ void m_cleanup(Slirp *slirp)
         if (m->m_flags & M_EXT) {
             free(m->m_ext);
         }
-        free(m);
+        if (!m_in_arena(slirp, m))
+            free(m);
         m = next;
     }
     m = slirp->m_freelist.m_next;
     while (m != &slirp->m_freelist) {
         next = m->m_next;
-        free(m);
+        if (!m_in_arena(slirp, m))
+            free(m);
         m = next;
     }
+    free(slirp->m_arena);
+    slirp->m_arena = NULL;
+
+    for (i = 0; i < M_EXT_CLASSES; i++) {
+        while ((buf = slirp->m_ext_free[i]) != NULL) {
+            memcpy(&slirp->m_ext_free[i], buf, sizeof(char *));
+            free(buf);
+        }
+        slirp->m_ext_cached[i] = 0;
+    }
 }
 
 /*
  * Get an mbuf from the free list, if there are none
  * malloc one
  *
- * Because fragmentation can occur if we alloc new mbufs and
- * free old mbufs, we mark all mbufs above mbuf_thresh as M_DOFREE,
+ * The free list is filled from the block preallocated in m_init(),
+ * so mbufs allocated here are above mbuf_thresh and marked M_DOFREE,
  * which tells m_free to actually free() it
  */
 struct mbuf *
@@ -115,9 +212,9 @@ m_free(struct mbuf *m)
 	if (m->m_flags & M_USEDLIST)
 	   remque(m);
 
-	/* If it's M_EXT, free() it */
+	/* If it's M_EXT, release the external buffer */
 	if (m->m_flags & M_EXT)
-	   free(m->m_ext);
+	   m_ext_release(m->slirp, m->m_ext, m->m_size);
 
 	/*
 	 * Either free() it or put it on the free list
@@ -158,24 +255,23 @@ void
 m_inc(struct mbuf *m, int size)
 {
 	int datasize;
+	char *dat;
 
 	/* some compiles throw up on gotos.  This one we can fake. */
         if(m->m_size>size) return;
 
+        dat = m_ext_alloc(m->slirp, &size);
         if (m->m_flags & M_EXT) {
 	  datasize = m->m_data - m->m_ext;
-	  m->m_ext = (char *)realloc(m->m_ext,size);
-	  m->m_data = m->m_ext + datasize;
+	  memcpy(dat, m->m_ext, m->m_size);
+	  m_ext_release(m->slirp, m->m_ext, m->m_size);
         } else {
-	  char *dat;
 	  datasize = m->m_data - m->m_dat;
-	  dat = (char *)malloc(size);
 	  memcpy(dat, m->m_dat, m->m_size);
-
-	  m->m_ext = dat;
-	  m->m_data = m->m_ext + datasize;
 	  m->m_flags |= M_EXT;
         }
+        m->m_ext = dat;
+        m->m_data = m->m_ext + datasize;
 
         m->m_size = size;
 
@@ -38,6 +38,16 @@
 
 #define MINCSIZE 4096	/* Amount to increase mbuf if too small */
 
+/*
+ * External data buffers are allocated in power-of-two size classes
+ * from 2K up to 64K, and freed buffers are kept on a small per-class
+ * free list so that growing an mbuf normally doesn't hit malloc().
+ * Larger requests fall back to malloc()/free().
+ */
+#define M_EXT_MIN_SHIFT		11
+#define M_EXT_CLASSES		6
+#define M_EXT_CACHE		8	/* max. cached buffers per class */
+
 /*
  * Macros for type conversion
  * mtod(m,t) -	convert mbuf pointer to data pointer of correct type
@@ -257,6 +257,9 @@ struct Slirp {
     /* mbuf states */
     struct mbuf m_freelist, m_usedlist;
     int mbuf_alloced;
+    char *m_arena;                        /* preallocated mbufs */
+    char *m_ext_free[M_EXT_CLASSES];      /* cached M_EXT buffers */
+    int m_ext_cached[M_EXT_CLASSES];
 
     /* if states */
     struct mbuf if_fastq;   /* fast queue (for interactive data) */
@@ -31,6 +31,7 @@
 #define BX_PLUGGABLE
 
 #include "iodev.h"
+#include "replay.h"
 
 #if !defined(WIN32) || defined(__CYGWIN__)
 #include <sys/types.h>
@@ -1639,6 +1640,10 @@ void bx_serial_c::rx_timer(void)
 #endif
         break;
     }
+    if (BX_SER_THIS s[port].io_mode != BX_SER_MODE_MOUSE) {
+      // host input is logged or taken from the replay log
+      data_ready = bx_replay.input_byte(BX_REPLAY_SERIAL, port, &chbuf, data_ready);
+    }
     if (data_ready) {
       if (!BX_SER_THIS s[port].modem_cntl.local_loopback) {
         rx_fifo_enq(port, chbuf);
@@ -23,6 +23,7 @@
 #include "bochs.h"
 #include "param_names.h"
 #include "slowdown_timer.h"
+#include "replay.h"
 
 #include <errno.h>
 #if !defined(_MSC_VER)
@@ -71,7 +72,7 @@ void bx_slowdown_timer_c::init(void)
   if(s.MAXmultiplier<1)
     s.MAXmultiplier=1;
 
-  s.start_time=sectousec(time(NULL));
+  s.start_time=sectousec(bx_replay.value(BX_REPLAY_HOSTTIME, time(NULL)));
   s.start_emulated_time = bx_pc_system.time_usec();
   s.lasttime=0;
   if (s.timer_handle == BX_NULL_TIMER_HANDLE) {
@@ -102,7 +103,7 @@ void bx_slowdown_timer_c::handle_timer()
 {
   Bit64u total_emu_time = (bx_pc_system.time_usec()) - s.start_emulated_time;
   Bit64u wanttime = s.lasttime+s.Q;
-  Bit64u totaltime = sectousec(time(NULL)) - s.start_time;
+  Bit64u totaltime = sectousec(bx_replay.value(BX_REPLAY_HOSTTIME, time(NULL))) - s.start_time;
   Bit64u thistime=(wanttime>totaltime)?wanttime:totaltime;
 
 #if BX_SLOWDOWN_PRINTF_FEEDBACK
@@ -139,7 +140,8 @@ void bx_slowdown_timer_c::handle_timer()
    *    <^Bochs runs at MAX speed.
    *      ^>Bochs runs at normal
    */
-  if(wanttime > (totaltime+REALTIME_Q)) {
+  // no need to wait for the host when replaying a log
+  if((wanttime > (totaltime+REALTIME_Q)) && !bx_replay.playing()) {
 #if BX_HAVE_USLEEP
     usleep(s.Q);
 #elif BX_HAVE_MSLEEP
@@ -1213,9 +1213,25 @@ void bx_usb_ohci_c::event_handler(int event, USBPacket *packet, int port)
   }
 }
 
+// The TD buffer crosses at most one page boundary: it runs from CBP to the
+// end of its page and continues at the start of the page holding BE.
+static unsigned ohci_td_sg(struct OHCI_TD *td, unsigned len, bx_dma_sg_t *sg)
+{
+  sg[0].addr = TD_GET_CBP(td);
+  if (((TD_GET_CBP(td) & 0xfff) + len) > 0x1000) {
+    sg[0].len = 0x1000 - (TD_GET_CBP(td) & 0xfff);
+    sg[1].addr = TD_GET_BE(td) & ~0xfff;
+    sg[1].len = len - sg[0].len;
+    return 2;
+  }
+  sg[0].len = len;
+  return 1;
+}
+
 bx_bool bx_usb_ohci_c::process_td(struct OHCI_TD *td, struct OHCI_ED *ed)
 {
-  unsigned pid = 0, len = 0, len1, len2;
+  unsigned pid = 0, len = 0, sg_count;
+  bx_dma_sg_t sg[2];
   int ilen, ret = 0, ret2 = 1;
   Bit32u addr;
   Bit16u maxlen = 0;
@@ -1288,16 +1304,20 @@ bx_bool bx_usb_ohci_c::process_td(struct OHCI_TD *td, struct OHCI_ED *ed)
 
     switch (pid) {
       case USB_TOKEN_SETUP:
-        if (len > 0)
-          DEV_MEM_READ_PHYSICAL_DMA(TD_GET_CBP(td), len, p->packet.data);
+        if (len > 0) {
+          sg_count = ohci_td_sg(td, len, sg);
+          DEV_MEM_READ_PHYSICAL_SG(sg, sg_count, p->packet.data);
+        }
         // TODO: This is a hack.  dev->handle_packet() should return the amount of bytes
         //  it received, not the amount it anticipates on receiving/sending in the next packet.
         if ((ret = BX_OHCI_THIS broadcast_packet(&p->packet)) >= 0)
           ret = 8;
         break;
       case USB_TOKEN_OUT:
-        if (len > 0)
-          DEV_MEM_READ_PHYSICAL_DMA(TD_GET_CBP(td), maxlen, p->packet.data);
+        if (len > 0) {
+          sg_count = ohci_td_sg(td, maxlen, sg);
+          DEV_MEM_READ_PHYSICAL_SG(sg, sg_count, p->packet.data);
+        }
         ret = BX_OHCI_THIS broadcast_packet(&p->packet);
         break;
       case USB_TOKEN_IN:
@@ -1315,14 +1335,8 @@ bx_bool bx_usb_ohci_c::process_td(struct OHCI_TD *td, struct OHCI_ED *ed)
     }
   }
   if ((ret > 0) && (pid == USB_TOKEN_IN)) {
-    if (((TD_GET_CBP(td) & 0xfff) + ret) > 0x1000) {
-      len1 = 0x1000 - (TD_GET_CBP(td) & 0xfff);
-      len2 = ret - len1;
-      DEV_MEM_WRITE_PHYSICAL_DMA(TD_GET_CBP(td), len1, p->packet.data);
-      DEV_MEM_WRITE_PHYSICAL_DMA((TD_GET_BE(td) & ~0xfff), len2, p->packet.data+len1);
-    } else {
-      DEV_MEM_WRITE_PHYSICAL_DMA(TD_GET_CBP(td), ret, p->packet.data);
-    }
+    sg_count = ohci_td_sg(td, ret, sg);
+    DEV_MEM_WRITE_PHYSICAL_SG(sg, sg_count, p->packet.data);
   }
   if ((ret == (int)len) || ((pid == USB_TOKEN_IN) && (ret >= 0) &&
       TD_GET_R(td)) || ((pid == USB_TOKEN_OUT) && (ret >= 0) &&
@@ -60,6 +60,7 @@
 #include "bochs.h"
 #include "param_names.h"
 #include "virt_timer.h"
+#include "replay.h"
 
 //Important constant #defines:
 #define USEC_PER_SECOND (1000000)
@@ -92,7 +93,7 @@
 #define DEBUG_REALTIME_WITH_PRINTF 0
 
 
-#define GET_VIRT_REALTIME64_USEC() (bx_get_realtime64_usec())
+#define GET_VIRT_REALTIME64_USEC() (bx_replay.value(BX_REPLAY_REALTIME, bx_get_realtime64_usec()))
 //Set up Logging.
 #define LOG_THIS bx_virt_timer.
 
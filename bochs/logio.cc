@@ -24,6 +24,7 @@
 #include "bxthread.h"
 #include "cpu/cpu.h"
 #include <assert.h>
+#include <stddef.h>
 
 #if BX_WITH_CARBON
 #include <Carbon/Carbon.h>
@@ -86,6 +87,8 @@ void iofunctions::init(void)
   // sets the default logprefix
   strcpy(logprefix,"%t%e%d");
   n_logfn = 0;
+  ring = NULL;
+  async = 0;
   init_log(stderr);
   log = new logfunc_t(this);
   log->put("logio", "IO");
@@ -169,6 +172,7 @@ void iofunctions::init_log(int fd)
 
 void iofunctions::exit_log()
 {
+  set_async(0);
   flush();
   if (logfd != stderr) {
     fclose(logfd);
@@ -188,20 +192,12 @@ void iofunctions::set_log_prefix(const char* prefix)
   strcpy(logprefix, prefix);
 }
 
-//  iofunctions::out(level, prefix, fmt, ap)
-//  DO NOT nest out() from ::info() and the like.
-//    fmt and ap retained for direct printinf from iofunctions only!
-
-void iofunctions::out(int level, const char *prefix, const char *fmt, va_list ap)
+// Builds the prefix of a log line from the logprefix template
+void iofunctions::make_prefix(char *msgpfx, int level, const char *prefix,
+                              Bit64u ticks, Bit32u eip)
 {
   char c = ' ', *s;
-  char tmpstr[80], msgpfx[80], msg[1024];
-
-  assert(magic==MAGIC_LOGNUM);
-  assert(this != NULL);
-  assert(logfd != NULL);
-
-  BX_LOCK(logio_mutex);
+  char tmpstr[80];
 
   switch (level) {
     case LOGLEV_INFO: c='i'; break;
@@ -213,6 +209,7 @@ void iofunctions::out(int level, const char *prefix, const char *fmt, va_list ap
 
   s = logprefix;
   msgpfx[0] = 0;
+  tmpstr[0] = 0;
   while (*s) {
     switch (*s) {
       case '%':
@@ -223,11 +220,11 @@ void iofunctions::out(int level, const char *prefix, const char *fmt, va_list ap
             sprintf(tmpstr, "%s", prefix==NULL?"":prefix);
             break;
           case 't':
-            sprintf(tmpstr, FMT_TICK, bx_pc_system.time_ticks());
+            sprintf(tmpstr, FMT_TICK, ticks);
             break;
           case 'i':
 #if BX_SUPPORT_SMP == 0
-            sprintf(tmpstr, "%08x", BX_CPU(0)->get_eip());
+            sprintf(tmpstr, "%08x", eip);
 #endif
             break;
           case 'e':
@@ -246,21 +243,510 @@ void iofunctions::out(int level, const char *prefix, const char *fmt, va_list ap
     strcat(msgpfx, tmpstr);
     s++;
   }
+}
 
+// Writes one formatted message, called with logio_mutex held
+void iofunctions::write_msg(int level, const char *msgpfx, const char *msg)
+{
   fprintf(logfd,"%s ", msgpfx);
 
   if(level==LOGLEV_PANIC)
     fprintf(logfd, ">>PANIC<< ");
 
-  vsnprintf(msg, sizeof(msg), fmt, ap);
   fprintf(logfd, "%s\n", msg);
-  fflush(logfd);
+  if (!async) {
+    fflush(logfd);
+  }
   if (SIM->has_log_viewer()) {
     SIM->log_msg(msgpfx, level, msg);
   }
+}
+
+//  iofunctions::out(level, prefix, fmt, ap)
+//  DO NOT nest out() from ::info() and the like.
+//    fmt and ap retained for direct printinf from iofunctions only!
+
+void iofunctions::out(int level, const char *prefix, const char *fmt, va_list ap)
+{
+  char msgpfx[80], msg[1024];
+  Bit32u eip = 0;
+
+  assert(magic==MAGIC_LOGNUM);
+  assert(this != NULL);
+  assert(logfd != NULL);
+
+  // in async mode panics and messages that cannot be queued are written
+  // directly, after the ones queued before them
+  if (async && (level != LOGLEV_PANIC) && push_msg(level, prefix, fmt, ap))
+    return;
+
+  BX_LOCK(logio_mutex);
+  if (ring != NULL) {
+    drain_locked();
+  }
+#if BX_SUPPORT_SMP == 0
+  eip = BX_CPU(0)->get_eip();
+#endif
+  make_prefix(msgpfx, level, prefix, bx_pc_system.time_ticks(), eip);
+  vsnprintf(msg, sizeof(msg), fmt, ap);
+  write_msg(level, msgpfx, msg);
+  if (async) {
+    fflush(logfd);
+  }
   BX_UNLOCK(logio_mutex);
 }
 
+// Asynchronous log output: out() copies the format string pointer and the
+// raw arguments into a slot of a bounded multi-producer ring and returns.
+// A writer thread formats the messages and writes them to the log file.
+
+#if BX_HAVE_ATOMICS && defined(va_copy)
+#define BX_LOG_ASYNC_SUPPORTED 1
+#else
+#define BX_LOG_ASYNC_SUPPORTED 0
+#endif
+
+#define BX_LOG_RING_SIZE  4096  // must be a power of 2
+#define BX_LOG_SLOT_SIZE  256
+#define BX_LOG_SPEC_LEN   32
+
+typedef struct {
+  volatile Bit32u seq;
+  Bit8u  level;
+  Bit32u eip;
+  Bit64u ticks;
+  const char *fmt;
+  char prefix[16];
+  Bit8u data[BX_LOG_SLOT_SIZE - 48];
+} bx_log_slot_t;
+
+struct bx_log_ring_t {
+  bx_log_slot_t slot[BX_LOG_RING_SIZE];
+  volatile Bit32u head;    // next slot to claim by a producer
+  Bit32u tail;             // next slot to format, owned by the consumer
+  iofunctions *owner;
+  volatile bx_bool stopped;
+  BX_THREAD_VAR(thread);
+};
+
+enum {
+  LOGARG_NONE,      // "%%"
+  LOGARG_INT,
+  LOGARG_LONG,
+  LOGARG_INT64,
+  LOGARG_SIZE,
+  LOGARG_PTRDIFF,
+  LOGARG_DOUBLE,
+  LOGARG_PTR,
+  LOGARG_STR,
+  LOGARG_INVALID
+};
+
+static const unsigned logarg_size[LOGARG_INVALID] = {
+  0, sizeof(int), sizeof(long), sizeof(Bit64s), sizeof(size_t),
+  sizeof(ptrdiff_t), sizeof(double), sizeof(void*), 0
+};
+
+// Parses the conversion specification following a '%'. Returns the
+// position after it and the argument type. '*' width and precision
+// fields are counted in 'stars', each of them takes an int argument.
+static const char *log_parse_spec(const char *s, int *type, int *stars)
+{
+  int len = 0;
+
+  *stars = 0;
+  while ((*s == '-') || (*s == '+') || (*s == ' ') || (*s == '#') || (*s == '0')) s++;
+  if (*s == '*') {
+    (*stars)++;
+    s++;
+  } else {
+    while ((*s >= '0') && (*s <= '9')) s++;
+  }
+  if (*s == '.') {
+    s++;
+    if (*s == '*') {
+      (*stars)++;
+      s++;
+    } else {
+      while ((*s >= '0') && (*s <= '9')) s++;
+    }
+  }
+  // length modifier: 1=l 2=ll/q/I64 3=z 4=t 5=L
+  if ((s[0] == 'h') && (s[1] == 'h')) {
+    s += 2;
+  } else if (s[0] == 'h') {
+    s++;
+  } else if ((s[0] == 'l') && (s[1] == 'l')) {
+    len = 2; s += 2;
+  } else if (s[0] == 'l') {
+    len = 1; s++;
+  } else if (s[0] == 'q') {
+    len = 2; s++;
+  } else if ((s[0] == 'I') && (s[1] == '6') && (s[2] == '4')) {
+    len = 2; s += 3;
+  } else if ((s[0] == 'I') && (s[1] == '3') && (s[2] == '2')) {
+    s += 3;
+  } else if (s[0] == 'z') {
+    len = 3; s++;
+  } else if (s[0] == 't') {
+    len = 4; s++;
+  } else if (s[0] == 'L') {
+    len = 5; s++;
+  }
+  switch (*s) {
+    case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+      switch (len) {
+        case 0: *type = LOGARG_INT; break;
+        case 1: *type = LOGARG_LONG; break;
+        case 2: *type = LOGARG_INT64; break;
+        case 3: *type = LOGARG_SIZE; break;
+        case 4: *type = LOGARG_PTRDIFF; break;
+        default: *type = LOGARG_INVALID;
+      }
+      break;
+    case 'c':
+      *type = (len == 0) ? LOGARG_INT : LOGARG_INVALID;
+      break;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+      *type = (len <= 1) ? LOGARG_DOUBLE : LOGARG_INVALID;
+      break;
+    case 's':
+      *type = (len == 0) ? LOGARG_STR : LOGARG_INVALID;
+      break;
+    case 'p':
+      *type = LOGARG_PTR;
+      break;
+    case '%':
+      *type = LOGARG_NONE;
+      break;
+    default:
+      *type = LOGARG_INVALID;
+      return s;
+  }
+  return s + 1;
+}
+
+// Copies the arguments of 'fmt' into 'data'. Returns the number of bytes
+// used or -1 if they don't fit or a conversion is not supported.
+static int log_store_args(Bit8u *data, unsigned size, const char *fmt, va_list ap)
+{
+  const char *end;
+  int type, stars, ival;
+  unsigned pos = 0, len;
+
+  while (*fmt) {
+    if (*fmt++ != '%') continue;
+    end = log_parse_spec(fmt, &type, &stars);
+    if ((type == LOGARG_INVALID) || ((end - fmt) >= (BX_LOG_SPEC_LEN - 12)))
+      return -1;
+    fmt = end;
+    if ((pos + stars * sizeof(int) + logarg_size[type]) > size)
+      return -1;
+    while (stars-- > 0) {
+      ival = va_arg(ap, int);
+      memcpy(data + pos, &ival, sizeof(int));
+      pos += sizeof(int);
+    }
+    switch (type) {
+      case LOGARG_INT:
+        ival = va_arg(ap, int);
+        memcpy(data + pos, &ival, sizeof(int));
+        break;
+      case LOGARG_LONG:
+        {
+          long val = va_arg(ap, long);
+          memcpy(data + pos, &val, sizeof(long));
+        }
+        break;
+      case LOGARG_INT64:
+        {
+          Bit64s val = va_arg(ap, Bit64s);
+          memcpy(data + pos, &val, sizeof(Bit64s));
+        }
+        break;
+      case LOGARG_SIZE:
+        {
+          size_t val = va_arg(ap, size_t);
+          memcpy(data + pos, &val, sizeof(size_t));
+        }
+        break;
+      case LOGARG_PTRDIFF:
+        {
+          ptrdiff_t val = va_arg(ap, ptrdiff_t);
+          memcpy(data + pos, &val, sizeof(ptrdiff_t));
+        }
+        break;
+      case LOGARG_DOUBLE:
+        {
+          double val = va_arg(ap, double);
+          memcpy(data + pos, &val, sizeof(double));
+        }
+        break;
+      case LOGARG_PTR:
+        {
+          void *val = va_arg(ap, void*);
+          memcpy(data + pos, &val, sizeof(void*));
+        }
+        break;
+      case LOGARG_STR:
+        {
+          const char *str = va_arg(ap, const char*);
+          if (str == NULL) str = "(null)";
+          len = strlen(str) + 1;
+          if ((pos + len) > size)
+            return -1;
+          memcpy(data + pos, str, len);
+          pos += len;
+        }
+        break;
+      default:
+        break;
+    }
+    pos += logarg_size[type];
+  }
+  return (int)pos;
+}
+
+// Formats a message from the format string and the stored arguments
+static void log_format_args(char *msg, unsigned size, const char *fmt, const Bit8u *data)
+{
+  char spec[BX_LOG_SPEC_LEN];
+  const char *start;
+  unsigned pos = 0, n;
+  int type, stars, ival, ret = 0;
+
+  while (*fmt && (pos < (size - 1))) {
+    if (*fmt != '%') {
+      msg[pos++] = *fmt++;
+      continue;
+    }
+    start = fmt++;
+    fmt = log_parse_spec(fmt, &type, &stars);
+    if (type == LOGARG_NONE) {
+      msg[pos++] = '%';
+      continue;
+    }
+    // rebuild the specification with the '*' fields filled in
+    n = 0;
+    for (const char *s = start; s < fmt; s++) {
+      if (*s == '*') {
+        memcpy(&ival, data, sizeof(int));
+        data += sizeof(int);
+        if (ival < 0) {
+          if ((n > 0) && (spec[n - 1] == '.')) {
+            n--;   // negative precision: as if it was omitted
+          } else {
+            spec[n++] = '-';
+            n += sprintf(&spec[n], "%d", -ival);
+          }
+        } else {
+          n += sprintf(&spec[n], "%d", ival);
+        }
+      } else {
+        spec[n++] = *s;
+      }
+    }
+    spec[n] = 0;
+    switch (type) {
+      case LOGARG_INT:
+        memcpy(&ival, data, sizeof(int));
+        ret = snprintf(msg + pos, size - pos, spec, ival);
+        break;
+      case LOGARG_LONG:
+        {
+          long val;
+          memcpy(&val, data, sizeof(long));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_INT64:
+        {
+          Bit64s val;
+          memcpy(&val, data, sizeof(Bit64s));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_SIZE:
+        {
+          size_t val;
+          memcpy(&val, data, sizeof(size_t));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_PTRDIFF:
+        {
+          ptrdiff_t val;
+          memcpy(&val, data, sizeof(ptrdiff_t));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_DOUBLE:
+        {
+          double val;
+          memcpy(&val, data, sizeof(double));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_PTR:
+        {
+          void *val;
+          memcpy(&val, data, sizeof(void*));
+          ret = snprintf(msg + pos, size - pos, spec, val);
+        }
+        break;
+      case LOGARG_STR:
+        ret = snprintf(msg + pos, size - pos, spec, (const char*)data);
+        data += strlen((const char*)data) + 1;
+        break;
+      default:
+        ret = 0;
+    }
+    data += logarg_size[type];
+    if (ret > 0) {
+      pos += ((unsigned)ret < (size - pos)) ? (unsigned)ret : (size - pos - 1);
+    }
+  }
+  msg[pos] = 0;
+}
+
+BX_THREAD_FUNC(log_writer_thread, indata)
+{
+  struct bx_log_ring_t *ring = (struct bx_log_ring_t*)indata;
+
+  while (ring->owner->get_async()) {
+    if (ring->owner->drain_async() == 0) {
+      BX_MSLEEP(10);
+    }
+  }
+  ring->stopped = 1;
+  BX_THREAD_EXIT;
+}
+
+// Queues a message for the writer thread. Returns 0 if the arguments of
+// the message cannot be stored in a slot, 'ap' is left untouched then.
+bx_bool iofunctions::push_msg(int level, const char *prefix, const char *fmt, va_list ap)
+{
+#if BX_LOG_ASYNC_SUPPORTED
+  bx_log_slot_t *slot;
+  Bit8u data[sizeof(slot->data)];
+  Bit32u pos, seq;
+  va_list args;
+  int len;
+
+  va_copy(args, ap);
+  len = log_store_args(data, sizeof(data), fmt, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+
+  // claim a slot; if the ring is full, wait for the writer thread
+  pos = ring->head;
+  for (;;) {
+    slot = &ring->slot[pos & (BX_LOG_RING_SIZE - 1)];
+    seq = slot->seq;
+    if (seq == pos) {
+      if (BX_ATOMIC_CAS32(&ring->head, pos, pos + 1))
+        break;
+      pos = ring->head;
+    } else if ((Bit32s)(seq - pos) < 0) {
+      BX_MSLEEP(1);
+      pos = ring->head;
+    } else {
+      pos = ring->head;
+    }
+  }
+
+  slot->level = level;
+  slot->ticks = bx_pc_system.time_ticks();
+#if BX_SUPPORT_SMP == 0
+  slot->eip = BX_CPU(0)->get_eip();
+#else
+  slot->eip = 0;
+#endif
+  slot->fmt = fmt;
+  strncpy(slot->prefix, (prefix == NULL) ? "" : prefix, sizeof(slot->prefix) - 1);
+  slot->prefix[sizeof(slot->prefix) - 1] = 0;
+  memcpy(slot->data, data, len);
+  BX_MEMORY_BARRIER();
+  slot->seq = pos + 1;
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+// Formats and writes the queued messages, called with logio_mutex held
+unsigned iofunctions::drain_locked(void)
+{
+  bx_log_slot_t *slot;
+  char msgpfx[80], msg[1024];
+  unsigned count = 0;
+
+  for (;;) {
+    slot = &ring->slot[ring->tail & (BX_LOG_RING_SIZE - 1)];
+    if (slot->seq != (ring->tail + 1))
+      break;
+    BX_MEMORY_BARRIER();
+    make_prefix(msgpfx, slot->level, slot->prefix, slot->ticks, slot->eip);
+    log_format_args(msg, sizeof(msg), slot->fmt, slot->data);
+    write_msg(slot->level, msgpfx, msg);
+    BX_MEMORY_BARRIER();
+    slot->seq = ring->tail + BX_LOG_RING_SIZE;
+    ring->tail++;
+    count++;
+  }
+  return count;
+}
+
+unsigned iofunctions::drain_async(void)
+{
+  unsigned count = 0;
+
+  if (ring != NULL) {
+    BX_LOCK(logio_mutex);
+    count = drain_locked();
+    if (count > 0) {
+      fflush(logfd);
+    }
+    BX_UNLOCK(logio_mutex);
+  }
+  return count;
+}
+
+void iofunctions::set_async(bx_bool enable)
+{
+  if (enable && !async) {
+#if BX_LOG_ASYNC_SUPPORTED
+    if (SIM->has_log_viewer()) {
+      log->info("log viewer present, asynchronous log output disabled");
+      return;
+    }
+    if (ring == NULL) {
+      ring = new bx_log_ring_t;
+      for (Bit32u i = 0; i < BX_LOG_RING_SIZE; i++) {
+        ring->slot[i].seq = i;
+      }
+      ring->head = 0;
+      ring->tail = 0;
+      ring->owner = this;
+    }
+    ring->stopped = 0;
+    async = 1;
+    BX_THREAD_CREATE(log_writer_thread, ring, ring->thread);
+#else
+    log->info("asynchronous log output not supported on this platform");
+#endif
+  } else if (!enable && async) {
+    // the ring stays allocated: a message queued after this point is
+    // written by the next synchronous out() call
+    async = 0;
+    while (!ring->stopped) {
+      BX_MSLEEP(1);
+    }
+    drain_async();
+  }
+}
+
 iofunctions::iofunctions(FILE *fs)
 {
   init();
@@ -286,6 +772,10 @@ iofunctions::iofunctions()
 
 iofunctions::~iofunctions(void)
 {
+  if (ring != NULL) {
+    set_async(0);
+    delete ring;
+  }
   BX_FINI_MUTEX(logio_mutex);
 
   // flush before erasing magic number, or flush does nothing.
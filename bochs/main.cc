@@ -35,6 +35,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#include "replay.h"
 
 #ifdef HAVE_LOCALE_H
 #include <locale.h>
@@ -58,6 +59,10 @@
 #include <Carbon/Carbon.h>
 #endif
 
+#if BX_SUPPORT_SMP_THREADS
+#include "bxthread.h"
+#endif
+
 extern "C" {
 #include <signal.h>
 }
@@ -790,6 +795,7 @@ void step_cpu(Bit64u steps) {
 
     bxICacheEntry_c *entry = BX_CPU_THIS_PTR getICacheEntry();
     bxInstruction_c *i = entry->i;
+    BX_INSTR_TRACE_ENTRY(BX_CPU_ID, entry);
 
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
     {
@@ -1324,6 +1330,9 @@ int bx_init_main(int argc, char *argv[])
 #if BX_SUPPORT_PCIDEV
           fprintf(stderr, "pcidev\n");
 #endif
+#if BX_SUPPORT_FUZZINPUT
+          fprintf(stderr, "fuzzinput\n");
+#endif
 #if BX_SUPPORT_NE2K
           fprintf(stderr, "ne2k\n");
 #endif
@@ -1662,6 +1671,180 @@ bx_bool load_and_init_display_lib(void)
   return (bx_gui != NULL);
 }
 
+#if BX_SUPPORT_SMP_THREADS && !BX_DEBUGGER
+
+// Parallel SMP simulation: every CPU runs in its own host thread, CPU 0 in
+// the main thread. The CPUs execute in rounds ending at the next timer event.
+// Between the rounds all CPUs are stopped and the main thread advances the
+// system time by the progress of the slowest CPU, which fires the timers.
+
+static struct {
+  volatile Bit32u generation;  // incremented to start a new round
+  volatile Bit32u finished;    // number of worker threads done with the round
+  volatile Bit32u busy;        // number of CPUs not halted
+  volatile bx_bool stop;       // all CPUs are halted, end the round
+  volatile bx_bool exit;       // terminate the worker threads
+  Bit32u *executed;            // instructions executed in the round
+  bx_bool *halted;             // CPU was halted at the end of the round
+} smp_round;
+
+static bx_bool bx_smp_parallel_enabled(void)
+{
+  if (! SIM->get_param_bool(BXPN_SMP_PARALLEL)->get())
+    return 0;
+
+#if BX_INSTRUMENTATION
+  BX_ERROR(("parallel SMP simulation is not supported with instrumentation"));
+  return 0;
+#endif
+  if (SIM->get_param_num(BXPN_HOST_MEM_SIZE)->get64() < SIM->get_param_num(BXPN_MEM_SIZE)->get64()) {
+    BX_ERROR(("parallel SMP simulation requires the whole guest memory to be allocated"));
+    return 0;
+  }
+#if BX_SUPPORT_X86_64 && !BX_HAVE_ATOMIC_CAS128
+  if (BX_CPU(0)->is_cpu_extension_supported(BX_ISA_CMPXCHG16B)) {
+    BX_ERROR(("parallel SMP simulation of CMPXCHG16B requires a host with 16-byte compare-and-swap"));
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+static Bit32u bx_smp_round_budget(void)
+{
+  static Bit32u quantum = SIM->get_param_num(BXPN_SMP_QUANTUM)->get();
+  Bit32u ticks = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  return (ticks > quantum) ? ticks : quantum;
+}
+
+static void bx_smp_run_round(unsigned cpu)
+{
+  BX_CPU_C *c = BX_CPU(cpu);
+  Bit64u start = c->get_icount();
+  bx_bool halted = 0;
+
+  while (! smp_round.stop && ! bx_pc_system.kill_bochs_request && ! bx_pc_system.pending_reset) {
+    Bit64u icount = c->get_icount();
+    c->cpu_run_trace();
+    if (c->get_icount() == icount && c->activity_state != BX_CPU_C::BX_ACTIVITY_STATE_ACTIVE) {
+      // the CPU is waiting for an interrupt, posted by another CPU or
+      // delivered by the devices at the end of the round
+      if (! halted) {
+        halted = 1;
+        if (BX_ATOMIC_ADD32(&smp_round.busy, (Bit32u) -1) == 0)
+          smp_round.stop = 1;
+      }
+      BX_YIELD();
+      continue;
+    }
+    if (halted) {
+      halted = 0;
+      BX_ATOMIC_ADD32(&smp_round.busy, 1);
+    }
+    if (c->get_icount() - start >= bx_smp_round_budget())
+      break;
+  }
+
+  // the halted CPUs wait for the others to finish the round
+  if (! halted) {
+    if (BX_ATOMIC_ADD32(&smp_round.busy, (Bit32u) -1) == 0)
+      smp_round.stop = 1;
+  }
+
+  smp_round.executed[cpu] = (Bit32u)(c->get_icount() - start);
+  smp_round.halted[cpu] = halted;
+}
+
+BX_THREAD_FUNC(bx_smp_cpu_thread, arg)
+{
+  unsigned cpu = (unsigned)(bx_ptr_equiv_t) arg;
+  Bit32u generation = 0;
+
+  bx_pc_system.set_current_cpu(cpu);
+
+  while (1) {
+    while (smp_round.generation == generation)
+      BX_YIELD();
+    generation = smp_round.generation;
+    if (smp_round.exit) break;
+    bx_smp_run_round(cpu);
+    BX_ATOMIC_ADD32(&smp_round.finished, 1);
+  }
+
+  BX_ATOMIC_ADD32(&smp_round.finished, 1);
+  BX_THREAD_EXIT;
+}
+
+static void bx_smp_parallel_loop(void)
+{
+  unsigned ncpus = BX_SMP_PROCESSORS, n;
+  BX_THREAD_VAR(thread);
+
+  BX_INFO(("parallel SMP simulation: %u host threads", ncpus));
+
+  smp_round.generation = 0;
+  smp_round.exit = 0;
+  smp_round.executed = new Bit32u[ncpus];
+  smp_round.halted = new bx_bool[ncpus];
+
+  bx_pc_system.set_current_cpu(0);
+  for (n = 1; n < ncpus; n++) {
+    BX_THREAD_CREATE(bx_smp_cpu_thread, (void*)(bx_ptr_equiv_t) n, thread);
+  }
+
+  while (1) {
+    smp_round.finished = 0;
+    smp_round.busy = ncpus;
+    smp_round.stop = 0;
+    bx_pc_system.cpus_running = 1;
+    BX_ATOMIC_ADD32(&smp_round.generation, 1);
+
+    bx_smp_run_round(0);
+    while (smp_round.finished != ncpus - 1)
+      BX_YIELD();
+
+    bx_pc_system.cpus_running = 0;
+    BX_MEMORY_BARRIER();
+
+    // handle the requests the CPUs did not pick up in this round
+    for (n = 0; n < ncpus; n++) {
+      if (BX_CPU(n)->lapic.mailbox_pending())
+        BX_CPU(n)->lapic.drain_mailbox();
+    }
+
+    // advance the system time by the progress of the slowest running CPU,
+    // a halted CPU is idle for the whole round
+    Bit32u ticks = 0xffffffff;
+    for (n = 0; n < ncpus; n++) {
+      if (! smp_round.halted[n] && smp_round.executed[n] < ticks)
+        ticks = smp_round.executed[n];
+    }
+    if (ticks == 0xffffffff)
+      ticks = bx_smp_round_budget();
+    BX_TICKN(ticks ? ticks : 1);
+
+    if (bx_pc_system.pending_reset) {
+      unsigned type = bx_pc_system.pending_reset;
+      bx_pc_system.pending_reset = 0;
+      bx_pc_system.Reset(type);
+    }
+
+    if (bx_pc_system.kill_bochs_request)
+      break;
+  }
+
+  smp_round.finished = 0;
+  smp_round.exit = 1;
+  BX_ATOMIC_ADD32(&smp_round.generation, 1);
+  while (smp_round.finished != ncpus - 1)
+    BX_YIELD();
+
+  delete [] smp_round.executed;
+  delete [] smp_round.halted;
+}
+
+#endif
+
 int bx_begin_simulation(int argc, char *argv[])
 {
   bx_user_quit = 0;
@@ -1757,37 +1940,93 @@ int bx_begin_simulation(int argc, char *argv[])
       // for one processor, the only reason for cpu_loop to return is
       // that kill_bochs_request was set by the GUI interface.
     }
+#if BX_SUPPORT_SMP_THREADS
+    else if (bx_smp_parallel_enabled()) {
+      bx_smp_parallel_loop();
+    }
+#endif
 #if BX_SUPPORT_SMP
     else {
-      // SMP simulation: do a few instructions on each processor, then switch
-      // to another.  Increasing quantum speeds up overall performance, but
-      // reduces granularity of synchronization between processors.
-      // Current implementation uses dynamic quantum, each processor will
-      // execute exactly one trace then quit the cpu_loop and switch to
-      // the next processor.
-
-      static int quantum = SIM->get_param_num(BXPN_SMP_QUANTUM)->get();
-      Bit32u executed = 0, processor = 0;
+      // SMP simulation: run a slice of instructions on each processor, then
+      // switch to another.  Increasing the slice speeds up overall
+      // performance, but reduces granularity of synchronization between
+      // processors. The slice starts at 'quantum' and is doubled every
+      // round up to 'max_quantum' while the processors don't interact; it
+      // drops back when a waiting processor wakes up or one spins with
+      // PAUSE. A slice never extends beyond the next timer event.
+      //
+      // Processors waiting in HLT or MWAIT state with nothing to wake them
+      // up are parked and not run at all. When all of them are parked the
+      // simulation skips ahead to the next timer event.
+
+      Bit32u quantum = SIM->get_param_num(BXPN_SMP_QUANTUM)->get();
+      Bit32u max_quantum = SIM->get_param_num(BXPN_SMP_MAX_QUANTUM)->get();
+      if (max_quantum < quantum) max_quantum = quantum;
+      Bit32u slice = quantum;
+
+      // instructions each processor ran beyond its previous slices, taken
+      // from the next ones, and whether it was parked in the previous round
+      Bit32u *overrun = new Bit32u[BX_SMP_PROCESSORS];
+      bx_bool *parked = new bx_bool[BX_SMP_PROCESSORS];
+      memset(overrun, 0, BX_SMP_PROCESSORS * sizeof(Bit32u));
+      memset(parked, 0, BX_SMP_PROCESSORS * sizeof(bx_bool));
 
       while (1) {
-         // do some instructions in each processor
-         Bit64u icount = BX_CPU(processor)->icount_last_sync = BX_CPU(processor)->get_icount();
-         BX_CPU(processor)->cpu_run_trace();
-
-         // see how many instruction it was able to run
-         Bit32u n = (Bit32u)(BX_CPU(processor)->get_icount() - icount);
-         if (n == 0) n = quantum; // the CPU was halted
-         executed += n;
-
-         if (++processor == BX_SMP_PROCESSORS) {
-           processor = 0;
-           BX_TICKN(executed / BX_SMP_PROCESSORS);
-           executed %= BX_SMP_PROCESSORS;
-         }
-
-         if (bx_pc_system.kill_bochs_request)
-           break;
+        Bit32u budget = bx_pc_system.getNumCpuTicksLeftNextEvent();
+        if (budget > slice) budget = slice;
+        if (budget == 0) budget = 1;
+        bx_bool idle = 1, interaction = 0;
+
+        for (unsigned processor = 0; processor < BX_SMP_PROCESSORS; processor++) {
+          BX_CPU_C *cpu = BX_CPU(processor);
+          if (cpu->is_parked()) {
+            parked[processor] = 1;
+            overrun[processor] = 0;
+            continue;
+          }
+          if (parked[processor]) {
+            parked[processor] = 0;
+            interaction = 1;
+          }
+          idle = 0;
+
+          if (overrun[processor] >= budget) {
+            overrun[processor] -= budget;
+            continue;
+          }
+          Bit32u target = budget - overrun[processor], n;
+
+          Bit64u icount = cpu->icount_last_sync = cpu->get_icount();
+          cpu->pause_hint = 0;
+          do {
+            cpu->cpu_run_trace();
+            n = (Bit32u)(cpu->get_icount() - icount);
+            if (cpu->pause_hint) {
+              interaction = 1;
+              break;
+            }
+            if (cpu->activity_state != BX_CPU_C::BX_ACTIVITY_STATE_ACTIVE)
+              break; // the CPU was halted
+          } while (n < target && !bx_pc_system.kill_bochs_request);
+          overrun[processor] = (n > target) ? (n - target) : 0;
+        }
+
+        // nothing to run, pass the time until the next timer event
+        if (idle && bx_pc_system.getNumCpuTicksLeftNextEvent() > budget)
+          budget = bx_pc_system.getNumCpuTicksLeftNextEvent();
+        BX_TICKN(budget);
+
+        if (interaction)
+          slice = quantum;
+        else if (slice < max_quantum)
+          slice = (slice > max_quantum / 2) ? max_quantum : (slice * 2);
+
+        if (bx_pc_system.kill_bochs_request)
+          break;
       }
+
+      delete [] overrun;
+      delete [] parked;
     }
 #endif /* BX_SUPPORT_SMP */
   }
@@ -1861,6 +2100,7 @@ void bx_init_hardware()
   }
 
   io->set_log_prefix(SIM->get_param_string(BXPN_LOG_PREFIX)->getptr());
+  io->set_async(SIM->get_param_bool(BXPN_LOG_ASYNC)->get());
 
   // Output to the log file the cpu and device settings
   // This will by handy for bug reports
@@ -1886,6 +2126,9 @@ void bx_init_hardware()
   BX_INFO(("CPU configuration"));
 #if BX_SUPPORT_SMP
   BX_INFO(("  SMP support: yes, quantum=%d", SIM->get_param_num(BXPN_SMP_QUANTUM)->get()));
+#if BX_SUPPORT_SMP_THREADS
+  BX_INFO(("  parallel SMP simulation: %s", SIM->get_param_bool(BXPN_SMP_PARALLEL)->get()?"yes":"no"));
+#endif
 #else
   BX_INFO(("  SMP support: no"));
 #endif
@@ -2007,6 +2250,9 @@ void bx_init_hardware()
   }
 #endif
 
+  // open the record / replay log before anything reads host values
+  bx_replay.init();
+
   // set up memory and CPU objects
   bx_param_num_c *bxp_memsize = SIM->get_param_num(BXPN_MEM_SIZE);
   Bit64u memSize = bxp_memsize->get64() * BX_CONST64(1024*1024);
@@ -2131,6 +2377,7 @@ int bx_atexit(void)
   BX_MEM(0)->cleanup_memory();
 
   bx_pc_system.exit();
+  bx_replay.exit();
 
   // restore signal handling to defaults
 #if BX_DEBUGGER == 0
@@ -76,6 +76,12 @@ struct memory_handler_struct {
   memory_direct_access_handler_t da_handler;
 };
 
+// scatter-gather list entry for device DMA, may cross page boundaries
+struct bx_dma_sg_t {
+  bx_phy_address addr;
+  Bit32u len;
+};
+
 #define SMRAM_CODE  1
 #define SMRAM_DATA  2
 
@@ -106,6 +112,8 @@ private:
   BX_MEM_SMF void   read_block(Bit32u block);
 #endif
 
+  BX_MEM_SMF Bit8u*  getHostMemRun(bx_phy_address addr, Bit32u len, unsigned rw, Bit32u *run);
+
 public:
   BX_MEM_C();
  ~BX_MEM_C();
@@ -131,6 +139,9 @@ public:
 
   BX_MEM_SMF void    dmaReadPhysicalPage(bx_phy_address addr, unsigned len, Bit8u *data);
   BX_MEM_SMF void    dmaWritePhysicalPage(bx_phy_address addr, unsigned len, Bit8u *data);
+  // scatter-gather DMA from / to a linear buffer
+  BX_MEM_SMF void    dma_read_sg(const bx_dma_sg_t *sg, unsigned count, Bit8u *data);
+  BX_MEM_SMF void    dma_write_sg(const bx_dma_sg_t *sg, unsigned count, const Bit8u *data);
 
   BX_MEM_SMF void    load_ROM(const char *path, bx_phy_address romaddress, Bit8u type);
   BX_MEM_SMF void    load_RAM(const char *path, bx_phy_address romaddress);
@@ -141,6 +152,7 @@ public:
 #if (BX_DEBUGGER || BX_GDBSTUB)
   BX_MEM_SMF bx_bool dbg_set_mem(bx_phy_address addr, unsigned len, Bit8u *buf);
   BX_MEM_SMF bx_bool dbg_crc32(bx_phy_address addr1, bx_phy_address addr2, Bit32u *crc);
+  BX_MEM_SMF Bit8u*  dbg_get_host_ram(Bit64u *size);
 #endif
 
   BX_MEM_SMF bx_bool registerMemoryHandlers(void *param, memory_handler_t read_handler,
@@ -23,6 +23,7 @@
 #include "bochs.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#include "revexec.h"
 #define LOG_THIS BX_MEM_THIS
 
 //
@@ -36,27 +37,33 @@
 // 0xf0000 - 0xfffff    Upper BIOS Area (64K)
 //
 
-void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, void *data)
-{
-  Bit8u *data_ptr;
-  bx_phy_address a20addr = A20ADDR(addr);
-  struct memory_handler_struct *memory_handler = NULL;
-
 #ifdef BOCHSERVISOR
-  // Defined in main.cc
-  extern Bit64u dirty_bits_l1[(4ULL * 1024 * 1024 * 1024) / (1024 * 1024 * 64)];
-  extern Bit64u dirty_bits_l2[(4ULL * 1024 * 1024 * 1024) / (4096 * 64)];
+// Defined in main.cc
+extern Bit64u dirty_bits_l1[(4ULL * 1024 * 1024 * 1024) / (1024 * 1024 * 64)];
+extern Bit64u dirty_bits_l2[(4ULL * 1024 * 1024 * 1024) / (4096 * 64)];
+
+#if BX_SUPPORT_SMP_THREADS
+// CPUs running in parallel may write to pages sharing a bitmap qword, the
+// atomic update is skipped if the bit is set already
+#define BX_DIRTY_BIT_SET(qword, bit) \
+  do { if (! ((qword) & (bit))) BX_ATOMIC_OR64(&(qword), (bit)); } while (0)
+#else
+#define BX_DIRTY_BIT_SET(qword, bit) do { (qword) |= (bit); } while (0)
+#endif
 
+// Set the dirty bits of every 4 KiB page touched by a write of <len> bytes
+// at <addr>, so that the page is restored on the next snapshot reset
+static BX_CPP_INLINE void mark_pages_dirty(bx_phy_address addr, Bit64u len)
+{
   // Compute the 4 KiB aligned addresses for the start and end of the region
   // being written
-  bx_phy_address aligned_addr = a20addr & ~0xfff;
-  bx_phy_address end_addr     = (a20addr + len + 0xfff) & ~0xfff;
+  bx_phy_address dirty_addr = addr & ~0xfff;
+  bx_phy_address end_addr   = (addr + len + 0xfff) & ~0xfff;
 
   // Go through each 4 KiB page that will be touched by this write
-  for(bx_phy_address dirty_addr = aligned_addr; aligned_addr < end_addr;
-      aligned_addr += 4096) {
+  for (; dirty_addr < end_addr; dirty_addr += 4096) {
     // Bounds check
-    if(dirty_addr >= 0x100000000ULL) {
+    if (dirty_addr >= 0x100000000ULL) {
       fprintf(stderr, "Whoa, writing to high 4 GiB?!?\n");
       exit(-1);
     }
@@ -64,13 +71,24 @@ void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned le
     // Set the dirty bit in the first level (1 MiB) dirty bit table
     Bit64u qword_l1 = dirty_addr / (1024 * 1024 * 64);
     Bit64u bit_l1   = (dirty_addr / (1024 * 1024)) % 64;
-    dirty_bits_l1[qword_l1] |= 1ULL << bit_l1;
+    BX_DIRTY_BIT_SET(dirty_bits_l1[qword_l1], 1ULL << bit_l1);
 
     // Set the dirty bit in the second level (4 KiB) dirty bit table
     Bit64u qword_l2 = dirty_addr / (4096 * 64);
     Bit64u bit_l2   = (dirty_addr / 4096) % 64;
-    dirty_bits_l2[qword_l2] |= 1ULL << bit_l2;
+    BX_DIRTY_BIT_SET(dirty_bits_l2[qword_l2], 1ULL << bit_l2);
   }
+}
+#endif
+
+void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, void *data)
+{
+  Bit8u *data_ptr;
+  bx_phy_address a20addr = A20ADDR(addr);
+  struct memory_handler_struct *memory_handler = NULL;
+
+#ifdef BOCHSERVISOR
+  mark_pages_dirty(a20addr, len);
 #endif
 
   // Note: accesses should always be contained within a single page
@@ -78,6 +96,10 @@ void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned le
     BX_PANIC(("writePhysicalPage: cross page access at address 0x" FMT_PHY_ADDRX ", len=%d", addr, len));
   }
 
+#if BX_DEBUGGER || BX_GDBSTUB
+  bx_revexec.ram_write(a20addr);
+#endif
+
 #if BX_SUPPORT_MONITOR_MWAIT
   BX_MEM_THIS check_monitor(a20addr, len);
 #endif
@@ -101,16 +123,24 @@ void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned le
   }
 
   memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->write_handler != NULL) {
-      if (memory_handler->begin <= a20addr &&
-          memory_handler->end >= a20addr &&
-          memory_handler->write_handler(a20addr, len, data, memory_handler->param))
-      {
-        return;
+  if (memory_handler) {
+    bx_bool handled = 0;
+    BX_LOCK_DEVICES();
+    memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
+    while (memory_handler) {
+      if (memory_handler->write_handler != NULL) {
+        if (memory_handler->begin <= a20addr &&
+            memory_handler->end >= a20addr &&
+            memory_handler->write_handler(a20addr, len, data, memory_handler->param))
+        {
+          handled = 1;
+          break;
+        }
       }
+      memory_handler = memory_handler->next;
     }
-    memory_handler = memory_handler->next;
+    BX_UNLOCK_DEVICES();
+    if (handled) return;
   }
 
 mem_write:
@@ -277,14 +307,22 @@ void BX_MEM_C::readPhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned len
   }
 
   memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr &&
-          memory_handler->end >= a20addr &&
-          memory_handler->read_handler(a20addr, len, data, memory_handler->param))
-    {
-      return;
+  if (memory_handler) {
+    bx_bool handled = 0;
+    BX_LOCK_DEVICES();
+    memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
+    while (memory_handler) {
+      if (memory_handler->begin <= a20addr &&
+            memory_handler->end >= a20addr &&
+            memory_handler->read_handler(a20addr, len, data, memory_handler->param))
+      {
+        handled = 1;
+        break;
+      }
+      memory_handler = memory_handler->next;
     }
-    memory_handler = memory_handler->next;
+    BX_UNLOCK_DEVICES();
+    if (handled) return;
   }
 
 mem_read:
@@ -447,6 +485,9 @@ void BX_MEM_C::dmaWritePhysicalPage(bx_phy_address addr, unsigned len, Bit8u *da
   Bit8u *memptr = getHostMemAddr(NULL, addr, BX_WRITE);
   if (memptr != NULL) {
     pageWriteStampTable.decWriteStamp(addr);
+#ifdef BOCHSERVISOR
+    mark_pages_dirty(A20ADDR(addr), len);
+#endif
     memcpy(memptr, data, len);
   }
   else {
@@ -455,3 +496,83 @@ void BX_MEM_C::dmaWritePhysicalPage(bx_phy_address addr, unsigned len, Bit8u *da
     }
   }
 }
+
+// Returns the host address of <addr> and in <run> the number of bytes from
+// there (up to <len>) that are contiguous in host memory as well. If direct
+// access is not allowed, NULL is returned and <run> covers the rest of the page.
+Bit8u *BX_MEM_C::getHostMemRun(bx_phy_address addr, Bit32u len, unsigned rw, Bit32u *run)
+{
+  Bit32u chunk = 0x1000 - (Bit32u)(addr & 0xfff);
+  if (chunk > len) chunk = len;
+  *run = chunk;
+
+  Bit8u *memptr = getHostMemAddr(NULL, addr, rw);
+  if (memptr == NULL) return NULL;
+
+  while (*run < len) {
+#if BX_LARGE_RAMFILE
+    // fetching the next block might swap out this one
+    if (((addr + *run) & (BX_MEM_BLOCK_LEN-1)) == 0) break;
+#endif
+    if (getHostMemAddr(NULL, addr + *run, rw) != (memptr + *run)) break;
+    chunk = len - *run;
+    if (chunk > 0x1000) chunk = 0x1000;
+    *run += chunk;
+  }
+  return memptr;
+}
+
+void BX_MEM_C::dma_read_sg(const bx_dma_sg_t *sg, unsigned count, Bit8u *data)
+{
+  Bit32u run;
+
+  for (unsigned n = 0; n < count; n++) {
+    bx_phy_address addr = sg[n].addr;
+    Bit32u len = sg[n].len;
+    while (len > 0) {
+      Bit8u *memptr = getHostMemRun(addr, len, BX_READ, &run);
+      if (memptr != NULL) {
+        memcpy(data, memptr, run);
+      }
+      else {
+        for (unsigned i = 0; i < run; i++) {
+          readPhysicalPage(NULL, addr+i, 1, &data[i]);
+        }
+      }
+      data += run;
+      addr += run;
+      len -= run;
+    }
+  }
+}
+
+void BX_MEM_C::dma_write_sg(const bx_dma_sg_t *sg, unsigned count, const Bit8u *data)
+{
+  Bit32u run;
+
+  for (unsigned n = 0; n < count; n++) {
+    bx_phy_address addr = sg[n].addr;
+    Bit32u len = sg[n].len;
+    while (len > 0) {
+      Bit8u *memptr = getHostMemRun(addr, len, BX_WRITE, &run);
+      if (memptr != NULL) {
+        bx_phy_address last = (addr + run - 1) & ~0xfff;
+        for (bx_phy_address page = addr & ~0xfff; page <= last; page += 0x1000) {
+          pageWriteStampTable.decWriteStamp(page);
+        }
+#ifdef BOCHSERVISOR
+        mark_pages_dirty(A20ADDR(addr), run);
+#endif
+        memcpy(memptr, data, run);
+      }
+      else {
+        for (unsigned i = 0; i < run; i++) {
+          writePhysicalPage(NULL, addr+i, 1, (void*)&data[i]);
+        }
+      }
+      data += run;
+      addr += run;
+      len -= run;
+    }
+  }
+}
@@ -26,6 +26,7 @@
 #include "param_names.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#include "revexec.h"
 #define LOG_THIS BX_MEM(0)->
 
 // alignment of memory vector, must be a power of 2
@@ -268,6 +269,19 @@ void BX_MEM_C::allocate_block(Bit32u block)
 {
   const Bit32u max_blocks = (Bit32u)(BX_MEM_THIS allocated / BX_MEM_BLOCK_LEN);
 
+#if BX_SUPPORT_SMP_THREADS
+  // another CPU might have allocated the block in the meantime
+  BX_LOCK_DEVICES();
+  if (BX_MEM_THIS blocks[block]
+#if BX_LARGE_RAMFILE
+      && (BX_MEM_THIS blocks[block] != BX_MEM_C::swapped_out)
+#endif
+     ) {
+    BX_UNLOCK_DEVICES();
+    return;
+  }
+#endif
+
 #if BX_LARGE_RAMFILE
   /* 
    * Match block to vector address
@@ -330,6 +344,7 @@ void BX_MEM_C::allocate_block(Bit32u block)
   }
   BX_DEBUG(("allocate_block: used_blocks=0x%x of 0x%x", BX_MEM_THIS used_blocks, max_blocks));
 #endif
+  BX_UNLOCK_DEVICES();
 }
 
 #if BX_LARGE_RAMFILE
@@ -724,6 +739,7 @@ bx_bool BX_MEM_C::dbg_set_mem(bx_phy_address addr, unsigned len, Bit8u *buf)
     return(0); // error, beyond limits of memory
   }
   for (; len>0; len--) {
+    bx_revexec.ram_write(addr);
     // Write to standard PCI/ISA Video Mem / SMMRAM
     if (addr >= 0x000a0000 && addr < 0x000c0000) {
       if (BX_MEM_THIS smram_enable)
@@ -775,6 +791,18 @@ bx_bool BX_MEM_C::dbg_crc32(bx_phy_address addr1, bx_phy_address addr2, Bit32u *
 
   return(1);
 }
+
+// Returns the host memory holding all guest RAM blocks, or NULL if blocks
+// can be swapped out to the overflow file.
+Bit8u* BX_MEM_C::dbg_get_host_ram(Bit64u *size)
+{
+#if BX_LARGE_RAMFILE
+  if (BX_MEM_THIS allocated < BX_MEM_THIS len)
+    return NULL;
+#endif
+  *size = BX_MEM_THIS allocated;
+  return BX_MEM_THIS vector;
+}
 #endif
 
 //
@@ -908,6 +936,9 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
     else
     {
       if (a20addr < 0x000c0000 || a20addr >= 0x00100000) {
+#if BX_DEBUGGER || BX_GDBSTUB
+        bx_revexec.ram_write(a20addr);
+#endif
         return BX_MEM_THIS get_vector(a20addr);
       }
       else {
@@ -1051,6 +1082,13 @@ bx_bool BX_MEM_C::is_monitor(bx_phy_address begin_addr, unsigned len)
 void BX_MEM_C::check_monitor(bx_phy_address begin_addr, unsigned len)
 {
   for (int i=0; i<BX_SMP_PROCESSORS;i++) {
+#if BX_SUPPORT_SMP_THREADS
+    if (bx_pc_system.is_remote_cpu(i)) {
+      if (BX_CPU(i)->is_monitor(begin_addr, len))
+        BX_CPU(i)->lapic.post_request(BX_LAPIC_MBOX_MONITOR);
+      continue;
+    }
+#endif
     BX_CPU(i)->check_monitor(begin_addr, len);
   }
 }
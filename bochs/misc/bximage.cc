@@ -76,6 +76,9 @@
 #include "iodev/hdimage/vmware3.h"
 #include "iodev/hdimage/vmware4.h"
 #include "iodev/hdimage/vpc-img.h"
+#include "iodev/hdimage/vbox.h"
+#include "iodev/hdimage/qcow2.h"
+#include "iodev/hdimage/dedup.h"
 
 #define BXIMAGE_MODE_NULL            0
 #define BXIMAGE_MODE_CREATE_IMAGE    1
@@ -101,6 +104,9 @@ const char *hdimage_mode_names[] = {
   "volatile",
   "vvfat",
   "vpc",
+  "vbox",
+  "qcow2",
+  "dedup",
   NULL
 };
 
@@ -144,12 +150,12 @@ const unsigned fdsize_sectors[] = { 320, 360, 640, 720, 1440, 2400, 2880, 3360,
 int fdsize_n_choices = 10;
 
 // menu data for choosing disk mode
-const char *hdmode_menu = "\nWhat kind of image should I create?\nPlease type flat, sparse, growing, vpc or vmware4. ";
-const char *hdmode_choices[] = {"flat", "sparse", "growing", "vpc", "vmware4" };
+const char *hdmode_menu = "\nWhat kind of image should I create?\nPlease type flat, sparse, growing, vpc, vmware4 or dedup. ";
+const char *hdmode_choices[] = {"flat", "sparse", "growing", "vpc", "vmware4", "dedup" };
 const int hdmode_choice_id[] = {BX_HDIMAGE_MODE_FLAT, BX_HDIMAGE_MODE_SPARSE,
                                 BX_HDIMAGE_MODE_GROWING, BX_HDIMAGE_MODE_VPC,
-                                BX_HDIMAGE_MODE_VMWARE4};
-int hdmode_n_choices = 5;
+                                BX_HDIMAGE_MODE_VMWARE4, BX_HDIMAGE_MODE_DEDUP};
+int hdmode_n_choices = 6;
 
 // menu data for choosing hard disk sector size
 const char *sectsize_menu = "\nChoose the size of hard disk sectors.\nPlease type 512, 1024 or 4096. ";
@@ -397,6 +403,18 @@ device_image_t* init_image(Bit8u image_mode)
       hdimage = new vpc_image_t();
       break;
 
+    case BX_HDIMAGE_MODE_VBOX:
+      hdimage = new vbox_image_t();
+      break;
+
+    case BX_HDIMAGE_MODE_QCOW2:
+      hdimage = new qcow2_image_t();
+      break;
+
+    case BX_HDIMAGE_MODE_DEDUP:
+      hdimage = new dedup_image_t();
+      break;
+
     default:
       fatal("unsupported disk image mode");
       break;
@@ -728,6 +746,41 @@ void create_vmware4_image(const char *filename, Bit64u size)
   close(fd);
 }
 
+// The chunk store is created on first use. By default all dedup images in
+// the same directory share one store.
+void create_dedup_image(const char *filename, Bit64u size)
+{
+  dedup_header_t header;
+  Bit32u map[1024];
+
+  Bit32u count = (Bit32u)((size + DEDUP_BLOCK_SIZE - 1) / DEDUP_BLOCK_SIZE);
+  memset(&header, 0, sizeof(header));
+  strcpy((char*)header.standard.magic, STANDARD_HEADER_MAGIC);
+  strcpy((char*)header.standard.type, DEDUP_TYPE);
+  strcpy((char*)header.standard.subtype, DEDUP_SUBTYPE_MAP);
+  header.standard.version = htod32(STANDARD_HEADER_VERSION);
+  header.standard.header = htod32(STANDARD_HEADER_SIZE);
+  header.specific.block = htod32(DEDUP_BLOCK_SIZE);
+  header.specific.count = htod32(count);
+  header.specific.disk = htod64(size);
+  strcpy((char*)header.specific.store, DEDUP_DEFAULT_STORE);
+
+  int fd = create_image_file(filename);
+  if (bx_write_image(fd, 0, &header, sizeof(header)) != sizeof(header)) {
+    close(fd);
+    fatal("ERROR: The disk image is not complete - could not write header!");
+  }
+  memset(map, 0, sizeof(map));
+  for (Bit32u i = 0; i < count; i += 1024) {
+    int n = ((count - i) < 1024) ? (count - i) * 4 : sizeof(map);
+    if (bx_write_image(fd, STANDARD_HEADER_SIZE + (Bit64s) i * 4, map, n) != n) {
+      close(fd);
+      fatal("ERROR: The disk image is not complete - could not write block map!");
+    }
+  }
+  close(fd);
+}
+
 void create_hard_disk_image(const char *filename, int imgmode, Bit64u size)
 {
   switch (imgmode) {
@@ -755,6 +808,10 @@ void create_hard_disk_image(const char *filename, int imgmode, Bit64u size)
       create_vmware4_image(filename, size);
       break;
 
+    case BX_HDIMAGE_MODE_DEDUP:
+      create_dedup_image(filename, size);
+      break;
+
     default:
       fatal("image mode not implemented yet");
   }
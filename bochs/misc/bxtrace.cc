@@ -0,0 +1,272 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+// bxtrace: decoder for the binary traces written by the "bintrace"
+// instrumentation module. It prints one line per record:
+//
+//   <cpu> I <laddr> <16|32|64> <opcode bytes>
+//   <cpu> M <R|W|X|RW> <laddr> <paddr> <size> [<memtype>]
+//   <cpu> E <exception|interrupt|hwinterrupt> <vector> [<error code>]
+//   <cpu> R <reset type>
+//
+// Numbers are hexadecimal except the cpu and the access size. With the
+// -stats option only a summary is printed.
+
+#include "config.h"
+#include "misc/bxcompat.h"
+#include "osdep.h"
+#include "instrument/bintrace/bxtrace.h"
+
+typedef struct {
+  Bit64u next_laddr;
+  Bit64u mem_laddr;
+  Bit64u mem_paddr;
+  bxtrace_opcache_entry_t *opcache;
+  Bit64u insns;
+  Bit64u mem_accesses;
+  Bit64u events;
+} cpu_state_t;
+
+static FILE *trace_fp;
+static Bit8u trace_buffer[65536];
+static unsigned trace_len = 0, trace_pos = 0;
+static Bit64u trace_offset = 0;
+static int eof = 0;
+
+static int filter_cpu = -1;
+static int show_mem = 1;
+static int stats_only = 0;
+static Bit64u max_insns = 0;
+
+static const char *rw_names[4] = { "R", "W", "X", "RW" };
+static const char *event_names[4] = { "exception", "interrupt", "hwinterrupt", "unknown" };
+
+void print_usage()
+{
+  fprintf(stderr,
+    "Usage: bxtrace [options] tracefile\n\n"
+    "Supported options:\n"
+    "  -cpu=...      only show the records of this cpu\n"
+    "  -count=...    stop after this number of instructions\n"
+    "  -nomem        don't show memory accesses\n"
+    "  -stats        only print a summary\n"
+    "  --help        display this help and exit\n\n");
+}
+
+static int get_byte(Bit8u *val)
+{
+  if (trace_pos >= trace_len) {
+    trace_offset += trace_len;
+    trace_len = (unsigned)fread(trace_buffer, 1, sizeof(trace_buffer), trace_fp);
+    trace_pos = 0;
+    if (trace_len == 0) {
+      eof = 1;
+      return 0;
+    }
+  }
+  *val = trace_buffer[trace_pos++];
+  return 1;
+}
+
+static int get_varint(Bit64u *val)
+{
+  Bit8u byte;
+  unsigned shift = 0;
+
+  *val = 0;
+  do {
+    if (!get_byte(&byte) || (shift > 63))
+      return 0;
+    *val |= (Bit64u)(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return 1;
+}
+
+static void corrupt(const char *what)
+{
+  fprintf(stderr, "bxtrace: %s at offset 0x" FMT_LL "x\n", what,
+          trace_offset + trace_pos);
+  exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+  bxtrace_header_t header;
+  cpu_state_t *cpus, *cpu;
+  bxtrace_opcache_entry_t *entry;
+  Bit64u val, laddr, paddr, size, insns = 0;
+  Bit8u tag, len, memtype;
+  unsigned ncpus, cur = 0, n;
+  const char *filename = NULL;
+  int arg;
+
+  for (arg = 1; arg < argc; arg++) {
+    if (!strcmp("--help", argv[arg]) || !strncmp("-h", argv[arg], 2)) {
+      print_usage();
+      return 0;
+    } else if (!strncmp("-cpu=", argv[arg], 5)) {
+      filter_cpu = atoi(&argv[arg][5]);
+    } else if (!strncmp("-count=", argv[arg], 7)) {
+      max_insns = strtoull(&argv[arg][7], NULL, 0);
+    } else if (!strcmp("-nomem", argv[arg])) {
+      show_mem = 0;
+    } else if (!strcmp("-stats", argv[arg])) {
+      stats_only = 1;
+    } else if ((argv[arg][0] != '-') && (filename == NULL)) {
+      filename = argv[arg];
+    } else {
+      fprintf(stderr, "Unknown option: %s\n\n", argv[arg]);
+      print_usage();
+      return 1;
+    }
+  }
+  if (filename == NULL) {
+    print_usage();
+    return 1;
+  }
+
+  trace_fp = fopen(filename, "rb");
+  if (trace_fp == NULL) {
+    fprintf(stderr, "bxtrace: cannot open '%s'\n", filename);
+    return 1;
+  }
+  if ((fread(&header, sizeof(header), 1, trace_fp) != 1) ||
+      (header.magic != BXTRACE_MAGIC)) {
+    fprintf(stderr, "bxtrace: '%s' is not a Bochs binary trace\n", filename);
+    return 1;
+  }
+  if (header.version != BXTRACE_VERSION) {
+    fprintf(stderr, "bxtrace: unsupported trace version %u\n", header.version);
+    return 1;
+  }
+  fseek(trace_fp, header.header_size, SEEK_SET);
+  trace_offset = header.header_size;
+
+  ncpus = header.ncpus;
+  cpus = new cpu_state_t[ncpus];
+  memset(cpus, 0, ncpus * sizeof(cpu_state_t));
+  for (n = 0; n < ncpus; n++) {
+    cpus[n].opcache = new bxtrace_opcache_entry_t[BXTRACE_OPCACHE_SIZE];
+    memset(cpus[n].opcache, 0, BXTRACE_OPCACHE_SIZE * sizeof(bxtrace_opcache_entry_t));
+  }
+  cpu = &cpus[0];
+
+  while (get_byte(&tag)) {
+    int show = !stats_only && ((filter_cpu < 0) || ((unsigned)filter_cpu == cur));
+    switch (BXTRACE_REC_TYPE(tag)) {
+      case BXTRACE_REC_INSN:
+        if (!get_varint(&val)) corrupt("truncated instruction record");
+        laddr = cpu->next_laddr + BXTRACE_UNZIGZAG(val);
+        entry = &cpu->opcache[BXTRACE_OPCACHE_INDEX(laddr)];
+        if (tag & BXTRACE_INSN_BYTES) {
+          if (!get_byte(&len) || (len == 0) || (len > BXTRACE_MAX_OPCODE_LENGTH))
+            corrupt("bad instruction length");
+          for (n = 0; n < len; n++) {
+            if (!get_byte(&entry->opcode[n])) corrupt("truncated instruction record");
+          }
+          entry->laddr = laddr;
+          entry->len = len;
+          entry->mode = tag & (BXTRACE_INSN_IS32 | BXTRACE_INSN_IS64);
+        } else if ((entry->laddr != laddr) || (entry->len == 0)) {
+          corrupt("instruction bytes missing");
+        }
+        cpu->next_laddr = laddr + entry->len;
+        cpu->insns++;
+        if (show) {
+          printf("%u I " FMT_LL "x %s ", cur, laddr,
+                 (entry->mode & BXTRACE_INSN_IS64) ? "64" : (entry->mode & BXTRACE_INSN_IS32) ? "32" : "16");
+          for (n = 0; n < entry->len; n++)
+            printf("%02x", entry->opcode[n]);
+          printf("\n");
+        }
+        if ((max_insns > 0) && (++insns >= max_insns))
+          goto done;
+        break;
+      case BXTRACE_REC_MEM:
+        if (!get_varint(&size) || !get_varint(&val)) corrupt("truncated memory record");
+        laddr = cpu->mem_laddr + BXTRACE_UNZIGZAG(val);
+        memtype = 0;
+        if ((tag & BXTRACE_MEM_MEMTYPE) && !get_byte(&memtype))
+          corrupt("truncated memory record");
+        if (tag & BXTRACE_MEM_IDENTITY) {
+          paddr = laddr;
+        } else {
+          if (!get_varint(&val)) corrupt("truncated memory record");
+          paddr = cpu->mem_paddr + BXTRACE_UNZIGZAG(val);
+        }
+        cpu->mem_laddr = laddr;
+        cpu->mem_paddr = paddr;
+        cpu->mem_accesses++;
+        if (show && show_mem) {
+          printf("%u M %s " FMT_LL "x " FMT_LL "x %u", cur, rw_names[BXTRACE_MEM_RW(tag)],
+                 laddr, paddr, (unsigned) size);
+          if (tag & BXTRACE_MEM_MEMTYPE)
+            printf(" %x", memtype);
+          printf("\n");
+        }
+        break;
+      case BXTRACE_REC_CPU:
+        if (!get_varint(&val)) corrupt("truncated cpu record");
+        if (val >= ncpus) corrupt("bad cpu number");
+        cur = (unsigned) val;
+        cpu = &cpus[cur];
+        break;
+      case BXTRACE_REC_EVENT:
+        if (!get_varint(&val)) corrupt("truncated event record");
+        cpu->events++;
+        if (show)
+          printf("%u E %s %x", cur, event_names[BXTRACE_EVENT_TYPE(tag)], (unsigned) val);
+        if (BXTRACE_EVENT_TYPE(tag) == BXTRACE_EVENT_EXCEPTION) {
+          if (!get_varint(&val)) corrupt("truncated event record");
+          if (show)
+            printf(" %x", (unsigned) val);
+        }
+        if (show)
+          printf("\n");
+        break;
+      case BXTRACE_REC_RESET:
+        if (!get_varint(&val)) corrupt("truncated reset record");
+        cpu->next_laddr = cpu->mem_laddr = cpu->mem_paddr = 0;
+        if (show)
+          printf("%u R %x\n", cur, (unsigned) val);
+        break;
+      default:
+        corrupt("unknown record type");
+    }
+  }
+  if (!eof) corrupt("read error");
+
+done:
+  if (stats_only) {
+    for (n = 0; n < ncpus; n++) {
+      if ((filter_cpu >= 0) && ((unsigned)filter_cpu != n)) continue;
+      printf("cpu %u: " FMT_LL "u instructions, " FMT_LL "u memory accesses, " FMT_LL "u events\n",
+             n, cpus[n].insns, cpus[n].mem_accesses, cpus[n].events);
+    }
+  }
+  for (n = 0; n < ncpus; n++)
+    delete [] cpus[n].opcache;
+  delete [] cpus;
+  fclose(trace_fp);
+  return 0;
+}
@@ -41,6 +41,8 @@
 #define BXPN_CPU_MODEL                   "cpu.model"
 #define BXPN_IPS                         "cpu.ips"
 #define BXPN_SMP_QUANTUM                 "cpu.quantum"
+#define BXPN_SMP_MAX_QUANTUM             "cpu.max_quantum"
+#define BXPN_SMP_PARALLEL                "cpu.parallel"
 #define BXPN_RESET_ON_TRIPLE_FAULT       "cpu.reset_on_triple_fault"
 #define BXPN_IGNORE_BAD_MSRS             "cpu.ignore_bad_msrs"
 #define BXPN_CONFIGURABLE_MSRS_PATH      "cpu.msrs"
@@ -99,6 +101,7 @@
 #define BXPN_PCI_CHIPSET                 "pci.chipset"
 #define BXPN_PCIDEV_VENDOR               "pci.pcidev.vendor"
 #define BXPN_PCIDEV_DEVICE               "pci.pcidev.device"
+#define BXPN_FUZZINPUT                   "pci.fuzzinput"
 #define BXPN_SEL_DISPLAY_LIBRARY         "display.display_library"
 #define BXPN_DISPLAYLIB_OPTIONS          "display.displaylib_options"
 #define BXPN_PRIVATE_COLORMAP            "display.private_colormap"
@@ -107,6 +110,7 @@
 #define BXPN_VGA_EXTENSION               "display.vga_extension"
 #define BXPN_VGA_UPDATE_FREQUENCY        "display.vga_update_frequency"
 #define BXPN_VGA_REALTIME                "display.vga_realtime"
+#define BXPN_VGA_HEADLESS                "display.vga_headless"
 #define BXPN_VOODOO                      "display.voodoo"
 #define BXPN_KEYBOARD                    "keyboard_mouse.keyboard"
 #define BXPN_KBD_TYPE                    "keyboard_mouse.keyboard.type"
@@ -179,8 +183,11 @@
 #define BXPN_SOUND_ES1370                "sound.es1370"
 #define BXPN_PORT_E9_HACK                "misc.port_e9_hack"
 #define BXPN_GDBSTUB                     "misc.gdbstub"
+#define BXPN_REPLAY_MODE                 "misc.replay.mode"
+#define BXPN_REPLAY_FILE                 "misc.replay.file"
 #define BXPN_LOG_FILENAME                "log.filename"
 #define BXPN_LOG_PREFIX                  "log.prefix"
+#define BXPN_LOG_ASYNC                   "log.async"
 #define BXPN_DEBUGGER_LOG_FILENAME       "log.debugger_filename"
 #define BXPN_MENU_DISK                   "menu.disk"
 #define BXPN_MENU_DISK_WIN32             "menu.disk_win32"
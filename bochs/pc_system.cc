@@ -23,6 +23,9 @@
 #include "bochs.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#if BX_SUPPORT_SMP_THREADS
+#include "bxthread.h"
+#endif
 #define LOG_THIS bx_pc_system.
 
 #if defined(PROVIDE_M_IPS)
@@ -37,6 +40,12 @@ double     m_ips; // Millions of Instructions Per Second
 
 const Bit64u bx_pc_system_c::NullTimerInterval = 0xffffffff;
 
+#if BX_SUPPORT_SMP_THREADS
+static BX_THREAD_LOCAL int smp_current_cpu = 0;
+static BX_THREAD_LOCAL unsigned device_lock_depth = 0;
+static BX_MUTEX(device_mutex);
+#endif
+
   // constructor
 bx_pc_system_c::bx_pc_system_c()
 {
@@ -55,6 +64,12 @@ bx_pc_system_c::bx_pc_system_c()
   timer[0].funct      = nullTimer;
   timer[0].this_ptr   = this;
   numTimers = 1; // So far, only the nullTimer.
+
+#if BX_SUPPORT_SMP_THREADS
+  cpus_running = 0;
+  pending_reset = 0;
+  BX_INIT_MUTEX(device_mutex);
+#endif
 }
 
 void bx_pc_system_c::initialize(Bit32u ips)
@@ -78,8 +93,15 @@ void bx_pc_system_c::initialize(Bit32u ips)
 void bx_pc_system_c::set_HRQ(bx_bool val)
 {
   HRQ = val;
-  if (val)
+  if (val) {
+#if BX_SUPPORT_SMP_THREADS
+    if (is_remote_cpu(0)) {
+      BX_CPU(0)->lapic.post_request(BX_LAPIC_MBOX_ASYNC_EVENT);
+      return;
+    }
+#endif
     BX_CPU(0)->async_event = 1;
+  }
 }
 
 void bx_pc_system_c::raise_INTR(void)
@@ -87,6 +109,12 @@ void bx_pc_system_c::raise_INTR(void)
   if (bx_dbg.interrupts)
     BX_INFO(("pc_system: Setting INTR=1 on bootstrap processor %d", BX_BOOTSTRAP_PROCESSOR));
 
+#if BX_SUPPORT_SMP_THREADS
+  if (is_remote_cpu(BX_BOOTSTRAP_PROCESSOR)) {
+    BX_CPU(BX_BOOTSTRAP_PROCESSOR)->lapic.post_intr(1);
+    return;
+  }
+#endif
   BX_CPU(BX_BOOTSTRAP_PROCESSOR)->raise_INTR();
 }
 
@@ -95,6 +123,12 @@ void bx_pc_system_c::clear_INTR(void)
   if (bx_dbg.interrupts)
     BX_INFO(("pc_system: Setting INTR=0 on bootstrap processor %d", BX_BOOTSTRAP_PROCESSOR));
 
+#if BX_SUPPORT_SMP_THREADS
+  if (is_remote_cpu(BX_BOOTSTRAP_PROCESSOR)) {
+    BX_CPU(BX_BOOTSTRAP_PROCESSOR)->lapic.post_intr(0);
+    return;
+  }
+#endif
   BX_CPU(BX_BOOTSTRAP_PROCESSOR)->clear_INTR();
 }
 
@@ -173,14 +207,28 @@ bx_bool bx_pc_system_c::get_enable_a20(void)
 
 void bx_pc_system_c::MemoryMappingChanged(void)
 {
-  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++)
+  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SUPPORT_SMP_THREADS
+    if (is_remote_cpu(i)) {
+      BX_CPU(i)->lapic.post_request(BX_LAPIC_MBOX_TLB_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->TLB_flush();
+  }
 }
 
 void bx_pc_system_c::invlpg(bx_address addr)
 {
-  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++)
+  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SUPPORT_SMP_THREADS
+    if (is_remote_cpu(i)) {
+      BX_CPU(i)->lapic.post_invlpg(addr);
+      continue;
+    }
+#endif
     BX_CPU(i)->TLB_invlpg(addr);
+  }
 }
 
 int bx_pc_system_c::Reset(unsigned type)
@@ -188,6 +236,18 @@ int bx_pc_system_c::Reset(unsigned type)
   // type is BX_RESET_HARDWARE or BX_RESET_SOFTWARE
   BX_INFO(("bx_pc_system_c::Reset(%s) called",type==BX_RESET_HARDWARE?"HARDWARE":"SOFTWARE"));
 
+#if BX_SUPPORT_SMP_THREADS
+  if (cpus_running) {
+    // the other CPUs are still running, let the main loop reset the
+    // system at the end of the round (a hardware reset supersedes a
+    // software one)
+    if (type == BX_RESET_HARDWARE || !pending_reset)
+      pending_reset = type;
+    BX_CPU(current_cpu())->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+    return(0);
+  }
+#endif
+
   set_enable_a20(1);
 
   // Always reset cpu
@@ -208,6 +268,34 @@ Bit8u bx_pc_system_c::IAC(void)
   return DEV_pic_iac();
 }
 
+#if BX_SUPPORT_SMP_THREADS
+int bx_pc_system_c::current_cpu(void)
+{
+  return smp_current_cpu;
+}
+
+void bx_pc_system_c::set_current_cpu(int cpu)
+{
+  smp_current_cpu = cpu;
+}
+
+// The device lock may be taken recursively by the thread owning it,
+// e.g. when a device handler triggers an interrupt or activates a timer.
+void bx_pc_system_c::enter_device_lock(void)
+{
+  if (device_lock_depth++ == 0) {
+    BX_LOCK(device_mutex);
+  }
+}
+
+void bx_pc_system_c::leave_device_lock(void)
+{
+  if (--device_lock_depth == 0) {
+    BX_UNLOCK(device_mutex);
+  }
+}
+#endif
+
 void bx_pc_system_c::exit(void)
 {
   // delete all registered timers (exception: null timer and APIC timer)
@@ -490,6 +578,7 @@ void bx_pc_system_c::activate_timer_ticks(unsigned i, Bit64u ticks, bx_bool cont
     ticks = MinAllowableTimerPeriod;
   }
 
+  BX_LOCK_DEVICES();
   timer[i].period = ticks;
   timer[i].timeToFire = (ticksTotal + Bit64u(currCountdownPeriod-currCountdown)) + ticks;
   timer[i].active     = 1;
@@ -502,6 +591,7 @@ void bx_pc_system_c::activate_timer_ticks(unsigned i, Bit64u ticks, bx_bool cont
     currCountdownPeriod -= (currCountdown - Bit32u(ticks));
     currCountdown = Bit32u(ticks);
   }
+  BX_UNLOCK_DEVICES();
 }
 
 void bx_pc_system_c::activate_timer(unsigned i, Bit32u useconds, bx_bool continuous)
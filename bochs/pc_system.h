@@ -103,12 +103,20 @@ public:
   Bit32u triggeredTimerParam(void) {
     return timer[triggeredTimer].param;
   }
+  bx_bool timerActive(unsigned timerID) {
+    return timer[timerID].active;
+  }
   static BX_CPP_INLINE void tick1(void) {
     if (--bx_pc_system.currCountdown == 0) {
       bx_pc_system.countdownEvent();
     }
   }
   static BX_CPP_INLINE void tickn(Bit32u n) {
+#if BX_SUPPORT_SMP_THREADS
+    // while the CPUs run in parallel the system time is advanced by the
+    // main loop only, at the end of each round
+    if (bx_pc_system.cpus_running) return;
+#endif
     while (n >= bx_pc_system.currCountdown) {
       n -= bx_pc_system.currCountdown;
       bx_pc_system.currCountdown = 0;
@@ -167,6 +175,29 @@ public:
 
   volatile bx_bool kill_bochs_request;
 
+#if BX_SUPPORT_SMP_THREADS
+  // Parallel SMP simulation: set while each CPU runs in its own host thread.
+  // Requests targeting another CPU are then posted to its local APIC mailbox
+  // and the devices and timers are protected by a single lock.
+  volatile bx_bool cpus_running;
+  // CPU reset requested during a round, performed by the main loop
+  volatile unsigned pending_reset;
+
+  int  current_cpu(void);
+  void set_current_cpu(int cpu);
+  bx_bool is_remote_cpu(unsigned cpu) {
+    return cpus_running && (current_cpu() != (int) cpu);
+  }
+  void enter_device_lock(void);
+  void leave_device_lock(void);
+  BX_CPP_INLINE void lock_devices(void) {
+    if (cpus_running) enter_device_lock();
+  }
+  BX_CPP_INLINE void unlock_devices(void) {
+    if (cpus_running) leave_device_lock();
+  }
+#endif
+
   void set_HRQ(bx_bool val);  // set the Hold ReQuest line
 
   void raise_INTR(void);
@@ -188,4 +219,12 @@ public:
   void    register_state(void);
 };
 
+#if BX_SUPPORT_SMP_THREADS
+#define BX_LOCK_DEVICES()   bx_pc_system.lock_devices()
+#define BX_UNLOCK_DEVICES() bx_pc_system.unlock_devices()
+#else
+#define BX_LOCK_DEVICES()
+#define BX_UNLOCK_DEVICES()
+#endif
+
 #endif
@@ -90,6 +90,10 @@ int (*pluginRegisterDefaultIOReadHandler)(void *thisPtr, ioReadHandler_t callbac
                             const char *name, Bit8u mask) = 0;
 int (*pluginRegisterDefaultIOWriteHandler)(void *thisPtr, ioWriteHandler_t callback,
                              const char *name, Bit8u mask) = 0;
+int (*pluginRegisterIOReadBlockHandler)(void *thisPtr, ioReadBlockHandler_t callback,
+                            unsigned base, const char *name, Bit8u mask) = 0;
+int (*pluginRegisterIOWriteBlockHandler)(void *thisPtr, ioWriteBlockHandler_t callback,
+                             unsigned base, const char *name, Bit8u mask) = 0;
 
 void (*pluginHRQHackCallback)(void);
 unsigned pluginHRQ = 0;
@@ -256,6 +260,28 @@ builtinRegisterDefaultIOWriteHandler(void *thisPtr, ioWriteHandler_t callback,
   return 0;
 }
 
+  static int
+builtinRegisterIOReadBlockHandler(void *thisPtr, ioReadBlockHandler_t callback,
+                            unsigned base, const char *name, Bit8u mask)
+{
+  int ret;
+  BX_ASSERT(mask<8);
+  ret = bx_devices.register_io_read_block_handler (thisPtr, callback, base, name, mask);
+  pluginlog->ldebug("plugin %s registered I/O block read  address at %04x", name, base);
+  return ret;
+}
+
+  static int
+builtinRegisterIOWriteBlockHandler(void *thisPtr, ioWriteBlockHandler_t callback,
+                             unsigned base, const char *name, Bit8u mask)
+{
+  int ret;
+  BX_ASSERT(mask<8);
+  ret = bx_devices.register_io_write_block_handler (thisPtr, callback, base, name, mask);
+  pluginlog->ldebug("plugin %s registered I/O block write address at %04x", name, base);
+  return ret;
+}
+
 #if BX_PLUGINS
 /************************************************************************/
 /* Plugin initialization / deinitialization                             */
@@ -281,6 +307,9 @@ plugin_t *plugin_unload(plugin_t *plugin)
   if (plugin->initialized)
       plugin->plugin_fini();
 
+  // queued log messages may refer to format strings of this plugin
+  io->drain_async();
+
 #if defined(WIN32)
   FreeLibrary(plugin->handle);
 #else
@@ -484,6 +513,9 @@ plugin_startup(void)
   pluginRegisterDefaultIOReadHandler = builtinRegisterDefaultIOReadHandler;
   pluginRegisterDefaultIOWriteHandler = builtinRegisterDefaultIOWriteHandler;
 
+  pluginRegisterIOReadBlockHandler = builtinRegisterIOReadBlockHandler;
+  pluginRegisterIOWriteBlockHandler = builtinRegisterIOWriteBlockHandler;
+
   pluginlog = new logfunctions();
   pluginlog->put("PLUGIN");
 #if BX_PLUGINS && !defined(WIN32)
@@ -822,6 +854,9 @@ static builtin_plugin_t builtin_plugins[] = {
 #if BX_WITH_SDL2
   BUILTIN_GUI_PLUGIN_ENTRY(sdl2),
 #endif
+#if BX_WITH_SHMFB
+  BUILTIN_GUI_PLUGIN_ENTRY(shmfb),
+#endif
 #if BX_WITH_SVGA
   BUILTIN_GUI_PLUGIN_ENTRY(svga),
 #endif
@@ -855,6 +890,9 @@ static builtin_plugin_t builtin_plugins[] = {
 #if BX_SUPPORT_ES1370
   BUILTIN_OPT_PLUGIN_ENTRY(es1370),
 #endif
+#if BX_SUPPORT_FUZZINPUT
+  BUILTIN_OPT_PLUGIN_ENTRY(fuzzinput),
+#endif
 #if BX_SUPPORT_GAMEPORT
   BUILTIN_OPT_PLUGIN_ENTRY(gameport),
 #endif
@@ -916,6 +954,7 @@ static builtin_plugin_t builtin_plugins[] = {
   BUILTIN_NET_PLUGIN_ENTRY(linux),
 #endif
   BUILTIN_NET_PLUGIN_ENTRY(null),
+  BUILTIN_NET_PLUGIN_ENTRY(pcap),
 #if BX_NETMOD_SLIRP
   BUILTIN_NET_PLUGIN_ENTRY(slirp),
 #endif
@@ -62,6 +62,7 @@ extern "C" {
 #define BX_PLUGIN_NE2K      "ne2k"
 #define BX_PLUGIN_EXTFPUIRQ "extfpuirq"
 #define BX_PLUGIN_PCIDEV    "pcidev"
+#define BX_PLUGIN_FUZZINPUT "fuzzinput"
 #define BX_PLUGIN_USB_UHCI  "usb_uhci"
 #define BX_PLUGIN_USB_OHCI  "usb_ohci"
 #define BX_PLUGIN_USB_EHCI  "usb_ehci"
@@ -108,6 +109,8 @@ extern "C" {
 #define DEV_unregister_iowrite_handler_range(b,c,d,e,f) pluginUnregisterIOWriteHandlerRange(b,c,d,e,f)
 #define DEV_register_default_ioread_handler(b,c,d,e) pluginRegisterDefaultIOReadHandler(b,c,d,e)
 #define DEV_register_default_iowrite_handler(b,c,d,e) pluginRegisterDefaultIOWriteHandler(b,c,d,e)
+#define DEV_register_ioread_block_handler(b,c,d,e,f)  pluginRegisterIOReadBlockHandler(b,c,d,e,f)
+#define DEV_register_iowrite_block_handler(b,c,d,e,f) pluginRegisterIOWriteBlockHandler(b,c,d,e,f)
 
 #define DEV_register_irq(b,c) pluginRegisterIRQ(b,c)
 #define DEV_unregister_irq(b,c) pluginUnregisterIRQ(b,c)
@@ -136,6 +139,8 @@ extern "C" {
 #define DEV_unregister_iowrite_handler_range(b,c,d,e,f) bx_devices.unregister_io_write_handler_range(b,c,d,e,f)
 #define DEV_register_default_ioread_handler(b,c,d,e) bx_devices.register_default_io_read_handler(b,c,d,e)
 #define DEV_register_default_iowrite_handler(b,c,d,e) bx_devices.register_default_io_write_handler(b,c,d,e)
+#define DEV_register_ioread_block_handler(b,c,d,e,f)  bx_devices.register_io_read_block_handler(b,c,d,e,f)
+#define DEV_register_iowrite_block_handler(b,c,d,e,f) bx_devices.register_io_write_block_handler(b,c,d,e,f)
 #define DEV_register_irq(b,c) bx_devices.register_irq(b,c)
 #define DEV_unregister_irq(b,c) bx_devices.unregister_irq(b,c)
 
@@ -198,10 +203,6 @@ extern "C" {
 #define DEV_hdimage_init_image(a,b,c) bx_devices.pluginHDImageCtl->init_image(a,b,c)
 #define DEV_hdimage_init_cdrom(a) bx_devices.pluginHDImageCtl->init_cdrom(a)
 
-#define DEV_bulk_io_quantum_requested() (bx_devices.bulkIOQuantumsRequested)
-#define DEV_bulk_io_quantum_transferred() (bx_devices.bulkIOQuantumsTransferred)
-#define DEV_bulk_io_host_addr() (bx_devices.bulkIOHostAddr)
-
 ///////// FLOPPY macro
 #define DEV_floppy_set_media_status(drive, status)  bx_devices.pluginFloppyDevice->set_media_status(drive, status)
 
@@ -244,7 +245,9 @@ extern "C" {
 #define DEV_pci_get_confAddr() bx_devices.pci_get_confAddr()
 #define DEV_pci_set_irq(a,b,c) bx_devices.pluginPci2IsaBridge->pci_set_irq(a,b,c)
 #define DEV_pci_set_base_mem(a,b,c,d,e,f) \
-  (bx_devices.pci_set_base_mem(a,b,c,d,e,f))
+  (bx_devices.pci_set_base_mem(a,b,c,d,e,f,NULL))
+#define DEV_pci_set_base_mem2(a,b,c,d,e,f,g) \
+  (bx_devices.pci_set_base_mem(a,b,c,d,e,f,g))
 #define DEV_pci_set_base_io(a,b,c,d,e,f,g,h) \
   (bx_devices.pci_set_base_io(a,b,c,d,e,f,g,h))
 #define DEV_ide_bmdma_present() bx_devices.pluginPciIdeController->bmdma_present()
@@ -293,6 +296,8 @@ extern "C" {
 
 typedef Bit32u (*ioReadHandler_t)(void *, Bit32u, unsigned);
 typedef void   (*ioWriteHandler_t)(void *, Bit32u, Bit32u, unsigned);
+typedef Bit32u (*ioReadBlockHandler_t)(void *, Bit32u, unsigned, Bit8u *, Bit32u);
+typedef Bit32u (*ioWriteBlockHandler_t)(void *, Bit32u, unsigned, const Bit8u *, Bit32u);
 
 extern plugin_t *plugins;
 
@@ -342,6 +347,10 @@ BOCHSAPI extern int (*pluginRegisterDefaultIOReadHandler)(void *thisPtr, ioReadH
                                 const char *name, Bit8u mask);
 BOCHSAPI extern int (*pluginRegisterDefaultIOWriteHandler)(void *thisPtr, ioWriteHandler_t callback,
                                  const char *name, Bit8u mask);
+BOCHSAPI extern int (*pluginRegisterIOReadBlockHandler)(void *thisPtr, ioReadBlockHandler_t callback,
+                                unsigned base, const char *name, Bit8u mask);
+BOCHSAPI extern int (*pluginRegisterIOWriteBlockHandler)(void *thisPtr, ioWriteBlockHandler_t callback,
+                                 unsigned base, const char *name, Bit8u mask);
 
 /* === IRQ stuff === */
 BOCHSAPI extern void  (*pluginRegisterIRQ)(unsigned irq, const char *name);
@@ -427,6 +436,7 @@ DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(pci)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(pci2isa)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(pci_ide)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(pcidev)
+DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(fuzzinput)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(usb_uhci)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(usb_ohci)
 DECLARE_PLUGIN_INIT_FINI_FOR_MODULE(usb_ehci)
@@ -454,6 +464,7 @@ DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(nogui)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(rfb)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(sdl)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(sdl2)
+DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(shmfb)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(svga)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(term)
 DECLARE_PLUGIN_INIT_FINI_FOR_GUI_MODULE(vncsrv)
@@ -472,6 +483,7 @@ DECLARE_PLUGIN_INIT_FINI_FOR_SOUND_MODULE(win)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(fbsd)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(linux)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(null)
+DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(pcap)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(slirp)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(socket)
 DECLARE_PLUGIN_INIT_FINI_FOR_NET_MODULE(tap)
@@ -0,0 +1,389 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#include "bochs.h"
+#include "param_names.h"
+#include "iodev/iodev.h"
+#include "replay.h"
+
+#define LOG_THIS bx_replay.
+
+// Log file layout: the magic string and version, followed by the number
+// of cpus, the memory size and the IPS setting the log was recorded with.
+// Each entry is a type byte (bits 5-7 hold the unit for polled input), the
+// ticks since the previous entry and the payload of the entry type. Numbers
+// are stored as variable length integers, 7 bits per byte. A zero type
+// byte marks the end of the log.
+#define BX_REPLAY_MAGIC     "BXREPLAY"
+#define BX_REPLAY_VERSION   1
+#define BX_REPLAY_BUFSIZE   (1024 * 1024)
+
+#define BX_REPLAY_UNIT_SHIFT 5
+
+bx_replay_c bx_replay;
+
+bx_replay_c::bx_replay_c()
+{
+  put("replay", "REPLY");
+
+  mode = BX_REPLAY_OFF;
+  fp = NULL;
+  last_tick = 0;
+  count = 0;
+  host_events = 0;
+  next_type = 0;
+  next_tick = 0;
+  memset(last_value, 0, sizeof(last_value));
+}
+
+bx_replay_c::~bx_replay_c()
+{
+  stop();
+}
+
+void bx_replay_c::init(void)
+{
+  char magic[sizeof(BX_REPLAY_MAGIC)];
+
+  mode = SIM->get_param_enum(BXPN_REPLAY_MODE)->get();
+  if (mode == BX_REPLAY_OFF)
+    return;
+
+#if BX_SUPPORT_SMP_THREADS
+  // the CPUs running in parallel don't see the inputs at a defined icount
+  if ((BX_SMP_PROCESSORS > 1) && SIM->get_param_bool(BXPN_SMP_PARALLEL)->get()) {
+    BX_PANIC(("record/replay of inputs is not supported with parallel SMP simulation"));
+    mode = BX_REPLAY_OFF;
+    return;
+  }
+#endif
+
+  const char *path = SIM->get_param_string(BXPN_REPLAY_FILE)->getptr();
+  fp = fopen(path, (mode == BX_REPLAY_RECORD) ? "wb" : "rb");
+  if (fp == NULL) {
+    BX_PANIC(("could not open replay log '%s'", path));
+    mode = BX_REPLAY_OFF;
+    return;
+  }
+  setvbuf(fp, NULL, _IOFBF, BX_REPLAY_BUFSIZE);
+  last_tick = bx_pc_system.time_ticks();
+  count = 0;
+  memset(last_value, 0, sizeof(last_value));
+
+  Bit64u config[3];
+  config[0] = BX_SMP_PROCESSORS;
+  config[1] = SIM->get_param_num(BXPN_MEM_SIZE)->get64();
+  config[2] = SIM->get_param_num(BXPN_IPS)->get64();
+
+  if (mode == BX_REPLAY_RECORD) {
+    fwrite(BX_REPLAY_MAGIC, 1, strlen(BX_REPLAY_MAGIC), fp);
+    fputc(BX_REPLAY_VERSION, fp);
+    for (int i = 0; i < 3; i++)
+      put_num(config[i]);
+    BX_INFO(("recording nondeterministic inputs to '%s'", path));
+  } else {
+    size_t len = strlen(BX_REPLAY_MAGIC);
+    if ((fread(magic, 1, len, fp) != len) || memcmp(magic, BX_REPLAY_MAGIC, len) ||
+        (fgetc(fp) != BX_REPLAY_VERSION)) {
+      BX_PANIC(("'%s' is not a replay log of this Bochs version", path));
+      stop();
+      return;
+    }
+    for (int i = 0; i < 3; i++) {
+      if (get_num() != config[i]) {
+        BX_PANIC(("replay log was recorded with a different cpu count, memory size or IPS setting"));
+        stop();
+        return;
+      }
+    }
+    BX_INFO(("replaying nondeterministic inputs from '%s'", path));
+    next_entry();
+  }
+}
+
+void bx_replay_c::exit(void)
+{
+  if (mode == BX_REPLAY_RECORD) {
+    fputc(0, fp);
+    BX_INFO(("recorded " FMT_LL "u log entries", count));
+  }
+  stop();
+}
+
+void bx_replay_c::stop(void)
+{
+  if (fp != NULL) {
+    fclose(fp);
+    fp = NULL;
+  }
+  mode = BX_REPLAY_OFF;
+}
+
+// log writer
+
+void bx_replay_c::put_entry(unsigned type)
+{
+  Bit64u tick = bx_pc_system.time_ticks();
+
+  fputc(type, fp);
+  put_num(tick - last_tick);
+  last_tick = tick;
+  count++;
+}
+
+void bx_replay_c::put_num(Bit64u val)
+{
+  while (val >= 0x80) {
+    fputc((int)(val & 0x7f) | 0x80, fp);
+    val >>= 7;
+  }
+  fputc((int) val, fp);
+}
+
+void bx_replay_c::put_snum(Bit64s val)
+{
+  // zigzag encoding keeps small negative numbers short
+  put_num(((Bit64u) val << 1) ^ (Bit64u)(val >> 63));
+}
+
+// log reader
+
+bx_bool bx_replay_c::next_entry(void)
+{
+  int type = fgetc(fp);
+
+  if (type == EOF || type == 0) {
+    if (type == EOF)
+      BX_ERROR(("replay log is truncated"));
+    BX_INFO(("end of replay log reached after " FMT_LL "u entries, continuing with live input", count));
+    stop();
+    return 0;
+  }
+  next_type = (unsigned) type;
+  next_tick = last_tick + get_num();
+  last_tick = next_tick;
+  count++;
+  return 1;
+}
+
+Bit64u bx_replay_c::get_num(void)
+{
+  Bit64u val = 0;
+  unsigned shift = 0;
+  int c;
+
+  do {
+    c = fgetc(fp);
+    if (c == EOF) break;
+    val |= (Bit64u)(c & 0x7f) << shift;
+    shift += 7;
+  } while ((c & 0x80) && (shift < 64));
+
+  return val;
+}
+
+Bit64s bx_replay_c::get_snum(void)
+{
+  Bit64u val = get_num();
+  return (Bit64s)(val >> 1) ^ -(Bit64s)(val & 1);
+}
+
+bx_bool bx_replay_c::expect(unsigned type)
+{
+  if ((next_type == type) && (next_tick == bx_pc_system.time_ticks()))
+    return 1;
+
+  diverged(type);
+  return 0;
+}
+
+void bx_replay_c::diverged(unsigned type)
+{
+  BX_PANIC(("replay diverged at tick " FMT_LL "u: expected entry type %u, log has type %u at tick " FMT_LL "u",
+    bx_pc_system.time_ticks(), type, next_type, next_tick));
+  stop();
+}
+
+// value, interrupt and polled input hooks
+
+Bit64u bx_replay_c::log_value(unsigned type, Bit64u val)
+{
+  // values are stored as difference to the previous one of the same type,
+  // this keeps host clock readings short
+  if (mode == BX_REPLAY_RECORD) {
+    put_entry(type);
+    put_snum((Bit64s)(val - last_value[type]));
+    last_value[type] = val;
+    return val;
+  }
+
+  if (! expect(type))
+    return val;
+  val = last_value[type] + (Bit64u) get_snum();
+  last_value[type] = val;
+  next_entry();
+  return val;
+}
+
+void bx_replay_c::log_interrupt(unsigned cpu, Bit8u vector)
+{
+  if (mode == BX_REPLAY_RECORD) {
+    put_entry(BX_REPLAY_INTR);
+    put_num(cpu);
+    fputc(vector, fp);
+    return;
+  }
+
+  if (! expect(BX_REPLAY_INTR))
+    return;
+  unsigned log_cpu = (unsigned) get_num();
+  int log_vector = fgetc(fp);
+  if ((log_cpu != cpu) || (log_vector != vector)) {
+    BX_PANIC(("replay diverged at tick " FMT_LL "u: interrupt 0x%02x on cpu %u, log has 0x%02x on cpu %u",
+      next_tick, vector, cpu, log_vector, log_cpu));
+    stop();
+    return;
+  }
+  next_entry();
+}
+
+bx_bool bx_replay_c::log_input_byte(unsigned type, unsigned unit, Bit8u *data, bx_bool ready)
+{
+  type |= unit << BX_REPLAY_UNIT_SHIFT;
+
+  if (mode == BX_REPLAY_RECORD) {
+    if (ready) {
+      put_entry(type);
+      fputc(*data, fp);
+    }
+    return ready;
+  }
+
+  // live input is dropped, only logged bytes are delivered
+  if ((next_type != type) || (next_tick != bx_pc_system.time_ticks()))
+    return 0;
+  *data = (Bit8u) fgetc(fp);
+  next_entry();
+  return 1;
+}
+
+// gui input events, only those coming from the host while the gui handles
+// its events are logged. Others are caused by the simulation itself and are
+// the same on replay.
+
+void bx_replay_c::handle_gui_events(void)
+{
+  host_events = 1;
+  bx_gui->handle_events();
+  host_events = 0;
+  if (mode == BX_REPLAY_PLAY)
+    play_gui_events();
+}
+
+bx_bool bx_replay_c::log_gui_event(unsigned type)
+{
+  if ((mode != BX_REPLAY_RECORD) || !host_events)
+    return 0;
+
+  put_entry(type);
+  return 1;
+}
+
+bx_bool bx_replay_c::pass_gui_event(void)
+{
+  return (mode != BX_REPLAY_PLAY) || !host_events;
+}
+
+bx_bool bx_replay_c::key_event(Bit32u key)
+{
+  if (log_gui_event(BX_REPLAY_KEY))
+    put_num(key);
+  return pass_gui_event();
+}
+
+bx_bool bx_replay_c::mouse_event(int delta_x, int delta_y, int delta_z, unsigned button_state, bx_bool absxy)
+{
+  if (log_gui_event(BX_REPLAY_MOUSE)) {
+    put_snum(delta_x);
+    put_snum(delta_y);
+    put_snum(delta_z);
+    put_num(button_state);
+    fputc(absxy, fp);
+  }
+  return pass_gui_event();
+}
+
+bx_bool bx_replay_c::mouse_enable_event(bx_bool enabled)
+{
+  if (log_gui_event(BX_REPLAY_MOUSE_ENABLE))
+    fputc(enabled, fp);
+  return pass_gui_event();
+}
+
+bx_bool bx_replay_c::paste_event(Bit8u *data, Bit32s length)
+{
+  if (log_gui_event(BX_REPLAY_PASTE)) {
+    put_num(length);
+    fwrite(data, 1, length, fp);
+  }
+  return pass_gui_event();
+}
+
+void bx_replay_c::play_gui_events(void)
+{
+  Bit64u tick = bx_pc_system.time_ticks();
+
+  // the entry payload is read before the event is delivered, the device
+  // may take more logged values while handling it
+  while ((mode == BX_REPLAY_PLAY) && (next_tick == tick)) {
+    if (next_type == BX_REPLAY_KEY) {
+      Bit32u key = (Bit32u) get_num();
+      next_entry();
+      bx_devices.gen_scancode(key);
+    } else if (next_type == BX_REPLAY_MOUSE) {
+      int delta_x = (int) get_snum();
+      int delta_y = (int) get_snum();
+      int delta_z = (int) get_snum();
+      unsigned button_state = (unsigned) get_num();
+      bx_bool absxy = (fgetc(fp) == 1);
+      next_entry();
+      bx_devices.mouse_motion(delta_x, delta_y, delta_z, button_state, absxy);
+    } else if (next_type == BX_REPLAY_MOUSE_ENABLE) {
+      bx_bool enabled = (fgetc(fp) == 1);
+      next_entry();
+      bx_devices.mouse_enabled_changed(enabled);
+    } else if (next_type == BX_REPLAY_PASTE) {
+      Bit32s length = (Bit32s) get_num();
+      // the keyboard takes ownership of the buffer
+      Bit8u *data = new Bit8u[length];
+      if (fread(data, 1, length, fp) != (size_t) length) {
+        BX_ERROR(("replay log is truncated"));
+        delete [] data;
+        stop();
+        break;
+      }
+      next_entry();
+      DEV_kbd_paste_bytes(data, length);
+    } else {
+      break;
+    }
+  }
+}
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_REPLAY_H
+#define BX_REPLAY_H
+
+// Record and replay of nondeterministic inputs
+//
+// In record mode every value the simulation takes from the host (random
+// numbers, host clock readings, keyboard / mouse / serial input) is
+// written to a binary log together with the system tick count. In replay
+// mode the same values are taken from the log instead and live host input
+// is dropped, so that the guest runs bit-exact again. Delivered hardware
+// interrupts are logged as well and compared on replay to detect a
+// diverging run early.
+
+enum {
+  BX_REPLAY_OFF,
+  BX_REPLAY_RECORD,
+  BX_REPLAY_PLAY
+};
+
+// log entry types
+enum {
+  BX_REPLAY_RDRAND = 1,
+  BX_REPLAY_RDSEED,
+  BX_REPLAY_REALTIME,      // host clock in usec
+  BX_REPLAY_HOSTTIME,      // host clock in seconds
+  BX_REPLAY_INTR,
+  BX_REPLAY_KEY,
+  BX_REPLAY_MOUSE,
+  BX_REPLAY_MOUSE_ENABLE,
+  BX_REPLAY_PASTE,
+  BX_REPLAY_SERIAL,
+  BX_REPLAY_N_TYPES
+};
+
+class BOCHSAPI bx_replay_c : public logfunctions {
+public:
+  bx_replay_c();
+  virtual ~bx_replay_c();
+
+  void init(void);
+  void exit(void);
+
+  BX_CPP_INLINE unsigned get_mode(void) const { return mode; }
+  BX_CPP_INLINE bx_bool playing(void) const { return mode == BX_REPLAY_PLAY; }
+
+  // returns the value read from the host, or the logged one on replay
+  BX_CPP_INLINE Bit64u value(unsigned type, Bit64u val) {
+    return (mode == BX_REPLAY_OFF) ? val : log_value(type, val);
+  }
+  // called for every hardware interrupt delivered to a cpu
+  BX_CPP_INLINE void interrupt(unsigned cpu, Bit8u vector) {
+    if (mode != BX_REPLAY_OFF) log_interrupt(cpu, vector);
+  }
+  // polled host input: returns if a byte is available and sets 'data'
+  BX_CPP_INLINE bx_bool input_byte(unsigned type, unsigned unit, Bit8u *data, bx_bool ready) {
+    return (mode == BX_REPLAY_OFF) ? ready : log_input_byte(type, unit, data, ready);
+  }
+
+  // gui input events, these return 0 if the live event has to be dropped
+  bx_bool key_event(Bit32u key);
+  bx_bool mouse_event(int delta_x, int delta_y, int delta_z, unsigned button_state, bx_bool absxy);
+  bx_bool mouse_enable_event(bx_bool enabled);
+  bx_bool paste_event(Bit8u *data, Bit32s length);
+  // runs the gui event handler, on replay the logged events are delivered
+  void handle_gui_events(void);
+
+private:
+  Bit64u log_value(unsigned type, Bit64u val);
+  void log_interrupt(unsigned cpu, Bit8u vector);
+  bx_bool log_input_byte(unsigned type, unsigned unit, Bit8u *data, bx_bool ready);
+  bx_bool log_gui_event(unsigned type);
+  bx_bool pass_gui_event(void);
+  void play_gui_events(void);
+
+  void put_entry(unsigned type);
+  void put_num(Bit64u val);
+  void put_snum(Bit64s val);
+  bx_bool next_entry(void);
+  bx_bool expect(unsigned type);
+  Bit64u get_num(void);
+  Bit64s get_snum(void);
+  void diverged(unsigned type);
+  void stop(void);
+
+  unsigned mode;
+  FILE *fp;
+  Bit64u last_tick;
+  Bit64u count;
+  Bit64u last_value[BX_REPLAY_N_TYPES];
+  bx_bool host_events;   // inside the gui event handler
+  // next entry of the log on replay
+  unsigned next_type;
+  Bit64u next_tick;
+};
+
+BOCHSAPI extern bx_replay_c bx_replay;
+
+#endif
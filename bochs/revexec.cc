@@ -0,0 +1,555 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#include "bochs.h"
+#include "cpu/cpu.h"
+#include "revexec.h"
+#include "replay.h"
+
+#if BX_DEBUGGER || BX_GDBSTUB
+
+#define LOG_THIS bx_revexec.
+
+// data parameters of this size or more are tracked page by page
+#define BX_REVEXEC_MIN_REGION (16 * BX_REVEXEC_PAGE_SIZE)
+
+extern void bx_sr_after_restore_state(void);
+
+bx_revexec_c bx_revexec;
+
+bx_revexec_c::bx_revexec_c()
+{
+  put("revexec", "REVEX");
+
+  interval = 0;
+  next_checkpoint = BX_MAX_BIT64U;
+  replay_target = BX_MAX_BIT64U;
+  stop_icount = BX_MAX_BIT64U;
+  num_checkpoints = 0;
+  memset(regions, 0, sizeof(regions));
+  num_regions = 0;
+  total_pages = 0;
+  ram_pages = 0;
+  ram_written = NULL;
+  memset(&ram_undo, 0, sizeof(ram_undo));
+  memset(mapping_params, 0, sizeof(mapping_params));
+  state_buf = NULL;
+  state_len = state_max = state_pos = 0;
+}
+
+bx_revexec_c::~bx_revexec_c()
+{
+  disable();
+}
+
+bx_bool bx_revexec_c::enable(Bit64u new_interval)
+{
+  if (new_interval == 0) {
+    disable();
+    return 1;
+  }
+  if (BX_SMP_PROCESSORS > 1) {
+    BX_ERROR(("reverse execution supports a single CPU only"));
+    return 0;
+  }
+  if (bx_replay.get_mode() != BX_REPLAY_OFF) {
+    BX_ERROR(("reverse execution cannot be used while recording or replaying inputs"));
+    return 0;
+  }
+  Bit64u ram_size;
+  Bit8u *host_ram = BX_MEM(0)->dbg_get_host_ram(&ram_size);
+  if (host_ram == NULL) {
+    BX_ERROR(("reverse execution needs all RAM in host memory"));
+    return 0;
+  }
+  if (enabled()) {
+    // keep the history, the new interval applies from the latest checkpoint
+    interval = new_interval;
+    next_checkpoint = checkpoints[num_checkpoints - 1].icount + interval;
+    update_stop_icount();
+    return 1;
+  }
+
+  // The block mapping only changes when a block is used the first time. It
+  // stays as it is, restoring it would also reload the overflow file.
+  bx_list_c *root = SIM->get_bochs_root();
+  mapping_params[0] = SIM->get_param("memory.used_blocks", root);
+  mapping_params[1] = SIM->get_param("memory.mapping", root);
+
+  add_region(host_ram, ram_size, SIM->get_param("memory.ram", root), 1);
+  find_regions(root);
+  ram_written = new Bit32u[(ram_pages + 31) / 32];
+  memset(ram_written, 0, ((ram_pages + 31) / 32) * sizeof(Bit32u));
+  // drop the host pointers for writes handed out so far
+  BX_CPU(0)->TLB_flush();
+  interval = new_interval;
+  take_checkpoint();
+  BX_INFO(("reverse execution enabled, checkpoint every " FMT_LL "u instructions", interval));
+  return 1;
+}
+
+void bx_revexec_c::disable(void)
+{
+  while (num_checkpoints > 0)
+    free_checkpoint(&checkpoints[--num_checkpoints]);
+  free_checkpoint(&ram_undo);
+  free_regions();
+  free(state_buf);
+  state_buf = NULL;
+  state_max = 0;
+  interval = 0;
+  next_checkpoint = BX_MAX_BIT64U;
+  replay_target = BX_MAX_BIT64U;
+  update_stop_icount();
+}
+
+void bx_revexec_c::update_stop_icount(void)
+{
+  stop_icount = (next_checkpoint < replay_target) ? next_checkpoint : replay_target;
+}
+
+// Called by the cpu loop once the instruction count reached stop_icount.
+// Returns 1 if the cpu loop has to return to the caller.
+bx_bool bx_revexec_c::stop_reached(void)
+{
+  Bit64u icount = BX_CPU(0)->get_icount();
+
+  if (icount >= next_checkpoint)
+    take_checkpoint();
+
+  return (icount >= replay_target);
+}
+
+void bx_revexec_c::put_data(const void *data, Bit32u len)
+{
+  if (state_len + len > state_max) {
+    while (state_len + len > state_max)
+      state_max = state_max ? state_max * 2 : 0x10000;
+    state_buf = (Bit8u*) realloc(state_buf, state_max);
+    if (state_buf == NULL)
+      BX_PANIC(("out of memory for the checkpoint state"));
+  }
+  memcpy(state_buf + state_len, data, len);
+  state_len += len;
+}
+
+void bx_revexec_c::get_data(void *data, Bit32u len)
+{
+  if (state_pos + len > state_len)
+    BX_PANIC(("checkpoint state does not match the parameter tree"));
+  memcpy(data, state_buf + state_pos, len);
+  state_pos += len;
+}
+
+// A tracked region is saved page by page before it is written, the others
+// are compared with a reference copy at every checkpoint
+void bx_revexec_c::add_region(Bit8u *data, Bit64u size, bx_param_c *param, bx_bool tracked)
+{
+  if (num_regions == BX_REVEXEC_MAX_REGIONS) {
+    // saved with the parameter tree instead
+    BX_DEBUG(("too many regions, %s is saved as a whole", param->get_name()));
+    return;
+  }
+  bx_revexec_region_t *region = &regions[num_regions++];
+  region->data = data;
+  region->num_pages = (Bit32u)(size / BX_REVEXEC_PAGE_SIZE);
+  region->first_page = total_pages;
+  region->param = param;
+  if (tracked) {
+    ram_pages = region->num_pages;
+  }
+  else {
+    region->ref = new Bit8u[(size_t) size];
+    memcpy(region->ref, data, (size_t) size);
+  }
+  total_pages += region->num_pages;
+}
+
+void bx_revexec_c::find_regions(bx_param_c *node)
+{
+  if (skip_param(node))
+    return;
+
+  if (node->get_type() == BXT_PARAM_DATA) {
+    bx_shadow_data_c *data = (bx_shadow_data_c*)node;
+    if ((data->get_size() >= BX_REVEXEC_MIN_REGION) &&
+        ((data->get_size() % BX_REVEXEC_PAGE_SIZE) == 0))
+      add_region(data->getptr(), data->get_size(), node, 0);
+  }
+  else if (node->get_type() == BXT_LIST) {
+    bx_list_c *list = (bx_list_c*)node;
+    for (int i = 0; i < list->get_size(); i++)
+      find_regions(list->get(i));
+  }
+}
+
+void bx_revexec_c::free_regions(void)
+{
+  ram_pages = 0;
+  delete [] ram_written;
+  ram_written = NULL;
+  for (int i = 0; i < num_regions; i++)
+    delete [] regions[i].ref;
+  memset(regions, 0, sizeof(regions));
+  num_regions = 0;
+  total_pages = 0;
+}
+
+Bit8u *bx_revexec_c::get_page(Bit32u page, Bit8u **ref)
+{
+  int i = 0;
+  while (page >= regions[i].first_page + regions[i].num_pages)
+    i++;
+  Bit64u offset = (Bit64u)(page - regions[i].first_page) * BX_REVEXEC_PAGE_SIZE;
+  *ref = (regions[i].ref != NULL) ? regions[i].ref + offset : NULL;
+  return regions[i].data + offset;
+}
+
+bx_bool bx_revexec_c::skip_param(bx_param_c *node)
+{
+  if (node == mapping_params[0] || node == mapping_params[1])
+    return 1;
+  for (int i = 0; i < num_regions; i++) {
+    if (node == regions[i].param)
+      return 1;
+  }
+  return 0;
+}
+
+void bx_revexec_c::save_param(bx_param_c *node)
+{
+  if (skip_param(node))
+    return;
+
+  switch (node->get_type()) {
+    case BXT_PARAM_NUM:
+    case BXT_PARAM_BOOL:
+    case BXT_PARAM_ENUM:
+      {
+        Bit64s val = ((bx_param_num_c*)node)->get64();
+        put_data(&val, sizeof(val));
+      }
+      break;
+    case BXT_PARAM_STRING:
+    case BXT_PARAM_BYTESTRING:
+      put_data(((bx_param_string_c*)node)->getptr(), ((bx_param_string_c*)node)->get_maxsize());
+      break;
+    case BXT_PARAM_DATA:
+      put_data(((bx_shadow_data_c*)node)->getptr(), ((bx_shadow_data_c*)node)->get_size());
+      break;
+    case BXT_LIST:
+      {
+        bx_list_c *list = (bx_list_c*)node;
+        for (int i = 0; i < list->get_size(); i++)
+          save_param(list->get(i));
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void bx_revexec_c::restore_param(bx_param_c *node)
+{
+  if (skip_param(node))
+    return;
+
+  switch (node->get_type()) {
+    case BXT_PARAM_NUM:
+    case BXT_PARAM_BOOL:
+    case BXT_PARAM_ENUM:
+      {
+        Bit64s val;
+        get_data(&val, sizeof(val));
+        ((bx_param_num_c*)node)->set(val);
+      }
+      break;
+    case BXT_PARAM_STRING:
+    case BXT_PARAM_BYTESTRING:
+      {
+        bx_param_string_c *sparam = (bx_param_string_c*)node;
+        char *buf = new char[sparam->get_maxsize()];
+        get_data(buf, sparam->get_maxsize());
+        sparam->set(buf);
+        delete [] buf;
+      }
+      break;
+    case BXT_PARAM_DATA:
+      get_data(((bx_shadow_data_c*)node)->getptr(), ((bx_shadow_data_c*)node)->get_size());
+      break;
+    case BXT_LIST:
+      {
+        bx_list_c *list = (bx_list_c*)node;
+        for (int i = 0; i < list->get_size(); i++)
+          restore_param(list->get(i));
+        list->restore();
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void bx_revexec_c::add_undo_page(bx_revexec_checkpoint_t *cp, Bit32u page, const Bit8u *data)
+{
+  if (cp->num_pages == cp->max_pages) {
+    cp->max_pages = cp->max_pages ? cp->max_pages * 2 : 64;
+    cp->pages = (Bit32u*) realloc(cp->pages, cp->max_pages * sizeof(Bit32u));
+    cp->undo = (Bit8u*) realloc(cp->undo, (size_t) cp->max_pages * BX_REVEXEC_PAGE_SIZE);
+    if ((cp->pages == NULL) || (cp->undo == NULL))
+      BX_PANIC(("out of memory for the changed pages"));
+  }
+  cp->pages[cp->num_pages] = page;
+  memcpy(cp->undo + (size_t) cp->num_pages * BX_REVEXEC_PAGE_SIZE, data, BX_REVEXEC_PAGE_SIZE);
+  cp->num_pages++;
+}
+
+// First write to the RAM page since the latest checkpoint
+void bx_revexec_c::save_ram_page(Bit32u page)
+{
+  ram_written[page >> 5] |= (1u << (page & 31));
+  add_undo_page(&ram_undo, page, regions[0].data + (size_t) page * BX_REVEXEC_PAGE_SIZE);
+}
+
+void bx_revexec_c::take_checkpoint(void)
+{
+  if (num_checkpoints == BX_REVEXEC_MAX_CHECKPOINTS)
+    drop_oldest();
+
+  // the RAM pages saved since the latest checkpoint start the undo list
+  bx_revexec_checkpoint_t *cp = &checkpoints[num_checkpoints];
+  *cp = ram_undo;
+  cp->icount = BX_CPU(0)->get_icount();
+  for (Bit32u n = 0; n < cp->num_pages; n++)
+    ram_written[cp->pages[n] >> 5] &= ~(1u << (cp->pages[n] & 31));
+  memset(&ram_undo, 0, sizeof(ram_undo));
+
+  // the other regions are written by the devices directly
+  for (Bit32u page = ram_pages; page < total_pages; page++) {
+    Bit8u *ref, *data = get_page(page, &ref);
+    if (memcmp(data, ref, BX_REVEXEC_PAGE_SIZE) == 0)
+      continue;
+    add_undo_page(cp, page, ref);
+    memcpy(ref, data, BX_REVEXEC_PAGE_SIZE);
+  }
+
+  state_len = 0;
+  save_param(SIM->get_bochs_root());
+  cp->state = new Bit8u[state_len];
+  memcpy(cp->state, state_buf, state_len);
+  cp->state_len = state_len;
+  num_checkpoints++;
+
+  BX_DEBUG(("checkpoint at icount " FMT_LL "u: %u changed pages, %u bytes state",
+    cp->icount, cp->num_pages, cp->state_len));
+
+  next_checkpoint = cp->icount + interval;
+  update_stop_icount();
+}
+
+void bx_revexec_c::free_checkpoint(bx_revexec_checkpoint_t *cp)
+{
+  delete [] cp->state;
+  free(cp->pages);
+  free(cp->undo);
+  memset(cp, 0, sizeof(bx_revexec_checkpoint_t));
+}
+
+void bx_revexec_c::drop_oldest(void)
+{
+  free_checkpoint(&checkpoints[0]);
+  num_checkpoints--;
+  memmove(&checkpoints[0], &checkpoints[1], num_checkpoints * sizeof(bx_revexec_checkpoint_t));
+  // the undo pages of the new oldest checkpoint lead to the dropped one
+  free(checkpoints[0].pages);
+  free(checkpoints[0].undo);
+  checkpoints[0].pages = NULL;
+  checkpoints[0].undo = NULL;
+  checkpoints[0].num_pages = 0;
+  checkpoints[0].max_pages = 0;
+}
+
+// Returns the latest checkpoint before the instruction count
+int bx_revexec_c::find_checkpoint(Bit64u icount)
+{
+  int n = num_checkpoints - 1;
+  while ((n >= 0) && (checkpoints[n].icount >= icount))
+    n--;
+  return n;
+}
+
+// Restores the checkpoint, all later checkpoints are dropped
+void bx_revexec_c::restore_checkpoint(int index)
+{
+  Bit8u *ref, *data;
+  Bit32u page, n;
+
+  // like for a restore at startup, the devices restore their state from
+  // the reset state, e.g. to register their IRQs again
+  bx_pc_system.Reset(BX_RESET_HARDWARE);
+
+  // go back to the page contents of the latest checkpoint ...
+  for (n = 0; n < ram_undo.num_pages; n++) {
+    page = ram_undo.pages[n];
+    memcpy(regions[0].data + (size_t) page * BX_REVEXEC_PAGE_SIZE,
+           ram_undo.undo + (size_t) n * BX_REVEXEC_PAGE_SIZE, BX_REVEXEC_PAGE_SIZE);
+    ram_written[page >> 5] &= ~(1u << (page & 31));
+  }
+  ram_undo.num_pages = 0;
+  for (page = ram_pages; page < total_pages; page++) {
+    data = get_page(page, &ref);
+    if (memcmp(data, ref, BX_REVEXEC_PAGE_SIZE))
+      memcpy(data, ref, BX_REVEXEC_PAGE_SIZE);
+  }
+  // ... and undo the changes of the later checkpoints
+  while (num_checkpoints > index + 1) {
+    bx_revexec_checkpoint_t *cp = &checkpoints[--num_checkpoints];
+    for (n = 0; n < cp->num_pages; n++) {
+      data = get_page(cp->pages[n], &ref);
+      memcpy(data, cp->undo + (size_t) n * BX_REVEXEC_PAGE_SIZE, BX_REVEXEC_PAGE_SIZE);
+      if (ref != NULL)
+        memcpy(ref, data, BX_REVEXEC_PAGE_SIZE);
+    }
+    free_checkpoint(cp);
+  }
+
+  bx_revexec_checkpoint_t *cp = &checkpoints[index];
+  Bit8u *saved_buf = state_buf;
+  Bit32u saved_len = state_len;
+  state_buf = cp->state;
+  state_len = cp->state_len;
+  state_pos = 0;
+  restore_param(SIM->get_bochs_root());
+  state_buf = saved_buf;
+  state_len = saved_len;
+
+  bx_sr_after_restore_state();
+  // the RAM was changed behind the back of the trace cache
+  flushICaches();
+
+  next_checkpoint = cp->icount + interval;
+  update_stop_icount();
+}
+
+// Runs the CPU until the instruction count is reached, breakpoints on the
+// way are skipped. If last_stop is given, the instruction count of the last
+// breakpoint hit before the target is returned there. Returns 0 if the
+// replay was interrupted.
+bx_bool bx_revexec_c::replay_to(Bit64u icount, bx_revexec_stop_check_t stop_check, Bit64u *last_stop)
+{
+  replay_target = icount;
+  update_stop_icount();
+  while (BX_CPU(0)->get_icount() < icount) {
+    BX_CPU(0)->cpu_loop();
+    if (bx_pc_system.kill_bochs_request)
+      break;
+#if BX_DEBUGGER
+    if (bx_guard.interrupt_requested)
+      break;
+#endif
+    if (BX_CPU(0)->get_icount() < icount) {
+      if ((*stop_check)() && (last_stop != NULL))
+        *last_stop = BX_CPU(0)->get_icount();
+    }
+  }
+  replay_target = BX_MAX_BIT64U;
+  update_stop_icount();
+  return (BX_CPU(0)->get_icount() >= icount);
+}
+
+bx_bool bx_revexec_c::step_back(Bit64u count, bx_revexec_stop_check_t stop_check)
+{
+  Bit64u icount = BX_CPU(0)->get_icount();
+
+  if (!enabled()) {
+    BX_ERROR(("reverse execution is not enabled"));
+    return 0;
+  }
+  if (count > icount) count = icount;
+  Bit64u target = icount - count;
+  int n = find_checkpoint(target + 1);
+  if (n < 0) {
+    BX_ERROR(("no checkpoint before icount " FMT_LL "u", target));
+    return 0;
+  }
+  restore_checkpoint(n);
+  return replay_to(target, stop_check);
+}
+
+// Goes back to the last position before the current one where the cpu
+// loop stopped at a breakpoint. Returns 1 if one was found, 0 if the CPU
+// stopped at the oldest checkpoint instead and -1 on error.
+int bx_revexec_c::continue_back(bx_revexec_stop_check_t stop_check)
+{
+  Bit64u limit = BX_CPU(0)->get_icount() - 1;
+
+  if (!enabled()) {
+    BX_ERROR(("reverse execution is not enabled"));
+    return -1;
+  }
+  int n = find_checkpoint(limit + 1);
+  if (n < 0) {
+    BX_ERROR(("no checkpoint before icount " FMT_LL "u", limit + 1));
+    return -1;
+  }
+
+  // Replay each interval and remember the last breakpoint hit in it. A stop
+  // right at the start of an interval is found in the interval before, so
+  // the replay runs one instruction beyond the next checkpoint.
+  for (; n >= 0; n--) {
+    Bit64u start = checkpoints[n].icount;
+    Bit64u last_stop = BX_MAX_BIT64U;
+    restore_checkpoint(n);
+    if (! replay_to(limit + 1, stop_check, &last_stop))
+      return -1;
+    if (last_stop != BX_MAX_BIT64U) {
+      restore_checkpoint(n);
+      return replay_to(last_stop, stop_check) ? 1 : -1;
+    }
+    limit = start;
+  }
+
+  restore_checkpoint(0);
+  return 0;
+}
+
+#if BX_DEBUGGER
+void bx_revexec_c::print_info(void)
+{
+  Bit64u undo_bytes = 0, state_bytes = 0;
+
+  if (!enabled()) {
+    dbg_printf("reverse execution is disabled\n");
+    return;
+  }
+  undo_bytes = (Bit64u) ram_undo.num_pages * BX_REVEXEC_PAGE_SIZE;
+  for (int n = 0; n < num_checkpoints; n++) {
+    undo_bytes += (Bit64u) checkpoints[n].num_pages * BX_REVEXEC_PAGE_SIZE;
+    state_bytes += checkpoints[n].state_len;
+  }
+  dbg_printf("reverse execution: checkpoint every " FMT_LL "u instructions\n", interval);
+  dbg_printf("%d checkpoints from icount " FMT_LL "u to " FMT_LL "u, " FMT_LL "u KB state, " FMT_LL "u KB pages\n",
+    num_checkpoints, checkpoints[0].icount, checkpoints[num_checkpoints - 1].icount,
+    state_bytes >> 10, undo_bytes >> 10);
+}
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2026  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_REVEXEC_H
+#define BX_REVEXEC_H
+
+// Reverse execution for the internal debugger and the gdb stub
+//
+// While enabled, a checkpoint is taken every 'interval' instructions. It
+// holds the save/restore parameter tree (CPU and device state) and the
+// pages that changed since the previous checkpoint, with their previous
+// contents. Pages are tracked for the RAM and for large data parameters
+// like the video memory, these are left out of the saved tree. A RAM page
+// is saved by the memory write paths before its first change after a
+// checkpoint, the CPU does not get host pointers for writes meanwhile.
+// Going back restores the nearest checkpoint and re-executes forward to
+// the requested instruction count. Only a single CPU is supported.
+
+#if BX_DEBUGGER || BX_GDBSTUB
+
+#define BX_REVEXEC_PAGE_SIZE        4096
+#define BX_REVEXEC_DEFAULT_INTERVAL 1000000
+#define BX_REVEXEC_MAX_CHECKPOINTS  64
+#define BX_REVEXEC_MAX_REGIONS      8
+
+typedef struct {
+  Bit64u icount;
+  Bit8u *state;        // serialized parameter tree without the RAM
+  Bit32u state_len;
+  Bit32u num_pages;    // pages changed since the previous checkpoint
+  Bit32u max_pages;
+  Bit32u *pages;
+  Bit8u *undo;         // their contents at the previous checkpoint
+} bx_revexec_checkpoint_t;
+
+typedef struct {
+  Bit8u *data;
+  Bit8u *ref;          // contents at the latest checkpoint, NULL for the RAM
+  Bit32u first_page;
+  Bit32u num_pages;
+  bx_param_c *param;   // data parameter left out of the saved tree
+} bx_revexec_region_t;
+
+// Called when the cpu loop returned before the replay target. Returns 1 if
+// it stopped at a breakpoint of the frontend and clears the stop condition.
+typedef bx_bool (*bx_revexec_stop_check_t)(void);
+
+class BOCHSAPI bx_revexec_c : public logfunctions {
+public:
+  bx_revexec_c();
+  virtual ~bx_revexec_c();
+
+  bx_bool enable(Bit64u interval);
+  void disable(void);
+  bx_bool enabled(void) const { return interval != 0; }
+  Bit64u get_interval(void) const { return interval; }
+
+  // checked by the cpu loop after every instruction
+  BX_CPP_INLINE Bit64u get_stop_icount(void) const { return stop_icount; }
+  bx_bool stop_reached(void);
+
+  // called by the memory object before the RAM page at addr is written
+  BX_CPP_INLINE void ram_write(bx_phy_address addr) {
+    Bit64u page = addr / BX_REVEXEC_PAGE_SIZE;
+    if ((page < ram_pages) && !(ram_written[page >> 5] & (1u << (page & 31))))
+      save_ram_page((Bit32u) page);
+  }
+
+  bx_bool step_back(Bit64u count, bx_revexec_stop_check_t stop_check);
+  int continue_back(bx_revexec_stop_check_t stop_check);
+#if BX_DEBUGGER
+  void print_info(void);
+#endif
+
+private:
+  void save_ram_page(Bit32u page);
+  void add_undo_page(bx_revexec_checkpoint_t *cp, Bit32u page, const Bit8u *data);
+  void take_checkpoint(void);
+  void restore_checkpoint(int index);
+  bx_bool replay_to(Bit64u icount, bx_revexec_stop_check_t stop_check, Bit64u *last_stop = NULL);
+  void drop_oldest(void);
+  void free_checkpoint(bx_revexec_checkpoint_t *cp);
+  int find_checkpoint(Bit64u icount);
+  void update_stop_icount(void);
+
+  void add_region(Bit8u *data, Bit64u size, bx_param_c *param, bx_bool tracked);
+  void find_regions(bx_param_c *node);
+  void free_regions(void);
+  Bit8u *get_page(Bit32u page, Bit8u **ref);
+
+  bx_bool skip_param(bx_param_c *node);
+  void save_param(bx_param_c *node);
+  void restore_param(bx_param_c *node);
+  void put_data(const void *data, Bit32u len);
+  void get_data(void *data, Bit32u len);
+
+  Bit64u interval;
+  Bit64u next_checkpoint;
+  Bit64u replay_target;
+  Bit64u stop_icount;
+
+  bx_revexec_checkpoint_t checkpoints[BX_REVEXEC_MAX_CHECKPOINTS];
+  int num_checkpoints;
+
+  bx_revexec_region_t regions[BX_REVEXEC_MAX_REGIONS];
+  int num_regions;
+  Bit32u total_pages;
+  Bit32u ram_pages;      // the RAM is region 0
+  Bit32u *ram_written;   // RAM pages written since the latest checkpoint
+  bx_revexec_checkpoint_t ram_undo;  // their contents at the latest checkpoint
+  bx_param_c *mapping_params[2];  // RAM block mapping, not restored
+
+  Bit8u *state_buf;   // serialization buffer
+  Bit32u state_len, state_max, state_pos;
+};
+
+BOCHSAPI extern bx_revexec_c bx_revexec;
+
+#endif
+
+#endif